@@ -27,7 +27,17 @@
 /****************************************************************************************
 *                              BOOLEAN TYPE DEFINITIONS                                *
 ****************************************************************************************/
+/* uint8 like the top level Std_Types.h: both share the include guard, so whichever a
+ * file sees first must give every struct holding a boolean the same layout */
+#ifndef FALSE
+#define FALSE 0u
+#endif
 
+#ifndef TRUE
+#define TRUE 1u
+#endif
+
+typedef unsigned char       boolean;    /* 8-bit boolean, TRUE or FALSE */
 
 /****************************************************************************************
 *                              INTEGER TYPE DEFINITIONS                                *
@@ -36,12 +46,16 @@ typedef signed char         sint8;      /* 8-bit signed integer     */
 typedef unsigned char       uint8;      /* 8-bit unsigned integer   */
 typedef signed short        sint16;     /* 16-bit signed integer    */
 typedef unsigned short      uint16;     /* 16-bit unsigned integer  */
+#if defined(HOST_BUILD)
+typedef signed int          sint32;     /* long is 64-bit on LP64 hosts */
+typedef unsigned int        uint32;
+#else
 typedef signed long         sint32;     /* 32-bit signed integer    */
 typedef unsigned long       uint32;     /* 32-bit unsigned integer  */
+#endif
 typedef signed long long    sint64;     /* 64-bit signed integer    */
 typedef unsigned long long  uint64;     /* 64-bit unsigned integer  */
 
-typedef enum {FALSE, TRUE}  boolean;
 /****************************************************************************************
 *                              POINTER  DEFINITIONS                                     *
 ****************************************************************************************/
@@ -93,6 +107,18 @@ typedef struct Std_VersionInfoType
 /****************************************************************************************
 *                              COMMON MACROS                                           *
 ****************************************************************************************/
-
+/* Interrupt path code in SRAM, see RAMFUNC in the top level Std_Types.h */
+#if defined(HOST_BUILD)
+#define RAMFUNC
+#else
+#define RAMFUNC             __attribute__((section(".ramfunc"), noinline, long_call))
+#endif
+
+/* Buffers left out of the .bss clear, see NOINIT in the top level Std_Types.h */
+#if defined(HOST_BUILD)
+#define NOINIT
+#else
+#define NOINIT              __attribute__((section(".noinit")))
+#endif
 
 #endif /* STD_TYPES_H */
\ No newline at end of file
@@ -37,16 +37,24 @@
 *                              FEATURE CONFIGURATION                                   *
 ****************************************************************************************/
 
+/* Both can be set from the command line, make test builds a queuing variant and a
+ * scheduler variant with priority on as well */
+#ifndef ADC_ENABLE_QUEUING
 #define ADC_ENABLE_QUEUING          STD_OFF  /*!< Enable group queuing support */ 
+#endif
+#ifndef ADC_ENABLE_PRIORITY
 #define ADC_ENABLE_PRIORITY         STD_OFF /*!< Enable priority-based interruption */ 
+#endif
+#define ADC_PRIORITY_IMPLEMENTATION ADC_PRIORITY_HW_SW /*!< Priority mode used when ADC_ENABLE_PRIORITY is STD_ON */
 #define ADC_ENABLE_DMA              STD_ON  /*!< Enable DMA support */ 
 
 
 #define ADC_ENABLE_STREAMING        STD_ON  /*!< Enable streaming mode */ 
 #define ADC_ENABLE_NOTIFICATIONS    STD_ON  /*!< Enable notification callbacks */ 
 
+#define ADC_ENABLE_LIMIT_CHECKING   STD_ON  /*!< Analog watchdog limit checking, Adc_SetGroupLimits */ 
+
 /*Not used */
-#define ADC_ENABLE_LIMIT_CHECKING   STD_OFF /*!< Enable limit checking */ 
 #define ADC_ENABLE_POWER_MANAGEMENT STD_OFF /*!< Enable power management */ 
 
 
@@ -54,13 +62,13 @@
 *                              SYSTEM CONFIGURATION                                    *
 ****************************************************************************************/
 /* System Limits */
-#define ADC_MAX_GROUPS              1      /*!< Maximum number of ADC groups */
+#define ADC_MAX_GROUPS              7      /*!< Maximum number of ADC groups */
 #define ADC_MAX_CHANNELS            1      /*!< Maximum number of ADC channels */ 
 #define ADC_MAX_HW_UNITS            1       /*!< Maximum number of ADC hardware units */
 
 #define ADC_HW_CONFIG_SIZE           1
 #define ADC_CHANNELS_CONFIG_SIZE     1
-#define ADC_GROUP_CONFIG_SIZE        1
+#define ADC_GROUP_CONFIG_SIZE        7
 /****************************************************************************************
 *                              CONFIGURATION PARAMETERS                                *
 ****************************************************************************************/
@@ -69,12 +77,14 @@
 /* Buffer Configuration */
 #define ADC_MAX_BUFFER_SIZE         256                         /*!< Maximum result buffer size per group */
 #define ADC_DEFAULT_MAX_GROUP       5                           /*!< Default maximum number of groups */
-#define ADC_DEFAULT_QUEUE_SIZE      ADC_DEFAULT_MAX_GROUP       /*!< Default queue size per hardware unit */ 
+
+/* Priority Configuration */
+#define ADC_PRIORITY_LEVELS         8                           /*!< Group priority levels, 0 is lowest, higher values are clamped */
 
 /* Real-time Safety Configuration */
 /* UNUSED - Max ISR processing time not used in source code */
 // #define ADC_MAX_ISR_PROCESSING_TIME_US  50  /*!< Maximum ISR processing time in microseconds */ 
-#define ADC_ENABLE_ISR_MONITORING   STD_OFF  /*!< Enable ISR execution time monitoring */
+/* ISR execution time is recorded by the Prof module, see Prof_Cfg.h */
 
 
 /* UNUSED - Runtime checks not used in source code */
@@ -90,7 +100,6 @@
 #define ADC1_DMA_ENABLED            STD_ON
 #define ADC1_DMA_CHANNEL            DMA1_Channel1
 #define ADC1_MAX_GROUPS             ADC_DEFAULT_MAX_GROUP
-#define ADC1_QUEUE_SIZE             ADC_DEFAULT_QUEUE_SIZE
 #define ADC1_QUEUE_ENABLE           STD_OFF
 
 /* ADC2 Configuration */
@@ -98,13 +107,27 @@
 #define ADC2_DMA_ENABLED            STD_OFF 
 #define ADC2_DMA_CHANNEL            NULL
 #define ADC2_MAX_GROUPS             ADC_DEFAULT_MAX_GROUP
-#define ADC2_QUEUE_SIZE             ADC_DEFAULT_QUEUE_SIZE
 #define ADC2_QUEUE_ENABLE           STD_OFF
 
 /* Clock Configuration */
-// #define ADC_CLOCK_PRESCALER         ADC_PCLK2_Div6  /*!< ADC clock prescaler */ 
+#define ADC_CLOCK_PRESCALER         RCC_PCLK2_Div6  /*!< ADCCLK = PCLK2 / 6, 12 MHz at 72 MHz (14 MHz max) */
 #define ADC_SAMPLING_TIME_DEFAULT   ADC_SampleTime_28Cycles5  /*!< Default sampling time */
 
+/* Hardware Trigger Configuration */
+#define ADC_HW_TRIGGER_TICK_HZ      1000000UL  /*!< Trigger timer tick, unit of Adc_HwTriggerTimer */
+#define ADC_HW_TRIGGER_PERIOD(Hz)   ((Adc_HwTriggerTimerType)(ADC_HW_TRIGGER_TICK_HZ / (Hz)))  /*!< Trigger period for a sampling rate */
+#define ADC_HW_TRIGGER_TIMER_MIN    2UL        /*!< Shortest period, ARR = 1 */
+#define ADC_HW_TRIGGER_TIMER_MAX    0x10000UL  /*!< Longest period, 16-bit ARR = 0xFFFF */
+
+/****************************************************************************************
+*                              TIMING MODEL CONFIGURATION                              *
+****************************************************************************************/
+/* Handler costs behind the CPU load of Adc_TimingGetGroupTiming, in core cycles.
+ * Planning values, replace them with the Prof_Dump max of the handlers on target */
+#define ADC_TIMING_EOC_ISR_CYCLES   300U    /*!< ADC1_2 handler for one EOC or JEOC, notification included */
+#define ADC_TIMING_DMA_ISR_CYCLES   400U    /*!< DMA1_Channel1 handler for one HT or TC, notification included */
+#define ADC_TIMING_DECIMATE_CYCLES  3U      /*!< Per raw value summed by the oversampling kernel */
+
 /****************************************************************************************
 *                              SAFETY CONFIGURATION                                    *
 ****************************************************************************************/
@@ -179,6 +202,26 @@ extern Adc_ValueGroupType Adc_ResultBuffer[ADC_MAX_GROUPS][ADC_MAX_BUFFER_SIZE];
 #define ADC_CHANNEL_GROUP_1_RESULT_SIZE 1
 extern Adc_ValueGroupType Adc_Group1_ResultBuffer[ADC_CHANNEL_GROUP_1_RESULT_SIZE];    
 
+#define ADC_CHANNEL_GROUP_2_RESULT_SIZE 16
+extern Adc_ValueGroupType Adc_Group2_ResultBuffer[ADC_CHANNEL_GROUP_2_RESULT_SIZE];
+
+#define ADC_CHANNEL_GROUP_3_RESULT_SIZE 8
+extern Adc_ValueGroupType Adc_Group3_ResultBuffer[ADC_CHANNEL_GROUP_3_RESULT_SIZE];
+
+#define ADC_CHANNEL_GROUP_4_RESULT_SIZE 1
+extern Adc_ValueGroupType Adc_Group4_ResultBuffer[ADC_CHANNEL_GROUP_4_RESULT_SIZE];
+
+/* Dual group: 2 values (ADC1, ADC2) per rank and sample */
+#define ADC_CHANNEL_GROUP_5_RESULT_SIZE 16
+extern Adc_ValueGroupType Adc_Group5_ResultBuffer[ADC_CHANNEL_GROUP_5_RESULT_SIZE];
+
+/* Oversampled group: one decimated value per rank */
+#define ADC_CHANNEL_GROUP_6_RESULT_SIZE 1
+extern Adc_ValueGroupType Adc_Group6_ResultBuffer[ADC_CHANNEL_GROUP_6_RESULT_SIZE];
+
+#define ADC_CHANNEL_GROUP_7_RESULT_SIZE 16
+extern Adc_ValueGroupType Adc_Group7_ResultBuffer[ADC_CHANNEL_GROUP_7_RESULT_SIZE];
+
 /****************************************************************************************
 *                              CALLBACK FUNCTION DECLARATIONS                         *
 ****************************************************************************************/
@@ -187,10 +230,19 @@ extern void Adc_Group1_Notification(void);
 extern void Adc_Group2_Notification(void);
 extern void Adc_Group3_Notification(void);
 extern void Adc_Group4_Notification(void);
+extern void Adc_Group5_Notification(void);
+extern void Adc_Group6_Notification(void);
+extern void Adc_Group7_Notification(void);
+
+/* Limit Notification Callbacks */
+extern void Adc_Group7_LimitNotification(Adc_GroupType Group, Adc_LimitEventType Event, Adc_ValueGroupType Value);
 
 /* Hardware Event Callbacks */
 void Adc_TransferComplete_Callback(ADC_TypeDef* ADCx);
+void Adc_InjectedTransferComplete_Callback(ADC_TypeDef* ADCx);
+void Adc_Watchdog_Callback(ADC_TypeDef* ADCx);
 void Adc_DmaTransferComplete_Callback(DMA_Channel_TypeDef* DMAx_Channely);
+void Adc_DmaHalfTransfer_Callback(DMA_Channel_TypeDef* DMAx_Channely);
 
 /****************************************************************************************
 *                              VALIDATION MACROS                                       *
@@ -213,10 +265,18 @@ void Adc_DmaTransferComplete_Callback(DMA_Channel_TypeDef* DMAx_Channely);
 #error "ADC_MAX_BUFFER_SIZE exceeds memory constraints"
 #endif
 
-/* UNUSED - Feature validation not used since feature flags are commented out */
-/* #if (ADC_ENABLE_PRIORITY == STD_ON) && (ADC_ENABLE_QUEUING == STD_OFF)
+/* Feature validation */
+#if (ADC_ENABLE_PRIORITY == STD_ON) && (ADC_ENABLE_QUEUING == STD_OFF)
 #error "Priority support requires queuing to be enabled"
-#endif */
+#endif
+
+#if (ADC_ENABLE_QUEUING == STD_ON) && (ADC_MAX_GROUPS > 32)
+#error "Queued group bitmask supports at most 32 groups"
+#endif
+
+#if (ADC_ENABLE_PRIORITY == STD_ON) && ((ADC_PRIORITY_LEVELS > 32) || (ADC_MAX_GROUPS > 32))
+#error "Priority ready bitmap supports at most 32 levels and 32 groups"
+#endif
 
 /* #if (ADC_ENABLE_STREAMING == STD_ON) && (ADC_ENABLE_DMA == STD_OFF)
 #error "Streaming mode requires DMA support"
@@ -0,0 +1,36 @@
+/****************************************************************************************
+*                                DET_CFG.H                                              *
+****************************************************************************************
+* File Name   : Det_Cfg.h
+* Module      : Development Error Tracer (DET)
+* Description : Development Error Tracer configuration header file
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+#ifndef DET_CFG_H
+#define DET_CFG_H
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "Std_Types.h"
+
+/****************************************************************************************
+*                              FEATURE CONFIGURATION                                   *
+****************************************************************************************/
+#define DET_ENABLED                 STD_ON  /*!< STD_OFF turns every report into (E_OK) */
+
+/****************************************************************************************
+*                              BUFFER CONFIGURATION                                    *
+****************************************************************************************/
+#define DET_BUFFER_SIZE             32U     /*!< Ring entries, power of two */
+#define DET_NBR_OF_ERROR_COUNTERS   64U     /*!< Counters for ErrorId 0..62, the last one counts all higher IDs */
+
+#if ((DET_BUFFER_SIZE & (DET_BUFFER_SIZE - 1U)) != 0U)
+#error "DET_BUFFER_SIZE must be a power of two"
+#endif
+
+#endif /* DET_CFG_H */
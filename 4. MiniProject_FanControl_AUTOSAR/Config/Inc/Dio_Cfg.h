@@ -18,6 +18,9 @@
 #define DIO_PORT_B 1    /* Mapping for GPIO Port B */
 #define DIO_PORT_C 2    /* Mapping for GPIO Port C */
 #define DIO_PORT_D 3    /* Mapping for GPIO Port D */
+#define DIO_NUM_PORTS 4 /* Ports A..D, channel IDs 0..(DIO_NUM_PORTS * 16 - 1) */
+
+#define DIO_DEV_ERROR_DETECT STD_ON /* Range check of channel IDs in Dio_ReadChannel/Dio_WriteChannel */
 
 /* MACRO TO CONVERT GPIO PIN TO CHANNEL ID */
 #define DIO_CHANNEL_A0      DIO_GET_CHANNEL_ID(DIO_PORT_A, 0)  // GPIOA Pin 0
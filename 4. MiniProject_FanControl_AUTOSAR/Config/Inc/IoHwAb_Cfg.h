@@ -0,0 +1,24 @@
+/****************************************************************************************
+*                                IOHWAB_CFG.H                                           *
+****************************************************************************************
+* File Name   : IoHwAb_Cfg.h
+* Module      : I/O Hardware Abstraction Layer
+* Description : IoHwAb signal filter configuration header file
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+#ifndef IOHWAB_CFG_H
+#define IOHWAB_CFG_H
+
+/****************************************************************************************
+*                              SIGNAL FILTER CONFIGURATION                             *
+****************************************************************************************/
+#define IOHWAB_FILTER_MAX_SIGNALS           1u     /*!< Entries in IoHwAb_FilterConfig */
+
+/* Signal IDs, index into IoHwAb_FilterConfig */
+#define IOHWAB_FILTER_SIGNAL_TEMPERATURE    0u     /*!< PA0 temperature sensor */
+
+#endif /* IOHWAB_CFG_H */
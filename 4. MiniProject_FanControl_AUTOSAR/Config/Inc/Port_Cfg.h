@@ -21,10 +21,25 @@
 #include "Port_Types.h"
 
 
+/**********************************************************
+ * PIN LIST
+ * One PIN(Arg, ...) entry per configured pin. Port_Cfg.c expands the list into
+ * PortCfg_Pins and into the per-port register images used by Port_Init, so both
+ * always describe the same configuration.
+ *   PortNum, PinNum, Mode, Direction, Level, Pull, Speed,
+ *   DirectionChangeable, ModeChangeable
+ **********************************************************/
+#define PORT_CFG_PINS(PIN, Arg) \
+    PIN(Arg, PORT_ID_A,  0, PORT_PIN_MODE_ADC, PORT_PIN_IN,  PORT_PIN_LEVEL_HIGH, PORT_PIN_PULL_NONE, PORT_PIN_SPEED_10MHZ, 0, 1) \
+    PIN(Arg, PORT_ID_A,  1, PORT_PIN_MODE_ADC, PORT_PIN_IN,  PORT_PIN_LEVEL_HIGH, PORT_PIN_PULL_NONE, PORT_PIN_SPEED_10MHZ, 0, 1) \
+    PIN(Arg, PORT_ID_A,  8, PORT_PIN_MODE_PWM, PORT_PIN_OUT, PORT_PIN_LEVEL_HIGH, PORT_PIN_PULL_NONE, PORT_PIN_SPEED_50MHZ, 0, 1) \
+    PIN(Arg, PORT_ID_C, 13, PORT_PIN_MODE_DIO, PORT_PIN_OUT, PORT_PIN_LEVEL_HIGH, PORT_PIN_PULL_NONE, PORT_PIN_SPEED_10MHZ, 0, 1)
+
 /**********************************************************
  * NUMBER OF PINS CONFIGURED
  **********************************************************/
-#define PortCfg_PinsCount    3U
+#define PORT_CFG_COUNT_PIN(Arg, PortNum, PinNum, Mode, Direction, Level, Pull, Speed, DirChg, ModeChg) + 1U
+#define PortCfg_PinsCount    (0U PORT_CFG_PINS(PORT_CFG_COUNT_PIN, 0))
 
 /**********************************************************
  * ARRAY OF PIN CONFIGURATIONS
@@ -0,0 +1,62 @@
+/****************************************************************************************
+*                                PROF_CFG.H                                             *
+****************************************************************************************
+* File Name   : Prof_Cfg.h
+* Module      : Profiling (PROF)
+* Description : Profiling probe configuration header file
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+#ifndef PROF_CFG_H
+#define PROF_CFG_H
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "Std_Types.h"
+
+/****************************************************************************************
+*                              FEATURE CONFIGURATION                                   *
+****************************************************************************************/
+#define PROF_ENABLED                STD_ON  /*!< Compile the probes in, STD_OFF removes them */
+
+/****************************************************************************************
+*                                 PROBE IDS                                            *
+****************************************************************************************/
+/**
+ * @brief   One entry per instrumented ISR or API
+ * @details API probes cover the driver work after DET validation.
+ */
+typedef enum
+{
+    /* Interrupt handlers, isr.c */
+    PROF_PROBE_ADC1_2_IRQ = 0,
+    PROF_PROBE_DMA1_CH1_IRQ,
+    PROF_PROBE_TIM1_IRQ,
+    PROF_PROBE_TIM2_IRQ,
+    PROF_PROBE_TIM3_IRQ,
+    PROF_PROBE_TIM4_IRQ,
+
+    /* Driver APIs */
+    PROF_PROBE_ADC_START_GROUP,
+    PROF_PROBE_ADC_STOP_GROUP,
+    PROF_PROBE_ADC_READ_GROUP,
+    PROF_PROBE_PWM_SET_DUTY,
+    PROF_PROBE_DIO_READ_CHANNEL,
+    PROF_PROBE_DIO_WRITE_CHANNEL,
+
+    /* Reset to main, one sample recorded by Prof_Init */
+    PROF_PROBE_STARTUP,
+
+    PROF_NBR_OF_PROBES
+} Prof_ProbeType;
+
+/****************************************************************************************
+*                              EXTERNAL CONFIGURATION                                  *
+****************************************************************************************/
+extern const char* const Prof_ProbeNames[PROF_NBR_OF_PROBES];
+
+#endif /* PROF_CFG_H */
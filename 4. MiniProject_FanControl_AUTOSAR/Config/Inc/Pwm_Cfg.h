@@ -38,6 +38,7 @@
 #define PWM_GET_OUTPUT_STATE_API    STD_ON  /*!< Enable/disable Pwm_GetOutputState API */
 #define PWM_ENABLE_PHASE_SHIFT      STD_OFF /*!< Enable/disable phase shift support */
 #define PWM_ENABLE_VARIABLE_PERIOD  STD_ON  /*!< Enable/disable variable period support */
+#define PWM_ADC_TRIGGER_API         STD_ON  /*!< Enable/disable Pwm_SetAdcTriggerOffset API */
 
 /****************************************************************************************
 *                              SYSTEM CONFIGURATION                                    *
@@ -132,6 +133,13 @@
 #define PWM_SYNC_MODE_DISABLED      0       /*!< Synchronization disabled */
 #define PWM_SYNC_MODE_ENABLED       1       /*!< Synchronization enabled */
 
+/* PWM ADC Trigger Compare Channel */
+#define PWM_ADC_TRIGGER_NONE        0       /*!< Channel has no ADC sample point */
+#define PWM_ADC_TRIGGER_CC2         2       /*!< TIMx CC2, TIM1 CC2 starts the ADC regular sequence */
+#define PWM_ADC_TRIGGER_CC3         3       /*!< TIMx CC3, TIM1 CC3 starts the ADC regular sequence */
+#define PWM_ADC_TRIGGER_CC4         4       /*!< TIMx CC4, TIM1 CC4 starts the ADC injected sequence */
+#define PWM_ADC_TRIGGER_OFFSET      0x6000  /*!< Fan sample point at 75% of the period, mid off-time at 50% duty */
+
 /* PWM Master/Slave Mode */
 #define PWM_MASTER_SLAVE_DISABLED   0       /*!< Master/slave mode disabled */
 #define PWM_MASTER_SLAVE_ENABLED    1       /*!< Master/slave mode enabled */
@@ -0,0 +1,44 @@
+/****************************************************************************************
+*                                SCH_CFG.H                                              *
+****************************************************************************************
+* File Name   : Sch_Cfg.h
+* Module      : Scheduler (SCH)
+* Description : Scheduler task table configuration header file
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+#ifndef SCH_CFG_H
+#define SCH_CFG_H
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "Std_Types.h"
+#include "Sch.h"
+
+/****************************************************************************************
+*                              SYSTEM CONFIGURATION                                    *
+****************************************************************************************/
+#define SCH_TICK_HZ                 1000U   /*!< 1 ms tick */
+#define SCH_MAX_TASKS               8U      /*!< Task table capacity */
+
+/* Milliseconds to ticks */
+#define SCH_MS_TO_TICKS(ms)         ((uint16)(((ms) * SCH_TICK_HZ) / 1000U))
+
+/****************************************************************************************
+*                              APPLICATION RUNNABLES                                   *
+****************************************************************************************/
+/**
+ * @brief   Cyclic application runnable, provided by main.c
+ */
+extern void Application_MainFunction(void);
+
+/****************************************************************************************
+*                              EXTERNAL CONFIGURATION                                  *
+****************************************************************************************/
+extern const Sch_ConfigType Sch_Config;
+
+#endif /* SCH_CFG_H */
@@ -29,11 +29,106 @@ static const Adc_ChannelDefType Adc_ChannelGroup1[] =
         .Adc_ChannelSampTime    = ADC_SAMPLING_TIME_DEFAULT
     },
 };
-#define ADC_CHANNEL_GROUP_1_SIZE            sizeof(Adc_ChannelGroup1)/sizeof(Adc_ChannelDefType)
+#define ADC_CHANNEL_GROUP_1_SIZE            (sizeof(Adc_ChannelGroup1) / sizeof(Adc_ChannelDefType))
 #define ADC_CHANNEL_GROUP_1_NUM_OF_SAMPLE   1
 // #define ADC_CHANNEL_GROUP_1_RESULT_SIZE     (ADC_CHANNEL_GROUP_1_NUM_OF_SAMPLE * ADC_CHANNEL_GROUP_1_SIZE)
 Adc_ValueGroupType Adc_Group1_ResultBuffer[ADC_CHANNEL_GROUP_1_RESULT_SIZE];  
 
+/* Channel configuration for Group 2 */
+static const Adc_ChannelDefType Adc_ChannelGroup2[] = 
+{
+    {
+        .Adc_ChannelId          = 0,                          /* PA0 - ADC1_IN0 */
+        .Adc_ChannelSampTime    = ADC_SAMPLING_TIME_DEFAULT
+    },
+};
+#define ADC_CHANNEL_GROUP_2_SIZE            (sizeof(Adc_ChannelGroup2) / sizeof(Adc_ChannelDefType))
+#define ADC_CHANNEL_GROUP_2_NUM_OF_SAMPLE   (ADC_CHANNEL_GROUP_2_RESULT_SIZE / ADC_CHANNEL_GROUP_2_SIZE)
+#define ADC_CHANNEL_GROUP_2_SAMPLE_RATE_HZ  1000    /* TIM3 TRGO, one scan per millisecond */
+Adc_ValueGroupType Adc_Group2_ResultBuffer[ADC_CHANNEL_GROUP_2_RESULT_SIZE];
+
+/* Channel configuration for Group 3 */
+static const Adc_ChannelDefType Adc_ChannelGroup3[] = 
+{
+    {
+        .Adc_ChannelId          = 0,                          /* PA0 - ADC1_IN0 */
+        .Adc_ChannelSampTime    = ADC_SAMPLING_TIME_DEFAULT
+    },
+};
+#define ADC_CHANNEL_GROUP_3_SIZE            (sizeof(Adc_ChannelGroup3) / sizeof(Adc_ChannelDefType))
+#define ADC_CHANNEL_GROUP_3_NUM_OF_SAMPLE   (ADC_CHANNEL_GROUP_3_RESULT_SIZE / ADC_CHANNEL_GROUP_3_SIZE)
+Adc_ValueGroupType Adc_Group3_ResultBuffer[ADC_CHANNEL_GROUP_3_RESULT_SIZE];
+
+/* Channel configuration for Group 4, injected sequence: at most 4 channels */
+static const Adc_ChannelDefType Adc_ChannelGroup4[] = 
+{
+    {
+        .Adc_ChannelId          = 0,                          /* PA0 - ADC1_IN0 */
+        .Adc_ChannelSampTime    = ADC_SAMPLING_TIME_DEFAULT
+    },
+};
+#define ADC_CHANNEL_GROUP_4_SIZE            (sizeof(Adc_ChannelGroup4) / sizeof(Adc_ChannelDefType))
+#define ADC_CHANNEL_GROUP_4_NUM_OF_SAMPLE   1
+Adc_ValueGroupType Adc_Group4_ResultBuffer[ADC_CHANNEL_GROUP_4_RESULT_SIZE];
+
+/* Channel configuration for Group 5, ADC1 ranks and the ADC2 ranks converted with them */
+static const Adc_ChannelDefType Adc_ChannelGroup5[] = 
+{
+    {
+        .Adc_ChannelId          = 0,                          /* PA0 - ADC1_IN0 */
+        .Adc_ChannelSampTime    = ADC_SAMPLING_TIME_DEFAULT
+    },
+};
+static const Adc_ChannelDefType Adc_PairedChannelGroup5[] = 
+{
+    {
+        .Adc_ChannelId          = 1,                          /* PA1 - ADC2_IN1 */
+        .Adc_ChannelSampTime    = ADC_SAMPLING_TIME_DEFAULT   /* Must match the ADC1 rank */
+    },
+};
+#define ADC_CHANNEL_GROUP_5_SIZE            (sizeof(Adc_ChannelGroup5) / sizeof(Adc_ChannelDefType))
+#define ADC_CHANNEL_GROUP_5_NUM_OF_SAMPLE   (ADC_CHANNEL_GROUP_5_RESULT_SIZE / (2 * ADC_CHANNEL_GROUP_5_SIZE))
+/* Packed 32-bit DMA words, ADC1 in the low and ADC2 in the high half-word.
+ * Written by DMA before the group reports a result, so not cleared at reset */
+__attribute__((aligned(4))) NOINIT Adc_ValueGroupType Adc_Group5_ResultBuffer[ADC_CHANNEL_GROUP_5_RESULT_SIZE];
+
+/* Channel configuration for Group 6, oversampled fan sensor */
+static const Adc_ChannelDefType Adc_ChannelGroup6[] = 
+{
+    {
+        .Adc_ChannelId          = 0,                          /* PA0 - ADC1_IN0 */
+        .Adc_ChannelSampTime    = ADC_SAMPLING_TIME_DEFAULT
+    },
+};
+#define ADC_CHANNEL_GROUP_6_SIZE            (sizeof(Adc_ChannelGroup6) / sizeof(Adc_ChannelDefType))
+#define ADC_CHANNEL_GROUP_6_NUM_OF_SAMPLE   1
+#define ADC_CHANNEL_GROUP_6_OVERSAMPLING    ADC_OVERSAMPLING_X16     /* 14 bit results */
+Adc_ValueGroupType Adc_Group6_ResultBuffer[ADC_CHANNEL_GROUP_6_RESULT_SIZE];
+/* Two halves of 16 raw rounds, filled by DMA and decimated in the DMA interrupt */
+__attribute__((aligned(4))) NOINIT static Adc_ValueGroupType Adc_Group6_StagingBuffer[2 * ADC_CHANNEL_GROUP_6_RESULT_SIZE * (1U << ADC_CHANNEL_GROUP_6_OVERSAMPLING)];
+
+/* Channel configuration for Group 7, fan sensor band monitor */
+static const Adc_ChannelDefType Adc_ChannelGroup7[] = 
+{
+    {
+        .Adc_ChannelId          = 0,                          /* PA0 - ADC1_IN0 */
+        .Adc_ChannelSampTime    = ADC_SAMPLING_TIME_DEFAULT
+    },
+};
+#define ADC_CHANNEL_GROUP_7_SIZE            (sizeof(Adc_ChannelGroup7) / sizeof(Adc_ChannelDefType))
+#define ADC_CHANNEL_GROUP_7_NUM_OF_SAMPLE   (ADC_CHANNEL_GROUP_7_RESULT_SIZE / ADC_CHANNEL_GROUP_7_SIZE)
+#define ADC_CHANNEL_GROUP_7_SAMPLE_RATE_HZ  20      /* TIM3 TRGO, slowest rate the 16-bit trigger timer reaches */
+Adc_ValueGroupType Adc_Group7_ResultBuffer[ADC_CHANNEL_GROUP_7_RESULT_SIZE];
+
+/* Whole range until the owner of the group narrows it with Adc_SetGroupLimits */
+static const Adc_LimitCheckDefType Adc_LimitCheckGroup7 =
+{
+    .Adc_LimitChannel           = 0,                          /* PA0 - ADC1_IN0 */
+    .Adc_LowLimit               = 0,
+    .Adc_HighLimit              = ADC_LIMIT_MAX_VALUE,
+    .Adc_LimitNotificationCb    = Adc_Group7_LimitNotification
+};
+
 
 /****************************************************************************************
 *                                 NOTIFICATION CALLBACKS                               *
@@ -48,6 +143,82 @@ __attribute__((weak)) void Adc_Group1_Notification(void)
     /* This can be used to signal completion to application */
 }
 
+/**
+ * @brief Notification callback for Group 2
+ * @return void
+ * @note Called once per half buffer from the DMA interrupt
+ */
+__attribute__((weak)) void Adc_Group2_Notification(void)  
+{
+    /* User-defined notification handling for Group 2 */
+}
+
+/**
+ * @brief Notification callback for Group 3
+ * @return void
+ * @note Called once per half buffer from the DMA interrupt
+ */
+__attribute__((weak)) void Adc_Group3_Notification(void)  
+{
+    /* User-defined notification handling for Group 3 */
+}
+
+/**
+ * @brief Notification callback for Group 4
+ * @return void
+ * @note Called from the JEOC interrupt, the regular stream is not disturbed
+ */
+__attribute__((weak)) void Adc_Group4_Notification(void)  
+{
+    /* User-defined notification handling for Group 4 */
+}
+
+/**
+ * @brief Notification callback for Group 5
+ * @return void
+ * @note Called once per half buffer from the DMA interrupt
+ */
+__attribute__((weak)) void Adc_Group5_Notification(void)  
+{
+    /* User-defined notification handling for Group 5 */
+}
+
+/**
+ * @brief Notification callback for Group 6
+ * @return void
+ * @note Called once per decimated result from the DMA interrupt
+ */
+__attribute__((weak)) void Adc_Group6_Notification(void)  
+{
+    /* User-defined notification handling for Group 6 */
+}
+
+/**
+ * @brief Notification callback for Group 7
+ * @return void
+ * @note Called once per half buffer from the DMA interrupt
+ */
+__attribute__((weak)) void Adc_Group7_Notification(void)  
+{
+    /* User-defined notification handling for Group 7 */
+}
+
+/**
+ * @brief Limit notification callback for Group 7
+ * @param[in] Group Group that left its window
+ * @param[in] Event Side of the window the value left on
+ * @param[in] Value Converted value outside the window
+ * @return void
+ * @note Called from the analog watchdog interrupt
+ */
+__attribute__((weak)) void Adc_Group7_LimitNotification(Adc_GroupType Group, Adc_LimitEventType Event, Adc_ValueGroupType Value)  
+{
+    /* User-defined limit handling for Group 7 */
+    (void)Group;
+    (void)Event;
+    (void)Value;
+}
+
 /****************************************************************************************
 *                                 GROUP CONFIGURATIONS                                 *
 ****************************************************************************************/
@@ -59,6 +230,7 @@ Adc_GroupDefType Adc_GroupConfig[ADC_MAX_GROUPS] =
         .Adc_HwUnitId           = ADC_INSTANCE_1,                               /* ADC Hardware Unit 0 (ADC1) */
         .Adc_GroupId            = 0,                                /* Group 0 (internally Group 1) */
         .Adc_GroupPriority      = 1,                          /* Highest priority */
+        .Adc_GroupKind          = ADC_GROUP_KIND_REGULAR,
         .Adc_GroupAccessMode    = ADC_ACCESS_MODE_SINGLE,
         .Adc_ValueResultSize    = ADC_CHANNEL_GROUP_1_RESULT_SIZE, /*1 channels × 1 samples = 1 */
         .Adc_StreamNumSamples   = ADC_CHANNEL_GROUP_1_NUM_OF_SAMPLE, /* 1 sample per channel */
@@ -69,17 +241,219 @@ Adc_GroupDefType Adc_GroupConfig[ADC_MAX_GROUPS] =
         .Adc_ResultAlignment    = ADC_ALIGN_RIGHT,
         .Adc_ChannelGroup       = (Adc_ChannelDefType*)Adc_ChannelGroup1,
         .Adc_NbrOfChannel       = ADC_CHANNEL_GROUP_1_SIZE,                           /* 1 channels: PA0  */
+        .Adc_PairedChannelGroup = NULL_PTR,
         .Adc_TriggerSource      = ADC_TRIGG_SRC_SW,
         .Adc_HwTriggerSignal    = ADC_HW_TRIG_RISING_EDGE,
+        .Adc_HwTriggerEvent     = ADC_HW_TRIG_EVT_TIM3_TRGO,
         .Adc_HwTriggerTimer     = 0,
-        .Adc_StreamBufferMode   = ADC_STREAM_BUFFER_CIRCULAR,
+        .Adc_StreamBufferMode   = ADC_STREAM_BUFFER_LINEAR,   /* One-shot, DMA stops after the block */
 
         .Adc_ValueResultPtr     = Adc_Group1_ResultBuffer,
         .Adc_SetupBufferFlag    = 0,
+        .Adc_Oversampling       = ADC_OVERSAMPLING_NONE,
+        .Adc_OversamplingBufferPtr = NULL_PTR,
+        .Adc_LimitCheck         = NULL_PTR,
         .Adc_NotificationCb     = Adc_Group1_Notification,
         .Adc_NotificationEnable = ADC_NOTIFICATION_DISABLE,
         .Adc_InterruptType      = ADC_HW_DMA
     },
+    /* Group 2: Streaming, circular, TIM3 TRGO trigger, DMA stores every sample */
+    {
+        .Adc_HwUnitId           = ADC_INSTANCE_1,
+        .Adc_GroupId            = 1,
+        .Adc_GroupPriority      = 0,
+        .Adc_GroupKind          = ADC_GROUP_KIND_REGULAR,
+        .Adc_GroupAccessMode    = ADC_ACCESS_MODE_STREAMING,
+        .Adc_ValueResultSize    = ADC_CHANNEL_GROUP_2_RESULT_SIZE,
+        .Adc_StreamNumSamples   = ADC_CHANNEL_GROUP_2_NUM_OF_SAMPLE,
+
+        .Adc_GroupConvMode      = ADC_CONV_MODE_CONTINUOUS,
+        .Adc_GroupReplacement   = ADC_GROUP_REPL_ABORT_RESTART,
+        .Adc_Status             = ADC_IDLE,
+        .Adc_ResultAlignment    = ADC_ALIGN_RIGHT,
+        .Adc_ChannelGroup       = (Adc_ChannelDefType*)Adc_ChannelGroup2,
+        .Adc_NbrOfChannel       = ADC_CHANNEL_GROUP_2_SIZE,
+        .Adc_PairedChannelGroup = NULL_PTR,
+        .Adc_TriggerSource      = ADC_TRIGG_SRC_HW,
+        .Adc_HwTriggerSignal    = ADC_HW_TRIG_RISING_EDGE,
+        .Adc_HwTriggerEvent     = ADC_HW_TRIG_EVT_TIM3_TRGO,
+        .Adc_HwTriggerTimer     = ADC_HW_TRIGGER_PERIOD(ADC_CHANNEL_GROUP_2_SAMPLE_RATE_HZ),
+        .Adc_StreamBufferMode   = ADC_STREAM_BUFFER_CIRCULAR,
+
+        .Adc_ValueResultPtr     = Adc_Group2_ResultBuffer,
+        .Adc_SetupBufferFlag    = 1,
+        .Adc_Oversampling       = ADC_OVERSAMPLING_NONE,
+        .Adc_OversamplingBufferPtr = NULL_PTR,
+        .Adc_LimitCheck         = NULL_PTR,
+        .Adc_NotificationCb     = Adc_Group2_Notification,
+        .Adc_NotificationEnable = ADC_NOTIFICATION_DISABLE,
+        .Adc_InterruptType      = ADC_HW_DMA
+    },
+    /* Group 3: Streaming, circular, one sample per PWM period at the Pwm channel 0
+     *          AdcTriggerOffset (TIM1 CC2), away from the PA8 switching edges */
+    {
+        .Adc_HwUnitId           = ADC_INSTANCE_1,
+        .Adc_GroupId            = 2,
+        .Adc_GroupPriority      = 0,
+        .Adc_GroupKind          = ADC_GROUP_KIND_REGULAR,
+        .Adc_GroupAccessMode    = ADC_ACCESS_MODE_STREAMING,
+        .Adc_ValueResultSize    = ADC_CHANNEL_GROUP_3_RESULT_SIZE,
+        .Adc_StreamNumSamples   = ADC_CHANNEL_GROUP_3_NUM_OF_SAMPLE,
+
+        .Adc_GroupConvMode      = ADC_CONV_MODE_CONTINUOUS,
+        .Adc_GroupReplacement   = ADC_GROUP_REPL_ABORT_RESTART,
+        .Adc_Status             = ADC_IDLE,
+        .Adc_ResultAlignment    = ADC_ALIGN_RIGHT,
+        .Adc_ChannelGroup       = (Adc_ChannelDefType*)Adc_ChannelGroup3,
+        .Adc_NbrOfChannel       = ADC_CHANNEL_GROUP_3_SIZE,
+        .Adc_PairedChannelGroup = NULL_PTR,
+        .Adc_TriggerSource      = ADC_TRIGG_SRC_HW,
+        .Adc_HwTriggerSignal    = ADC_HW_TRIG_RISING_EDGE,
+        .Adc_HwTriggerEvent     = ADC_HW_TRIG_EVT_TIM1_CC2,
+        .Adc_HwTriggerTimer     = 0,                          /* Paced by the PWM period */
+        .Adc_StreamBufferMode   = ADC_STREAM_BUFFER_CIRCULAR,
+
+        .Adc_ValueResultPtr     = Adc_Group3_ResultBuffer,
+        .Adc_SetupBufferFlag    = 1,
+        .Adc_Oversampling       = ADC_OVERSAMPLING_NONE,
+        .Adc_OversamplingBufferPtr = NULL_PTR,
+        .Adc_LimitCheck         = NULL_PTR,
+        .Adc_NotificationCb     = Adc_Group3_Notification,
+        .Adc_NotificationEnable = ADC_NOTIFICATION_DISABLE,
+        .Adc_InterruptType      = ADC_HW_DMA
+    },
+    /* Group 4: Injected, one-shot, software trigger, urgent over-temperature read of PA0
+     *          between two conversions of the running regular group */
+    {
+        .Adc_HwUnitId           = ADC_INSTANCE_1,
+        .Adc_GroupId            = 3,
+        .Adc_GroupPriority      = 0,                          /* Not used, the ADC preempts in hardware */
+        .Adc_GroupKind          = ADC_GROUP_KIND_INJECTED,
+        .Adc_GroupAccessMode    = ADC_ACCESS_MODE_SINGLE,
+        .Adc_ValueResultSize    = ADC_CHANNEL_GROUP_4_RESULT_SIZE,
+        .Adc_StreamNumSamples   = ADC_CHANNEL_GROUP_4_NUM_OF_SAMPLE,
+
+        .Adc_GroupConvMode      = ADC_CONV_MODE_ONESHOT,
+        .Adc_GroupReplacement   = ADC_GROUP_REPL_ABORT_RESTART,
+        .Adc_Status             = ADC_IDLE,
+        .Adc_ResultAlignment    = ADC_ALIGN_RIGHT,
+        .Adc_ChannelGroup       = (Adc_ChannelDefType*)Adc_ChannelGroup4,
+        .Adc_NbrOfChannel       = ADC_CHANNEL_GROUP_4_SIZE,
+        .Adc_PairedChannelGroup = NULL_PTR,
+        .Adc_TriggerSource      = ADC_TRIGG_SRC_SW,
+        .Adc_HwTriggerSignal    = ADC_HW_TRIG_RISING_EDGE,
+        .Adc_HwTriggerEvent     = ADC_HW_TRIG_EVT_TIM1_CC4,   /* Used if switched to ADC_TRIGG_SRC_HW */
+        .Adc_HwTriggerTimer     = 0,
+        .Adc_StreamBufferMode   = ADC_STREAM_BUFFER_LINEAR,
+
+        .Adc_ValueResultPtr     = Adc_Group4_ResultBuffer,
+        .Adc_SetupBufferFlag    = 1,
+        .Adc_Oversampling       = ADC_OVERSAMPLING_NONE,
+        .Adc_OversamplingBufferPtr = NULL_PTR,
+        .Adc_LimitCheck         = NULL_PTR,
+        .Adc_NotificationCb     = Adc_Group4_Notification,
+        .Adc_NotificationEnable = ADC_NOTIFICATION_DISABLE,
+        .Adc_InterruptType      = ADC_HW_EOC                  /* JEOC, injected groups never use DMA */
+    },
+    /* Group 5: Dual ADC, fan sensor PA0 on ADC1 and PA1 on ADC2 sampled at the same
+     *          instant, one pair per PWM period at TIM1 CC2 */
+    {
+        .Adc_HwUnitId           = ADC_INSTANCE_1,             /* Master, ADC2 follows */
+        .Adc_GroupId            = 4,
+        .Adc_GroupPriority      = 0,
+        .Adc_GroupKind          = ADC_GROUP_KIND_REGULAR,
+        .Adc_GroupAccessMode    = ADC_ACCESS_MODE_STREAMING,
+        .Adc_ValueResultSize    = ADC_CHANNEL_GROUP_5_RESULT_SIZE,
+        .Adc_StreamNumSamples   = ADC_CHANNEL_GROUP_5_NUM_OF_SAMPLE,
+
+        .Adc_GroupConvMode      = ADC_CONV_MODE_CONTINUOUS,
+        .Adc_GroupReplacement   = ADC_GROUP_REPL_ABORT_RESTART,
+        .Adc_Status             = ADC_IDLE,
+        .Adc_ResultAlignment    = ADC_ALIGN_RIGHT,
+        .Adc_ChannelGroup       = (Adc_ChannelDefType*)Adc_ChannelGroup5,
+        .Adc_NbrOfChannel       = ADC_CHANNEL_GROUP_5_SIZE,
+        .Adc_PairedChannelGroup = Adc_PairedChannelGroup5,
+        .Adc_TriggerSource      = ADC_TRIGG_SRC_HW,
+        .Adc_HwTriggerSignal    = ADC_HW_TRIG_RISING_EDGE,
+        .Adc_HwTriggerEvent     = ADC_HW_TRIG_EVT_TIM1_CC2,
+        .Adc_HwTriggerTimer     = 0,                          /* Paced by the PWM period */
+        .Adc_StreamBufferMode   = ADC_STREAM_BUFFER_CIRCULAR,
+
+        .Adc_ValueResultPtr     = Adc_Group5_ResultBuffer,
+        .Adc_SetupBufferFlag    = 1,
+        .Adc_Oversampling       = ADC_OVERSAMPLING_NONE,
+        .Adc_OversamplingBufferPtr = NULL_PTR,
+        .Adc_LimitCheck         = NULL_PTR,
+        .Adc_NotificationCb     = Adc_Group5_Notification,
+        .Adc_NotificationEnable = ADC_NOTIFICATION_DISABLE,
+        .Adc_InterruptType      = ADC_HW_DMA
+    },
+    /* Group 6: Single access, continuous, software trigger, PA0 oversampled x16 and
+     *          decimated to 14 bit, Adc_ReadGroup returns 0..16380 */
+    {
+        .Adc_HwUnitId           = ADC_INSTANCE_1,
+        .Adc_GroupId            = 5,
+        .Adc_GroupPriority      = 0,
+        .Adc_GroupKind          = ADC_GROUP_KIND_REGULAR,
+        .Adc_GroupAccessMode    = ADC_ACCESS_MODE_SINGLE,
+        .Adc_ValueResultSize    = ADC_CHANNEL_GROUP_6_RESULT_SIZE,
+        .Adc_StreamNumSamples   = ADC_CHANNEL_GROUP_6_NUM_OF_SAMPLE,
+
+        .Adc_GroupConvMode      = ADC_CONV_MODE_CONTINUOUS,
+        .Adc_GroupReplacement   = ADC_GROUP_REPL_ABORT_RESTART,
+        .Adc_Status             = ADC_IDLE,
+        .Adc_ResultAlignment    = ADC_ALIGN_RIGHT,            /* Required by the decimation kernel */
+        .Adc_ChannelGroup       = (Adc_ChannelDefType*)Adc_ChannelGroup6,
+        .Adc_NbrOfChannel       = ADC_CHANNEL_GROUP_6_SIZE,
+        .Adc_PairedChannelGroup = NULL_PTR,
+        .Adc_TriggerSource      = ADC_TRIGG_SRC_SW,
+        .Adc_HwTriggerSignal    = ADC_HW_TRIG_RISING_EDGE,
+        .Adc_HwTriggerEvent     = ADC_HW_TRIG_EVT_TIM1_CC1,
+        .Adc_HwTriggerTimer     = 0,
+        .Adc_StreamBufferMode   = ADC_STREAM_BUFFER_LINEAR,
+
+        .Adc_ValueResultPtr     = Adc_Group6_ResultBuffer,
+        .Adc_SetupBufferFlag    = 1,
+        .Adc_Oversampling       = ADC_CHANNEL_GROUP_6_OVERSAMPLING,
+        .Adc_OversamplingBufferPtr = Adc_Group6_StagingBuffer,
+        .Adc_LimitCheck         = NULL_PTR,
+        .Adc_NotificationCb     = Adc_Group6_Notification,
+        .Adc_NotificationEnable = ADC_NOTIFICATION_DISABLE,
+        .Adc_InterruptType      = ADC_HW_DMA
+    },
+    /* Group 7: Streaming, circular, PA0 at 20 Hz into a DMA ring, the analog watchdog
+     *          wakes the CPU only when the value leaves the current band */
+    {
+        .Adc_HwUnitId           = ADC_INSTANCE_1,
+        .Adc_GroupId            = 6,
+        .Adc_GroupPriority      = 0,
+        .Adc_GroupKind          = ADC_GROUP_KIND_REGULAR,
+        .Adc_GroupAccessMode    = ADC_ACCESS_MODE_STREAMING,
+        .Adc_ValueResultSize    = ADC_CHANNEL_GROUP_7_RESULT_SIZE,
+        .Adc_StreamNumSamples   = ADC_CHANNEL_GROUP_7_NUM_OF_SAMPLE,
+
+        .Adc_GroupConvMode      = ADC_CONV_MODE_CONTINUOUS,
+        .Adc_GroupReplacement   = ADC_GROUP_REPL_ABORT_RESTART,
+        .Adc_Status             = ADC_IDLE,
+        .Adc_ResultAlignment    = ADC_ALIGN_RIGHT,
+        .Adc_ChannelGroup       = (Adc_ChannelDefType*)Adc_ChannelGroup7,
+        .Adc_NbrOfChannel       = ADC_CHANNEL_GROUP_7_SIZE,
+        .Adc_PairedChannelGroup = NULL_PTR,
+        .Adc_TriggerSource      = ADC_TRIGG_SRC_HW,
+        .Adc_HwTriggerSignal    = ADC_HW_TRIG_RISING_EDGE,
+        .Adc_HwTriggerEvent     = ADC_HW_TRIG_EVT_TIM3_TRGO,
+        .Adc_HwTriggerTimer     = ADC_HW_TRIGGER_PERIOD(ADC_CHANNEL_GROUP_7_SAMPLE_RATE_HZ),
+        .Adc_StreamBufferMode   = ADC_STREAM_BUFFER_CIRCULAR,
+
+        .Adc_ValueResultPtr     = Adc_Group7_ResultBuffer,
+        .Adc_SetupBufferFlag    = 1,
+        .Adc_Oversampling       = ADC_OVERSAMPLING_NONE,
+        .Adc_OversamplingBufferPtr = NULL_PTR,
+        .Adc_LimitCheck         = &Adc_LimitCheckGroup7,
+        .Adc_NotificationCb     = Adc_Group7_Notification,
+        .Adc_NotificationEnable = ADC_NOTIFICATION_DISABLE,
+        .Adc_InterruptType      = ADC_HW_DMA
+    },
 };
 
 /****************************************************************************************
@@ -93,7 +467,8 @@ Adc_HwUnitDefType Adc_HwUnitConfig[ADC_MAX_HW_UNITS] =
         .AdcHW_UnitId           = 0,                               /* Hardware Unit 0 corresponds to ADC1 */
         .AdcHw_QueueEnable      = ADC_ENABLE_QUEUING,         /* Queue enabled */
         .AdcHw_PriorityEnable   = ADC_PRIORITY_IMPLEMENTATION,
-        .AdcHw_DMAAvailable     = ADC_DMA_NOT_AVAILABLE,     /* DMA not available */
+        .AdcHw_DMAAvailable     = ADC_DMA_AVAILABLE,         /* DMA1 Channel1, scan mode */
+        .AdcHw_DualMode         = ADC_DUAL_MODE_REG_SIMULT,  /* Groups with paired ranks drive ADC2 too */
     },
 };
 
@@ -0,0 +1,58 @@
+/****************************************************************************************
+*                                IOHWAB_CFG.C                                           *
+****************************************************************************************
+* File Name   : IoHwAb_Cfg.c
+* Module      : I/O Hardware Abstraction Layer
+* Description : IoHwAb signal filter configuration source file
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "IoHwAb_Cfg.h"
+#include "IoHwAb_Filter.h"
+
+/****************************************************************************************
+*                              TEMPERATURE FILTER CHAIN                                *
+****************************************************************************************/
+/* Median of 5 rejects single-sample spikes, the IIR then smooths the steps */
+#define IOHWAB_TEMP_MEDIAN_LENGTH   5u
+static uint16 IoHwAb_TempMedianWindow[IOHWAB_TEMP_MEDIAN_LENGTH];
+static uint16 IoHwAb_TempMedianSorted[IOHWAB_TEMP_MEDIAN_LENGTH];
+
+static const IoHwAb_FilterStageDefType IoHwAb_TempFilterStages[] =
+{
+    {
+        .Kind   = IOHWAB_FILTER_MEDIAN,
+        .Length = IOHWAB_TEMP_MEDIAN_LENGTH,
+        .Alpha  = 0u,
+        .Window = IoHwAb_TempMedianWindow,
+        .Sorted = IoHwAb_TempMedianSorted
+    },
+    {
+        .Kind   = IOHWAB_FILTER_IIR,
+        .Length = 0u,
+        .Alpha  = IOHWAB_FILTER_Q15(0.25),                  /* Time constant about 4 samples */
+        .Window = NULL_PTR,
+        .Sorted = NULL_PTR
+    },
+};
+#define IOHWAB_TEMP_FILTER_STAGES   (sizeof(IoHwAb_TempFilterStages) / sizeof(IoHwAb_FilterStageDefType))
+static IoHwAb_FilterStageStateType IoHwAb_TempFilterState[IOHWAB_TEMP_FILTER_STAGES];
+
+/****************************************************************************************
+*                              SIGNAL FILTER TABLE                                     *
+****************************************************************************************/
+const IoHwAb_FilterSignalDefType IoHwAb_FilterConfig[IOHWAB_FILTER_MAX_SIGNALS] =
+{
+    /* IOHWAB_FILTER_SIGNAL_TEMPERATURE */
+    {
+        .Stages      = IoHwAb_TempFilterStages,
+        .State       = IoHwAb_TempFilterState,
+        .NbrOfStages = (uint8)IOHWAB_TEMP_FILTER_STAGES
+    },
+};
@@ -11,19 +11,58 @@
 * Github      : https://github.com/HoangPhuc02
  **********************************************************/
 
-#include "Port_cfg.h"
+#include "Port_Cfg.h"
 
 /**
- * @brief Configuration for the Port Driver
- *        - PinCount: Total number of pins configured
- *        - PinConfigs: Pointer to an array of pin configurations
+ * @brief Expansion of one PORT_CFG_PINS entry
+ *        - PIN_INIT:   PortCfg_Pins initializer
+ *        - CR*_MASK:   CNF/MODE field of the pin if it is on Port
+ *        - CR*:        CNF/MODE value of the pin if it is on Port
+ *        - BSRR:       initial output level or pull of the pin if it is on Port
+ *        - APB2:       clock of the pin's port
  */
-const Port_ConfigType PortCfg_Port = {
-    .PinCount = PortCfg_PinsCount,
-    .PinConfigs = PortCfg_Pins
-};
+#define PORT_CFG_PIN_INIT(Arg, Port, Pin, PinMode, PinDirection, PinLevel, PinPull, PinSpeed, DirChg, ModeChg) \
+    {                                                   \
+        .PortNum = Port,                                \
+        .PinNum = Pin,                                  \
+        .Mode = PinMode,                                \
+        .Direction = PinDirection,                      \
+        .DirectionChangeable = DirChg,                  \
+        .Level = PinLevel,                              \
+        .Pull = PinPull,                                \
+        .ModeChangeable = ModeChg,                      \
+        .Speed = PinSpeed,                              \
+    },
+
+#define PORT_CFG_PIN_ON_CR(Arg, Port, Pin, PinMode, High) \
+    (((Port) == (Arg)) && (((Pin) >= 8U) == (High)) && PORT_PIN_HAS_IMAGE(PinMode))
+
+#define PORT_CFG_CRL_MASK(Arg, Port, Pin, PinMode, PinDirection, PinLevel, PinPull, PinSpeed, DirChg, ModeChg) \
+    | (PORT_CFG_PIN_ON_CR(Arg, Port, Pin, PinMode, 0) ? (0xFUL << PORT_PIN_CR_SHIFT(Pin)) : 0UL)
+#define PORT_CFG_CRH_MASK(Arg, Port, Pin, PinMode, PinDirection, PinLevel, PinPull, PinSpeed, DirChg, ModeChg) \
+    | (PORT_CFG_PIN_ON_CR(Arg, Port, Pin, PinMode, 1) ? (0xFUL << PORT_PIN_CR_SHIFT(Pin)) : 0UL)
+#define PORT_CFG_CRL(Arg, Port, Pin, PinMode, PinDirection, PinLevel, PinPull, PinSpeed, DirChg, ModeChg) \
+    | (PORT_CFG_PIN_ON_CR(Arg, Port, Pin, PinMode, 0) ? \
+       (PORT_PIN_CNF_MODE(PinMode, PinDirection, PinPull, PinSpeed) << PORT_PIN_CR_SHIFT(Pin)) : 0UL)
+#define PORT_CFG_CRH(Arg, Port, Pin, PinMode, PinDirection, PinLevel, PinPull, PinSpeed, DirChg, ModeChg) \
+    | (PORT_CFG_PIN_ON_CR(Arg, Port, Pin, PinMode, 1) ? \
+       (PORT_PIN_CNF_MODE(PinMode, PinDirection, PinPull, PinSpeed) << PORT_PIN_CR_SHIFT(Pin)) : 0UL)
+#define PORT_CFG_BSRR(Arg, Port, Pin, PinMode, PinDirection, PinLevel, PinPull, PinSpeed, DirChg, ModeChg) \
+    | ((Port) == (Arg) ? PORT_PIN_BSRR(Pin, PinMode, PinDirection, PinLevel, PinPull) : 0UL)
+#define PORT_CFG_APB2(Arg, Port, Pin, PinMode, PinDirection, PinLevel, PinPull, PinSpeed, DirChg, ModeChg) \
+    | (PORT_IS_VALID_PORT_ID(Port) ? PORT_GET_APB2_CLOCK(Port) : 0UL)
+
+#define PORT_CFG_PORT_IMAGE(Port)                                   \
+    [Port] = {                                                      \
+        .CrlMask    = (0UL PORT_CFG_PINS(PORT_CFG_CRL_MASK, Port)), \
+        .Crl        = (0UL PORT_CFG_PINS(PORT_CFG_CRL, Port)),      \
+        .CrhMask    = (0UL PORT_CFG_PINS(PORT_CFG_CRH_MASK, Port)), \
+        .Crh        = (0UL PORT_CFG_PINS(PORT_CFG_CRH, Port)),      \
+        .Bsrr       = (0UL PORT_CFG_PINS(PORT_CFG_BSRR, Port)),     \
+    }
+
 /**
- * @brief Configuration for each pin
+ * @brief Configuration for each pin, expanded from PORT_CFG_PINS in Port_Cfg.h
  *        - PortNum:   PORT_ID_A, PORT_ID_B, PORT_ID_C, ...
  *        - PinNum:    Pin number within the port (0-15)
  *        - Mode:      PORT_PIN_MODE_DIO, ...
@@ -32,41 +71,32 @@ const Port_ConfigType PortCfg_Port = {
  *        - Level:     PORT_PIN_LEVEL_HIGH / PORT_PIN_LEVEL_LOW
  *        - Pull:      PORT_PIN_PULL_NONE / UP / DOWN
  *        - ModeChangeable: 1 = Allow mode change at runtime
- * @note When add more pins, ensure to update PortCfg_PinsCount
+ * @note When add more pins, add them to PORT_CFG_PINS
  */
-
 const Port_PinConfigType PortCfg_Pins[PortCfg_PinsCount] = {
-    {
-        .PortNum = PORT_ID_A,
-        .PinNum = 0,
-        .Mode = PORT_PIN_MODE_ADC,
-        .Direction = PORT_PIN_IN,
-        .DirectionChangeable = 0,
-        .Level = PORT_PIN_LEVEL_HIGH,
-        .Pull = PORT_PIN_PULL_NONE,
-        .ModeChangeable = 1,
-        .Speed = PORT_PIN_SPEED_10MHZ,
-    },
-    {
-        .PortNum = PORT_ID_A,
-        .PinNum = 8,
-        .Mode = PORT_PIN_MODE_PWM,
-        .Direction = PORT_PIN_OUT,
-        .DirectionChangeable = 0,
-        .Level = PORT_PIN_LEVEL_HIGH,
-        .Pull = PORT_PIN_PULL_NONE,
-        .ModeChangeable = 1,
-        .Speed = PORT_PIN_SPEED_50MHZ,
-    },
-    {
-        .PortNum = PORT_ID_C,
-        .PinNum = 13,
-        .Mode = PORT_PIN_MODE_DIO,
-        .Direction = PORT_PIN_OUT,
-        .DirectionChangeable = 0,
-        .Level = PORT_PIN_LEVEL_HIGH,
-        .Pull = PORT_PIN_PULL_NONE,
-        .ModeChangeable = 1,
-        .Speed = PORT_PIN_SPEED_10MHZ,
-    }
-};
\ No newline at end of file
+    PORT_CFG_PINS(PORT_CFG_PIN_INIT, 0)
+};
+
+/**
+ * @brief Register images written by Port_Init, one per port
+ */
+static const Port_PortImageType PortCfg_PortImages[PORT_NBR_OF_PORTS] = {
+    PORT_CFG_PORT_IMAGE(PORT_ID_A),
+    PORT_CFG_PORT_IMAGE(PORT_ID_B),
+    PORT_CFG_PORT_IMAGE(PORT_ID_C),
+    PORT_CFG_PORT_IMAGE(PORT_ID_D),
+};
+
+/**
+ * @brief Configuration for the Port Driver
+ *        - PinCount: Total number of pins configured
+ *        - PinConfigs: Pointer to an array of pin configurations
+ *        - Apb2EnableMask: Clocks of every port used by PinConfigs
+ *        - PortImages: Register image of each port
+ */
+const Port_ConfigType PortCfg_Port = {
+    .PinCount = PortCfg_PinsCount,
+    .PinConfigs = PortCfg_Pins,
+    .Apb2EnableMask = (0UL PORT_CFG_PINS(PORT_CFG_APB2, 0)),
+    .PortImages = PortCfg_PortImages
+};
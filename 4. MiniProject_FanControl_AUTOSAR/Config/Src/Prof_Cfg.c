@@ -0,0 +1,37 @@
+/****************************************************************************************
+*                                PROF_CFG.C                                             *
+****************************************************************************************
+* File Name   : Prof_Cfg.c
+* Module      : Profiling (PROF)
+* Description : Profiling probe configuration source file
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "Prof_Cfg.h"
+
+/****************************************************************************************
+*                                 PROBE NAMES                                          *
+****************************************************************************************/
+/* Same order as Prof_ProbeType, used by Prof_Dump */
+const char* const Prof_ProbeNames[PROF_NBR_OF_PROBES] =
+{
+    [PROF_PROBE_ADC1_2_IRQ]         = "ADC1_2_IRQHandler",
+    [PROF_PROBE_DMA1_CH1_IRQ]       = "DMA1_Channel1_IRQHandler",
+    [PROF_PROBE_TIM1_IRQ]           = "TIM1_UP_CC_IRQHandler",
+    [PROF_PROBE_TIM2_IRQ]           = "TIM2_IRQHandler",
+    [PROF_PROBE_TIM3_IRQ]           = "TIM3_IRQHandler",
+    [PROF_PROBE_TIM4_IRQ]           = "TIM4_IRQHandler",
+    [PROF_PROBE_ADC_START_GROUP]    = "Adc_StartGroupConversion",
+    [PROF_PROBE_ADC_STOP_GROUP]     = "Adc_StopGroupConversion",
+    [PROF_PROBE_ADC_READ_GROUP]     = "Adc_ReadGroup",
+    [PROF_PROBE_PWM_SET_DUTY]       = "Pwm_SetDutyCycle",
+    [PROF_PROBE_DIO_READ_CHANNEL]   = "Dio_ReadChannel",
+    [PROF_PROBE_DIO_WRITE_CHANNEL]  = "Dio_WriteChannel",
+    [PROF_PROBE_STARTUP]            = "Reset_Handler",
+};
@@ -38,6 +38,8 @@ Pwm_ChannelConfigType Pwm_ChannelConfig[PWM_MAX_CHANNELS] =
         .IdleState          = PWM_LOW,
         .NotificationPtr    = NULL_PTR,
         .NotificationEdge   = PWM_RISING_EDGE,
+        .AdcTriggerChannel  = PWM_ADC_TRIGGER_CC2,      /* Adc group with ADC_HW_TRIG_EVT_TIM1_CC2 */
+        .AdcTriggerOffset   = PWM_ADC_TRIGGER_OFFSET,
     }
 };
 
@@ -142,6 +144,16 @@ Std_ReturnType Pwm_ValidateConfig(const Pwm_ConfigType* ConfigPtr)
                 RetVal = E_NOT_OK;
                 break;
             }
+            
+            /* ADC sample point must be a spare channel of the same timer */
+            if ((ChannelConfig->AdcTriggerChannel != PWM_ADC_TRIGGER_NONE) &&
+                ((ChannelConfig->AdcTriggerChannel > PWM_CHANNELS_PER_HW_UNIT) ||
+                 (ChannelConfig->AdcTriggerChannel == (ChannelConfig->ChannelId % PWM_CHANNELS_PER_HW_UNIT) + 1) ||
+                 (ChannelConfig->AdcTriggerOffset > 0x8000)))
+            {
+                RetVal = E_NOT_OK;
+                break;
+            }
         }
         
         /* Validate hardware unit configuration */
@@ -0,0 +1,49 @@
+/****************************************************************************************
+*                                SCH_CFG.C                                              *
+****************************************************************************************
+* File Name   : Sch_Cfg.c
+* Module      : Scheduler (SCH)
+* Description : Scheduler task table configuration source file
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "Sch_Cfg.h"
+#include "IoHwAb.h"
+
+/****************************************************************************************
+*                                 TASK TABLE                                           *
+****************************************************************************************/
+/* Offsets keep the 10 ms tasks on different ticks */
+static const Sch_TaskConfigType Sch_Tasks[] =
+{
+    /* Temperature acquisition, must match IOHWAB_MAINFUNCTION_PERIOD_MS */
+    {
+        .Sch_TaskFunc       = IoHwAb_MainFunction,
+        .Sch_PeriodTicks    = SCH_MS_TO_TICKS(IOHWAB_MAINFUNCTION_PERIOD_MS),
+        .Sch_OffsetTicks    = SCH_MS_TO_TICKS(1U),
+        .Sch_BudgetUs       = 200U
+    },
+    /* Fan and LED control */
+    {
+        .Sch_TaskFunc       = Application_MainFunction,
+        .Sch_PeriodTicks    = SCH_MS_TO_TICKS(10U),
+        .Sch_OffsetTicks    = SCH_MS_TO_TICKS(5U),
+        .Sch_BudgetUs       = 100U
+    },
+};
+
+/****************************************************************************************
+*                              SCHEDULER CONFIGURATION                                 *
+****************************************************************************************/
+const Sch_ConfigType Sch_Config =
+{
+    .Sch_Tasks          = Sch_Tasks,
+    .Sch_NbrOfTasks     = (uint8)(sizeof(Sch_Tasks) / sizeof(Sch_TaskConfigType)),
+    .Sch_TickHz         = SCH_TICK_HZ
+};
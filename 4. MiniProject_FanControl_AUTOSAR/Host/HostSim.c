@@ -0,0 +1,756 @@
+/****************************************************************************************
+*                                HOSTSIM.C                                              *
+****************************************************************************************
+* File Name   : HostSim.c
+* Module      : Host Simulation (HOSTSIM)
+* Description : Register trapping, simulated clock, NVIC and SysTick of the host model
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * The register windows are mapped at the addresses stm32f10x.h uses and kept
+ * PROT_NONE. A driver access faults, the SIGSEGV handler opens the windows,
+ * refreshes computed registers and single-steps the instruction with the trap
+ * flag. The SIGTRAP handler then compares the word, applies the write side
+ * effects and closes the windows again. Interrupt handlers are only called from
+ * thread context: HostSim_Advance, WFI and the PRIMASK intrinsics.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+
+#include "HostSim.h"
+#include "HostSim_Periph.h"
+
+#if !defined(__x86_64__) || !defined(__linux__)
+#error "The register model traps accesses through x86-64 Linux page faults"
+#endif
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define HOSTSIM_CORE_BASE           0xE0000000UL    /*!< ITM, DWT, FPB and SCS */
+#define HOSTSIM_EFLAGS_TF           0x100ULL        /*!< x86 single-step flag */
+#define HOSTSIM_PF_WRITE            0x2ULL          /*!< Page fault error code, write access */
+#define HOSTSIM_MAX_TAIL_CHAIN      100000UL        /*!< Handlers in a row before an IRQ counts as stuck */
+
+/* SysTick CTRL bits */
+#define HOSTSIM_SYSTICK_ENABLE      SysTick_CTRL_ENABLE_Msk
+#define HOSTSIM_SYSTICK_TICKINT     SysTick_CTRL_TICKINT_Msk
+#define HOSTSIM_SYSTICK_CLKSOURCE   SysTick_CTRL_CLKSOURCE_Msk
+#define HOSTSIM_SYSTICK_COUNTFLAG   SysTick_CTRL_COUNTFLAG_Msk
+
+#define HOSTSIM_REG(Addr)           (*(volatile uint32_t*)(uintptr_t)(Addr))
+#define HOSTSIM_ADDR(Reg)           ((uint32_t)(uintptr_t)&(Reg))
+
+/****************************************************************************************
+*                              LOCAL TYPES                                             *
+****************************************************************************************/
+typedef struct
+{
+    uintptr_t Base;
+    size_t    Size;
+} HostSim_WindowType;
+
+typedef void (*HostSim_HandlerType)(void);
+
+/****************************************************************************************
+*                              EXTERNAL HANDLERS                                       *
+****************************************************************************************/
+/* Weak like the startup vector table, a missing handler reads as NULL */
+extern void SysTick_Handler(void) __attribute__((weak));
+extern void DMA1_Channel1_IRQHandler(void) __attribute__((weak));
+extern void ADC1_2_IRQHandler(void) __attribute__((weak));
+extern void TIM1_UP_IRQHandler(void) __attribute__((weak));
+extern void TIM1_CC_IRQHandler(void) __attribute__((weak));
+extern void TIM2_IRQHandler(void) __attribute__((weak));
+extern void TIM3_IRQHandler(void) __attribute__((weak));
+extern void TIM4_IRQHandler(void) __attribute__((weak));
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static const HostSim_WindowType HostSim_Windows[] =
+{
+    { PERIPH_BASE,          0x00030000UL },     /* APB1, APB2, AHB */
+    { PERIPH_BB_BASE,       0x00600000UL },     /* Bit-band alias of the three buses */
+    { HOSTSIM_CORE_BASE,    0x00100000UL },     /* Private peripheral bus */
+};
+
+static const HostSim_HandlerType HostSim_Vectors[64] =
+{
+    [DMA1_Channel1_IRQn]    = DMA1_Channel1_IRQHandler,
+    [ADC1_2_IRQn]           = ADC1_2_IRQHandler,
+    [TIM1_UP_IRQn]          = TIM1_UP_IRQHandler,
+    [TIM1_CC_IRQn]          = TIM1_CC_IRQHandler,
+    [TIM2_IRQn]             = TIM2_IRQHandler,
+    [TIM3_IRQn]             = TIM3_IRQHandler,
+    [TIM4_IRQn]             = TIM4_IRQHandler,
+};
+
+volatile uint32_t HostSim_Primask;
+
+static uint64_t HostSim_Cycles;
+static uint64_t HostSim_StopCycles = UINT64_MAX;
+static void (*HostSim_StopFunc)(void);
+
+/* Fault in flight, filled by SIGSEGV and consumed by SIGTRAP */
+static volatile sig_atomic_t HostSim_TrapActive;
+static uint32_t HostSim_TrapAddr;
+static uint32_t HostSim_TrapOld;
+static uint8_t HostSim_TrapWrite;
+
+/* Single steps of HostSim_CountInstructions, the trap flag stays set while counting */
+static volatile sig_atomic_t HostSim_Counting;
+static volatile uint64_t HostSim_Steps;
+
+/* Access hook, not called again for its own accesses */
+static HostSim_AccessHookType HostSim_AccessHook;
+static uint8_t HostSim_InAccessHook;
+
+/* NVIC and SysTick state behind the register images */
+static uint64_t HostSim_IrqEnabled;
+static uint64_t HostSim_IrqLatched;
+static uint8_t HostSim_SysTickPending;
+static uint32_t HostSim_SysTickResidual;
+static uint8_t HostSim_InHandler;
+static uint32_t HostSim_IrqCount[64];      /*!< Bit position of HostSim_PendingIrqs */
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void HostSim_Lock(void);
+static void HostSim_Unlock(void);
+static int HostSim_IsModelAddress(uintptr_t Addr);
+static void HostSim_SegvHandler(int Signal, siginfo_t* Info, void* Context);
+static void HostSim_TrapHandler(int Signal, siginfo_t* Info, void* Context);
+static uint64_t HostSim_CountSteps(void (*Func)(void));
+static void HostSim_NoOperation(void);
+static void HostSim_BeforeRead(uint32_t Addr);
+static void HostSim_AfterRead(uint32_t Addr);
+static void HostSim_Write(uint32_t Addr, uint32_t Old, uint32_t New);
+static void HostSim_CoreReset(void);
+static void HostSim_CoreWrite(uint32_t Addr, uint32_t Old, uint32_t New);
+static void HostSim_Step(uint64_t Cycles);
+static void HostSim_SysTickStep(uint64_t Cycles);
+static uint64_t HostSim_CyclesToNextEvent(void);
+static uint64_t HostSim_PendingIrqs(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+/**
+ * @brief   Map the register blocks and load the reset values
+ */
+void HostSim_Init(void)
+{
+    struct sigaction Action;
+    uint8_t Idx;
+
+    for (Idx = 0U; Idx < (uint8_t)(sizeof(HostSim_Windows) / sizeof(HostSim_Windows[0])); Idx++)
+    {
+        void* Base = mmap((void*)HostSim_Windows[Idx].Base, HostSim_Windows[Idx].Size,
+                          PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if (Base != (void*)HostSim_Windows[Idx].Base)
+        {
+            fprintf(stderr, "HostSim: cannot map 0x%08lx, link with -no-pie\n",
+                    (unsigned long)HostSim_Windows[Idx].Base);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    HostSim_Cycles = 0U;
+    HostSim_Primask = 0U;
+    HostSimPeriph_Reset();
+    HostSim_CoreReset();
+
+    memset(&Action, 0, sizeof(Action));
+    Action.sa_flags = SA_SIGINFO | SA_NODEFER;
+    Action.sa_sigaction = HostSim_SegvHandler;
+    (void)sigaction(SIGSEGV, &Action, NULL);
+    Action.sa_sigaction = HostSim_TrapHandler;
+    (void)sigaction(SIGTRAP, &Action, NULL);
+
+    HostSim_Lock();
+}
+
+/**
+ * @brief   Run the simulated clock
+ */
+void HostSim_Advance(uint64_t Cycles)
+{
+    uint64_t Step;
+
+    while (Cycles > 0U)
+    {
+        /* Stop on every event so interrupts are taken at the right time */
+        Step = HostSim_CyclesToNextEvent();
+        if (Step > Cycles)
+        {
+            Step = Cycles;
+        }
+
+        HostSim_Unlock();
+        HostSim_Step(Step);
+        HostSim_Lock();
+        Cycles -= Step;
+
+        HostSim_DeliverInterrupts();
+    }
+}
+
+/**
+ * @brief   Simulated time since HostSim_Init
+ */
+uint64_t HostSim_GetCycles(void)
+{
+    return HostSim_Cycles;
+}
+
+/**
+ * @brief   Stop the simulation once the clock reaches a limit
+ */
+void HostSim_SetStopTime(uint64_t Cycles, void (*StopFunc)(void))
+{
+    HostSim_StopCycles = Cycles;
+    HostSim_StopFunc = StopFunc;
+}
+
+/**
+ * @brief   Install a hook run after each register access
+ */
+void HostSim_SetAccessHook(HostSim_AccessHookType Hook)
+{
+    HostSim_AccessHook = Hook;
+}
+
+/**
+ * @brief   Host instructions executed by one call of a function
+ */
+uint64_t HostSim_CountInstructions(void (*Func)(void))
+{
+    uint64_t Steps = HostSim_CountSteps(Func);
+
+    return Steps - HostSim_CountSteps(HostSim_NoOperation);
+}
+
+/**
+ * @brief   Value of a register without triggering its read side effects
+ */
+uint32_t HostSim_PeekRegister(volatile const void* Addr)
+{
+    uint32_t Value;
+
+    HostSim_Unlock();
+    Value = HOSTSIM_REG((uintptr_t)Addr);
+    HostSim_Lock();
+
+    return Value;
+}
+
+/**
+ * @brief   Handler calls since HostSim_Init
+ */
+uint32_t HostSim_GetInterruptCount(IRQn_Type IRQn)
+{
+    if (IRQn == SysTick_IRQn)
+    {
+        return HostSim_IrqCount[63];
+    }
+
+    return ((IRQn >= 0) && (IRQn < 63)) ? HostSim_IrqCount[IRQn] : 0U;
+}
+
+/**
+ * @brief   Sleep until an enabled interrupt is pending
+ * @details Wakes on a pending interrupt even with PRIMASK set, as the core does.
+ *          The clock jumps from event to event while nothing is pending.
+ */
+void HostSim_WaitForInterrupt(void)
+{
+    uint64_t Step;
+
+    for (;;)
+    {
+        if (HostSim_Cycles >= HostSim_StopCycles)
+        {
+            HostSim_StopFunc();
+        }
+
+        if (HostSim_PendingIrqs() != 0U)
+        {
+            break;
+        }
+
+        Step = HostSim_CyclesToNextEvent();
+        if (Step == HOSTSIM_NO_EVENT)
+        {
+            if (HostSim_StopFunc == NULL)
+            {
+                fprintf(stderr, "HostSim: WFI with no interrupt source at cycle %llu\n",
+                        (unsigned long long)HostSim_Cycles);
+                abort();
+            }
+            Step = HostSim_StopCycles - HostSim_Cycles;
+        }
+        else if (Step > (HostSim_StopCycles - HostSim_Cycles))
+        {
+            Step = HostSim_StopCycles - HostSim_Cycles;
+        }
+
+        HostSim_Unlock();
+        HostSim_Step(Step);
+        HostSim_Lock();
+    }
+
+    HostSim_DeliverInterrupts();
+}
+
+/**
+ * @brief   Call the handlers of all pending and enabled interrupts
+ * @details No nesting: priorities are not modelled and a handler that clears
+ *          PRIMASK does not get preempted.
+ */
+void HostSim_DeliverInterrupts(void)
+{
+    uint64_t Pending;
+    uint32_t Chain = 0U;
+    uint8_t Irq;
+
+    if ((HostSim_Primask != 0U) || (HostSim_InHandler != 0U))
+    {
+        return;
+    }
+
+    HostSim_InHandler = 1U;
+    for (;;)
+    {
+        Pending = HostSim_PendingIrqs();
+        if (Pending == 0U)
+        {
+            break;
+        }
+
+        if (++Chain > HOSTSIM_MAX_TAIL_CHAIN)
+        {
+            fprintf(stderr, "HostSim: interrupt never cleared, pending 0x%016llx\n", (unsigned long long)Pending);
+            abort();
+        }
+
+        if (HostSim_SysTickPending != 0U)
+        {
+            HostSim_SysTickPending = 0U;
+            HostSim_IrqCount[63]++;
+            if (SysTick_Handler != NULL)
+            {
+                SysTick_Handler();
+            }
+            continue;
+        }
+
+        Irq = (uint8_t)__builtin_ctzll(Pending);
+        HostSim_IrqLatched &= ~(1ULL << Irq);
+        if (HostSim_Vectors[Irq] == NULL)
+        {
+            fprintf(stderr, "HostSim: IRQ %u enabled without a handler\n", Irq);
+            abort();
+        }
+        HostSim_IrqCount[Irq]++;
+        HostSim_Vectors[Irq]();
+    }
+    HostSim_InHandler = 0U;
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   Make every register access fault
+ */
+static void HostSim_Lock(void)
+{
+    uint8_t Idx;
+
+    for (Idx = 0U; Idx < (uint8_t)(sizeof(HostSim_Windows) / sizeof(HostSim_Windows[0])); Idx++)
+    {
+        (void)mprotect((void*)HostSim_Windows[Idx].Base, HostSim_Windows[Idx].Size, PROT_NONE);
+    }
+}
+
+/**
+ * @brief   Open the windows for the model itself
+ */
+static void HostSim_Unlock(void)
+{
+    uint8_t Idx;
+
+    for (Idx = 0U; Idx < (uint8_t)(sizeof(HostSim_Windows) / sizeof(HostSim_Windows[0])); Idx++)
+    {
+        (void)mprotect((void*)HostSim_Windows[Idx].Base, HostSim_Windows[Idx].Size, PROT_READ | PROT_WRITE);
+    }
+}
+
+static int HostSim_IsModelAddress(uintptr_t Addr)
+{
+    uint8_t Idx;
+
+    for (Idx = 0U; Idx < (uint8_t)(sizeof(HostSim_Windows) / sizeof(HostSim_Windows[0])); Idx++)
+    {
+        if ((Addr >= HostSim_Windows[Idx].Base) && (Addr < (HostSim_Windows[Idx].Base + HostSim_Windows[Idx].Size)))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief   Call Func between setting and clearing the trap flag
+ * @details The kernel clears the flag for the signal handlers, the model is not
+ *          counted. The pushf/popf pairs add a constant, removed by the caller.
+ */
+static uint64_t HostSim_CountSteps(void (*Func)(void))
+{
+    HostSim_Steps = 0U;
+    HostSim_Counting = 1;
+    __asm volatile ("pushfq\n\torq %0, (%%rsp)\n\tpopfq" :: "i" (HOSTSIM_EFLAGS_TF) : "memory", "cc");
+    Func();
+    __asm volatile ("pushfq\n\tandq %0, (%%rsp)\n\tpopfq" :: "i" ((int64_t)~HOSTSIM_EFLAGS_TF) : "memory", "cc");
+    HostSim_Counting = 0;
+
+    return HostSim_Steps;
+}
+
+/**
+ * @brief   Reference for HostSim_CountSteps, its call and return only
+ */
+static __attribute__((noinline)) void HostSim_NoOperation(void)
+{
+    __COMPILER_BARRIER();
+}
+
+/**
+ * @brief   First half of an access: open the windows and single-step the instruction
+ */
+static void HostSim_SegvHandler(int Signal, siginfo_t* Info, void* Context)
+{
+    ucontext_t* Uc = (ucontext_t*)Context;
+    uintptr_t Addr = (uintptr_t)Info->si_addr;
+
+    (void)Signal;
+
+    /* A real crash, or a fault inside the model: let the default action dump core */
+    if ((HostSim_IsModelAddress(Addr) == 0) || (HostSim_TrapActive != 0))
+    {
+        (void)signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+
+    HostSim_Unlock();
+    HostSim_Step(HOSTSIM_ACCESS_CYCLES);
+
+    HostSim_TrapAddr = (uint32_t)(Addr & ~(uintptr_t)3U);
+    HostSim_TrapWrite = ((Uc->uc_mcontext.gregs[REG_ERR] & HOSTSIM_PF_WRITE) != 0U) ? 1U : 0U;
+
+    /* Read-modify-write instructions fault as writes, refresh for them as well */
+    HostSim_BeforeRead(HostSim_TrapAddr);
+    HostSim_TrapOld = HOSTSIM_REG(HostSim_TrapAddr);
+
+    HostSim_TrapActive = 1;
+    Uc->uc_mcontext.gregs[REG_EFL] |= HOSTSIM_EFLAGS_TF;
+}
+
+/**
+ * @brief   Second half of an access: apply the side effects and close the windows
+ */
+static void HostSim_TrapHandler(int Signal, siginfo_t* Info, void* Context)
+{
+    ucontext_t* Uc = (ucontext_t*)Context;
+    uint32_t New;
+
+    (void)Signal;
+    (void)Info;
+
+    if (HostSim_Counting != 0)
+    {
+        HostSim_Steps++;
+    }
+
+    if (HostSim_TrapActive == 0)
+    {
+        if (HostSim_Counting == 0)
+        {
+            (void)signal(SIGTRAP, SIG_DFL);
+        }
+        return;
+    }
+
+    /* The access step is one of the counted ones, keep stepping after it */
+    if (HostSim_Counting == 0)
+    {
+        Uc->uc_mcontext.gregs[REG_EFL] &= ~HOSTSIM_EFLAGS_TF;
+    }
+
+    /* A store of the unchanged value still counts, e.g. rewriting a w1c bit */
+    New = HOSTSIM_REG(HostSim_TrapAddr);
+    if ((HostSim_TrapWrite != 0U) || (New != HostSim_TrapOld))
+    {
+        HostSim_Write(HostSim_TrapAddr, HostSim_TrapOld, New);
+    }
+    else
+    {
+        HostSim_AfterRead(HostSim_TrapAddr);
+    }
+
+    HostSim_TrapActive = 0;
+    HostSim_Lock();
+
+    /* The access is complete, the hook sees the registers as the next instruction would */
+    if ((HostSim_AccessHook != NULL) && (HostSim_InAccessHook == 0U))
+    {
+        HostSim_InAccessHook = 1U;
+        HostSim_AccessHook(HostSim_TrapAddr, HostSim_TrapWrite);
+        HostSim_InAccessHook = 0U;
+    }
+}
+
+static void HostSim_BeforeRead(uint32_t Addr)
+{
+    if (Addr >= HOSTSIM_CORE_BASE)
+    {
+        /* Pending state is kept outside the register */
+        if (Addr == HOSTSIM_ADDR(SCB->ICSR))
+        {
+            HOSTSIM_REG(Addr) = (HostSim_SysTickPending != 0U) ? SCB_ICSR_PENDSTSET_Msk : 0U;
+        }
+        return;
+    }
+    HostSimPeriph_BeforeRead(Addr);
+}
+
+static void HostSim_AfterRead(uint32_t Addr)
+{
+    if (Addr >= HOSTSIM_CORE_BASE)
+    {
+        if (Addr == HOSTSIM_ADDR(SysTick->CTRL))
+        {
+            HOSTSIM_REG(Addr) &= ~HOSTSIM_SYSTICK_COUNTFLAG;
+        }
+        return;
+    }
+    HostSimPeriph_AfterRead(Addr);
+}
+
+static void HostSim_Write(uint32_t Addr, uint32_t Old, uint32_t New)
+{
+    if (Addr >= HOSTSIM_CORE_BASE)
+    {
+        HostSim_CoreWrite(Addr, Old, New);
+        return;
+    }
+    HostSimPeriph_Write(Addr, Old, New);
+}
+
+/**
+ * @brief   Reset values of the SCS registers the drivers touch
+ */
+static void HostSim_CoreReset(void)
+{
+    HostSim_Unlock();
+    HOSTSIM_REG(HOSTSIM_ADDR(SCB->CPUID)) = 0x411FC231UL;      /* Cortex-M3 r1p1 */
+    HOSTSIM_REG(HOSTSIM_ADDR(SysTick->CALIB)) = 9000UL;        /* 1 ms at HCLK/8 = 9 MHz */
+    HostSim_Lock();
+
+    HostSim_IrqEnabled = 0U;
+    HostSim_IrqLatched = 0U;
+    HostSim_SysTickPending = 0U;
+    HostSim_SysTickResidual = 0U;
+    HostSim_InHandler = 0U;
+}
+
+/**
+ * @brief   Write side effects of SysTick, NVIC and SCB
+ */
+static void HostSim_CoreWrite(uint32_t Addr, uint32_t Old, uint32_t New)
+{
+    uint32_t Offset;
+    uint8_t Word;
+
+    if (Addr == HOSTSIM_ADDR(SysTick->CTRL))
+    {
+        /* COUNTFLAG is read-only */
+        HOSTSIM_REG(Addr) = (New & ~HOSTSIM_SYSTICK_COUNTFLAG) | (Old & HOSTSIM_SYSTICK_COUNTFLAG);
+        if (((Old & HOSTSIM_SYSTICK_ENABLE) == 0U) && ((New & HOSTSIM_SYSTICK_ENABLE) != 0U))
+        {
+            HostSim_SysTickResidual = 0U;
+        }
+    }
+    else if (Addr == HOSTSIM_ADDR(SysTick->VAL))
+    {
+        /* Any write clears the counter and COUNTFLAG */
+        HOSTSIM_REG(Addr) = 0U;
+        SysTick->CTRL &= ~HOSTSIM_SYSTICK_COUNTFLAG;
+    }
+    else if (Addr == HOSTSIM_ADDR(SCB->ICSR))
+    {
+        if ((New & SCB_ICSR_PENDSTSET_Msk) != 0U)
+        {
+            HostSim_SysTickPending = 1U;
+        }
+        if ((New & SCB_ICSR_PENDSTCLR_Msk) != 0U)
+        {
+            HostSim_SysTickPending = 0U;
+        }
+        HOSTSIM_REG(Addr) = 0U;
+    }
+    else if ((Addr >= HOSTSIM_ADDR(NVIC->ISER[0])) && (Addr < HOSTSIM_ADDR(NVIC->IP[0])))
+    {
+        Offset = Addr - HOSTSIM_ADDR(NVIC->ISER[0]);
+        Word = (uint8_t)((Offset & 0x7FU) >> 2);
+        if (Word >= 2U)
+        {
+            /* F103 has 43 lines, the upper words read as zero */
+            HOSTSIM_REG(Addr) = 0U;
+            return;
+        }
+
+        /* Set/clear pairs: ISER/ICER 0x000/0x080, ISPR/ICPR 0x100/0x180 */
+        switch (Offset & ~0x7FUL)
+        {
+            case 0x000U: HostSim_IrqEnabled |= ((uint64_t)New << (32U * Word));  break;
+            case 0x080U: HostSim_IrqEnabled &= ~((uint64_t)New << (32U * Word)); break;
+            case 0x100U: HostSim_IrqLatched |= ((uint64_t)New << (32U * Word));  break;
+            case 0x180U: HostSim_IrqLatched &= ~((uint64_t)New << (32U * Word)); break;
+            default:     HOSTSIM_REG(Addr) = Old; return;   /* IABR is read-only */
+        }
+
+        /* Both registers of a pair read back the state */
+        NVIC->ISER[Word] = (uint32_t)(HostSim_IrqEnabled >> (32U * Word));
+        NVIC->ICER[Word] = (uint32_t)(HostSim_IrqEnabled >> (32U * Word));
+        NVIC->ISPR[Word] = (uint32_t)(HostSim_IrqLatched >> (32U * Word));
+        NVIC->ICPR[Word] = (uint32_t)(HostSim_IrqLatched >> (32U * Word));
+    }
+    else
+    {
+        /* Priorities, VTOR, AIRCR, DWT, ...: plain storage */
+    }
+}
+
+/**
+ * @brief   Advance every block, windows open
+ */
+static void HostSim_Step(uint64_t Cycles)
+{
+    HostSim_Cycles += Cycles;
+    HostSim_SysTickStep(Cycles);
+    HostSimPeriph_Step(Cycles);
+}
+
+/**
+ * @brief   Count SysTick down, pend the exception on the 1 -> 0 transition
+ */
+static void HostSim_SysTickStep(uint64_t Cycles)
+{
+    uint32_t Ctrl = SysTick->CTRL;
+    uint32_t Divider = ((Ctrl & HOSTSIM_SYSTICK_CLKSOURCE) != 0U) ? 1U : 8U;
+    uint64_t Ticks;
+    uint32_t Val;
+
+    if ((Ctrl & HOSTSIM_SYSTICK_ENABLE) == 0U)
+    {
+        return;
+    }
+
+    Ticks = (HostSim_SysTickResidual + Cycles) / Divider;
+    HostSim_SysTickResidual = (uint32_t)((HostSim_SysTickResidual + Cycles) % Divider);
+
+    Val = SysTick->VAL;
+    while (Ticks > 0U)
+    {
+        if (Val == 0U)
+        {
+            /* Reload tick */
+            if (SysTick->LOAD == 0U)
+            {
+                break;
+            }
+            Val = SysTick->LOAD & SysTick_LOAD_RELOAD_Msk;
+            Ticks--;
+        }
+        else if (Ticks < Val)
+        {
+            Val -= (uint32_t)Ticks;
+            Ticks = 0U;
+        }
+        else
+        {
+            Ticks -= Val;
+            Val = 0U;
+            SysTick->CTRL |= HOSTSIM_SYSTICK_COUNTFLAG;
+            if ((Ctrl & HOSTSIM_SYSTICK_TICKINT) != 0U)
+            {
+                HostSim_SysTickPending = 1U;
+            }
+        }
+    }
+    SysTick->VAL = Val;
+}
+
+/**
+ * @brief   Cycles until SysTick or a peripheral does something observable
+ */
+static uint64_t HostSim_CyclesToNextEvent(void)
+{
+    uint64_t Next;
+    uint64_t SysTickNext = HOSTSIM_NO_EVENT;
+    uint32_t Ctrl;
+    uint32_t Divider;
+    uint64_t Ticks;
+
+    HostSim_Unlock();
+    Next = HostSimPeriph_CyclesToNextEvent();
+
+    Ctrl = SysTick->CTRL;
+    if (((Ctrl & HOSTSIM_SYSTICK_ENABLE) != 0U) && ((Ctrl & HOSTSIM_SYSTICK_TICKINT) != 0U) && (SysTick->LOAD != 0U))
+    {
+        Divider = ((Ctrl & HOSTSIM_SYSTICK_CLKSOURCE) != 0U) ? 1U : 8U;
+        Ticks = (SysTick->VAL != 0U) ? SysTick->VAL : ((uint64_t)SysTick->LOAD + 1U);
+        SysTickNext = (Ticks * Divider) - HostSim_SysTickResidual;
+    }
+    HostSim_Lock();
+
+    if (SysTickNext < Next)
+    {
+        Next = SysTickNext;
+    }
+    return (Next == 0U) ? 1U : Next;
+}
+
+/**
+ * @brief   Enabled interrupts that are requested or latched, SysTick as bit 63
+ */
+static uint64_t HostSim_PendingIrqs(void)
+{
+    uint64_t Lines;
+
+    HostSim_Unlock();
+    Lines = HostSimPeriph_GetIrqLines();
+    HostSim_Lock();
+
+    return ((Lines | HostSim_IrqLatched) & HostSim_IrqEnabled) |
+           ((HostSim_SysTickPending != 0U) ? (1ULL << 63) : 0U);
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -0,0 +1,158 @@
+/****************************************************************************************
+*                                HOSTSIM.H                                              *
+****************************************************************************************
+* File Name   : HostSim.h
+* Module      : Host Simulation (HOSTSIM)
+* Description : Behavioural STM32F103 peripheral model for the host build
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+#ifndef HOSTSIM_H
+#define HOSTSIM_H
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "stm32f10x.h"
+
+/****************************************************************************************
+*                                 CONFIGURATION                                        *
+****************************************************************************************/
+#define HOSTSIM_ACCESS_CYCLES       2U      /*!< HCLK cycles charged per register access */
+#define HOSTSIM_NBR_OF_ANALOG_INPUTS 18U    /*!< ADC channels 0..17 */
+
+/****************************************************************************************
+*                                 TYPE DEFINITIONS                                     *
+****************************************************************************************/
+/**
+ * @brief   Level of an ADC channel at the end of one conversion
+ * @details Called by the model with the register windows open, it must not access
+ *          peripheral registers.
+ * @param[in] Channel ADC channel 0..17
+ * @param[in] Cycles Simulated time of the conversion in HCLK cycles
+ * @return  Raw 12-bit conversion result
+ */
+typedef uint16_t (*HostSim_AnalogSourceType)(uint8_t Channel, uint64_t Cycles);
+
+/**
+ * @brief   Called after every register access of the program, like an interrupt
+ *          taken between two instructions
+ * @details Register accesses of the hook itself are trapped as usual and do not
+ *          call it again.
+ * @param[in] Addr Word address of the register
+ * @param[in] Write 1 for a store or a read-modify-write instruction, 0 for a load
+ * @return  void
+ */
+typedef void (*HostSim_AccessHookType)(uint32_t Addr, uint8_t Write);
+
+/****************************************************************************************
+*                                 FUNCTION PROTOTYPES                                  *
+****************************************************************************************/
+/**
+ * @brief   Map the register blocks and load the reset values
+ * @details The peripheral, bit-band and core windows are mapped at their real
+ *          addresses and kept inaccessible. Every load or store traps into the
+ *          model, which applies the side effects of the register (write-1-to-clear
+ *          flags, BSRR, conversion start, ...). Must run before any driver code.
+ * @return  void
+ */
+void HostSim_Init(void);
+
+/**
+ * @brief   Run the simulated clock
+ * @details Counts the timers, converts, transfers and raises interrupts, which are
+ *          delivered here when PRIMASK is clear. Thread context only.
+ * @param[in] Cycles HCLK cycles to advance
+ * @return  void
+ */
+void HostSim_Advance(uint64_t Cycles);
+
+/**
+ * @brief   Simulated time since HostSim_Init
+ * @return  HCLK cycles
+ */
+uint64_t HostSim_GetCycles(void);
+
+/**
+ * @brief   Stop the simulation once the clock reaches a limit
+ * @details Checked while the core sleeps in WFI. The callback either ends the
+ *          process or sets a later limit with HostSim_SetStopTime and returns.
+ * @param[in] Cycles Limit in HCLK cycles
+ * @param[in] StopFunc Called on the limit, e.g. to print results and exit
+ * @return  void
+ */
+void HostSim_SetStopTime(uint64_t Cycles, void (*StopFunc)(void));
+
+/**
+ * @brief   Install a hook run after each register access, e.g. to interleave an ISR
+ * @param[in] Hook Called once per access, NULL to remove it
+ * @return  void
+ */
+void HostSim_SetAccessHook(HostSim_AccessHookType Hook);
+
+/**
+ * @brief   Host instructions executed by one call of a function
+ * @details Runs Func with the x86 trap flag set and counts the single steps, the
+ *          call and return of an empty function are subtracted. Instructions of the
+ *          model and of interrupt handlers are not counted. x86-64 code of the host
+ *          compiler, a relative measure between paths built with the same flags.
+ * @param[in] Func Code to measure, called once
+ * @return  Instructions executed
+ */
+uint64_t HostSim_CountInstructions(void (*Func)(void));
+
+/**
+ * @brief   Voltage seen by an ADC channel
+ * @param[in] Channel ADC channel 0..17
+ * @param[in] Value Raw 12-bit conversion result
+ * @return  void
+ */
+void HostSim_SetAnalogInput(uint8_t Channel, uint16_t Value);
+
+/**
+ * @brief   Per conversion source for every ADC channel, e.g. a ramp or noise
+ * @details Replaces the levels of HostSim_SetAnalogInput while set.
+ * @param[in] Source Called once per channel conversion, NULL to go back to the levels
+ * @return  void
+ */
+void HostSim_SetAnalogSource(HostSim_AnalogSourceType Source);
+
+/**
+ * @brief   Level driven on an input pin from outside
+ * @param[in] GPIOx Port
+ * @param[in] Pin Pin number 0..15
+ * @param[in] Level 0 or 1
+ * @return  void
+ */
+void HostSim_SetPinInput(GPIO_TypeDef* GPIOx, uint8_t Pin, uint8_t Level);
+
+/**
+ * @brief   Value of a register without triggering its read side effects
+ * @param[in] Addr Register address
+ * @return  Register content
+ */
+uint32_t HostSim_PeekRegister(volatile const void* Addr);
+
+/**
+ * @brief   Handler calls since HostSim_Init
+ * @param[in] IRQn Device interrupt or SysTick_IRQn
+ * @return  Number of times the handler was entered
+ */
+uint32_t HostSim_GetInterruptCount(IRQn_Type IRQn);
+
+/**
+ * @brief   Finished channel conversions since HostSim_Init
+ * @details Regular and injected, not cleared by an ADC reset through RCC.
+ * @param[in] ADCx ADC1 or ADC2
+ * @return  Conversion count
+ */
+uint32_t HostSim_GetConversionCount(const ADC_TypeDef* ADCx);
+
+#endif /* HOSTSIM_H */
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
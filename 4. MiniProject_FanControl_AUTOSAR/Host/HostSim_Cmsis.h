@@ -0,0 +1,181 @@
+/****************************************************************************************
+*                                HOSTSIM_CMSIS.H                                        *
+****************************************************************************************
+* File Name   : HostSim_Cmsis.h
+* Module      : Host Simulation (HOSTSIM)
+* Description : Host replacement for the cmsis_gcc.h core intrinsics
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * Force-included in front of every host translation unit (-include). Defining the
+ * cmsis_gcc.h guard keeps the Thumb inline assembly out, core_cm3.h then picks up
+ * the functions below. PRIMASK and WFI are routed to the simulated core.
+ */
+
+#ifndef HOSTSIM_CMSIS_H
+#define HOSTSIM_CMSIS_H
+
+#if !defined(HOST_BUILD)
+#error "HostSim_Cmsis.h is only for the host build"
+#endif
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdint.h>
+
+/* Skip Core/cmsis_gcc.h */
+#define __CMSIS_GCC_H
+
+/****************************************************************************************
+*                              COMPILER ABSTRACTION                                    *
+****************************************************************************************/
+#define __ASM                       __asm
+#define __INLINE                    inline
+#define __STATIC_INLINE             static inline
+#define __STATIC_FORCEINLINE        __attribute__((always_inline)) static inline
+#define __NO_RETURN                 __attribute__((__noreturn__))
+#define __USED                      __attribute__((used))
+#define __WEAK                      __attribute__((weak))
+#define __PACKED                    __attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT             struct __attribute__((packed, aligned(1)))
+#define __PACKED_UNION              union __attribute__((packed, aligned(1)))
+#define __ALIGNED(x)                __attribute__((aligned(x)))
+#define __RESTRICT                  __restrict
+#define __COMPILER_BARRIER()        __asm volatile("" ::: "memory")
+
+/****************************************************************************************
+*                              SIMULATED CORE                                          *
+****************************************************************************************/
+extern volatile uint32_t HostSim_Primask;          /*!< 1 while interrupts are masked */
+
+void HostSim_WaitForInterrupt(void);
+void HostSim_DeliverInterrupts(void);
+
+/****************************************************************************************
+*                              CORE REGISTER ACCESS                                    *
+****************************************************************************************/
+__STATIC_FORCEINLINE void __enable_irq(void)
+{
+    HostSim_Primask = 0U;
+    HostSim_DeliverInterrupts();
+}
+
+__STATIC_FORCEINLINE void __disable_irq(void)
+{
+    HostSim_Primask = 1U;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void)
+{
+    return HostSim_Primask;
+}
+
+__STATIC_FORCEINLINE void __set_PRIMASK(uint32_t priMask)
+{
+    HostSim_Primask = priMask & 1U;
+    if (HostSim_Primask == 0U)
+    {
+        HostSim_DeliverInterrupts();
+    }
+}
+
+/****************************************************************************************
+*                              CPU INSTRUCTIONS                                        *
+****************************************************************************************/
+#define __NOP()                     __asm volatile ("nop")
+#define __WFI()                     HostSim_WaitForInterrupt()
+#define __WFE()                     HostSim_WaitForInterrupt()
+#define __SEV()                     do { } while (0)
+#define __BKPT(value)               __builtin_trap()
+
+__STATIC_FORCEINLINE void __ISB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+__STATIC_FORCEINLINE void __DSB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+__STATIC_FORCEINLINE void __DMB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+__STATIC_FORCEINLINE uint32_t __REV(uint32_t value)
+{
+    return __builtin_bswap32(value);
+}
+
+__STATIC_FORCEINLINE uint32_t __REV16(uint32_t value)
+{
+    return ((value & 0xFF00FF00UL) >> 8) | ((value & 0x00FF00FFUL) << 8);
+}
+
+__STATIC_FORCEINLINE int16_t __REVSH(int16_t value)
+{
+    return (int16_t)__builtin_bswap16((uint16_t)value);
+}
+
+__STATIC_FORCEINLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+    op2 %= 32U;
+    return (op2 == 0U) ? op1 : ((op1 >> op2) | (op1 << (32U - op2)));
+}
+
+__STATIC_FORCEINLINE uint32_t __RBIT(uint32_t value)
+{
+    uint32_t result = 0U;
+    uint32_t bit;
+
+    for (bit = 0U; bit < 32U; bit++)
+    {
+        result = (result << 1) | ((value >> bit) & 1U);
+    }
+    return result;
+}
+
+/* CLZ of 0 is 32 on the core, __builtin_clz(0) is undefined */
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t value)
+{
+    return (value == 0U) ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+/* Single host thread, interrupts only run between statements: the store always succeeds */
+__STATIC_FORCEINLINE uint32_t __LDREXW(volatile uint32_t *addr)
+{
+    return *addr;
+}
+
+__STATIC_FORCEINLINE uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+    *addr = value;
+    return 0U;
+}
+
+__STATIC_FORCEINLINE uint8_t __LDREXB(volatile uint8_t *addr)
+{
+    return *addr;
+}
+
+__STATIC_FORCEINLINE uint32_t __STREXB(uint8_t value, volatile uint8_t *addr)
+{
+    *addr = value;
+    return 0U;
+}
+
+__STATIC_FORCEINLINE void __CLREX(void)
+{
+}
+
+#endif /* HOSTSIM_CMSIS_H */
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -0,0 +1,114 @@
+/****************************************************************************************
+*                                HOSTSIM_MAIN.C                                         *
+****************************************************************************************
+* File Name   : HostSim_Main.c
+* Module      : Host Simulation (HOSTSIM)
+* Description : Host entry point, runs the fan application on the simulated MCU
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * Usage: FanControl_host [time_ms] [pa0_raw]
+ *   time_ms  Simulated run time, default 1000
+ *   pa0_raw  12-bit ADC value on PA0 (temperature sensor), default 0
+ * The application main() is built as HostSim_AppMain. When the simulated clock
+ * reaches time_ms the fan and LED outputs, the probe table and the DET entries
+ * are printed.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "HostSim.h"
+#include "Prof.h"
+#include "Det.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define HOSTSIM_DEFAULT_TIME_MS     1000UL
+#define HOSTSIM_TEMP_CHANNEL        0U      /*!< PA0, ADC12_IN0 */
+#define HOSTSIM_LED_PIN             13U     /*!< PC13 */
+#define HOSTSIM_DET_DRAIN_SIZE      8U
+
+/****************************************************************************************
+*                              EXTERNAL FUNCTIONS                                      *
+****************************************************************************************/
+int HostSim_AppMain(void);
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void HostSim_WriteText(const char* Text);
+static void HostSim_Report(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(int argc, char** argv)
+{
+    unsigned long TimeMs = (argc > 1) ? strtoul(argv[1], NULL, 0) : HOSTSIM_DEFAULT_TIME_MS;
+    unsigned long Raw = (argc > 2) ? strtoul(argv[2], NULL, 0) : 0UL;
+
+    HostSim_Init();
+    HostSim_SetAnalogInput(HOSTSIM_TEMP_CHANNEL, (uint16_t)Raw);
+    HostSim_SetStopTime((uint64_t)TimeMs * (SystemCoreClock / 1000U), HostSim_Report);
+
+    /* Same entry as Reset_Handler, which does not call SystemInit either */
+    (void)HostSim_AppMain();
+
+    HostSim_Report();
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+static void HostSim_WriteText(const char* Text)
+{
+    (void)fputs(Text, stdout);
+}
+
+/**
+ * @brief   Print the outputs and diagnostics, then end the process
+ */
+static void HostSim_Report(void)
+{
+    Det_ErrorEntryType Entries[HOSTSIM_DET_DRAIN_SIZE];
+    uint32_t Arr = HostSim_PeekRegister(&TIM1->ARR) & 0xFFFFU;
+    uint32_t Ccr = HostSim_PeekRegister(&TIM1->CCR1) & 0xFFFFU;
+    uint32_t Odr = HostSim_PeekRegister(&GPIOC->ODR);
+    uint8 Count;
+    uint8 Idx;
+
+    printf("time_ms,%llu\n", (unsigned long long)(HostSim_GetCycles() / (SystemCoreClock / 1000U)));
+    printf("fan_duty_permille,%lu\n", (unsigned long)((Ccr * 1000UL) / (Arr + 1UL)));
+    printf("led,%u\n", (unsigned)((Odr >> HOSTSIM_LED_PIN) & 1U));
+
+    Prof_Dump(HostSim_WriteText);
+
+    printf("det_module,instance,api,error,kind\n");
+    do
+    {
+        Count = Det_Drain(Entries, HOSTSIM_DET_DRAIN_SIZE);
+        for (Idx = 0U; Idx < Count; Idx++)
+        {
+            printf("%u,%u,%u,%u,%u\n", Entries[Idx].ModuleId, Entries[Idx].InstanceId,
+                   Entries[Idx].ApiId, Entries[Idx].ErrorId, Entries[Idx].Kind);
+        }
+    } while (Count == HOSTSIM_DET_DRAIN_SIZE);
+    printf("det_overflow,%lu\n", (unsigned long)Det_GetOverflowCount());
+
+    (void)fflush(stdout);
+    exit(EXIT_SUCCESS);
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -0,0 +1,1243 @@
+/****************************************************************************************
+*                                HOSTSIM_PERIPH.C                                       *
+****************************************************************************************
+* File Name   : HostSim_Periph.c
+* Module      : Host Simulation (HOSTSIM)
+* Description : Behavioural RCC, GPIO, TIM1-TIM4, ADC1/ADC2 and DMA1 model
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * Registers live in the mapped windows, the model keeps only what the hardware
+ * hides (prescaler phase, conversion progress, DMA shadow pointers). Timing is
+ * in HCLK cycles with the RCC bus prescalers applied.
+ *
+ * Modelled: RCC ready flags and peripheral resets, GPIO ODR/IDR/BSRR/BRR and the
+ * bit-band alias, up-counting timers with compare events, update flags and TRGO,
+ * regular and injected conversions with sample times, scan, continuous mode,
+ * external triggers, analog watchdog and regular simultaneous dual mode, DMA1
+ * channels with circular mode and TC/HT flags.
+ * Not modelled: clock gating, preload shadow registers, down/center counting,
+ * repetition counter, timer outputs and input capture, EXTI, DMA arbitration.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <string.h>
+
+#include "HostSim_Periph.h"
+#include "stm32f10x_rcc.h"
+#include "Adc_Timing.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define HOSTSIM_NBR_OF_GPIO         5U      /*!< GPIOA..GPIOE */
+#define HOSTSIM_NBR_OF_TIM          4U      /*!< TIM1..TIM4 */
+#define HOSTSIM_NBR_OF_ADC          2U      /*!< ADC1, ADC2 */
+#define HOSTSIM_NBR_OF_DMA_CH       7U      /*!< DMA1 channel 1..7 */
+
+#define HOSTSIM_BB_WINDOW_SIZE      0x00030000UL    /*!< Peripheral bytes covered by the alias */
+#define HOSTSIM_DMA_CH_STRIDE       0x14UL
+#define HOSTSIM_DMA_IRQ_FLAGS       0x0EUL  /*!< TCIF/HTIF/TEIF, same positions as TCIE/HTIE/TEIE */
+#define HOSTSIM_TIM_IRQ_FLAGS       0x5FUL  /*!< UIF, CC1IF..CC4IF, TIF */
+#define HOSTSIM_TIM_CC_FLAGS        0x1EUL
+
+#define HOSTSIM_EXTSEL_SWSTART      7U      /*!< EXTSEL/JEXTSEL value for the software trigger */
+#define HOSTSIM_NO_TIMER            0xFFU
+
+#define HOSTSIM_REG(Addr)           (*(volatile uint32_t*)(uintptr_t)(Addr))
+#define HOSTSIM_ADDR(Reg)           ((uint32_t)(uintptr_t)&(Reg))
+#define HOSTSIM_IN_BLOCK(Addr, Block) \
+    (((Addr) >= (uint32_t)(uintptr_t)(Block)) && ((Addr) < ((uint32_t)(uintptr_t)(Block) + sizeof(*(Block)))))
+
+/****************************************************************************************
+*                              LOCAL TYPES                                             *
+****************************************************************************************/
+/**
+ * @brief Timer events, TRGO and CCx are also ADC trigger sources
+ */
+typedef enum
+{
+    HOSTSIM_TIM_EVT_UPDATE = 0,
+    HOSTSIM_TIM_EVT_TRGO,
+    HOSTSIM_TIM_EVT_CC1,
+    HOSTSIM_TIM_EVT_CC2,
+    HOSTSIM_TIM_EVT_CC3,
+    HOSTSIM_TIM_EVT_CC4
+} HostSim_TimEventType;
+
+/**
+ * @brief One input of the EXTSEL/JEXTSEL multiplexer
+ */
+typedef struct
+{
+    uint8_t Tim;                        /*!< Index in HostSimPeriph_Tims, HOSTSIM_NO_TIMER for EXTI/SWSTART */
+    uint8_t Event;                      /*!< HostSim_TimEventType */
+} HostSim_TriggerType;
+
+typedef struct
+{
+    uint32_t Residual;                  /*!< HCLK cycles into the current counter tick */
+} HostSim_TimStateType;
+
+typedef struct
+{
+    uint8_t  RegBusy;                   /*!< Regular sequence running */
+    uint8_t  RegIdx;                    /*!< Rank being converted */
+    uint8_t  InjBusy;                   /*!< Injected sequence running, preempts the regular one */
+    uint8_t  InjIdx;
+    uint64_t Remaining;                 /*!< HCLK cycles left in the current conversion */
+} HostSim_AdcStateType;
+
+typedef struct
+{
+    uint16_t Count;                     /*!< CNDTR when the channel was enabled */
+    uint16_t Done;                      /*!< Transfers since the last reload */
+    uint32_t PeriphAddr;                /*!< CPAR/CMAR shadows latched on enable */
+    uint32_t MemAddr;
+} HostSim_DmaStateType;
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static GPIO_TypeDef* const HostSimPeriph_Gpios[HOSTSIM_NBR_OF_GPIO] = { GPIOA, GPIOB, GPIOC, GPIOD, GPIOE };
+static TIM_TypeDef* const HostSimPeriph_Tims[HOSTSIM_NBR_OF_TIM] = { TIM1, TIM2, TIM3, TIM4 };
+static ADC_TypeDef* const HostSimPeriph_Adcs[HOSTSIM_NBR_OF_ADC] = { ADC1, ADC2 };
+static DMA_Channel_TypeDef* const HostSimPeriph_DmaChannels[HOSTSIM_NBR_OF_DMA_CH] =
+{
+    DMA1_Channel1, DMA1_Channel2, DMA1_Channel3, DMA1_Channel4,
+    DMA1_Channel5, DMA1_Channel6, DMA1_Channel7
+};
+
+/* ADC1/ADC2 regular trigger multiplexer, RM0008 table 69 */
+static const HostSim_TriggerType HostSimPeriph_RegularTriggers[8] =
+{
+    { 0U, HOSTSIM_TIM_EVT_CC1 },  { 0U, HOSTSIM_TIM_EVT_CC2 },  { 0U, HOSTSIM_TIM_EVT_CC3 },
+    { 1U, HOSTSIM_TIM_EVT_CC2 },  { 2U, HOSTSIM_TIM_EVT_TRGO }, { 3U, HOSTSIM_TIM_EVT_CC4 },
+    { HOSTSIM_NO_TIMER, 0U },     { HOSTSIM_NO_TIMER, 0U }
+};
+
+/* ADC1/ADC2 injected trigger multiplexer, RM0008 table 70 */
+static const HostSim_TriggerType HostSimPeriph_InjectedTriggers[8] =
+{
+    { 0U, HOSTSIM_TIM_EVT_TRGO }, { 0U, HOSTSIM_TIM_EVT_CC4 },  { 1U, HOSTSIM_TIM_EVT_TRGO },
+    { 1U, HOSTSIM_TIM_EVT_CC1 },  { 2U, HOSTSIM_TIM_EVT_CC4 },  { 3U, HOSTSIM_TIM_EVT_TRGO },
+    { HOSTSIM_NO_TIMER, 0U },     { HOSTSIM_NO_TIMER, 0U }
+};
+
+/* Sample time + 12.5 ADCCLK conversion, indexed by the SMPx code */
+
+static HostSim_TimStateType HostSimPeriph_TimStates[HOSTSIM_NBR_OF_TIM];
+static HostSim_AdcStateType HostSimPeriph_AdcStates[HOSTSIM_NBR_OF_ADC];
+static uint32_t HostSimPeriph_AdcConversions[HOSTSIM_NBR_OF_ADC];   /*!< Survives ADC resets */
+static HostSim_DmaStateType HostSimPeriph_DmaStates[HOSTSIM_NBR_OF_DMA_CH];
+
+static uint16_t HostSimPeriph_PinInputs[HOSTSIM_NBR_OF_GPIO];
+static uint16_t HostSimPeriph_AnalogInputs[HOSTSIM_NBR_OF_ANALOG_INPUTS];
+static HostSim_AnalogSourceType HostSimPeriph_AnalogSource;
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static uint32_t HostSimPeriph_BitBandTarget(uint32_t Addr, uint8_t* Bit);
+static uint32_t HostSimPeriph_ApbDivider(uint8_t Shift);
+static void HostSimPeriph_ResetGpio(uint8_t Idx);
+static void HostSimPeriph_ResetTim(uint8_t Idx);
+static void HostSimPeriph_ResetAdc(uint8_t Idx);
+static void HostSimPeriph_ResetBlocks(uint32_t Apb2Mask, uint32_t Apb1Mask);
+static void HostSimPeriph_RccWrite(uint32_t Addr, uint32_t Old, uint32_t New);
+static void HostSimPeriph_GpioWrite(GPIO_TypeDef* GPIOx, uint32_t Addr, uint32_t Old, uint32_t New);
+static void HostSimPeriph_TimWrite(uint8_t Idx, uint32_t Addr, uint32_t Old, uint32_t New);
+static void HostSimPeriph_AdcWrite(uint8_t Idx, uint32_t Addr, uint32_t Old, uint32_t New);
+static void HostSimPeriph_DmaWrite(uint32_t Addr, uint32_t Old, uint32_t New);
+static uint32_t HostSimPeriph_TimCyclesPerTick(uint8_t Idx);
+static uint32_t HostSimPeriph_TimTicksToEvent(const TIM_TypeDef* TIMx, uint32_t Cnt, uint32_t Arr);
+static void HostSimPeriph_TimStep(uint8_t Idx, uint64_t Cycles);
+static void HostSimPeriph_TimEvent(uint8_t Idx, HostSim_TimEventType Event);
+static uint8_t HostSimPeriph_TimObserved(uint8_t Idx);
+static uint8_t HostSimPeriph_AdcRegularChannel(const ADC_TypeDef* ADCx, uint8_t Rank);
+static uint8_t HostSimPeriph_AdcInjectedChannel(const ADC_TypeDef* ADCx, uint8_t Idx);
+static uint64_t HostSimPeriph_AdcConversionCycles(const ADC_TypeDef* ADCx, uint8_t Channel);
+static uint8_t HostSimPeriph_AdcIsDualRegular(void);
+static uint16_t HostSimPeriph_AdcSample(uint8_t Channel);
+static void HostSimPeriph_AdcStartRegular(uint8_t Idx);
+static void HostSimPeriph_AdcStartInjected(uint8_t Idx);
+static void HostSimPeriph_AdcWatchdog(ADC_TypeDef* ADCx, uint8_t Channel, uint16_t Raw, uint32_t EnableBit);
+static void HostSimPeriph_AdcComplete(uint8_t Idx);
+static void HostSimPeriph_AdcStep(uint8_t Idx, uint64_t Cycles);
+static void HostSimPeriph_DmaRequest(uint8_t Channel);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+/**
+ * @brief   Voltage seen by an ADC channel
+ */
+void HostSim_SetAnalogInput(uint8_t Channel, uint16_t Value)
+{
+    if (Channel < HOSTSIM_NBR_OF_ANALOG_INPUTS)
+    {
+        HostSimPeriph_AnalogInputs[Channel] = Value & 0x0FFFU;
+    }
+}
+
+/**
+ * @brief   Per conversion source for every ADC channel
+ */
+void HostSim_SetAnalogSource(HostSim_AnalogSourceType Source)
+{
+    HostSimPeriph_AnalogSource = Source;
+}
+
+/**
+ * @brief   Level driven on an input pin from outside
+ */
+void HostSim_SetPinInput(GPIO_TypeDef* GPIOx, uint8_t Pin, uint8_t Level)
+{
+    uint8_t Idx;
+
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_GPIO; Idx++)
+    {
+        if ((HostSimPeriph_Gpios[Idx] == GPIOx) && (Pin < 16U))
+        {
+            if (Level != 0U)
+            {
+                HostSimPeriph_PinInputs[Idx] |= (uint16_t)(1U << Pin);
+            }
+            else
+            {
+                HostSimPeriph_PinInputs[Idx] &= (uint16_t)~(1U << Pin);
+            }
+        }
+    }
+}
+
+/**
+ * @brief   Finished channel conversions since HostSim_Init
+ */
+uint32_t HostSim_GetConversionCount(const ADC_TypeDef* ADCx)
+{
+    uint8_t Idx;
+
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_ADC; Idx++)
+    {
+        if (HostSimPeriph_Adcs[Idx] == ADCx)
+        {
+            return HostSimPeriph_AdcConversions[Idx];
+        }
+    }
+
+    return 0U;
+}
+
+/**
+ * @brief   Load reset values into every block and clear the model state
+ */
+void HostSimPeriph_Reset(void)
+{
+    uint8_t Idx;
+
+    memset((void*)(uintptr_t)PERIPH_BASE, 0, HOSTSIM_BB_WINDOW_SIZE);
+    memset((void*)(uintptr_t)PERIPH_BB_BASE, 0, HOSTSIM_BB_WINDOW_SIZE * 32U);
+
+    RCC->CR = RCC_CR_HSION | RCC_CR_HSIRDY | 0x80U;     /* HSITRIM = 16 */
+    FLASH->ACR = 0x30U;
+
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_GPIO; Idx++)
+    {
+        HostSimPeriph_ResetGpio(Idx);
+    }
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_TIM; Idx++)
+    {
+        HostSimPeriph_ResetTim(Idx);
+    }
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_ADC; Idx++)
+    {
+        HostSimPeriph_ResetAdc(Idx);
+    }
+    memset(HostSimPeriph_DmaStates, 0, sizeof(HostSimPeriph_DmaStates));
+    memset(HostSimPeriph_AdcConversions, 0, sizeof(HostSimPeriph_AdcConversions));
+}
+
+/**
+ * @brief   Refresh a register whose content is computed, before it is read
+ */
+void HostSimPeriph_BeforeRead(uint32_t Addr)
+{
+    GPIO_TypeDef* GPIOx;
+    uint32_t Target;
+    uint32_t Outputs = 0U;
+    uint8_t Bit;
+    uint8_t Idx;
+
+    if (Addr >= PERIPH_BB_BASE)
+    {
+        Target = HostSimPeriph_BitBandTarget(Addr, &Bit);
+        HostSimPeriph_BeforeRead(Target);
+        HOSTSIM_REG(Addr) = (HOSTSIM_REG(Target) >> Bit) & 1U;
+        return;
+    }
+
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_GPIO; Idx++)
+    {
+        GPIOx = HostSimPeriph_Gpios[Idx];
+        if (Addr == HOSTSIM_ADDR(GPIOx->IDR))
+        {
+            /* Output pins read back ODR, the others the external level */
+            for (Bit = 0U; Bit < 16U; Bit++)
+            {
+                uint32_t Cr = (Bit < 8U) ? GPIOx->CRL : GPIOx->CRH;
+                if (((Cr >> ((Bit & 7U) * 4U)) & 0x3U) != 0U)
+                {
+                    Outputs |= (1UL << Bit);
+                }
+            }
+            GPIOx->IDR = (GPIOx->ODR & Outputs) | (HostSimPeriph_PinInputs[Idx] & ~Outputs & 0xFFFFU);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief   Apply read side effects
+ */
+void HostSimPeriph_AfterRead(uint32_t Addr)
+{
+    uint8_t Bit;
+    uint8_t Idx;
+
+    if (Addr >= PERIPH_BB_BASE)
+    {
+        HostSimPeriph_AfterRead(HostSimPeriph_BitBandTarget(Addr, &Bit));
+        return;
+    }
+
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_ADC; Idx++)
+    {
+        if (Addr == HOSTSIM_ADDR(HostSimPeriph_Adcs[Idx]->DR))
+        {
+            HostSimPeriph_Adcs[Idx]->SR &= ~ADC_SR_EOC;
+        }
+    }
+}
+
+/**
+ * @brief   Apply write side effects
+ */
+void HostSimPeriph_Write(uint32_t Addr, uint32_t Old, uint32_t New)
+{
+    uint32_t Target;
+    uint32_t TargetOld;
+    uint32_t TargetNew;
+    uint8_t Bit;
+    uint8_t Idx;
+
+    if (Addr >= PERIPH_BB_BASE)
+    {
+        /* The alias store is a read-modify-write of the target word on the bus */
+        Target = HostSimPeriph_BitBandTarget(Addr, &Bit);
+        HostSimPeriph_BeforeRead(Target);
+        TargetOld = HOSTSIM_REG(Target);
+        TargetNew = ((New & 1U) != 0U) ? (TargetOld | (1UL << Bit)) : (TargetOld & ~(1UL << Bit));
+        HOSTSIM_REG(Target) = TargetNew;
+        HostSimPeriph_Write(Target, TargetOld, TargetNew);
+        HOSTSIM_REG(Addr) = (HOSTSIM_REG(Target) >> Bit) & 1U;
+        return;
+    }
+
+    if (HOSTSIM_IN_BLOCK(Addr, RCC))
+    {
+        HostSimPeriph_RccWrite(Addr, Old, New);
+        return;
+    }
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_GPIO; Idx++)
+    {
+        if (HOSTSIM_IN_BLOCK(Addr, HostSimPeriph_Gpios[Idx]))
+        {
+            HostSimPeriph_GpioWrite(HostSimPeriph_Gpios[Idx], Addr, Old, New);
+            return;
+        }
+    }
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_TIM; Idx++)
+    {
+        if (HOSTSIM_IN_BLOCK(Addr, HostSimPeriph_Tims[Idx]))
+        {
+            HostSimPeriph_TimWrite(Idx, Addr, Old, New);
+            return;
+        }
+    }
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_ADC; Idx++)
+    {
+        if (HOSTSIM_IN_BLOCK(Addr, HostSimPeriph_Adcs[Idx]))
+        {
+            HostSimPeriph_AdcWrite(Idx, Addr, Old, New);
+            return;
+        }
+    }
+    if ((Addr >= DMA1_BASE) && (Addr < (DMA1_Channel1_BASE + (HOSTSIM_NBR_OF_DMA_CH * HOSTSIM_DMA_CH_STRIDE))))
+    {
+        HostSimPeriph_DmaWrite(Addr, Old, New);
+        return;
+    }
+
+    /* AFIO, FLASH, ...: plain storage */
+}
+
+/**
+ * @brief   Advance timers, conversions and transfers
+ */
+void HostSimPeriph_Step(uint64_t Cycles)
+{
+    uint8_t Idx;
+
+    /* ADC2 first, the dual mode master packs its result into ADC1_DR */
+    HostSimPeriph_AdcStep(1U, Cycles);
+    HostSimPeriph_AdcStep(0U, Cycles);
+
+    /* Triggers land at the end of the step, the conversion starts from there */
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_TIM; Idx++)
+    {
+        HostSimPeriph_TimStep(Idx, Cycles);
+    }
+}
+
+/**
+ * @brief   Time until the next event software can observe
+ */
+uint64_t HostSimPeriph_CyclesToNextEvent(void)
+{
+    const TIM_TypeDef* TIMx;
+    uint64_t Next = HOSTSIM_NO_EVENT;
+    uint64_t Cycles;
+    uint8_t Idx;
+
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_ADC; Idx++)
+    {
+        if ((HostSimPeriph_AdcStates[Idx].RegBusy != 0U) || (HostSimPeriph_AdcStates[Idx].InjBusy != 0U))
+        {
+            Cycles = HostSimPeriph_AdcStates[Idx].Remaining;
+            if (Cycles < Next)
+            {
+                Next = Cycles;
+            }
+        }
+    }
+
+    /* Timers nobody listens to run in bulk */
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_TIM; Idx++)
+    {
+        TIMx = HostSimPeriph_Tims[Idx];
+        if (((TIMx->CR1 & TIM_CR1_CEN) != 0U) && (TIMx->ARR != 0U) && (HostSimPeriph_TimObserved(Idx) != 0U))
+        {
+            Cycles = ((uint64_t)HostSimPeriph_TimTicksToEvent(TIMx, TIMx->CNT, TIMx->ARR) *
+                      HostSimPeriph_TimCyclesPerTick(Idx)) - HostSimPeriph_TimStates[Idx].Residual;
+            if (Cycles < Next)
+            {
+                Next = Cycles;
+            }
+        }
+    }
+
+    return Next;
+}
+
+/**
+ * @brief   Interrupt request lines of the peripherals
+ */
+uint64_t HostSimPeriph_GetIrqLines(void)
+{
+    const ADC_TypeDef* ADCx;
+    uint64_t Lines = 0U;
+    uint32_t Flags;
+    uint8_t Idx;
+
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_DMA_CH; Idx++)
+    {
+        Flags = (DMA1->ISR >> (4U * Idx)) & HOSTSIM_DMA_IRQ_FLAGS;
+        if ((Flags & HostSimPeriph_DmaChannels[Idx]->CCR) != 0U)
+        {
+            Lines |= 1ULL << (DMA1_Channel1_IRQn + Idx);
+        }
+    }
+
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_ADC; Idx++)
+    {
+        ADCx = HostSimPeriph_Adcs[Idx];
+        if ((((ADCx->SR & ADC_SR_EOC) != 0U) && ((ADCx->CR1 & ADC_CR1_EOCIE) != 0U)) ||
+            (((ADCx->SR & ADC_SR_AWD) != 0U) && ((ADCx->CR1 & ADC_CR1_AWDIE) != 0U)) ||
+            (((ADCx->SR & ADC_SR_JEOC) != 0U) && ((ADCx->CR1 & ADC_CR1_JEOCIE) != 0U)))
+        {
+            Lines |= 1ULL << ADC1_2_IRQn;
+        }
+    }
+
+    Flags = TIM1->SR & TIM1->DIER;
+    if ((Flags & TIM_SR_UIF) != 0U)
+    {
+        Lines |= 1ULL << TIM1_UP_IRQn;
+    }
+    if ((Flags & HOSTSIM_TIM_CC_FLAGS) != 0U)
+    {
+        Lines |= 1ULL << TIM1_CC_IRQn;
+    }
+    if ((TIM2->SR & TIM2->DIER & HOSTSIM_TIM_IRQ_FLAGS) != 0U)
+    {
+        Lines |= 1ULL << TIM2_IRQn;
+    }
+    if ((TIM3->SR & TIM3->DIER & HOSTSIM_TIM_IRQ_FLAGS) != 0U)
+    {
+        Lines |= 1ULL << TIM3_IRQn;
+    }
+    if ((TIM4->SR & TIM4->DIER & HOSTSIM_TIM_IRQ_FLAGS) != 0U)
+    {
+        Lines |= 1ULL << TIM4_IRQn;
+    }
+
+    return Lines;
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   Word and bit addressed by a peripheral bit-band alias
+ */
+static uint32_t HostSimPeriph_BitBandTarget(uint32_t Addr, uint8_t* Bit)
+{
+    uint32_t Offset = Addr - PERIPH_BB_BASE;
+    uint32_t Byte = PERIPH_BASE + (Offset >> 5);
+
+    *Bit = (uint8_t)(((Byte & 3U) * 8U) + ((Offset >> 2) & 7U));
+    return Byte & ~3UL;
+}
+
+/**
+ * @brief   APB prescaler from a PPREx field of RCC_CFGR
+ */
+static uint32_t HostSimPeriph_ApbDivider(uint8_t Shift)
+{
+    uint32_t Code = (RCC->CFGR >> Shift) & 0x7U;
+
+    return (Code < 4U) ? 1U : (2UL << (Code - 4U));
+}
+
+static void HostSimPeriph_ResetGpio(uint8_t Idx)
+{
+    GPIO_TypeDef* GPIOx = HostSimPeriph_Gpios[Idx];
+
+    memset((void*)GPIOx, 0, sizeof(*GPIOx));
+    GPIOx->CRL = 0x44444444UL;          /* Floating inputs */
+    GPIOx->CRH = 0x44444444UL;
+}
+
+static void HostSimPeriph_ResetTim(uint8_t Idx)
+{
+    memset((void*)HostSimPeriph_Tims[Idx], 0, sizeof(TIM_TypeDef));
+    memset(&HostSimPeriph_TimStates[Idx], 0, sizeof(HostSimPeriph_TimStates[Idx]));
+}
+
+static void HostSimPeriph_ResetAdc(uint8_t Idx)
+{
+    memset((void*)HostSimPeriph_Adcs[Idx], 0, sizeof(ADC_TypeDef));
+    memset(&HostSimPeriph_AdcStates[Idx], 0, sizeof(HostSimPeriph_AdcStates[Idx]));
+}
+
+/**
+ * @brief   Peripherals whose APBxRSTR bit was just set
+ */
+static void HostSimPeriph_ResetBlocks(uint32_t Apb2Mask, uint32_t Apb1Mask)
+{
+    uint8_t Idx;
+
+    for (Idx = 0U; Idx < HOSTSIM_NBR_OF_GPIO; Idx++)
+    {
+        if ((Apb2Mask & (RCC_APB2Periph_GPIOA << Idx)) != 0U)
+        {
+            HostSimPeriph_ResetGpio(Idx);
+        }
+    }
+    if ((Apb2Mask & RCC_APB2Periph_ADC1) != 0U)
+    {
+        HostSimPeriph_ResetAdc(0U);
+    }
+    if ((Apb2Mask & RCC_APB2Periph_ADC2) != 0U)
+    {
+        HostSimPeriph_ResetAdc(1U);
+    }
+    if ((Apb2Mask & RCC_APB2Periph_TIM1) != 0U)
+    {
+        HostSimPeriph_ResetTim(0U);
+    }
+    for (Idx = 1U; Idx < HOSTSIM_NBR_OF_TIM; Idx++)
+    {
+        if ((Apb1Mask & (RCC_APB1Periph_TIM2 << (Idx - 1U))) != 0U)
+        {
+            HostSimPeriph_ResetTim(Idx);
+        }
+    }
+}
+
+/**
+ * @brief   Oscillators and the PLL are ready as soon as they are switched on
+ */
+static void HostSimPeriph_RccWrite(uint32_t Addr, uint32_t Old, uint32_t New)
+{
+    uint32_t Ready = 0U;
+
+    if (Addr == HOSTSIM_ADDR(RCC->CR))
+    {
+        Ready |= ((New & RCC_CR_HSION) != 0U) ? RCC_CR_HSIRDY : 0U;
+        Ready |= ((New & RCC_CR_HSEON) != 0U) ? RCC_CR_HSERDY : 0U;
+        Ready |= ((New & RCC_CR_PLLON) != 0U) ? RCC_CR_PLLRDY : 0U;
+        RCC->CR = (New & ~(RCC_CR_HSIRDY | RCC_CR_HSERDY | RCC_CR_PLLRDY)) | Ready;
+    }
+    else if (Addr == HOSTSIM_ADDR(RCC->CFGR))
+    {
+        /* Switch status follows the selection */
+        RCC->CFGR = (New & ~RCC_CFGR_SWS) | ((New & RCC_CFGR_SW) << 2);
+    }
+    else if (Addr == HOSTSIM_ADDR(RCC->CIR))
+    {
+        /* Only the enables stick, no ready interrupt is ever raised */
+        RCC->CIR = New & 0x00001F00UL;
+    }
+    else if (Addr == HOSTSIM_ADDR(RCC->APB2RSTR))
+    {
+        HostSimPeriph_ResetBlocks(New & ~Old, 0U);
+    }
+    else if (Addr == HOSTSIM_ADDR(RCC->APB1RSTR))
+    {
+        HostSimPeriph_ResetBlocks(0U, New & ~Old);
+    }
+    else
+    {
+        /* Enable registers, BDCR, CSR: plain storage */
+    }
+}
+
+static void HostSimPeriph_GpioWrite(GPIO_TypeDef* GPIOx, uint32_t Addr, uint32_t Old, uint32_t New)
+{
+    if (Addr == HOSTSIM_ADDR(GPIOx->BSRR))
+    {
+        /* Set wins over reset for the same pin */
+        GPIOx->ODR = (GPIOx->ODR & ~(New >> 16)) | (New & 0xFFFFU);
+        GPIOx->BSRR = 0U;
+    }
+    else if (Addr == HOSTSIM_ADDR(GPIOx->BRR))
+    {
+        GPIOx->ODR &= ~(New & 0xFFFFU);
+        GPIOx->BRR = 0U;
+    }
+    else if (Addr == HOSTSIM_ADDR(GPIOx->IDR))
+    {
+        GPIOx->IDR = Old;
+    }
+    else
+    {
+        /* CRL, CRH, ODR, LCKR: plain storage */
+    }
+}
+
+static void HostSimPeriph_TimWrite(uint8_t Idx, uint32_t Addr, uint32_t Old, uint32_t New)
+{
+    TIM_TypeDef* TIMx = HostSimPeriph_Tims[Idx];
+    HostSim_TimEventType Event;
+
+    if (Addr == HOSTSIM_ADDR(TIMx->SR))
+    {
+        /* rc_w0 */
+        TIMx->SR = (uint16_t)(Old & New);
+    }
+    else if (Addr == HOSTSIM_ADDR(TIMx->EGR))
+    {
+        TIMx->EGR = 0U;
+        if ((New & TIM_EGR_UG) != 0U)
+        {
+            TIMx->CNT = 0U;
+            HostSimPeriph_TimStates[Idx].Residual = 0U;
+            if ((TIMx->CR1 & TIM_CR1_URS) == 0U)
+            {
+                TIMx->SR |= TIM_SR_UIF;
+            }
+            /* MMS = reset routes UG to TRGO */
+            if ((TIMx->CR2 & TIM_CR2_MMS) == 0U)
+            {
+                HostSimPeriph_TimEvent(Idx, HOSTSIM_TIM_EVT_TRGO);
+            }
+        }
+        for (Event = HOSTSIM_TIM_EVT_CC1; Event <= HOSTSIM_TIM_EVT_CC4; Event++)
+        {
+            if ((New & (TIM_EGR_CC1G << (Event - HOSTSIM_TIM_EVT_CC1))) != 0U)
+            {
+                HostSimPeriph_TimEvent(Idx, Event);
+            }
+        }
+        if ((New & TIM_EGR_TG) != 0U)
+        {
+            TIMx->SR |= TIM_SR_TIF;
+        }
+    }
+    else
+    {
+        /* Counter, prescaler, reload and compare values take effect immediately */
+    }
+}
+
+static void HostSimPeriph_AdcWrite(uint8_t Idx, uint32_t Addr, uint32_t Old, uint32_t New)
+{
+    ADC_TypeDef* ADCx = HostSimPeriph_Adcs[Idx];
+    uint32_t Value;
+
+    if (Addr == HOSTSIM_ADDR(ADCx->SR))
+    {
+        ADCx->SR = Old & New & 0x1FU;
+    }
+    else if ((Addr >= HOSTSIM_ADDR(ADCx->JDR1)) && (Addr <= HOSTSIM_ADDR(ADCx->DR)))
+    {
+        /* Data registers are read-only */
+        HOSTSIM_REG(Addr) = Old;
+    }
+    else if (Addr == HOSTSIM_ADDR(ADCx->CR2))
+    {
+        /* Calibration completes at once */
+        Value = New & ~(ADC_CR2_CAL | ADC_CR2_RSTCAL);
+        ADCx->CR2 = Value;
+
+        if ((Value & ADC_CR2_ADON) == 0U)
+        {
+            HostSimPeriph_AdcStates[Idx].RegBusy = 0U;
+            HostSimPeriph_AdcStates[Idx].InjBusy = 0U;
+            return;
+        }
+
+        /* Setting ADON again with no other change starts a regular conversion */
+        if (((Old & ADC_CR2_ADON) != 0U) && (New == Old))
+        {
+            HostSimPeriph_AdcStartRegular(Idx);
+        }
+
+        if (((Value & ADC_CR2_SWSTART) != 0U) && ((Value & ADC_CR2_EXTTRIG) != 0U) &&
+            (((Value & ADC_CR2_EXTSEL) >> 17) == HOSTSIM_EXTSEL_SWSTART))
+        {
+            ADCx->CR2 &= ~ADC_CR2_SWSTART;
+            HostSimPeriph_AdcStartRegular(Idx);
+        }
+        if (((Value & ADC_CR2_JSWSTART) != 0U) && ((Value & ADC_CR2_JEXTTRIG) != 0U) &&
+            (((Value & ADC_CR2_JEXTSEL) >> 12) == HOSTSIM_EXTSEL_SWSTART))
+        {
+            ADCx->CR2 &= ~ADC_CR2_JSWSTART;
+            HostSimPeriph_AdcStartInjected(Idx);
+        }
+    }
+    else
+    {
+        /* CR1, sample times, sequences, offsets, thresholds: plain storage */
+    }
+}
+
+static void HostSimPeriph_DmaWrite(uint32_t Addr, uint32_t Old, uint32_t New)
+{
+    DMA_Channel_TypeDef* Channel;
+    uint8_t Idx;
+
+    if (Addr == HOSTSIM_ADDR(DMA1->ISR))
+    {
+        DMA1->ISR = Old;
+        return;
+    }
+    if (Addr == HOSTSIM_ADDR(DMA1->IFCR))
+    {
+        DMA1->ISR &= ~New;
+        DMA1->IFCR = 0U;
+        return;
+    }
+
+    Idx = (uint8_t)((Addr - DMA1_Channel1_BASE) / HOSTSIM_DMA_CH_STRIDE);
+    Channel = HostSimPeriph_DmaChannels[Idx];
+    if ((Addr == HOSTSIM_ADDR(Channel->CCR)) && ((Old & DMA_CCR1_EN) == 0U) && ((New & DMA_CCR1_EN) != 0U))
+    {
+        /* Addresses and count are latched when the channel is enabled */
+        HostSimPeriph_DmaStates[Idx].Count = (uint16_t)Channel->CNDTR;
+        HostSimPeriph_DmaStates[Idx].Done = 0U;
+        HostSimPeriph_DmaStates[Idx].PeriphAddr = Channel->CPAR;
+        HostSimPeriph_DmaStates[Idx].MemAddr = Channel->CMAR;
+    }
+}
+
+/**
+ * @brief   HCLK cycles per counter tick, timer clock is 2 x PCLK when the APB is divided
+ */
+static uint32_t HostSimPeriph_TimCyclesPerTick(uint8_t Idx)
+{
+    uint32_t Divider = HostSimPeriph_ApbDivider((Idx == 0U) ? 11U : 8U);
+
+    return ((Divider == 1U) ? 1U : (Divider / 2U)) * ((uint32_t)HostSimPeriph_Tims[Idx]->PSC + 1U);
+}
+
+/**
+ * @brief   Counter ticks to the next overflow or compare match of an output channel
+ */
+static uint32_t HostSimPeriph_TimTicksToEvent(const TIM_TypeDef* TIMx, uint32_t Cnt, uint32_t Arr)
+{
+    uint32_t Ticks = (Cnt <= Arr) ? (Arr - Cnt + 1U) : (0x10000UL - Cnt);
+    uint32_t Ccr;
+    uint8_t Ch;
+
+    for (Ch = 0U; Ch < 4U; Ch++)
+    {
+        uint32_t Ccmr = (Ch < 2U) ? TIMx->CCMR1 : TIMx->CCMR2;
+        if (((Ccmr >> ((Ch & 1U) * 8U)) & 0x3U) != 0U)
+        {
+            continue;                   /* Input capture */
+        }
+        Ccr = (&TIMx->CCR1)[Ch * 2U];
+        if ((Ccr > Cnt) && (Ccr <= Arr) && ((Ccr - Cnt) < Ticks))
+        {
+            Ticks = Ccr - Cnt;
+        }
+    }
+    return Ticks;
+}
+
+/**
+ * @brief   Count up, raising update and compare events on the way
+ */
+static void HostSimPeriph_TimStep(uint8_t Idx, uint64_t Cycles)
+{
+    TIM_TypeDef* TIMx = HostSimPeriph_Tims[Idx];
+    HostSim_TimStateType* State = &HostSimPeriph_TimStates[Idx];
+    uint32_t PerTick;
+    uint64_t Ticks;
+    uint32_t Dist;
+    uint32_t Cnt;
+    uint32_t Arr;
+    uint8_t Ch;
+
+    /* ARR = 0 blocks the counter */
+    if (((TIMx->CR1 & TIM_CR1_CEN) == 0U) || (TIMx->ARR == 0U))
+    {
+        return;
+    }
+
+    PerTick = HostSimPeriph_TimCyclesPerTick(Idx);
+    Ticks = (State->Residual + Cycles) / PerTick;
+    State->Residual = (uint32_t)((State->Residual + Cycles) % PerTick);
+
+    Cnt = TIMx->CNT;
+    Arr = TIMx->ARR;
+    while (Ticks > 0U)
+    {
+        Dist = HostSimPeriph_TimTicksToEvent(TIMx, Cnt, Arr);
+        if (Ticks < Dist)
+        {
+            Cnt += (uint32_t)Ticks;
+            break;
+        }
+        Ticks -= Dist;
+        Cnt += Dist;
+
+        if ((Cnt > Arr) || (Cnt > 0xFFFFU))
+        {
+            Cnt = 0U;
+            TIMx->CNT = 0U;
+            HostSimPeriph_TimEvent(Idx, HOSTSIM_TIM_EVT_UPDATE);
+        }
+        for (Ch = 0U; Ch < 4U; Ch++)
+        {
+            uint32_t Ccmr = (Ch < 2U) ? TIMx->CCMR1 : TIMx->CCMR2;
+            if ((((Ccmr >> ((Ch & 1U) * 8U)) & 0x3U) == 0U) && ((&TIMx->CCR1)[Ch * 2U] == Cnt))
+            {
+                TIMx->CNT = (uint16_t)Cnt;
+                HostSimPeriph_TimEvent(Idx, (HostSim_TimEventType)(HOSTSIM_TIM_EVT_CC1 + Ch));
+            }
+        }
+    }
+    TIMx->CNT = (uint16_t)Cnt;
+}
+
+/**
+ * @brief   Flag an event, derive TRGO and feed the ADC trigger multiplexers
+ */
+static void HostSimPeriph_TimEvent(uint8_t Idx, HostSim_TimEventType Event)
+{
+    TIM_TypeDef* TIMx = HostSimPeriph_Tims[Idx];
+    uint32_t Mms = (TIMx->CR2 & TIM_CR2_MMS) >> 4;
+    const HostSim_TriggerType* Trigger;
+    ADC_TypeDef* ADCx;
+    uint8_t Adc;
+
+    if (Event == HOSTSIM_TIM_EVT_UPDATE)
+    {
+        if ((TIMx->CR1 & TIM_CR1_UDIS) != 0U)
+        {
+            return;
+        }
+        TIMx->SR |= TIM_SR_UIF;
+        if (Mms == 2U)
+        {
+            HostSimPeriph_TimEvent(Idx, HOSTSIM_TIM_EVT_TRGO);
+        }
+        return;
+    }
+
+    if (Event >= HOSTSIM_TIM_EVT_CC1)
+    {
+        TIMx->SR |= (uint16_t)(TIM_SR_CC1IF << (Event - HOSTSIM_TIM_EVT_CC1));
+        /* Compare pulse on CC1, OCxREF approximated by the CCx match */
+        if (((Mms == 3U) && (Event == HOSTSIM_TIM_EVT_CC1)) ||
+            ((Mms >= 4U) && ((Mms - 4U) == (uint32_t)(Event - HOSTSIM_TIM_EVT_CC1))))
+        {
+            HostSimPeriph_TimEvent(Idx, HOSTSIM_TIM_EVT_TRGO);
+        }
+    }
+
+    for (Adc = 0U; Adc < HOSTSIM_NBR_OF_ADC; Adc++)
+    {
+        ADCx = HostSimPeriph_Adcs[Adc];
+        if ((ADCx->CR2 & ADC_CR2_EXTTRIG) != 0U)
+        {
+            Trigger = &HostSimPeriph_RegularTriggers[(ADCx->CR2 & ADC_CR2_EXTSEL) >> 17];
+            if ((Trigger->Tim == Idx) && (Trigger->Event == (uint8_t)Event))
+            {
+                HostSimPeriph_AdcStartRegular(Adc);
+            }
+        }
+        if ((ADCx->CR2 & ADC_CR2_JEXTTRIG) != 0U)
+        {
+            Trigger = &HostSimPeriph_InjectedTriggers[(ADCx->CR2 & ADC_CR2_JEXTSEL) >> 12];
+            if ((Trigger->Tim == Idx) && (Trigger->Event == (uint8_t)Event))
+            {
+                HostSimPeriph_AdcStartInjected(Adc);
+            }
+        }
+    }
+}
+
+/**
+ * @brief   A timer matters when it can interrupt or trigger a conversion
+ */
+static uint8_t HostSimPeriph_TimObserved(uint8_t Idx)
+{
+    const ADC_TypeDef* ADCx;
+    uint8_t Adc;
+
+    if ((HostSimPeriph_Tims[Idx]->DIER & HOSTSIM_TIM_IRQ_FLAGS) != 0U)
+    {
+        return 1U;
+    }
+    for (Adc = 0U; Adc < HOSTSIM_NBR_OF_ADC; Adc++)
+    {
+        ADCx = HostSimPeriph_Adcs[Adc];
+        if ((((ADCx->CR2 & ADC_CR2_EXTTRIG) != 0U) &&
+             (HostSimPeriph_RegularTriggers[(ADCx->CR2 & ADC_CR2_EXTSEL) >> 17].Tim == Idx)) ||
+            (((ADCx->CR2 & ADC_CR2_JEXTTRIG) != 0U) &&
+             (HostSimPeriph_InjectedTriggers[(ADCx->CR2 & ADC_CR2_JEXTSEL) >> 12].Tim == Idx)))
+        {
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+static uint8_t HostSimPeriph_AdcRegularChannel(const ADC_TypeDef* ADCx, uint8_t Rank)
+{
+    if (Rank < 6U)
+    {
+        return (uint8_t)((ADCx->SQR3 >> (5U * Rank)) & 0x1FU);
+    }
+    if (Rank < 12U)
+    {
+        return (uint8_t)((ADCx->SQR2 >> (5U * (Rank - 6U))) & 0x1FU);
+    }
+    return (uint8_t)((ADCx->SQR1 >> (5U * (Rank - 12U))) & 0x1FU);
+}
+
+/**
+ * @brief   Injected channel in conversion order, a short sequence ends at JSQ4
+ */
+static uint8_t HostSimPeriph_AdcInjectedChannel(const ADC_TypeDef* ADCx, uint8_t Idx)
+{
+    uint8_t Length = (uint8_t)(((ADCx->JSQR >> 20) & 0x3U) + 1U);
+
+    return (uint8_t)((ADCx->JSQR >> (5U * (4U - Length + Idx))) & 0x1FU);
+}
+
+/**
+ * @brief   Sample plus conversion time of one channel in HCLK cycles
+ */
+static uint64_t HostSimPeriph_AdcConversionCycles(const ADC_TypeDef* ADCx, uint8_t Channel)
+{
+    uint32_t Code = (Channel < 10U) ? (ADCx->SMPR2 >> (3U * Channel)) : (ADCx->SMPR1 >> (3U * (Channel - 10U)));
+    uint32_t AdcPre = (((RCC->CFGR & RCC_CFGR_ADCPRE) >> 14) + 1U) * 2U;
+
+    /* Same table as the timing model, so the report compares like with like */
+    return (uint64_t)Adc_TimingChannelClocks((Adc_SamplingTimeType)(Code & 0x7U)) * HostSimPeriph_ApbDivider(11U) * AdcPre;
+}
+
+/**
+ * @brief   ADC2 follows the ADC1 regular sequence
+ */
+static uint8_t HostSimPeriph_AdcIsDualRegular(void)
+{
+    uint32_t DualMode = (ADC1->CR1 & ADC_CR1_DUALMOD) >> 16;
+
+    return ((DualMode == 1U) || (DualMode == 2U) || (DualMode == 6U)) ? 1U : 0U;
+}
+
+/**
+ * @brief   A trigger during a conversion is ignored
+ */
+static void HostSimPeriph_AdcStartRegular(uint8_t Idx)
+{
+    ADC_TypeDef* ADCx = HostSimPeriph_Adcs[Idx];
+    HostSim_AdcStateType* State = &HostSimPeriph_AdcStates[Idx];
+
+    if (((ADCx->CR2 & ADC_CR2_ADON) == 0U) || (State->RegBusy != 0U))
+    {
+        return;
+    }
+
+    State->RegBusy = 1U;
+    State->RegIdx = 0U;
+    ADCx->SR |= ADC_SR_STRT;
+    if (State->InjBusy == 0U)
+    {
+        State->Remaining = HostSimPeriph_AdcConversionCycles(ADCx, HostSimPeriph_AdcRegularChannel(ADCx, 0U));
+    }
+
+    if ((Idx == 0U) && (HostSimPeriph_AdcIsDualRegular() != 0U))
+    {
+        HostSimPeriph_AdcStartRegular(1U);
+    }
+}
+
+/**
+ * @brief   Injected sequence preempts a regular conversion, which restarts afterwards
+ */
+static void HostSimPeriph_AdcStartInjected(uint8_t Idx)
+{
+    ADC_TypeDef* ADCx = HostSimPeriph_Adcs[Idx];
+    HostSim_AdcStateType* State = &HostSimPeriph_AdcStates[Idx];
+
+    if (((ADCx->CR2 & ADC_CR2_ADON) == 0U) || (State->InjBusy != 0U))
+    {
+        return;
+    }
+
+    State->InjBusy = 1U;
+    State->InjIdx = 0U;
+    ADCx->SR |= ADC_SR_JSTRT;
+    State->Remaining = HostSimPeriph_AdcConversionCycles(ADCx, HostSimPeriph_AdcInjectedChannel(ADCx, 0U));
+}
+
+/**
+ * @brief   Raw result outside [LTR, HTR] sets AWD
+ */
+static void HostSimPeriph_AdcWatchdog(ADC_TypeDef* ADCx, uint8_t Channel, uint16_t Raw, uint32_t EnableBit)
+{
+    uint32_t Cr1 = ADCx->CR1;
+
+    if ((Cr1 & EnableBit) == 0U)
+    {
+        return;
+    }
+    if (((Cr1 & ADC_CR1_AWDSGL) != 0U) && ((Cr1 & ADC_CR1_AWDCH) != Channel))
+    {
+        return;
+    }
+    if ((Raw > (ADCx->HTR & 0x0FFFU)) || (Raw < (ADCx->LTR & 0x0FFFU)))
+    {
+        ADCx->SR |= ADC_SR_AWD;
+    }
+}
+
+/**
+ * @brief   Level converted on a channel, from the source if one is set
+ */
+static uint16_t HostSimPeriph_AdcSample(uint8_t Channel)
+{
+    if (Channel >= HOSTSIM_NBR_OF_ANALOG_INPUTS)
+    {
+        Channel = 0U;
+    }
+    if (HostSimPeriph_AnalogSource != NULL)
+    {
+        return HostSimPeriph_AnalogSource(Channel, HostSim_GetCycles()) & 0x0FFFU;
+    }
+    return HostSimPeriph_AnalogInputs[Channel];
+}
+
+/**
+ * @brief   Store the finished conversion and move the sequence on
+ */
+static void HostSimPeriph_AdcComplete(uint8_t Idx)
+{
+    ADC_TypeDef* ADCx = HostSimPeriph_Adcs[Idx];
+    HostSim_AdcStateType* State = &HostSimPeriph_AdcStates[Idx];
+    uint8_t Channel;
+    uint16_t Raw;
+    int32_t Data;
+    uint32_t Result;
+
+    HostSimPeriph_AdcConversions[Idx]++;
+    if (State->InjBusy != 0U)
+    {
+        Channel = HostSimPeriph_AdcInjectedChannel(ADCx, State->InjIdx);
+        Raw = HostSimPeriph_AdcSample(Channel);
+        HostSimPeriph_AdcWatchdog(ADCx, Channel, Raw, ADC_CR1_JAWDEN);
+
+        /* Offset result is signed, left alignment keeps the sign in bit 15 */
+        Data = (int32_t)Raw - (int32_t)((&ADCx->JOFR1)[State->InjIdx] & 0x0FFFU);
+        Result = ((ADCx->CR2 & ADC_CR2_ALIGN) != 0U) ? (uint16_t)(Data << 3) : (uint16_t)(int16_t)Data;
+        (&ADCx->JDR1)[State->InjIdx] = Result;
+
+        State->InjIdx++;
+        if (State->InjIdx > ((ADCx->JSQR >> 20) & 0x3U))
+        {
+            ADCx->SR |= ADC_SR_JEOC;
+            State->InjBusy = 0U;
+            State->Remaining = (State->RegBusy != 0U) ?
+                HostSimPeriph_AdcConversionCycles(ADCx, HostSimPeriph_AdcRegularChannel(ADCx, State->RegIdx)) : 0U;
+        }
+        else
+        {
+            State->Remaining = HostSimPeriph_AdcConversionCycles(ADCx, HostSimPeriph_AdcInjectedChannel(ADCx, State->InjIdx));
+        }
+        return;
+    }
+
+    Channel = HostSimPeriph_AdcRegularChannel(ADCx, State->RegIdx);
+    Raw = HostSimPeriph_AdcSample(Channel);
+    HostSimPeriph_AdcWatchdog(ADCx, Channel, Raw, ADC_CR1_AWDEN);
+
+    Result = ((ADCx->CR2 & ADC_CR2_ALIGN) != 0U) ? ((uint32_t)Raw << 4) : Raw;
+    if ((Idx == 0U) && (HostSimPeriph_AdcIsDualRegular() != 0U))
+    {
+        Result |= (ADC2->DR & 0xFFFFU) << 16;
+    }
+    ADCx->DR = Result;
+    ADCx->SR |= ADC_SR_EOC;
+
+    if (((ADCx->CR2 & ADC_CR2_DMA) != 0U) && (Idx == 0U))
+    {
+        HostSimPeriph_DmaRequest(0U);
+    }
+
+    State->RegIdx++;
+    if (((ADCx->CR1 & ADC_CR1_SCAN) == 0U) || (State->RegIdx > ((ADCx->SQR1 >> 20) & 0xFU)))
+    {
+        State->RegIdx = 0U;
+        if ((ADCx->CR2 & ADC_CR2_CONT) == 0U)
+        {
+            State->RegBusy = 0U;
+        }
+    }
+    State->Remaining = (State->RegBusy != 0U) ?
+        HostSimPeriph_AdcConversionCycles(ADCx, HostSimPeriph_AdcRegularChannel(ADCx, State->RegIdx)) : 0U;
+}
+
+static void HostSimPeriph_AdcStep(uint8_t Idx, uint64_t Cycles)
+{
+    HostSim_AdcStateType* State = &HostSimPeriph_AdcStates[Idx];
+
+    while ((State->RegBusy != 0U) || (State->InjBusy != 0U))
+    {
+        if (State->Remaining > Cycles)
+        {
+            State->Remaining -= Cycles;
+            return;
+        }
+        Cycles -= State->Remaining;
+        State->Remaining = 0U;
+        HostSimPeriph_AdcComplete(Idx);
+    }
+}
+
+/**
+ * @brief   One transfer on a DMA1 channel
+ * @note    Memory addresses are host pointers truncated to 32 bits, the host
+ *          binary is linked without PIE so static buffers fit.
+ */
+static void HostSimPeriph_DmaRequest(uint8_t Channel)
+{
+    DMA_Channel_TypeDef* Regs = HostSimPeriph_DmaChannels[Channel];
+    HostSim_DmaStateType* State = &HostSimPeriph_DmaStates[Channel];
+    uint32_t Ccr = Regs->CCR;
+    uint32_t PSize = 1UL << ((Ccr & DMA_CCR1_PSIZE) >> 8);
+    uint32_t MSize = 1UL << ((Ccr & DMA_CCR1_MSIZE) >> 10);
+    uintptr_t PAddr;
+    uintptr_t MAddr;
+    uintptr_t Src;
+    uintptr_t Dst;
+    uint32_t SrcSize;
+    uint32_t DstSize;
+    uint32_t Value;
+    uint32_t Old = 0U;
+    uint32_t Flags = 0U;
+
+    if (((Ccr & DMA_CCR1_EN) == 0U) || (Regs->CNDTR == 0U))
+    {
+        return;
+    }
+
+    PAddr = State->PeriphAddr + (((Ccr & DMA_CCR1_PINC) != 0U) ? (State->Done * PSize) : 0U);
+    MAddr = State->MemAddr + (((Ccr & DMA_CCR1_MINC) != 0U) ? (State->Done * MSize) : 0U);
+    Src = ((Ccr & DMA_CCR1_DIR) != 0U) ? MAddr : PAddr;
+    Dst = ((Ccr & DMA_CCR1_DIR) != 0U) ? PAddr : MAddr;
+    SrcSize = ((Ccr & DMA_CCR1_DIR) != 0U) ? MSize : PSize;
+    DstSize = ((Ccr & DMA_CCR1_DIR) != 0U) ? PSize : MSize;
+
+    switch (SrcSize)
+    {
+        case 1U:  Value = *(volatile uint8_t*)Src;  break;
+        case 2U:  Value = *(volatile uint16_t*)Src; break;
+        default:  Value = *(volatile uint32_t*)Src; break;
+    }
+    if ((Ccr & DMA_CCR1_DIR) == 0U)
+    {
+        HostSimPeriph_AfterRead((uint32_t)(Src & ~(uintptr_t)3U));
+    }
+    else
+    {
+        Old = HOSTSIM_REG(Dst & ~(uintptr_t)3U);
+    }
+    switch (DstSize)
+    {
+        case 1U:  *(volatile uint8_t*)Dst = (uint8_t)Value;   break;
+        case 2U:  *(volatile uint16_t*)Dst = (uint16_t)Value; break;
+        default:  *(volatile uint32_t*)Dst = Value;           break;
+    }
+    if ((Ccr & DMA_CCR1_DIR) != 0U)
+    {
+        HostSimPeriph_Write((uint32_t)(Dst & ~(uintptr_t)3U), Old, HOSTSIM_REG(Dst & ~(uintptr_t)3U));
+    }
+
+    State->Done++;
+    Regs->CNDTR--;
+    if (State->Done == (State->Count >> 1))
+    {
+        Flags |= DMA_ISR_HTIF1;
+    }
+    if (Regs->CNDTR == 0U)
+    {
+        Flags |= DMA_ISR_TCIF1;
+        if ((Ccr & DMA_CCR1_CIRC) != 0U)
+        {
+            Regs->CNDTR = State->Count;
+            State->Done = 0U;
+        }
+    }
+    if (Flags != 0U)
+    {
+        DMA1->ISR |= (Flags | DMA_ISR_GIF1) << (4U * Channel);
+    }
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
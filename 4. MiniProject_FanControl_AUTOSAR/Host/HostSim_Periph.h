@@ -0,0 +1,89 @@
+/****************************************************************************************
+*                                HOSTSIM_PERIPH.H                                       *
+****************************************************************************************
+* File Name   : HostSim_Periph.h
+* Module      : Host Simulation (HOSTSIM)
+* Description : Peripheral side of the register model, used by HostSim.c only
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+#ifndef HOSTSIM_PERIPH_H
+#define HOSTSIM_PERIPH_H
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "HostSim.h"
+
+/****************************************************************************************
+*                                 DEFINES                                              *
+****************************************************************************************/
+#define HOSTSIM_NO_EVENT            UINT64_MAX  /*!< Nothing scheduled */
+
+/****************************************************************************************
+*                                 FUNCTION PROTOTYPES                                  *
+****************************************************************************************/
+/*
+ * All functions run with the register windows accessible: from the fault handlers
+ * or between HostSim_Unlock and HostSim_Lock. Addr is the word address of the
+ * accessed register.
+ */
+
+/**
+ * @brief   Load reset values into every block and clear the model state
+ * @return  void
+ */
+void HostSimPeriph_Reset(void);
+
+/**
+ * @brief   Refresh a register whose content is computed, before it is read
+ * @param[in] Addr Register address
+ * @return  void
+ */
+void HostSimPeriph_BeforeRead(uint32_t Addr);
+
+/**
+ * @brief   Apply read side effects, e.g. EOC cleared by reading ADC_DR
+ * @param[in] Addr Register address
+ * @return  void
+ */
+void HostSimPeriph_AfterRead(uint32_t Addr);
+
+/**
+ * @brief   Apply write side effects
+ * @details The store already landed, the handler may rewrite the register,
+ *          e.g. BSRR reads back as 0 after it updated ODR.
+ * @param[in] Addr Register address
+ * @param[in] Old Content before the store
+ * @param[in] New Content after the store
+ * @return  void
+ */
+void HostSimPeriph_Write(uint32_t Addr, uint32_t Old, uint32_t New);
+
+/**
+ * @brief   Advance timers, conversions and transfers
+ * @param[in] Cycles HCLK cycles
+ * @return  void
+ */
+void HostSimPeriph_Step(uint64_t Cycles);
+
+/**
+ * @brief   Time until the next event software can observe
+ * @return  HCLK cycles, HOSTSIM_NO_EVENT when every block is idle
+ */
+uint64_t HostSimPeriph_CyclesToNextEvent(void);
+
+/**
+ * @brief   Interrupt request lines of the peripherals
+ * @return  Bit n set while IRQn n is requested
+ */
+uint64_t HostSimPeriph_GetIrqLines(void);
+
+#endif /* HOSTSIM_PERIPH_H */
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
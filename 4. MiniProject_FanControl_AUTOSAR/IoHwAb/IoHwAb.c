@@ -16,6 +16,8 @@
  * =====================================================
  */
 #include "IoHwAb.h"
+#include "IoHwAb_Filter.h"
+#include "Det.h"
 
 
 
@@ -34,20 +36,34 @@ static uint8 IoHwAb_CurrentFanDuty = 0u;
 static boolean IoHwAb_CurrentLedState = FALSE;
 #endif
 Adc_GroupType AdcConf_AdcGroup_TemperatureSensor = 0; /* ADC group for temperature sensor */
+Adc_GroupType AdcConf_AdcGroup_TemperatureMonitor = 6; /* ADC group with analog watchdog */
+
+/* Main function ticks for a duration in ms */
+#define IOHWAB_MS_TO_TICKS(ms)      ((ms) / IOHWAB_MAINFUNCTION_PERIOD_MS)
+
+/* Temperature acquisition state */
+static volatile boolean IoHwAb_TempConvDone = FALSE;        /* Set by ADC group notification */
+static boolean IoHwAb_TempRequestPending = FALSE;           /* Conversion in flight */
+static uint16 IoHwAb_TempRequestTicks = 0u;                 /* Ticks since request was started */
+static uint16 IoHwAb_TempCachedValue = IOHWAB_TEMP_INVALID_VALUE; /* Last good reading */
+static uint16 IoHwAb_TempAgeTicks = IOHWAB_TEMP_AGE_MAX_TICKS;    /* Ticks since last good reading */
+static IoHwAb_TempStatusType IoHwAb_TempStatus = IOHWAB_TEMP_STATUS_INVALID;
+
+/* Temperature band monitor state */
+static boolean IoHwAb_MonActive = FALSE;                    /* Monitor group owns the ADC */
+static uint16 IoHwAb_MonThresholds[IOHWAB_TEMP_MAX_THRESHOLDS]; /* Ascending band borders */
+static uint8 IoHwAb_MonCount = 0u;                          /* Number of valid thresholds */
+static uint16 IoHwAb_MonHysteresis = 0u;                    /* Counts past a border to switch */
+static volatile uint8 IoHwAb_MonBand = 0u;                  /* Current band, written in ISR */
+static volatile boolean IoHwAb_MonSampleSeen = FALSE;       /* Set by the monitor stream notification */
+static uint16 IoHwAb_MonAgeTicks = 0u;                      /* Ticks since the last monitor samples */
+static boolean IoHwAb_MonStale = FALSE;                     /* Stream silent, top band reported */
 /*
  * =====================================================
  *  LOCAL FUNCTION PROTOTYPES
  * =====================================================
  */
 
-/*
- * Function: IoHwAb_ConvertAdcToTemperature
- * Description: Convert raw ADC value to temperature in Celsius
- * Parameters: adcValue - Raw ADC reading (0-4095)
- * Return: uint16 - Temperature in Celsius, or IOHWAB_TEMP_INVALID_VALUE on error
- */
-static uint16 IoHwAb_ConvertAdcToTemperature(uint16 adcValue);
-
 /*
  * Function: IoHwAb_ConvertPercentToPwm
  * Description: Convert percentage (0-100%) to PWM duty cycle value
@@ -67,6 +83,30 @@ static uint16 IoHwAb_ConvertPercentToPwm(uint8 percent);
  */
 static boolean IoHwAb_ValidateParameters(uint8 functionId, uint32 param, uint32 min, uint32 max);
 
+/*
+ * Function: IoHwAb_SetMonitorWindow
+ * Description: Program the watchdog window of a band, widened by the hysteresis
+ * Parameters: band - Band the monitored value is in
+ * Return: None
+ */
+static void IoHwAb_SetMonitorWindow(uint8 band);
+
+/*
+ * Function: IoHwAb_MonitorBandOf
+ * Description: Band of a raw value, 0 = below the first threshold
+ * Parameters: value - Raw ADC counts
+ * Return: uint8 - Band index
+ */
+static uint8 IoHwAb_MonitorBandOf(uint16 value);
+
+/*
+ * Function: IoHwAb_MonitorSupervise
+ * Description: Fail safe when the monitor stream stops, resume when it is back
+ * Parameters: None
+ * Return: None
+ */
+static void IoHwAb_MonitorSupervise(void);
+
 /*
  * =====================================================
  *  PUBLIC FUNCTION IMPLEMENTATIONS
@@ -79,8 +119,6 @@ static boolean IoHwAb_ValidateParameters(uint8 functionId, uint32 param, uint32
  */
 void IoHwAb_Init(void)
 {
-    /* TODO: Initialize all MCAL drivers in correct order */
-    
     /* 1. Initialize Port Driver first (GPIO configuration) */
     Port_Init(&PortCfg_Port);
     
@@ -90,26 +128,35 @@ void IoHwAb_Init(void)
     /* 3. Initialize ADC Driver */
     Adc_Init(&Adc_Config);
     Adc_SetupResultBuffer(AdcConf_AdcGroup_TemperatureSensor, Adc_Group1_ResultBuffer);
+    Adc_EnableGroupNotification(AdcConf_AdcGroup_TemperatureSensor);
     /* 4. Initialize PWM Driver */
     Pwm_Init(&Pwm_Config);
     
     /* Set initial states */
     IoHwAb_SetFanDuty(IOHWAB_FAN_DUTY_MIN);    /* Fan OFF initially */
     IoHwAb_SetLed(IOHWAB_LED_OFF);             /* LED OFF initially */
-
-    // Adc_StartGroupConversion(AdcConf_AdcGroup_TemperatureSensor);
     
+    /* Reset temperature acquisition state */
+    IoHwAb_TempConvDone = FALSE;
+    IoHwAb_TempRequestPending = FALSE;
+    IoHwAb_TempRequestTicks = 0u;
+    IoHwAb_TempCachedValue = IOHWAB_TEMP_INVALID_VALUE;
+    IoHwAb_TempAgeTicks = IOHWAB_TEMP_AGE_MAX_TICKS;
+    IoHwAb_TempStatus = IOHWAB_TEMP_STATUS_INVALID;
+    
+    /* An invalid filter chain leaves its signal unfiltered */
+    (void)IoHwAb_FilterInit();
+
     /* Mark module as initialized */
     IoHwAb_ModuleState = IOHWAB_INITIALIZED;
 }
 
 /*
  * Function: IoHwAb_ReadTemperature
- * Description: Read current temperature from analog sensor
+ * Description: Return cached temperature, request a new one if idle
  */
 uint16 IoHwAb_ReadTemperature(void)
 {
-    uint16 adcValue = 0;
     uint16 temperature = IOHWAB_TEMP_INVALID_VALUE;
     
     /* Check if module is initialized */
@@ -118,23 +165,268 @@ uint16 IoHwAb_ReadTemperature(void)
         return IOHWAB_TEMP_INVALID_VALUE;
     }
     
+    /* Kick a new acquisition, ignored while one is pending */
+    (void)IoHwAb_RequestTemperature();
+    
+    /* Only a fresh value is reported, the caller never waits for the ADC */
+    if (IoHwAb_GetTemperature(&temperature, NULL_PTR) != IOHWAB_TEMP_STATUS_VALID)
+    {
+        temperature = IOHWAB_TEMP_INVALID_VALUE;
+    }
+    
+    return temperature;
+}
 
-     Adc_StartGroupConversion(AdcConf_AdcGroup_TemperatureSensor);
+/*
+ * Function: IoHwAb_RequestTemperature
+ * Description: Start one temperature conversion without waiting for it
+ */
+Std_ReturnType IoHwAb_RequestTemperature(void)
+{
+    /* Check if module is initialized */
+    if (IoHwAb_ModuleState != IOHWAB_INITIALIZED)
+    {
+        return E_NOT_OK;
+    }
     
-    // Wait for conversion to complete
-    while (Adc_GetGroupStatus(AdcConf_AdcGroup_TemperatureSensor) != ADC_STREAM_COMPLETED)
+    /* Only one request in flight, the monitor group holds the ADC while it runs */
+    if ((IoHwAb_TempRequestPending == TRUE) || (IoHwAb_MonActive == TRUE))
     {
-        // Wait or add timeout
+        return E_NOT_OK;
     }
     
-    // Read ADC result
-    if (Adc_ReadGroup(AdcConf_AdcGroup_TemperatureSensor, &temperature) == E_OK)
+    IoHwAb_TempConvDone = FALSE;
+    Adc_StartGroupConversion(AdcConf_AdcGroup_TemperatureSensor);
+    
+    /* Group stays IDLE if the driver refused the start */
+    if (Adc_GetGroupStatus(AdcConf_AdcGroup_TemperatureSensor) == ADC_IDLE)
     {
-        // temperature = IoHwAb_ConvertAdcToTemperature(adcValue);
+        return E_NOT_OK;
     }
-   //TODO: BUG READ GROUP NOT GET THE VALUE RESULT
     
-    return temperature;
+    IoHwAb_TempRequestTicks = 0u;
+    IoHwAb_TempRequestPending = TRUE;
+    
+    return E_OK;
+}
+
+/*
+ * Function: IoHwAb_GetTemperature
+ * Description: Constant-time read of the cached temperature and its age
+ */
+IoHwAb_TempStatusType IoHwAb_GetTemperature(uint16* value, uint32* ageMs)
+{
+    if (value != NULL_PTR)
+    {
+        *value = IoHwAb_TempCachedValue;
+    }
+    
+    if (ageMs != NULL_PTR)
+    {
+        *ageMs = (uint32)IoHwAb_TempAgeTicks * IOHWAB_MAINFUNCTION_PERIOD_MS;
+    }
+    
+    return IoHwAb_TempStatus;
+}
+
+/*
+ * Function: IoHwAb_MainFunction
+ * Description: Collect finished conversions, age cache and handle timeout
+ */
+void IoHwAb_MainFunction(void)
+{
+    uint16 adcValue = 0;
+    sint16 temperature = 0;
+    
+    /* Check if module is initialized */
+    if (IoHwAb_ModuleState != IOHWAB_INITIALIZED)
+    {
+        return;
+    }
+    
+    /* Age the cached value */
+    if (IoHwAb_TempAgeTicks < IOHWAB_TEMP_AGE_MAX_TICKS)
+    {
+        IoHwAb_TempAgeTicks++;
+    }
+    
+    if ((IoHwAb_TempStatus == IOHWAB_TEMP_STATUS_VALID) &&
+        (IoHwAb_TempAgeTicks >= IOHWAB_MS_TO_TICKS(IOHWAB_TEMP_STALE_MS)))
+    {
+        IoHwAb_TempStatus = IOHWAB_TEMP_STATUS_STALE;
+    }
+    
+    if (IoHwAb_MonActive == TRUE)
+    {
+        IoHwAb_MonitorSupervise();
+    }
+    
+    if (IoHwAb_TempRequestPending == FALSE)
+    {
+        return;
+    }
+    
+    /* Notification is the normal path, group status covers a disabled notification */
+    if ((IoHwAb_TempConvDone == TRUE) ||
+        (Adc_GetGroupStatus(AdcConf_AdcGroup_TemperatureSensor) == ADC_STREAM_COMPLETED))
+    {
+        if (Adc_ReadGroup(AdcConf_AdcGroup_TemperatureSensor, &adcValue) == E_OK)
+        {
+            /* Filter in ADC codes, the table then maps the smoothed code */
+            (void)IoHwAb_FilterProcess(IOHWAB_FILTER_SIGNAL_TEMPERATURE, &adcValue, 1u, 1u, &adcValue);
+            temperature = IoHwAb_ConvertAdcToTemperature(adcValue);
+            
+            /* The cache is unsigned, below 0 degC reads as 0 */
+            IoHwAb_TempCachedValue = (temperature > 0) ? (uint16)temperature : 0u;
+            IoHwAb_TempAgeTicks = 0u;
+            IoHwAb_TempStatus = IOHWAB_TEMP_STATUS_VALID;
+            IoHwAb_TempRequestPending = FALSE;
+            IoHwAb_TempConvDone = FALSE;
+            
+            IoHwAb_TemperatureReady(IOHWAB_TEMP_STATUS_VALID);
+            return;
+        }
+    }
+    
+    /* Abort a conversion that never completes instead of hanging */
+    if (++IoHwAb_TempRequestTicks >= IOHWAB_MS_TO_TICKS(IOHWAB_TEMP_TIMEOUT_MS))
+    {
+        Adc_StopGroupConversion(AdcConf_AdcGroup_TemperatureSensor);
+        IoHwAb_TempRequestPending = FALSE;
+        IoHwAb_TempConvDone = FALSE;
+        
+        if (IoHwAb_TempStatus == IOHWAB_TEMP_STATUS_VALID)
+        {
+            IoHwAb_TempStatus = IOHWAB_TEMP_STATUS_STALE;
+        }
+        
+        IoHwAb_TemperatureReady(IoHwAb_TempStatus);
+    }
+}
+
+/*
+ * Function: Adc_Group1_Notification
+ * Description: ADC group notification for the temperature group (ISR context)
+ */
+void Adc_Group1_Notification(void)
+{
+    IoHwAb_TempConvDone = TRUE;
+}
+
+/*
+ * Function: IoHwAb_TemperatureReady
+ * Description: Default completion callback, override in the application
+ */
+__attribute__((weak)) void IoHwAb_TemperatureReady(IoHwAb_TempStatusType status)
+{
+    (void)status;
+}
+
+/*
+ * Function: IoHwAb_StartTemperatureMonitor
+ * Description: Background sampling, CPU woken by the analog watchdog on band change
+ */
+Std_ReturnType IoHwAb_StartTemperatureMonitor(const uint16* thresholds, uint8 count, uint16 hysteresis)
+{
+    uint8 i;
+    
+    /* Check if module is initialized */
+    if ((IoHwAb_ModuleState != IOHWAB_INITIALIZED) || (IoHwAb_TempRequestPending == TRUE))
+    {
+        return E_NOT_OK;
+    }
+    
+    if ((thresholds == NULL_PTR) || (count == 0u) || (count > IOHWAB_TEMP_MAX_THRESHOLDS))
+    {
+        return E_NOT_OK;
+    }
+    
+    for (i = 0u; i < count; i++)
+    {
+        /* Strictly ascending and above 0 so no band is empty */
+        if ((thresholds[i] == 0u) || (thresholds[i] > IOHWAB_ADC_RESOLUTION) ||
+            ((i > 0u) && (thresholds[i] <= thresholds[i - 1u])))
+        {
+            return E_NOT_OK;
+        }
+        IoHwAb_MonThresholds[i] = thresholds[i];
+    }
+    IoHwAb_MonCount = count;
+    IoHwAb_MonHysteresis = hysteresis;
+    IoHwAb_MonBand = 0u;
+    IoHwAb_MonSampleSeen = FALSE;
+    IoHwAb_MonAgeTicks = 0u;
+    IoHwAb_MonStale = FALSE;
+    
+    /* Half buffer notifications are the heartbeat of the stream */
+    Adc_EnableGroupNotification(AdcConf_AdcGroup_TemperatureMonitor);
+    
+    /* Window first, the first conversion already compares against it */
+    IoHwAb_SetMonitorWindow(0u);
+    Adc_EnableHardwareTrigger(AdcConf_AdcGroup_TemperatureMonitor);
+    if (Adc_GetGroupStatus(AdcConf_AdcGroup_TemperatureMonitor) == ADC_IDLE)
+    {
+        return E_NOT_OK;
+    }
+    
+    IoHwAb_MonActive = TRUE;
+    return E_OK;
+}
+
+/*
+ * Function: IoHwAb_StopTemperatureMonitor
+ * Description: Stop background sampling, the watchdog is disarmed with the group
+ */
+void IoHwAb_StopTemperatureMonitor(void)
+{
+    if (IoHwAb_MonActive == FALSE)
+    {
+        return;
+    }
+    
+    Adc_DisableHardwareTrigger(AdcConf_AdcGroup_TemperatureMonitor);
+    Adc_DisableGroupNotification(AdcConf_AdcGroup_TemperatureMonitor);
+    IoHwAb_MonActive = FALSE;
+}
+
+/*
+ * Function: Adc_Group7_Notification
+ * Description: Half buffer of the monitor group is done (ISR context)
+ */
+void Adc_Group7_Notification(void)
+{
+    IoHwAb_MonSampleSeen = TRUE;
+}
+
+/*
+ * Function: Adc_Group7_LimitNotification
+ * Description: Analog watchdog event of the monitor group (ISR context)
+ */
+void Adc_Group7_LimitNotification(Adc_GroupType Group, Adc_LimitEventType Event, Adc_ValueGroupType Value)
+{
+    /* Band straight from the value, it may have skipped one */
+    uint8 band = IoHwAb_MonitorBandOf(Value);
+    
+    (void)Group;
+    (void)Event;
+    
+    /* Re-arming with the new window keeps the watchdog quiet until the next crossing */
+    IoHwAb_SetMonitorWindow(band);
+    
+    if (band != IoHwAb_MonBand)
+    {
+        IoHwAb_MonBand = band;
+        IoHwAb_TemperatureBandChanged(band);
+    }
+}
+
+/*
+ * Function: IoHwAb_TemperatureBandChanged
+ * Description: Default band change callback, override in the application
+ */
+__attribute__((weak)) void IoHwAb_TemperatureBandChanged(uint8 band)
+{
+    (void)band;
 }
 
 /*
@@ -185,7 +477,7 @@ void IoHwAb_SetLed(boolean state)
     dioLevel = (state == TRUE) ? STD_LOW : STD_HIGH; // Active low logic
     
     /* Set LED state */
-    Dio_WriteChannel(IOHWAB_DIO_CHANNEL_LED, dioLevel);
+    Dio_FastWriteChannel(IOHWAB_DIO_CHANNEL_LED, dioLevel);
     
 }
 
@@ -198,49 +490,113 @@ void IoHwAb_SetLed(boolean state)
  */
 
 /*
- * Function: IoHwAb_ConvertAdcToTemperature
- * Description: Convert raw ADC value to temperature in Celsius
+ * Function: IoHwAb_SetMonitorWindow
+ * Description: Band b covers [T(b-1), T(b)), the window adds the hysteresis on both sides
  */
-static uint16 IoHwAb_ConvertAdcToTemperature(uint16 adcValue)
+static void IoHwAb_SetMonitorWindow(uint8 band)
 {
-    uint32 millivolts = 0;
-    uint16 temperature = 0;
-    
-    #if (IOHWAB_TEMP_SENSOR_TYPE == TEMP_SENSOR_LM35)
+    uint16 low = 0u;
+    uint32 high = IOHWAB_ADC_RESOLUTION;
     
-    /* LM35 Temperature Sensor Conversion */
-    /* Formula: Temp(°C) = (ADC_Value * Vref_mV) / (ADC_Resolution * mV_per_°C) */
-    /* LM35: 10mV/°C linear response */
-    
-    millivolts = ((uint32)adcValue * IOHWAB_ADC_VREF_MV) / IOHWAB_ADC_RESOLUTION;
-    temperature = (uint16)(millivolts / IOHWAB_LM35_MV_PER_CELSIUS);
+    if (band > 0u)
+    {
+        uint16 border = IoHwAb_MonThresholds[band - 1u];
+        low = (border > IoHwAb_MonHysteresis) ? (uint16)(border - IoHwAb_MonHysteresis) : 0u;
+    }
     
-    #elif (IOHWAB_TEMP_SENSOR_TYPE == TEMP_SENSOR_NTC)
+    if (band < IoHwAb_MonCount)
+    {
+        high = (uint32)IoHwAb_MonThresholds[band] + IoHwAb_MonHysteresis - 1u;
+        if (high > IOHWAB_ADC_RESOLUTION)
+        {
+            high = IOHWAB_ADC_RESOLUTION;
+        }
+    }
     
-    /* NTC Thermistor Conversion */
-    /* TODO: Implement NTC conversion using Steinhart-Hart equation */
-    /* or lookup table for better accuracy */
+    Adc_SetGroupLimits(AdcConf_AdcGroup_TemperatureMonitor, low, (uint16)high);
+}
+
+/*
+ * Function: IoHwAb_MonitorBandOf
+ * Description: Band b covers [T(b-1), T(b)), no hysteresis
+ */
+static uint8 IoHwAb_MonitorBandOf(uint16 value)
+{
+    uint8 band = 0u;
     
-    /* Simplified linear approximation (not recommended for production) */
-    /* This is just a placeholder - implement proper NTC conversion */
-    millivolts = ((uint32)adcValue * IOHWAB_ADC_VREF_MV) / IOHWAB_ADC_RESOLUTION;
+    while ((band < IoHwAb_MonCount) && (value >= IoHwAb_MonThresholds[band]))
+    {
+        band++;
+    }
+    return band;
+}
+
+/*
+ * Function: IoHwAb_MonitorSupervise
+ * Description: The watchdog is silent both in band and when the stream is dead,
+ *              so a stream without notifications for IOHWAB_TEMP_STALE_MS reports
+ *              the top band. The first samples after that report the real band.
+ */
+static void IoHwAb_MonitorSupervise(void)
+{
+    Adc_ValueGroupType* samples = NULL_PTR;
+    Adc_StreamNumSampleType count;
+    uint8 band;
     
-    /* Simple linear mapping (INCORRECT for NTC - fix this!) */
-    /* Assuming 25°C at mid-range voltage for demonstration */
-    if (millivolts > 1650)  /* Above 1.65V */
+    if (IoHwAb_MonSampleSeen == FALSE)
     {
-        temperature = 25 - ((millivolts - 1650) / 50);  /* Rough approximation */
+        if (IoHwAb_MonAgeTicks < IOHWAB_TEMP_AGE_MAX_TICKS)
+        {
+            IoHwAb_MonAgeTicks++;
+        }
+        
+        if ((IoHwAb_MonStale == FALSE) &&
+            (IoHwAb_MonAgeTicks >= IOHWAB_MS_TO_TICKS(IOHWAB_TEMP_STALE_MS)))
+        {
+            IoHwAb_MonStale = TRUE;
+            IoHwAb_MonBand = IoHwAb_MonCount;
+            IoHwAb_TemperatureBandChanged(IoHwAb_MonCount);
+        }
+        return;
     }
-    else
+    
+    IoHwAb_MonSampleSeen = FALSE;
+    IoHwAb_MonAgeTicks = 0u;
+    if (IoHwAb_MonStale == FALSE)
     {
-        temperature = 25 + ((1650 - millivolts) / 50);  /* Rough approximation */
+        return;
     }
     
-    #else
-    #error "Unsupported temperature sensor type"
-    #endif
+    /* No crossing since the stop leaves the watchdog quiet, take the band from the data */
+    count = Adc_GetStreamLastPointer(AdcConf_AdcGroup_TemperatureMonitor, &samples);
+    if ((count == 0u) || (samples == NULL_PTR))
+    {
+        return;
+    }
     
-    return temperature;
+    band = IoHwAb_MonitorBandOf(samples[count - 1u]);
+    IoHwAb_MonStale = FALSE;
+    IoHwAb_SetMonitorWindow(band);
+    IoHwAb_MonBand = band;
+    IoHwAb_TemperatureBandChanged(band);
+}
+
+/*
+ * Function: IoHwAb_ConvertAdcToTemperature
+ * Description: Convert raw ADC value to temperature in 0.01 degC via the lookup table
+ */
+sint16 IoHwAb_ConvertAdcToTemperature(uint16 adcValue)
+{
+    /* Table entry i holds the temperature at code (i << SHIFT), the last entry
+     * lies one segment past full scale so code 4095 still has a right neighbour */
+    uint32 code  = (uint32)adcValue & IOHWAB_ADC_RESOLUTION;
+    uint32 index = code >> IOHWAB_TEMP_LUT_SHIFT;
+    sint32 frac  = (sint32)(code & ((1UL << IOHWAB_TEMP_LUT_SHIFT) - 1UL));
+    sint32 t0    = IoHwAb_TempLut[index];
+    sint32 t1    = IoHwAb_TempLut[index + 1U];
+    
+    /* Arithmetic shift of the signed delta, the span of one segment is exact */
+    return (sint16)(t0 + (((t1 - t0) * frac) >> IOHWAB_TEMP_LUT_SHIFT));
 }
 
 /*
@@ -271,14 +627,10 @@ static uint16 IoHwAb_ConvertPercentToPwm(uint8 percent)
  */
 static boolean IoHwAb_ValidateParameters(uint8 functionId, uint32 param, uint32 min, uint32 max)
 {
-    /* Suppress unused parameter warning */
-    (void)functionId;
-    
     /* Check parameter range */
     if ((param < min) || (param > max))
     {
-        /* TODO: Report error with Development Error Tracer (DET) if available */
-        /* Det_ReportError(IOHWAB_MODULE_ID, 0, functionId, IOHWAB_E_PARAM_VALUE); */
+        (void)Det_ReportError(IOHWAB_MODULE_ID, IOHWAB_INSTANCE_ID, functionId, IOHWAB_E_PARAM_VALUE);
         return FALSE;
     }
     
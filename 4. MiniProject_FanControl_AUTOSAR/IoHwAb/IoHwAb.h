@@ -45,6 +45,8 @@ extern const Adc_ConfigType Adc_Config;
 extern Adc_ValueGroupType Adc_ResultBuffer[ADC_MAX_GROUPS][ADC_MAX_BUFFER_SIZE];
 extern Adc_ValueGroupType Adc_Group1_ResultBuffer[ADC_CHANNEL_GROUP_1_RESULT_SIZE];  
 
+extern const sint16 IoHwAb_TempLut[];
+
 extern const Pwm_ConfigType Pwm_Config;
 extern Pwm_ChannelConfigType Pwm_ChannelConfig[PWM_MAX_CHANNELS];
 extern Pwm_HwUnitConfigType Pwm_HwUnitConfig[PWM_MAX_HW_UNITS];
@@ -68,6 +70,14 @@ typedef enum
     TEMP_SENSOR_NTC  = 1       /* NTC thermistor */
 } IoHwAb_TempSensorType;
 
+/* Quality of the cached temperature value */
+typedef enum
+{
+    IOHWAB_TEMP_STATUS_INVALID = 0,  /* No sample acquired yet */
+    IOHWAB_TEMP_STATUS_VALID   = 1,  /* Cached sample is fresh */
+    IOHWAB_TEMP_STATUS_STALE   = 2   /* Cached sample too old or last request timed out */
+} IoHwAb_TempStatusType;
+
 
 /*
  * =====================================================
@@ -78,6 +88,7 @@ typedef enum
 /* Module version information */
 #define IOHWAB_VENDOR_ID                    1
 #define IOHWAB_MODULE_ID                    255    /* IoHwAb doesn't have standard ID */
+#define IOHWAB_INSTANCE_ID                  0
 #define IOHWAB_AR_RELEASE_MAJOR_VERSION     4
 #define IOHWAB_AR_RELEASE_MINOR_VERSION     2
 #define IOHWAB_AR_RELEASE_REVISION_VERSION  2
@@ -85,6 +96,9 @@ typedef enum
 #define IOHWAB_SW_MINOR_VERSION             0
 #define IOHWAB_SW_PATCH_VERSION             0
 
+/* Development error codes */
+#define IOHWAB_E_PARAM_VALUE                0x01   /* Parameter out of range */
+
 /* Hardware pin assignments */
 #define IOHWAB_TEMP_SENSOR_PIN              0      /* PA0 - ADC input */
 #define IOHWAB_FAN_PWM_PIN                  8      /* PA8 - PWM output */
@@ -96,6 +110,15 @@ typedef enum
 #define IOHWAB_TEMP_MAX_CELSIUS             100    /* Maximum measurable temperature */
 #define IOHWAB_TEMP_INVALID_VALUE           0xFFFF  /* Invalid temperature reading */
 
+/* Asynchronous acquisition timing */
+#define IOHWAB_MAINFUNCTION_PERIOD_MS       10u     /* IoHwAb_MainFunction call period */
+#define IOHWAB_TEMP_TIMEOUT_MS              50u     /* Max time for one conversion request */
+#define IOHWAB_TEMP_STALE_MS                3000u   /* Cached value older than this is stale */
+#define IOHWAB_TEMP_AGE_MAX_TICKS           0xFFFFu /* Age counter saturation value */
+
+/* Temperature band monitoring (analog watchdog) */
+#define IOHWAB_TEMP_MAX_THRESHOLDS          4u      /* Band borders, bands = thresholds + 1 */
+
 /* Fan control specifications */
 #define IOHWAB_FAN_DUTY_MIN                 0      /* Minimum duty cycle (%) */
 #define IOHWAB_FAN_DUTY_MAX                 100    /* Maximum duty cycle (%) */
@@ -110,6 +133,10 @@ typedef enum
 #define IOHWAB_ADC_RESOLUTION           4095       /* 12-bit ADC: 0-4095 */
 #define IOHWAB_ADC_VREF_MV              3300       /* 3.3V reference in mV */
 #define IOHWAB_LM35_MV_PER_CELSIUS      10
+
+/* Temperature lookup table, generated into IoHwAb_TempLut.c by 'make templut' */
+#define IOHWAB_TEMP_LUT_SHIFT           6          /* Segment width 2^6 ADC codes, use 5 for NTC */
+#define IOHWAB_TEMP_LUT_SIZE            ((IOHWAB_ADC_RESOLUTION >> IOHWAB_TEMP_LUT_SHIFT) + 2)
 /* PWM conversion constants */
 #define IOHWAB_PWM_MAX_VALUE            0x8000     /* PWM driver max duty cycle */
 #define IOHWAB_PERCENT_MAX              100        /* 100% */
@@ -146,17 +173,136 @@ void IoHwAb_Init(void);
 /*
  * Function: IoHwAb_ReadTemperature
  * Service ID: 0x02
+ * Sync/Async: Asynchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint16 - Last valid temperature in 0.01 degC, 0 below 0 degC
+ *                       Returns IOHWAB_TEMP_INVALID_VALUE if the cache is invalid or stale
+ * Description: Return the cached temperature without waiting for the ADC.
+ *              A new acquisition is requested if none is pending.
+ */
+uint16 IoHwAb_ReadTemperature(void);
+
+/*
+ * Function: IoHwAb_RequestTemperature
+ * Service ID: 0x06
+ * Sync/Async: Asynchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType - E_OK if a conversion was started,
+ *                                E_NOT_OK if not initialized or a request is pending
+ * Description: Start one temperature conversion. Completion is signalled by the
+ *              ADC group notification and collected in IoHwAb_MainFunction.
+ */
+Std_ReturnType IoHwAb_RequestTemperature(void);
+
+/*
+ * Function: IoHwAb_GetTemperature
+ * Service ID: 0x07
  * Sync/Async: Synchronous
  * Reentrancy: Reentrant
  * Parameters (in): None
  * Parameters (inout): None
+ * Parameters (out): value - Last good temperature in 0.01 degC (may be NULL_PTR)
+ *                   ageMs - Age of the last good reading in ms (may be NULL_PTR)
+ * Return value: IoHwAb_TempStatusType - Quality of the cached reading
+ * Description: Constant-time read of the cached temperature and its age.
+ */
+IoHwAb_TempStatusType IoHwAb_GetTemperature(uint16* value, uint32* ageMs);
+
+/*
+ * Function: IoHwAb_MainFunction
+ * Service ID: 0x08
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
  * Parameters (out): None
- * Return value: uint16 - Current temperature in Celsius (0-100°C)
- *                       Returns IOHWAB_TEMP_INVALID_VALUE on error
- * Description: Read the current temperature from the analog temperature sensor.
- *              Converts ADC reading to temperature value in Celsius.
+ * Return value: None
+ * Description: Cyclic job, called every IOHWAB_MAINFUNCTION_PERIOD_MS.
+ *              Collects finished conversions, ages the cache and aborts
+ *              requests that exceed IOHWAB_TEMP_TIMEOUT_MS. While monitoring,
+ *              reports the top band when the stream is silent for
+ *              IOHWAB_TEMP_STALE_MS.
  */
-uint16 IoHwAb_ReadTemperature(void);
+void IoHwAb_MainFunction(void);
+
+/*
+ * Function: IoHwAb_TemperatureReady
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): status - IOHWAB_TEMP_STATUS_VALID on a new sample, otherwise
+ *                           the cache status after the request timed out
+ * Return value: None
+ * Description: Weak callback invoked from IoHwAb_MainFunction when a request
+ *              finishes. Override it in the application to be notified.
+ */
+void IoHwAb_TemperatureReady(IoHwAb_TempStatusType status);
+
+/*
+ * Function: IoHwAb_StartTemperatureMonitor
+ * Service ID: 0x09
+ * Sync/Async: Asynchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): thresholds - Ascending band borders in raw ADC counts
+ *                  count - Number of thresholds (1..IOHWAB_TEMP_MAX_THRESHOLDS)
+ *                  hysteresis - Counts a value must pass a border by to change band
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType - E_OK if monitoring started,
+ *                                E_NOT_OK if not initialized, a request is pending
+ *                                or the thresholds are invalid
+ * Description: Sample the sensor in the background and arm the ADC analog watchdog
+ *              around the current band. The CPU is only interrupted when the value
+ *              leaves the band plus hysteresis. Monitoring starts in band 0.
+ *              A stream that stops is reported as the top band by
+ *              IoHwAb_MainFunction, the band is reported again once it resumes.
+ *              IoHwAb_RequestTemperature is refused while monitoring runs.
+ */
+Std_ReturnType IoHwAb_StartTemperatureMonitor(const uint16* thresholds, uint8 count, uint16 hysteresis);
+
+/*
+ * Function: IoHwAb_StopTemperatureMonitor
+ * Service ID: 0x0A
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Stop background sampling and disarm the analog watchdog.
+ */
+void IoHwAb_StopTemperatureMonitor(void);
+
+/*
+ * Function: IoHwAb_TemperatureBandChanged
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): band - New band, 0 = below the first threshold
+ * Return value: None
+ * Description: Weak callback invoked from the ADC watchdog interrupt when the
+ *              monitored value changes band, and from IoHwAb_MainFunction when
+ *              the stream stops or resumes. Override it in the application.
+ */
+void IoHwAb_TemperatureBandChanged(uint8 band);
+
+/*
+ * Function: IoHwAb_ConvertAdcToTemperature
+ * Service ID: 0x0B
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): adcValue - Raw ADC reading (0-4095), as cached by IoHwAb
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: sint16 - Temperature in 0.01 degC, clamped to -55.00..150.00 degC
+ * Description: Linear interpolation in the generated IoHwAb_TempLut table.
+ *              Constant time, no divisions and no branches.
+ */
+sint16 IoHwAb_ConvertAdcToTemperature(uint16 adcValue);
 
 /*
  * Function: IoHwAb_SetFanDuty
@@ -262,6 +408,16 @@ boolean IoHwAb_SelfTest(void);
     #error "Invalid fan duty cycle range configuration"
 #endif
 
+/* Validate acquisition timing */
+#if (IOHWAB_MAINFUNCTION_PERIOD_MS == 0) || (IOHWAB_TEMP_TIMEOUT_MS < IOHWAB_MAINFUNCTION_PERIOD_MS)
+    #error "Invalid temperature acquisition timing configuration"
+#endif
+
+/* Validate temperature band monitor */
+#if (ADC_ENABLE_LIMIT_CHECKING != STD_ON) || (IOHWAB_TEMP_MAX_THRESHOLDS == 0)
+    #error "Temperature band monitor needs ADC_ENABLE_LIMIT_CHECKING and at least one threshold"
+#endif
+
 #endif /* IOHWAB_H */
 
 /*
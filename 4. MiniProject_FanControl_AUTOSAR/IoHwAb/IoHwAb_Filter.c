@@ -0,0 +1,341 @@
+/****************************************************************************************
+*                        AUTOSAR IoHwAb Module - Signal Filters                        *
+****************************************************************************************
+* File Name   : IoHwAb_Filter.c
+* Module      : I/O Hardware Abstraction Layer
+* Description : Per-signal streaming filter chains (boxcar, IIR, median)
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * =====================================================
+ *  INCLUDES
+ * =====================================================
+ */
+#include "IoHwAb.h"
+#include "IoHwAb_Filter.h"
+
+/*
+ * =====================================================
+ *  LOCAL VARIABLES
+ * =====================================================
+ */
+
+/* Chain passed validation in IoHwAb_FilterInit */
+static boolean IoHwAb_FilterValid[IOHWAB_FILTER_MAX_SIGNALS];
+
+/* First sample after init/reset primes the stages */
+static boolean IoHwAb_FilterPrimed[IOHWAB_FILTER_MAX_SIGNALS];
+
+/* Last chain output */
+static uint16 IoHwAb_FilterOutput[IOHWAB_FILTER_MAX_SIGNALS];
+
+/*
+ * =====================================================
+ *  LOCAL FUNCTION PROTOTYPES
+ * =====================================================
+ */
+
+/*
+ * Function: IoHwAb_FilterValidateStage
+ * Description: Check one stage configuration and derive its constant state
+ * Parameters: Stage - Stage configuration
+ *             State - Stage runtime state, Shift is set for a boxcar
+ * Return: boolean - TRUE if the stage can run
+ */
+static boolean IoHwAb_FilterValidateStage(const IoHwAb_FilterStageDefType* Stage,
+                                          IoHwAb_FilterStageStateType* State);
+
+/*
+ * Function: IoHwAb_FilterPrimeStage
+ * Description: Fill the stage history with one value
+ * Parameters: Stage - Stage configuration
+ *             State - Stage runtime state
+ *             Value - Input sample
+ * Return: uint16 - Stage output, equal to the input
+ */
+static uint16 IoHwAb_FilterPrimeStage(const IoHwAb_FilterStageDefType* Stage,
+                                      IoHwAb_FilterStageStateType* State, uint16 Value);
+
+/*
+ * Function: IoHwAb_FilterStepStage
+ * Description: Feed one sample into a primed stage
+ * Parameters: Stage - Stage configuration
+ *             State - Stage runtime state
+ *             Value - Input sample
+ * Return: uint16 - Stage output
+ */
+static uint16 IoHwAb_FilterStepStage(const IoHwAb_FilterStageDefType* Stage,
+                                     IoHwAb_FilterStageStateType* State, uint16 Value);
+
+/*
+ * =====================================================
+ *  PUBLIC FUNCTION IMPLEMENTATIONS
+ * =====================================================
+ */
+
+/*
+ * Function: IoHwAb_FilterInit
+ * Description: Validate the filter configuration and reset all chains
+ */
+Std_ReturnType IoHwAb_FilterInit(void)
+{
+    Std_ReturnType result = E_OK;
+    IoHwAb_FilterSignalType signal;
+    uint8 stage;
+
+    for (signal = 0u; signal < IOHWAB_FILTER_MAX_SIGNALS; signal++)
+    {
+        const IoHwAb_FilterSignalDefType* chain = &IoHwAb_FilterConfig[signal];
+        boolean valid = ((chain->NbrOfStages == 0u) ||
+                         ((chain->Stages != NULL_PTR) && (chain->State != NULL_PTR))) ? TRUE : FALSE;
+
+        for (stage = 0u; (valid == TRUE) && (stage < chain->NbrOfStages); stage++)
+        {
+            valid = IoHwAb_FilterValidateStage(&chain->Stages[stage], &chain->State[stage]);
+        }
+
+        IoHwAb_FilterValid[signal] = valid;
+        IoHwAb_FilterReset(signal);
+
+        if (valid == FALSE)
+        {
+            result = E_NOT_OK;
+        }
+    }
+
+    return result;
+}
+
+/*
+ * Function: IoHwAb_FilterReset
+ * Description: Forget the history of one signal
+ */
+void IoHwAb_FilterReset(IoHwAb_FilterSignalType Signal)
+{
+    if (Signal < IOHWAB_FILTER_MAX_SIGNALS)
+    {
+        IoHwAb_FilterPrimed[Signal] = FALSE;
+        IoHwAb_FilterOutput[Signal] = IOHWAB_TEMP_INVALID_VALUE;
+    }
+}
+
+/*
+ * Function: IoHwAb_FilterProcess
+ * Description: Run a block of samples through the chain of one signal
+ */
+Std_ReturnType IoHwAb_FilterProcess(IoHwAb_FilterSignalType Signal, const Adc_ValueGroupType* Samples,
+                                    uint16 NbrOfSamples, uint8 Stride, uint16* Output)
+{
+    const IoHwAb_FilterSignalDefType* chain;
+    uint16 value = 0u;
+    uint16 sample;
+    uint8 stage;
+
+    if ((Signal >= IOHWAB_FILTER_MAX_SIGNALS) || (IoHwAb_FilterValid[Signal] == FALSE) ||
+        (Samples == NULL_PTR) || (Stride == 0u))
+    {
+        return E_NOT_OK;
+    }
+
+    chain = &IoHwAb_FilterConfig[Signal];
+
+    for (sample = 0u; sample < NbrOfSamples; sample++)
+    {
+        value = *Samples;
+        Samples += Stride;
+
+        if (IoHwAb_FilterPrimed[Signal] == TRUE)
+        {
+            for (stage = 0u; stage < chain->NbrOfStages; stage++)
+            {
+                value = IoHwAb_FilterStepStage(&chain->Stages[stage], &chain->State[stage], value);
+            }
+        }
+        else
+        {
+            for (stage = 0u; stage < chain->NbrOfStages; stage++)
+            {
+                value = IoHwAb_FilterPrimeStage(&chain->Stages[stage], &chain->State[stage], value);
+            }
+            IoHwAb_FilterPrimed[Signal] = TRUE;
+        }
+    }
+
+    if (NbrOfSamples > 0u)
+    {
+        IoHwAb_FilterOutput[Signal] = value;
+    }
+
+    if (Output != NULL_PTR)
+    {
+        *Output = IoHwAb_FilterOutput[Signal];
+    }
+
+    return E_OK;
+}
+
+/*
+ * Function: IoHwAb_FilterGetOutput
+ * Description: Last output of one signal
+ */
+uint16 IoHwAb_FilterGetOutput(IoHwAb_FilterSignalType Signal)
+{
+    if (Signal >= IOHWAB_FILTER_MAX_SIGNALS)
+    {
+        return IOHWAB_TEMP_INVALID_VALUE;
+    }
+
+    return IoHwAb_FilterOutput[Signal];
+}
+
+/*
+ * =====================================================
+ *  LOCAL FUNCTION IMPLEMENTATIONS
+ * =====================================================
+ */
+
+/*
+ * Function: IoHwAb_FilterValidateStage
+ * Description: Check one stage configuration
+ */
+static boolean IoHwAb_FilterValidateStage(const IoHwAb_FilterStageDefType* Stage,
+                                          IoHwAb_FilterStageStateType* State)
+{
+    uint8 shift = 0u;
+
+    switch (Stage->Kind)
+    {
+        case IOHWAB_FILTER_BOXCAR:
+            /* Power of two so the mean is a shift */
+            if ((Stage->Window == NULL_PTR) || (Stage->Length == 0u) ||
+                ((Stage->Length & (Stage->Length - 1u)) != 0u))
+            {
+                return FALSE;
+            }
+            while ((1u << shift) < Stage->Length)
+            {
+                shift++;
+            }
+            State->Shift = shift;
+            return TRUE;
+
+        case IOHWAB_FILTER_IIR:
+            return (boolean)((Stage->Alpha > 0u) && (Stage->Alpha <= IOHWAB_FILTER_Q15_MAX));
+
+        case IOHWAB_FILTER_MEDIAN:
+            /* Odd length so the median is one element */
+            return (boolean)((Stage->Window != NULL_PTR) && (Stage->Sorted != NULL_PTR) &&
+                             ((Stage->Length & 1u) != 0u));
+
+        default:
+            return FALSE;
+    }
+}
+
+/*
+ * Function: IoHwAb_FilterPrimeStage
+ * Description: Fill the stage history with one value
+ */
+static uint16 IoHwAb_FilterPrimeStage(const IoHwAb_FilterStageDefType* Stage,
+                                      IoHwAb_FilterStageStateType* State, uint16 Value)
+{
+    uint8 i;
+
+    State->Index = 0u;
+
+    switch (Stage->Kind)
+    {
+        case IOHWAB_FILTER_BOXCAR:
+            for (i = 0u; i < Stage->Length; i++)
+            {
+                Stage->Window[i] = Value;
+            }
+            State->Acc = (uint32)Value << State->Shift;
+            break;
+
+        case IOHWAB_FILTER_IIR:
+            State->Acc = (uint32)Value << IOHWAB_FILTER_IIR_FRAC_BITS;
+            break;
+
+        case IOHWAB_FILTER_MEDIAN:
+            for (i = 0u; i < Stage->Length; i++)
+            {
+                Stage->Window[i] = Value;
+                Stage->Sorted[i] = Value;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return Value;
+}
+
+/*
+ * Function: IoHwAb_FilterStepStage
+ * Description: Feed one sample into a primed stage
+ */
+static uint16 IoHwAb_FilterStepStage(const IoHwAb_FilterStageDefType* Stage,
+                                     IoHwAb_FilterStageStateType* State, uint16 Value)
+{
+    uint16 oldest;
+    uint8 pos;
+    sint64 delta;
+
+    switch (Stage->Kind)
+    {
+        case IOHWAB_FILTER_BOXCAR:
+            /* Running sum: add the newest, drop the oldest */
+            oldest = Stage->Window[State->Index];
+            Stage->Window[State->Index] = Value;
+            if (++State->Index >= Stage->Length)
+            {
+                State->Index = 0u;
+            }
+            State->Acc = State->Acc + Value - oldest;
+            return (uint16)((State->Acc + ((1UL << State->Shift) >> 1)) >> State->Shift);
+
+        case IOHWAB_FILTER_IIR:
+            /* y += alpha * (x - y), 16-bit input with 16 fraction bits needs a 64-bit product */
+            delta = ((sint64)Value << IOHWAB_FILTER_IIR_FRAC_BITS) - (sint64)State->Acc;
+            State->Acc = (uint32)((sint64)State->Acc + ((delta * Stage->Alpha) >> 15));
+            return (uint16)((State->Acc + (1UL << (IOHWAB_FILTER_IIR_FRAC_BITS - 1u))) >>
+                            IOHWAB_FILTER_IIR_FRAC_BITS);
+
+        case IOHWAB_FILTER_MEDIAN:
+            oldest = Stage->Window[State->Index];
+            Stage->Window[State->Index] = Value;
+            if (++State->Index >= Stage->Length)
+            {
+                State->Index = 0u;
+            }
+
+            /* The slot of the oldest value becomes a hole, slide it to where the
+             * new value belongs, only one of the two loops moves */
+            pos = 0u;
+            while (Stage->Sorted[pos] != oldest)
+            {
+                pos++;
+            }
+            while ((pos > 0u) && (Stage->Sorted[pos - 1u] > Value))
+            {
+                Stage->Sorted[pos] = Stage->Sorted[pos - 1u];
+                pos--;
+            }
+            while (((uint8)(pos + 1u) < Stage->Length) && (Stage->Sorted[pos + 1u] < Value))
+            {
+                Stage->Sorted[pos] = Stage->Sorted[pos + 1u];
+                pos++;
+            }
+            Stage->Sorted[pos] = Value;
+            return Stage->Sorted[Stage->Length >> 1];
+
+        default:
+            return Value;
+    }
+}
@@ -0,0 +1,148 @@
+/****************************************************************************************
+*                        AUTOSAR IoHwAb Module - Signal Filters                        *
+****************************************************************************************
+* File Name   : IoHwAb_Filter.h
+* Module      : I/O Hardware Abstraction Layer
+* Description : Per-signal streaming filter chains (boxcar, IIR, median)
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+#ifndef IOHWAB_FILTER_H
+#define IOHWAB_FILTER_H
+
+/*
+ * =====================================================
+ *  INCLUDES
+ * =====================================================
+ */
+#include "Common/Inc/Std_Types.h"      /* AUTOSAR standard types */
+#include "MCAL/Adc/Inc/Adc.h"        /* Adc_ValueGroupType of the DMA buffers */
+#include "IoHwAb_Cfg.h"               /* Signal IDs and counts */
+
+/*
+ * =====================================================
+ *  TYPE DEFINITIONS
+ * =====================================================
+ */
+
+/* Filtered signal, index into IoHwAb_FilterConfig */
+typedef uint8 IoHwAb_FilterSignalType;
+
+/* Filter stage algorithm */
+typedef enum
+{
+    IOHWAB_FILTER_BOXCAR = 0,   /* Moving average over a running sum, O(1) */
+    IOHWAB_FILTER_IIR    = 1,   /* First-order low pass with Q15 weight, O(1) */
+    IOHWAB_FILTER_MEDIAN = 2    /* Median of the window, sorted incrementally, O(Length) */
+} IoHwAb_FilterKindType;
+
+/* Stage configuration (flash) */
+typedef struct
+{
+    IoHwAb_FilterKindType Kind;
+    uint8 Length;               /* Boxcar: power of two, Median: odd, unused for IIR */
+    uint16 Alpha;               /* IIR: weight of the new sample in Q15, 1..32767 */
+    uint16* Window;             /* Boxcar/Median: Length entries in arrival order */
+    uint16* Sorted;             /* Median: Length entries kept in ascending order */
+} IoHwAb_FilterStageDefType;
+
+/* Stage runtime state (RAM) */
+typedef struct
+{
+    uint32 Acc;                 /* Boxcar: window sum, IIR: output in Q16 */
+    uint8 Index;                /* Boxcar/Median: oldest window entry */
+    uint8 Shift;                /* Boxcar: log2(Length) */
+} IoHwAb_FilterStageStateType;
+
+/* Filter chain of one signal, stages run in array order */
+typedef struct
+{
+    const IoHwAb_FilterStageDefType* Stages;
+    IoHwAb_FilterStageStateType* State;     /* NbrOfStages entries */
+    uint8 NbrOfStages;
+} IoHwAb_FilterSignalDefType;
+
+/*
+ * =====================================================
+ *  CONSTANTS AND MACROS
+ * =====================================================
+ */
+
+/* Q15 weight from a constant fraction, e.g. IOHWAB_FILTER_Q15(0.25) */
+#define IOHWAB_FILTER_Q15(x)            ((uint16)(((x) * 32768.0) + 0.5))
+#define IOHWAB_FILTER_Q15_MAX           32767u
+
+/* Fraction bits of the IIR accumulator */
+#define IOHWAB_FILTER_IIR_FRAC_BITS     16u
+
+extern const IoHwAb_FilterSignalDefType IoHwAb_FilterConfig[IOHWAB_FILTER_MAX_SIGNALS];
+
+/*
+ * =====================================================
+ *  FUNCTION PROTOTYPES
+ * =====================================================
+ */
+
+/*
+ * Function: IoHwAb_FilterInit
+ * Service ID: 0x0C
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType - E_OK if every configured chain is valid
+ * Description: Validate IoHwAb_FilterConfig and reset all chains. A signal with an
+ *              invalid chain is rejected by IoHwAb_FilterProcess.
+ */
+Std_ReturnType IoHwAb_FilterInit(void);
+
+/*
+ * Function: IoHwAb_FilterReset
+ * Service ID: 0x0D
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant for the same signal
+ * Parameters (in): Signal - Filtered signal
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Forget the history, the next sample primes every stage.
+ */
+void IoHwAb_FilterReset(IoHwAb_FilterSignalType Signal);
+
+/*
+ * Function: IoHwAb_FilterProcess
+ * Service ID: 0x0E
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-reentrant for the same signal
+ * Parameters (in): Signal - Filtered signal
+ *                  Samples - First sample of the signal, e.g. in a DMA stream buffer
+ *                  NbrOfSamples - Number of samples to run through the chain
+ *                  Stride - Distance between samples, the channel count of the group
+ * Parameters (inout): None
+ * Parameters (out): Output - Filter output after the last sample (may be NULL_PTR)
+ * Return value: Std_ReturnType - E_NOT_OK for an invalid signal or chain
+ * Description: Run a block of samples through the chain of the signal. The first
+ *              sample after init or reset fills every window, so the output does
+ *              not ramp up from zero.
+ */
+Std_ReturnType IoHwAb_FilterProcess(IoHwAb_FilterSignalType Signal, const Adc_ValueGroupType* Samples,
+                                    uint16 NbrOfSamples, uint8 Stride, uint16* Output);
+
+/*
+ * Function: IoHwAb_FilterGetOutput
+ * Service ID: 0x0F
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Signal - Filtered signal
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint16 - Last filter output, IOHWAB_TEMP_INVALID_VALUE before the
+ *                        first sample or for an invalid signal
+ * Description: Constant-time read of the last filter output.
+ */
+uint16 IoHwAb_FilterGetOutput(IoHwAb_FilterSignalType Signal);
+
+#endif /* IOHWAB_FILTER_H */
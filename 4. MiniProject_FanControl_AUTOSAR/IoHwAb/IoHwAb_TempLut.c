@@ -0,0 +1,33 @@
+/****************************************************************************************
+*                  IoHwAb Temperature Lookup Table - GENERATED FILE                    *
+****************************************************************************************
+* File Name   : IoHwAb_TempLut.c
+* Description : ADC code to temperature in 0.01 degC, generated by Tools/TempLutGen.
+*               Do not edit, regenerate with 'make templut'.
+* Sensor      : LM35, 10.000 mV/degC, VREF 3300 mV
+* Accuracy    : max 0.012 degC interpolation error over -40..125 degC
+****************************************************************************************/
+
+#include "IoHwAb.h"
+
+#if (IOHWAB_TEMP_LUT_SHIFT != 6)
+#error "IoHwAb_TempLut.c was generated for another IOHWAB_TEMP_LUT_SHIFT"
+#endif
+
+#if (IOHWAB_TEMP_SENSOR_TYPE != TEMP_SENSOR_LM35)
+#error "IoHwAb_TempLut.c was generated for another IOHWAB_TEMP_SENSOR_TYPE"
+#endif
+
+/* Entry i is the temperature at ADC code (i << IOHWAB_TEMP_LUT_SHIFT) */
+const sint16 IoHwAb_TempLut[IOHWAB_TEMP_LUT_SIZE] =
+{
+         0,    516,   1032,   1547,   2063,   2579,   3095,   3610,
+      4126,   4642,   5158,   5673,   6189,   6705,   7221,   7736,
+      8252,   8768,   9284,   9799,  10315,  10831,  11347,  11862,
+     12378,  12894,  13410,  13925,  14441,  14957,  15000,  15000,
+     15000,  15000,  15000,  15000,  15000,  15000,  15000,  15000,
+     15000,  15000,  15000,  15000,  15000,  15000,  15000,  15000,
+     15000,  15000,  15000,  15000,  15000,  15000,  15000,  15000,
+     15000,  15000,  15000,  15000,  15000,  15000,  15000,  15000,
+     15000
+};
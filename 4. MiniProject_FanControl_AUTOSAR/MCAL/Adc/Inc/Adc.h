@@ -96,6 +96,8 @@
 #define ADC_GET_CURRENT_POWER_STATE_ID      0x11U   /*!< Function ID for Adc_GetCurrentPowerState */
 #define ADC_GET_TARGET_POWER_STATE_ID       0x12U   /*!< Function ID for Adc_GetTargetPowerState */
 #define ADC_PREPARE_POWER_STATE_ID          0x0DU   /*!< Function ID for Adc_PreparePowerState */
+#define ADC_SET_HW_TRIGGER_TIMER_ID         0x0EU   /*!< Function ID for Adc_SetHwTriggerTimer */
+#define ADC_SET_GROUP_LIMITS_ID             0x0FU   /*!< Function ID for Adc_SetGroupLimits */
 
 /****************************************************************************************
 *                              GLOBAL VARIABLES                                        *
@@ -186,6 +188,9 @@ void Adc_StopGroupConversion (Adc_GroupType Group);
  * @return  Std_ReturnType
  *          E_OK: results are available and written to the data buffer
  *          E_NOT_OK: results are not available or an error occurred
+ * @note   For a dual ADC1/ADC2 group the buffer takes 2 x NbrOfChannel values:
+ *         the ADC1 ranks first, followed by the paired ADC2 ranks.
+ * @note   An oversampled group returns 12 + log2(N)/2 bit values, see Adc_OversamplingType.
  * @reqs   SWS_Adc_00369
  */
 Std_ReturnType Adc_ReadGroup (Adc_GroupType Group,
@@ -207,6 +212,31 @@ void Adc_EnableHardwareTrigger (Adc_GroupType Group);
  */
 void Adc_DisableHardwareTrigger (Adc_GroupType Group);
 
+/**
+ * @brief  Changes the sampling period of a timer-paced hardware-triggered group
+ * @param[in] Group: Numeric ID of the ADC channel group
+ * @param[in] TriggerTimer: New period in ADC_HW_TRIGGER_TICK_HZ ticks
+ * @return  void
+ * @note   Groups triggered from TIM1 follow the PWM period, their sample point is
+ *         moved with Pwm_SetAdcTriggerOffset instead. ADC_E_PARAM_CONFIG for a
+ *         period outside ADC_HW_TRIGGER_TIMER_MIN..ADC_HW_TRIGGER_TIMER_MAX,
+ *         ADC_E_WRONG_TRIGG_SRC for a group not paced by TIM2/TIM3/TIM4
+ */
+void Adc_SetHwTriggerTimer (Adc_GroupType Group, Adc_HwTriggerTimerType TriggerTimer);
+
+#if (ADC_ENABLE_LIMIT_CHECKING == STD_ON)
+/**
+ * @brief  Moves the analog watchdog window of a group configured with limit checking
+ * @param[in] Group: Numeric ID of the ADC channel group
+ * @param[in] LowLimit: Lowest in-range value, 12-bit
+ * @param[in] HighLimit: Highest in-range value, 12-bit
+ * @return  void
+ * @note   May be called from the limit notification to follow the value into the next
+ *         band, the watchdog interrupt is re-armed for the new window
+ */
+void Adc_SetGroupLimits (Adc_GroupType Group, Adc_ValueGroupType LowLimit, Adc_ValueGroupType HighLimit);
+#endif
+
 
 /**
  * @brief   Enables the notification mechanism for the requested ADC Channel group.
@@ -247,6 +277,8 @@ Adc_StatusType Adc_GetGroupStatus (Adc_GroupType Group);
  * @param[in] Group : Numeric ID of the ADC channel group
  * @param[out] PtrToSamplePtr : Pointer to result buffer pointer 
  * @return Adc_StreamNumSampleType : Number of valid samples per channel.
+ * @note    A dual ADC1/ADC2 group stores one ADC1, ADC2 pair per rank, so one
+ *          conversion round is 2 x NbrOfChannel values.
  * @reqs    SWS_Adc_00375
  */
 Adc_StreamNumSampleType Adc_GetStreamLastPointer (Adc_GroupType Group,
@@ -269,20 +301,35 @@ void Adc_GetVersionInfo (Std_VersionInfoType* versioninfo);
  * @param[in] ADCx ADC hardware module
  * @return void
  */
-void Adc_TransferComplete_Callback(ADC_TypeDef* ADCx);
+RAMFUNC void Adc_TransferComplete_Callback(ADC_TypeDef* ADCx);
+
+/**
+ * @brief Injected transfer complete callback
+ * @param[in] ADCx ADC hardware module
+ * @return void
+ */
+RAMFUNC void Adc_InjectedTransferComplete_Callback(ADC_TypeDef* ADCx);
+
+/**
+ * @brief Analog watchdog callback
+ * @param[in] ADCx ADC hardware module
+ * @return void
+ */
+void Adc_Watchdog_Callback(ADC_TypeDef* ADCx);
 
 /**
  * @brief DMA transfer complete callback
  * @param[in] DMAx_Channely DMA channel
  * @return void
  */
-void Adc_DmaTransferComplete_Callback(DMA_Channel_TypeDef* DMAx_Channely);
+RAMFUNC void Adc_DmaTransferComplete_Callback(DMA_Channel_TypeDef* DMAx_Channely);
 
 /**
- * @brief   Main function for deferred ADC processing
- * @return  void
+ * @brief DMA half transfer callback
+ * @param[in] DMAx_Channely DMA channel
+ * @return void
  */
-void Adc_MainFunction(void);
+RAMFUNC void Adc_DmaHalfTransfer_Callback(DMA_Channel_TypeDef* DMAx_Channely);
 
 /**
  * @brief   This API configures the Adc module so that 
@@ -100,6 +100,141 @@
  */
 #define ADC_HW_IS_EOC_SET(ADCx)     ((ADCx->SR & ADC_SR_EOC) != 0)
 
+/**
+ * @brief Check if a group is converted in scan mode with one DMA block transfer
+ * @param HwUnitCfg Pointer to hardware unit configuration
+ * @param GroupCfg Pointer to group configuration
+ * @return Non-zero if all ranks are programmed once and DMA moves the whole group
+ */
+#if (ADC_ENABLE_DMA == STD_ON)
+#define ADC_HW_IS_SCAN_DMA_GROUP(HwUnitCfg, GroupCfg) \
+    (((HwUnitCfg)->AdcHw_DMAAvailable == ADC_DMA_AVAILABLE) && \
+     ((GroupCfg)->Adc_InterruptType == ADC_HW_DMA))
+#else
+#define ADC_HW_IS_SCAN_DMA_GROUP(HwUnitCfg, GroupCfg)   (0)
+#endif
+
+/**
+ * @brief Check if a group converts ADC1/ADC2 rank pairs in regular simultaneous mode
+ * @param HwUnitCfg Pointer to hardware unit configuration
+ * @param GroupCfg Pointer to group configuration
+ * @return Non-zero if DMA moves one packed 32-bit word (ADC2 << 16 | ADC1) per rank
+ */
+#define ADC_HW_IS_DUAL_GROUP(HwUnitCfg, GroupCfg) \
+    (ADC_HW_IS_SCAN_DMA_GROUP(HwUnitCfg, GroupCfg) && \
+     ((HwUnitCfg)->AdcHw_DualMode == ADC_DUAL_MODE_REG_SIMULT) && \
+     ((GroupCfg)->Adc_PairedChannelGroup != NULL_PTR))
+
+/**
+ * @brief Number of Adc_ValueGroupType entries one rank takes in the result buffer
+ * @param HwUnitCfg Pointer to hardware unit configuration
+ * @param GroupCfg Pointer to group configuration
+ * @return 2 for dual groups (packed ADC1/ADC2 half-words), 1 otherwise
+ */
+#define ADC_HW_VALUES_PER_RANK(HwUnitCfg, GroupCfg) \
+    (ADC_HW_IS_DUAL_GROUP(HwUnitCfg, GroupCfg) ? 2U : 1U)
+
+/**
+ * @brief Check if a circular streaming group is double buffered with DMA HT + TC
+ * @param HwUnitCfg Pointer to hardware unit configuration
+ * @param GroupCfg Pointer to group configuration
+ * @return Non-zero if each buffer half is handed out while DMA fills the other
+ * @note Needs an even Adc_StreamNumSamples so both halves hold whole samples
+ */
+#define ADC_HW_IS_PING_PONG_GROUP(HwUnitCfg, GroupCfg) \
+    (ADC_HW_IS_SCAN_DMA_GROUP(HwUnitCfg, GroupCfg) && \
+     ((GroupCfg)->Adc_GroupAccessMode == ADC_ACCESS_MODE_STREAMING) && \
+     ((GroupCfg)->Adc_StreamBufferMode == ADC_STREAM_BUFFER_CIRCULAR) && \
+     ((GroupCfg)->Adc_StreamNumSamples >= 2U) && \
+     (((GroupCfg)->Adc_StreamNumSamples & 1U) == 0U))
+
+/**
+ * @brief Check if a group sums several raw rounds into one result
+ * @param HwUnitCfg Pointer to hardware unit configuration
+ * @param GroupCfg Pointer to group configuration
+ * @return Non-zero if DMA fills the staging buffer and the TC/HT handler decimates it
+ */
+#define ADC_HW_IS_OVERSAMPLED_GROUP(HwUnitCfg, GroupCfg) \
+    (ADC_HW_IS_SCAN_DMA_GROUP(HwUnitCfg, GroupCfg) && \
+     ((GroupCfg)->Adc_Oversampling != ADC_OVERSAMPLING_NONE) && \
+     ((GroupCfg)->Adc_OversamplingBufferPtr != NULL_PTR))
+
+/**
+ * @brief Right shift applied to the sum of an oversampled group
+ * @param GroupCfg Pointer to group configuration
+ * @return log2(N) - log2(N)/2, leaves 12 + log2(N)/2 result bits
+ */
+#define ADC_HW_OVERSAMPLING_SHIFT(GroupCfg) \
+    ((uint8)((GroupCfg)->Adc_Oversampling - ((GroupCfg)->Adc_Oversampling >> 1)))
+
+/**
+ * @brief Number of raw conversions summed into one result round
+ * @param GroupCfg Pointer to group configuration
+ * @return Adc_NbrOfChannel x oversampling ratio, one staging half
+ */
+#define ADC_HW_OVERSAMPLING_BLOCK_SIZE(GroupCfg) \
+    ((uint16)((uint16)(GroupCfg)->Adc_NbrOfChannel << (GroupCfg)->Adc_Oversampling))
+
+/**
+ * @brief Words summed per lane before the 16-bit lanes are folded
+ * @note 16 x 4095 = 65520 still fits a half-word, needs right aligned 12-bit data
+ */
+#define ADC_HW_OVERSAMPLING_LANE_WORDS      16U
+
+/**
+ * @brief Check if a group is converted on the injected sequence
+ * @param GroupCfg Pointer to group configuration
+ * @return Non-zero for ADC_GROUP_KIND_INJECTED
+ */
+#define ADC_HW_IS_INJECTED_GROUP(GroupCfg) \
+    ((GroupCfg)->Adc_GroupKind == ADC_GROUP_KIND_INJECTED)
+
+/**
+ * @brief Check if a trigger event can only start the injected sequence
+ * @param Event Adc_HwTriggerEventType of the group
+ * @return Non-zero for the JEXTSEL events
+ */
+#define ADC_HW_IS_INJECTED_EVENT(Event) \
+    (((Event) >= ADC_HW_TRIG_EVT_TIM1_TRGO) && ((Event) < ADC_HW_TRIG_EVT_COUNT))
+
+/**
+ * @brief Check if a trigger event is a timer TRGO (update event)
+ * @param Event Adc_HwTriggerEventType of the group
+ * @return Non-zero for TIM1/TIM2/TIM3/TIM4 TRGO
+ */
+#define ADC_HW_IS_TRGO_EVENT(Event) \
+    (((Event) == ADC_HW_TRIG_EVT_TIM3_TRGO) || ((Event) == ADC_HW_TRIG_EVT_TIM1_TRGO) || \
+     ((Event) == ADC_HW_TRIG_EVT_TIM2_TRGO) || ((Event) == ADC_HW_TRIG_EVT_TIM4_TRGO))
+
+/**
+ * @brief Get the timer that generates a hardware trigger event
+ * @param Event Adc_HwTriggerEventType of the group
+ * @return Pointer to TIM_TypeDef, NULL for the EXTI11/EXTI15 pin triggers
+ */
+#define ADC_HW_GET_TRIGGER_TIMER(Event) \
+    ((((Event) <= ADC_HW_TRIG_EVT_TIM1_CC3) || ((Event) == ADC_HW_TRIG_EVT_TIM1_TRGO) || \
+      ((Event) == ADC_HW_TRIG_EVT_TIM1_CC4)) ? TIM1 : \
+     (((Event) == ADC_HW_TRIG_EVT_TIM2_CC2) || ((Event) == ADC_HW_TRIG_EVT_TIM2_TRGO) || \
+      ((Event) == ADC_HW_TRIG_EVT_TIM2_CC1)) ? TIM2 : \
+     (((Event) == ADC_HW_TRIG_EVT_TIM3_TRGO) || ((Event) == ADC_HW_TRIG_EVT_TIM3_CC4)) ? TIM3 : \
+     (((Event) == ADC_HW_TRIG_EVT_TIM4_CC4) || ((Event) == ADC_HW_TRIG_EVT_TIM4_TRGO)) ? TIM4 : \
+     ((TIM_TypeDef*)0))
+
+/**
+ * @brief Number of conversions in one block of a group
+ * @param GroupCfg Pointer to group configuration
+ * @return Adc_NbrOfChannel x Adc_StreamNumSamples
+ */
+#define ADC_HW_GROUP_BLOCK_SIZE(GroupCfg) \
+    ((uint16)(GroupCfg)->Adc_NbrOfChannel * (uint16)(GroupCfg)->Adc_StreamNumSamples)
+
+/**
+ * @brief First FIFO ticket of a hardware unit after AdcHw_ResetHwRuntime
+ * @note 256 tickets below the 32-bit wrap, so the wrap-safe ordering of the queue is
+ *       exercised from the first seconds of a run instead of after 2^32 requests
+ */
+#define ADC_HW_QUEUE_TICKET_INIT            0xFFFFFF00UL
+
 /****************************************************************************************
 *                              EXTERNAL DECLARATIONS                                   *
 ****************************************************************************************/
@@ -136,6 +271,8 @@ Std_ReturnType AdcHw_DeInit(Adc_HwUnitType HwUnitId);
  * @return E_OK if successful, E_NOT_OK otherwise
  * @note This function initiates software-triggered conversion for the specified group
  *       If queuing is enabled, the group will be added to the conversion queue
+ *       If priority is enabled, a higher priority group replaces the current one
+ *       according to its Adc_GroupReplacement, otherwise it waits in the ready bitmap
  */
 Std_ReturnType AdcHw_StartSwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
 
@@ -166,12 +303,55 @@ Std_ReturnType AdcHw_StartHwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType Gr
  */
 Std_ReturnType AdcHw_StopHwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
 
+/**
+ * @brief Change the sampling period of a timer-paced hardware-triggered group
+ * @param[in] GroupId ADC group ID
+ * @param[in] TriggerTimer New period in ADC_HW_TRIGGER_TICK_HZ ticks
+ * @return E_OK if successful, E_NOT_OK if the group is not paced by TIM2/TIM3/TIM4
+ *         or the period does not fit the timer
+ * @note A running group picks the new period up at the next update event
+ */
+Std_ReturnType AdcHw_SetHwTriggerTimer(Adc_GroupType GroupId, Adc_HwTriggerTimerType TriggerTimer);
+
+#if (ADC_ENABLE_LIMIT_CHECKING == STD_ON)
+/**
+ * @brief Move the analog watchdog window of a group with limit checking
+ * @param[in] GroupId ADC group ID
+ * @param[in] LowLimit New low limit, 12-bit
+ * @param[in] HighLimit New high limit, 12-bit
+ * @return E_OK if successful, E_NOT_OK if the group has no limit check or the window is invalid
+ * @note A running group uses the new window from the next conversion on and gets
+ *       its watchdog interrupt re-armed
+ */
+Std_ReturnType AdcHw_SetGroupLimits(Adc_GroupType GroupId, Adc_ValueGroupType LowLimit, Adc_ValueGroupType HighLimit);
+#endif
+
+/**
+ * @brief Arm an injected group, software start or hardware trigger
+ * @param[in] HwUnitId ADC hardware unit ID (0 = ADC1, 1 = ADC2)
+ * @param[in] GroupId Injected ADC group ID
+ * @return E_OK if successful, E_NOT_OK if another injected group owns the unit
+ *         or the group does not fit the injected sequence
+ * @note The regular group and its DMA keep running, the injected sequence is
+ *       inserted by the ADC between two regular conversions
+ */
+Std_ReturnType AdcHw_StartInjectedConversion(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
+
+/**
+ * @brief Disarm an injected group and release the injected sequence
+ * @param[in] HwUnitId ADC hardware unit ID (0 = ADC1, 1 = ADC2)
+ * @param[in] GroupId Injected ADC group ID
+ * @return E_OK if successful, E_NOT_OK if the group does not own the injected sequence
+ */
+Std_ReturnType AdcHw_StopInjectedConversion(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
+
 /**
  * @brief Recall next software conversion from queue
  * @param[in] HwUnitId ADC hardware unit ID (0 = ADC1, 1 = ADC2)
- * @return E_OK if successful, E_NOT_OK otherwise
+ * @return E_OK if a queued group was started, E_NOT_OK otherwise
  * @note Called after hardware conversion completion to process pending software requests
- *       Only used when ADC_ENABLE_QUEUING is enabled
+ *       Only used when ADC_ENABLE_QUEUING is enabled. With ADC_ENABLE_PRIORITY the
+ *       scheduler in Adc_Hw.c picks the next group instead.
  */
 Std_ReturnType AdcHw_RecallSwConversion(Adc_HwUnitType HwUnitId);
 /****************************************************************************************
@@ -191,7 +371,8 @@ Std_ReturnType AdcHw_ConfigureGroup(Adc_HwUnitType HwUnitId, Adc_GroupType Group
  * @param[in] HwUnitConfig Pointer to hardware unit configuration
  * @param[in] GroupConfig Pointer to group configuration containing channel settings
  * @return E_OK if successful, E_NOT_OK otherwise
- * @note This function configures channel rank, sampling time, and sequence for the group
+ * @note This function configures channel rank, sampling time, and sequence for the group.
+ *       Scan DMA groups get every rank programmed once, interrupt groups only rank 1.
  */
 Std_ReturnType AdcHw_ConfigureChannels(ADC_TypeDef* ADCx, 
                                        Adc_HwUnitDefType* HwUnitConfig, 
@@ -208,6 +389,7 @@ Std_ReturnType AdcHw_ConfigureChannels(ADC_TypeDef* ADCx,
  * @param[in] GroupId ADC group ID for DMA configuration
  * @return E_OK if successful, E_NOT_OK otherwise
  * @note Configures DMA channel, buffer, and interrupt settings for the specified group
+ *       The transfer covers the whole Adc_NbrOfChannel x Adc_StreamNumSamples block
  *       Only available when ADC_ENABLE_DMA is STD_ON
  */
 Std_ReturnType AdcHw_InitDma(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
@@ -230,6 +412,9 @@ Std_ReturnType AdcHw_DeInitDma(Adc_HwUnitType HwUnitId);
  * @param[in] InterruptType Type of interrupt to enable (see ADC_Hw_Interrupt_types)
  *                          - ADC_INTERRUPT_EOC: End of conversion interrupt
  *                          - ADC_INTERRUPT_DMA_TC: DMA transfer complete interrupt
+ *                          - ADC_INTERRUPT_DMA_HT: DMA half transfer interrupt
+ *                          - ADC_INTERRUPT_JEOC: Injected end of sequence interrupt
+ *                          - ADC_INTERRUPT_AWD: Analog watchdog interrupt
  * @return E_OK if successful, E_NOT_OK otherwise
  * @note Multiple interrupt types can be enabled using bitwise OR operation
  */
@@ -241,8 +426,12 @@ Std_ReturnType AdcHw_EnableInterrupt(Adc_HwUnitType HwUnitId, uint8 InterruptTyp
  * @param[in] InterruptType Type of interrupt to disable (see ADC_Hw_Interrupt_types)
  *                          - ADC_INTERRUPT_EOC: End of conversion interrupt
  *                          - ADC_INTERRUPT_DMA_TC: DMA transfer complete interrupt
+ *                          - ADC_INTERRUPT_DMA_HT: DMA half transfer interrupt
+ *                          - ADC_INTERRUPT_JEOC: Injected end of sequence interrupt
+ *                          - ADC_INTERRUPT_AWD: Analog watchdog interrupt
  * @return E_OK if successful, E_NOT_OK otherwise
  * @note Multiple interrupt types can be disabled using bitwise OR operation
+ * @note ADC1_2_IRQn stays enabled while EOC or JEOC is still in use
  */
 Std_ReturnType AdcHw_DisableInterrupt(Adc_HwUnitType HwUnitId, uint8 InterruptType);
 
@@ -273,6 +462,19 @@ Std_ReturnType AdcHw_ReadResult(Adc_HwUnitType HwUnitId,
 void AdcHw_HandleReadResultState(Adc_HwUnitType HwUnitId, 
                                Adc_GroupType GroupId);
 
+/**
+ * @brief Reduce one staging block of an oversampled group to one result per rank
+ * @param[in] Staging Word aligned raw samples, rank interleaved, ratio rounds
+ * @param[in] NbrOfChannel Number of ranks per round
+ * @param[in] Oversampling log2 of the number of rounds
+ * @param[out] ResultPtr One decimated value per rank
+ * @return void
+ */
+RAMFUNC void AdcHw_Decimate(const Adc_ValueGroupType* Staging,
+                    Adc_ChannelType NbrOfChannel,
+                    Adc_OversamplingType Oversampling,
+                    Adc_ValueGroupType* ResultPtr);
+
 
 
 
@@ -288,7 +490,26 @@ void AdcHw_HandleReadResultState(Adc_HwUnitType HwUnitId,
  * @note This function handles EOC interrupts, reads conversion data, and manages
  *       channel sequencing for multi-channel groups
  */
-void AdcHw_InterruptHandler(ADC_TypeDef* ADCx, Adc_HwUnitType HwUnitId);
+RAMFUNC void AdcHw_InterruptHandler(ADC_TypeDef* ADCx, Adc_HwUnitType HwUnitId);
+
+/**
+ * @brief ADC injected end-of-conversion interrupt service routine
+ * @param[in] ADCx Pointer to ADC peripheral that generated the interrupt
+ * @param[in] HwUnitId ADC hardware unit ID (0 = ADC1, 1 = ADC2)
+ * @return void
+ * @note Copies JDR1..JDRn of the whole injected sequence in one go
+ */
+RAMFUNC void AdcHw_InjectedInterruptHandler(ADC_TypeDef* ADCx, Adc_HwUnitType HwUnitId);
+
+/**
+ * @brief ADC analog watchdog interrupt service routine
+ * @param[in] ADCx Pointer to ADC peripheral that generated the interrupt
+ * @param[in] HwUnitId ADC hardware unit ID (0 = ADC1, 1 = ADC2)
+ * @return void
+ * @note One interrupt per window crossing: if the callback does not move the window
+ *       around the value, the interrupt stays off until AdcHw_SetGroupLimits
+ */
+void AdcHw_WatchdogInterruptHandler(ADC_TypeDef* ADCx, Adc_HwUnitType HwUnitId);
 
 /**
  * @brief DMA transfer complete interrupt service routine
@@ -298,7 +519,17 @@ void AdcHw_InterruptHandler(ADC_TypeDef* ADCx, Adc_HwUnitType HwUnitId);
  * @note This function handles DMA TC interrupts, updates group status, and calls
  *       notification callbacks when conversion is complete
  */
-void AdcHw_DmaInterruptHandler(DMA_Channel_TypeDef* DMAx, Adc_HwUnitType HwUnitId);
+RAMFUNC void AdcHw_DmaInterruptHandler(DMA_Channel_TypeDef* DMAx, Adc_HwUnitType HwUnitId);
+
+/**
+ * @brief DMA half transfer interrupt service routine
+ * @param[in] DMAx Pointer to DMA channel that generated the interrupt
+ * @param[in] HwUnitId ADC hardware unit ID (0 = ADC1, 1 = ADC2)
+ * @return void
+ * @note Ping-pong groups only: the first buffer half is stable while DMA fills
+ *       the second, the consumer is notified once per half
+ */
+RAMFUNC void AdcHw_DmaHalfTransferHandler(DMA_Channel_TypeDef* DMAx, Adc_HwUnitType HwUnitId);
 
 /****************************************************************************************
 *                              QUEUE MANAGEMENT FUNCTIONS                             *
@@ -308,7 +539,12 @@ void AdcHw_DmaInterruptHandler(DMA_Channel_TypeDef* DMAx, Adc_HwUnitType HwUnitI
  * @brief Add group to conversion queue
  * @param[in] HwUnitId ADC hardware unit ID
  * @param[in] GroupId ADC group ID
- * @return E_OK if successful, E_NOT_OK otherwise
+ * @return E_OK if successful, E_NOT_OK if the group is already queued
+ * @note The queue only holds waiting groups, the converting group is not part of it.
+ *       It is a bitmap of waiting groups plus a FIFO ticket per group, not a ring:
+ *       start requests add from thread and notification context and both the
+ *       request and the release path take groups out. Every update is one
+ *       LDREX/STREX word, interrupts are never disabled.
  */
 Std_ReturnType AdcHw_AddGroupToQueue(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
 
@@ -316,7 +552,8 @@ Std_ReturnType AdcHw_AddGroupToQueue(Adc_HwUnitType HwUnitId, Adc_GroupType Grou
  * @brief Remove group from conversion queue
  * @param[in] HwUnitId ADC hardware unit ID
  * @param[in] GroupId ADC group ID
- * @return E_OK if successful, E_NOT_OK otherwise
+ * @return E_OK if the group was queued and removed, E_NOT_OK otherwise
+ * @note O(1), test and clear of the queued bit, the stale ticket is never read again
  */
 Std_ReturnType AdcHw_RemoveGroupFromQueue(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
 
@@ -324,6 +561,10 @@ Std_ReturnType AdcHw_RemoveGroupFromQueue(Adc_HwUnitType HwUnitId, Adc_GroupType
  * @brief Get next group from queue
  * @param[in] HwUnitId ADC hardware unit ID
  * @return Group ID or ADC_INVALID_GROUP_ID if queue is empty
+ * @note The returned group is removed from the queue. Not O(1): the head is the
+ *       oldest ticket among the queued bits, found in one pass over them (at most
+ *       ADC_MAX_GROUPS). The pass starts over when another context took or removed
+ *       that group before its bit was cleared here.
  */
 Adc_GroupType AdcHw_GetNextGroupFromQueue(Adc_HwUnitType HwUnitId);
 
@@ -331,9 +572,10 @@ Adc_GroupType AdcHw_GetNextGroupFromQueue(Adc_HwUnitType HwUnitId);
  * @brief Check if group is in queue
  * @param[in] HwUnitId ADC hardware unit ID
  * @param[in] GroupId ADC group ID
- * @return index of group in queue , if not in queue return ADC_INVALID_GROUP_ID
+ * @return TRUE if the group is waiting in the queue, FALSE otherwise
+ * @note O(1), reads the per-group queued bitmask
  */
-Adc_GroupType AdcHw_IsGroupInQueue(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
+boolean AdcHw_IsGroupInQueue(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
 
 /**
  * @brief Clear conversion queue
@@ -448,28 +690,14 @@ uint32 AdcHw_GetHwSampleTime(Adc_SamplingTimeType SampleTime);
 
 /**
  * @brief Get hardware trigger source
- * @param[in] TriggerSource Trigger source
- * @return Hardware trigger source value
+ * @param[in] TriggerEvent Timer or pin event of the group
+ * @return ADC_ExternalTrigConv_xxx value for ADC_Init
  */
-uint32 AdcHw_GetHwTriggerSource(Adc_TriggerSourceType TriggerSource);
+uint32 AdcHw_GetHwTriggerSource(Adc_HwTriggerEventType TriggerEvent);
 
 /****************************************************************************************
-*                              DEFERRED PROCESSING FUNCTIONS                          *
+*                              COMPLETION FUNCTIONS                                   *
 ****************************************************************************************/
-/**
- * @brief Main function for deferred processing
- * @return void
- * @note This function should be called periodically from the main loop
- */
-void AdcHw_MainFunction(void);
-
-/**
- * @brief Process completed conversions
- * @param[in] HwUnitId ADC hardware unit ID
- * @return void
- */
-void AdcHw_ProcessCompletedConversions(Adc_HwUnitType HwUnitId);
-
 /**
  * @brief Handle group completion
  * @param[in] HwUnitId ADC hardware unit ID
@@ -490,9 +718,13 @@ void AdcHw_HandleGroupCompletion(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
 /* ADC Hardware Interrupt Types - Used with Enable/Disable Interrupt functions */
 #define ADC_INTERRUPT_EOC           (uint8)0x01U    /* End of conversion interrupt */
 #define ADC_INTERRUPT_DMA_TC        (uint8)0x02U    /* DMA transfer complete interrupt */
+#define ADC_INTERRUPT_DMA_HT        (uint8)0x04U    /* DMA half transfer interrupt */
+#define ADC_INTERRUPT_JEOC          (uint8)0x08U    /* Injected end of sequence interrupt */
+#define ADC_INTERRUPT_AWD           (uint8)0x10U    /* Analog watchdog interrupt */
 
 /* Hardware performance limits and constraints */
 #define ADC_HW_MAX_CHANNELS_PER_GROUP   16U     /* Maximum channels per conversion group */
+#define ADC_HW_MAX_INJECTED_CHANNELS    4U      /* JSQ1..4 / JDR1..4 */
 #define ADC_HW_MAX_CONVERSION_TIME_US   20U     /* Maximum conversion time in microseconds */
 #define ADC_HW_MAX_SAMPLING_CYCLES      239U    /* Maximum sampling cycles (STM32F103 limit) */
 
@@ -0,0 +1,103 @@
+/****************************************************************************************
+*                                ADC_TIMING.H                                          *
+****************************************************************************************
+* File Name   : Adc_Timing.h
+* Module      : Analog to Digital Converter (ADC) - Timing Model
+* Description : Conversion time, sample rate and interrupt load of the configured groups
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+#ifndef ADC_TIMING_H
+#define ADC_TIMING_H
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "Std_Types.h"
+#include "Adc_Types.h"
+#include "Adc_Cfg.h"
+
+/****************************************************************************************
+*                              TIMING MACROS                                           *
+****************************************************************************************/
+/**
+ * @brief PCLK2 cycles per ADCCLK for an RCC_PCLK2_DivX value
+ * @param Prescaler RCC_PCLK2_Div2, RCC_PCLK2_Div4, RCC_PCLK2_Div6 or RCC_PCLK2_Div8
+ * @return 2, 4, 6 or 8
+ */
+#define ADC_TIMING_PRESCALER_DIV(Prescaler) \
+    (((((uint32)(Prescaler) >> 14) & 0x3U) + 1U) * 2U)
+
+/****************************************************************************************
+*                              TYPE DEFINITIONS                                        *
+****************************************************************************************/
+/**
+ * @brief Timing of one group running on its own
+ * @details Cycles are HCLK cycles, rates are per second of SystemCoreClock. A round
+ *          converts every rank once. Software groups are modelled restarted back to
+ *          back, which is the upper bound a one-shot group can reach. A one-shot
+ *          software group runs when the caller asks, so it is OnDemand and has no
+ *          load, its handler cost per round is IsrCyclesPerRound.
+ */
+typedef struct
+{
+    Adc_ConversionTimeType  SequenceCycles;         /*!< Sample and conversion time of all ranks */
+    Adc_ConversionTimeType  TriggerCycles;          /*!< Trigger period, 0 for software groups */
+    Adc_ConversionTimeType  RoundCycles;            /*!< Start of one round to the next */
+    uint32                  ConversionsPerSecond;   /*!< Rank conversions of the master ADC */
+    uint32                  ResultsPerSecond;       /*!< Values stored in the result buffer */
+    uint32                  InterruptsPerSecond;    /*!< EOC, JEOC or DMA HT/TC interrupts */
+    uint16                  CpuLoadPermille;        /*!< HCLK share spent in those handlers, 0 if OnDemand */
+    uint32                  IsrCyclesPerRound;      /*!< Handler cycles per round, averaged over a block */
+    boolean                 TriggerOverrun;         /*!< Trigger period shorter than the sequence */
+    boolean                 OnDemand;               /*!< One-shot software group, rate set by the caller */
+} Adc_GroupTimingType;
+
+/****************************************************************************************
+*                              TIMING FUNCTIONS                                        *
+****************************************************************************************/
+/**
+ * @brief ADCCLK cycles to sample and convert one channel
+ * @param[in] SampleTime ADC_SampleTime_xCycles5 code of the channel
+ * @return Sample time plus 12.5 cycles, rounded up (14 .. 252)
+ */
+uint16 Adc_TimingChannelClocks(Adc_SamplingTimeType SampleTime);
+
+/**
+ * @brief HCLK cycles per ADCCLK
+ * @return APB2 divider from RCC_CFGR times ADC_TIMING_PRESCALER_DIV(ADC_CLOCK_PRESCALER)
+ */
+uint32 Adc_TimingAdcClockDivider(void);
+
+/**
+ * @brief HCLK cycles to convert every rank of a group once
+ * @param[in] Group ADC group ID
+ * @return Conversion time, dual groups take the slower rank of each pair
+ */
+Adc_ConversionTimeType Adc_TimingSequenceCycles(Adc_GroupType Group);
+
+/**
+ * @brief HCLK cycles between two hardware triggers of a group
+ * @param[in] Group ADC group ID
+ * @return Trigger period, 0 for software groups and EXTI pin triggers
+ * @note A running trigger timer is read back, so the PWM period and a period set
+ *       with Adc_SetHwTriggerTimer are included. Otherwise Adc_HwTriggerTimer is used.
+ */
+Adc_ConversionTimeType Adc_TimingTriggerCycles(Adc_GroupType Group);
+
+/**
+ * @brief Achievable sample rate and interrupt load of a group
+ * @param[in] Group ADC group ID
+ * @param[out] TimingPtr Timing of the group
+ * @return E_OK, E_NOT_OK for an invalid group or pointer
+ */
+Std_ReturnType Adc_TimingGetGroupTiming(Adc_GroupType Group, Adc_GroupTimingType* TimingPtr);
+
+#endif /* ADC_TIMING_H */
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
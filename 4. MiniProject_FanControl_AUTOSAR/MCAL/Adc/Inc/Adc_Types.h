@@ -24,9 +24,7 @@
 /****************************************************************************************
 *                                 FEATURE MACROS                                       *
 ****************************************************************************************/
-
-
-#define ADC_PRIORITY_IMPLEMENTATION 0
+/* ADC_PRIORITY_IMPLEMENTATION is selected in Adc_Cfg.h */
 
 /****************************************************************************************
 *                              BASIC NUMERIC TYPES                                     *
@@ -119,7 +117,10 @@ typedef uint32 Adc_SamplingTimeType;
 /** 
  * @brief   Adc_HwTriggerTimerType
  * @typedef uint32
- * @details Reload value for ADC embedded timer
+ * @details Trigger timer value in ADC_HW_TRIGGER_TICK_HZ ticks
+ *          - TIM2/TIM3/TIM4 events: sampling period, timer reload is this value - 1
+ *          - TIM1 events: unused, the sample point is the Pwm channel AdcTriggerOffset
+ *            (see Pwm_SetAdcTriggerOffset), TIM1 belongs to Pwm
  */
 typedef uint32 Adc_HwTriggerTimerType;
 
@@ -150,6 +151,19 @@ typedef enum
     ADC_CONV_MODE_CONTINUOUS = 0x01U,     /*!< Continuous conversion mode */
 } Adc_GroupConvModeType;
 
+/**
+ * @brief   Adc_GroupKindType
+ * @typedef enum
+ * @details ADC sequence a group is converted on
+ * @note    The F1 also sets EOC at the end of an injected sequence, regular groups
+ *          running beside an injected group should use DMA rather than EOC
+ */
+typedef enum
+{
+    ADC_GROUP_KIND_REGULAR = 0x00U,     /*!< Regular sequence, SQR1..3 + DR, one group at a time */
+    ADC_GROUP_KIND_INJECTED = 0x01U     /*!< Injected sequence, JSQR + JDR1..4, preempts the regular group */
+} Adc_GroupKindType;
+
 /**
  * @brief   Adc_GroupAccessModeType
  * @typedef enum
@@ -162,6 +176,26 @@ typedef enum
     ADC_ACCESS_MODE_STREAMING = 0x01U   /*!< Streaming access mode */
 } Adc_GroupAccessModeType;
 
+/**
+ * @brief   Adc_OversamplingType
+ * @typedef enum
+ * @details Raw conversion rounds summed per result, stored as log2 of the ratio
+ * @note    The sum is shifted right by log2(N) - log2(N)/2, one result has
+ *          12 + log2(N)/2 bits: X4 = 13, X16 = 14, X64 = 15, X256 = 16 bits.
+ *          The extra bits are only real if the input carries about 1 LSB of noise.
+ */
+typedef enum
+{
+    ADC_OVERSAMPLING_NONE = 0x00U,      /*!< One conversion per result */
+    ADC_OVERSAMPLING_X4 = 0x02U,        /*!< 4 rounds, 13 bit */
+    ADC_OVERSAMPLING_X8 = 0x03U,        /*!< 8 rounds, 13 bit */
+    ADC_OVERSAMPLING_X16 = 0x04U,       /*!< 16 rounds, 14 bit */
+    ADC_OVERSAMPLING_X32 = 0x05U,       /*!< 32 rounds, 14 bit */
+    ADC_OVERSAMPLING_X64 = 0x06U,       /*!< 64 rounds, 15 bit */
+    ADC_OVERSAMPLING_X128 = 0x07U,      /*!< 128 rounds, 15 bit */
+    ADC_OVERSAMPLING_X256 = 0x08U       /*!< 256 rounds, 16 bit */
+} Adc_OversamplingType;
+
 /**
  * @brief   Adc_HwTriggerSignalType
  * @typedef enum
@@ -175,6 +209,32 @@ typedef enum
     ADC_HW_TRIG_BOTH_EDGES = 0x02U      /*!< Hardware trigger both edges */
 } Adc_HwTriggerSignalType;
 
+/**
+ * @brief   Adc_HwTriggerEventType
+ * @typedef enum
+ * @details Event routed to the external trigger input of ADC1/ADC2
+ *          - TIM1_CC1..EXTI11: regular sequence (EXTSEL)
+ *          - TIM1_TRGO..EXTI15: injected sequence (JEXTSEL)
+ */
+typedef enum
+{
+    ADC_HW_TRIG_EVT_TIM1_CC1  = 0x00U,  /*!< TIM1 capture compare 1 */
+    ADC_HW_TRIG_EVT_TIM1_CC2  = 0x01U,  /*!< TIM1 capture compare 2 */
+    ADC_HW_TRIG_EVT_TIM1_CC3  = 0x02U,  /*!< TIM1 capture compare 3 */
+    ADC_HW_TRIG_EVT_TIM2_CC2  = 0x03U,  /*!< TIM2 capture compare 2 */
+    ADC_HW_TRIG_EVT_TIM3_TRGO = 0x04U,  /*!< TIM3 trigger output on update */
+    ADC_HW_TRIG_EVT_TIM4_CC4  = 0x05U,  /*!< TIM4 capture compare 4 */
+    ADC_HW_TRIG_EVT_EXTI11    = 0x06U,  /*!< EXTI line 11 pin */
+    ADC_HW_TRIG_EVT_TIM1_TRGO = 0x07U,  /*!< Injected: TIM1 trigger output on update */
+    ADC_HW_TRIG_EVT_TIM1_CC4  = 0x08U,  /*!< Injected: TIM1 capture compare 4 */
+    ADC_HW_TRIG_EVT_TIM2_TRGO = 0x09U,  /*!< Injected: TIM2 trigger output on update */
+    ADC_HW_TRIG_EVT_TIM2_CC1  = 0x0AU,  /*!< Injected: TIM2 capture compare 1 */
+    ADC_HW_TRIG_EVT_TIM3_CC4  = 0x0BU,  /*!< Injected: TIM3 capture compare 4 */
+    ADC_HW_TRIG_EVT_TIM4_TRGO = 0x0CU,  /*!< Injected: TIM4 trigger output on update */
+    ADC_HW_TRIG_EVT_EXTI15    = 0x0DU,  /*!< Injected: EXTI line 15 pin */
+    ADC_HW_TRIG_EVT_COUNT     = 0x0EU   /*!< Number of trigger events */
+} Adc_HwTriggerEventType;
+
 /****************************************************************************************
 *                              BUFFER AND STREAM ENUMS                                 *
 ****************************************************************************************/
@@ -267,6 +327,27 @@ typedef enum
     ADC_RANGE_NOT_OVER_HIGH = 0x06U  /*!< Range below high limit */
 } Adc_ChannelRangeSelectType;
 
+/**
+ * @brief   Adc_LimitEventType
+ * @typedef enum
+ * @details Side of the analog watchdog window a converted value left on
+ */
+typedef enum
+{
+    ADC_LIMIT_BELOW_LOW = 0x00U,     /*!< Value under the low limit */
+    ADC_LIMIT_ABOVE_HIGH = 0x01U     /*!< Value over the high limit */
+} Adc_LimitEventType;
+
+/**
+ * @brief Adc_LimitChannel value guarding every rank of the group
+ */
+#define ADC_LIMIT_ALL_CHANNELS      ((Adc_ChannelType)0xFFU)
+
+/**
+ * @brief Highest value the analog watchdog compares against (12-bit, independent of alignment)
+ */
+#define ADC_LIMIT_MAX_VALUE         ((Adc_ValueGroupType)0x0FFFU)
+
 /****************************************************************************************
 *                              POWER MANAGEMENT ENUMS                                  *
 ****************************************************************************************/
@@ -322,6 +403,13 @@ typedef enum
  */
 typedef void (*Adc_NotificationCallBack)(void);
 
+/**
+ * @brief   Adc_LimitNotificationCallBack
+ * @typedef Function pointer
+ * @details Called from the analog watchdog interrupt when a value leaves the window
+ */
+typedef void (*Adc_LimitNotificationCallBack)(Adc_GroupType Group, Adc_LimitEventType Event, Adc_ValueGroupType Value);
+
 /****************************************************************************************
 *                              CONFIGURATION STRUCTURES                                *
 ****************************************************************************************/
@@ -336,6 +424,22 @@ typedef struct
     Adc_SamplingTimeType    Adc_ChannelSampTime;    /*!< Sampling time */
 } Adc_ChannelDefType;
 
+/**
+ * @brief   Adc_LimitCheckDefType
+ * @typedef struct
+ * @details Analog watchdog window of a group, results inside [low, high] are in range
+ * @note    One watchdog per ADC, the window belongs to the regular group running on it.
+ *          Only ADC_RANGE_BETWEEN exists in hardware, the other range selections are
+ *          not supported.
+ */
+typedef struct
+{
+    Adc_ChannelType               Adc_LimitChannel;        /*!< Guarded channel, ADC_LIMIT_ALL_CHANNELS for every rank */
+    Adc_ValueGroupType            Adc_LowLimit;            /*!< Initial low limit, 12-bit */
+    Adc_ValueGroupType            Adc_HighLimit;           /*!< Initial high limit, 12-bit */
+    Adc_LimitNotificationCallBack Adc_LimitNotificationCb; /*!< Called when the window is left */
+} Adc_LimitCheckDefType;
+
 
 typedef enum 
 {
@@ -355,6 +459,7 @@ typedef struct
     const Adc_HwUnitType          Adc_HwUnitId;           /*!< Hardware unit ID */
     const Adc_GroupType           Adc_GroupId;            /*!< Group ID */
     const Adc_GroupPriorityType   Adc_GroupPriority;      /*!< Group priority */
+    const Adc_GroupKindType       Adc_GroupKind;          /*!< Regular or injected sequence */
     
     /* Conversion Configuration */
     const Adc_GroupAccessModeType Adc_GroupAccessMode;    /*!< Access mode */
@@ -368,10 +473,12 @@ typedef struct
     /* Channel Configuration */
     const Adc_ChannelDefType*     Adc_ChannelGroup;       /*!< Channel array */
     const Adc_ChannelType         Adc_NbrOfChannel;       /*!< Number of channels */
+    const Adc_ChannelDefType*     Adc_PairedChannelGroup; /*!< ADC2 channel per rank in dual mode, NULL_PTR otherwise */
     
     /* Trigger Configuration */
     const Adc_TriggerSourceType   Adc_TriggerSource;      /*!< Trigger source */
     const Adc_HwTriggerSignalType Adc_HwTriggerSignal;    /*!< HW trigger signal */
+    const Adc_HwTriggerEventType  Adc_HwTriggerEvent;     /*!< HW trigger event */
     const Adc_HwTriggerTimerType  Adc_HwTriggerTimer;     /*!< HW trigger timer */
     
     /* Streaming Configuration */
@@ -383,6 +490,13 @@ typedef struct
     uint16                  Adc_ValueResultSize;    /*!< Result buffer size */
     uint8                   Adc_SetupBufferFlag;   /*!< Check buffer is reset 1: Reset, 0: Not reset yet*/
     
+    /* Oversampling Configuration */
+    const Adc_OversamplingType Adc_Oversampling;      /*!< Raw rounds per result, ADC_OVERSAMPLING_NONE = off */
+    Adc_ValueGroupType*     Adc_OversamplingBufferPtr; /*!< DMA staging, word aligned, ratio x NbrOfChannel (x2 if continuous) */
+    
+    /* Limit Checking Configuration */
+    const Adc_LimitCheckDefType* Adc_LimitCheck;  /*!< Analog watchdog window, NULL_PTR = no limit checking */
+    
     /* Notification Configuration */
     Adc_NotificationCallBack     Adc_NotificationCb;    /*!< Notification callback */
     Adc_NotificationEnableType   Adc_NotificationEnable; /*!< Notification enable flag */
@@ -401,6 +515,18 @@ typedef enum
     ADC_DMA_NOT_AVAILABLE       = STD_OFF /*!< ADC DMA not available*/
 }Adc_HwDmaAvailable;
 
+/**
+ * @brief   Adc_HwDualModeType
+ * @typedef enum
+ * @details ADC1/ADC2 coupling, only meaningful on ADC1 (master)
+ */
+typedef enum
+{
+    ADC_DUAL_MODE_INDEPENDENT   = 0x00U,  /*!< ADC1 and ADC2 convert on their own */
+    ADC_DUAL_MODE_REG_SIMULT    = 0x01U   /*!< Paired groups: ADC2 converts its rank together with ADC1,
+                                               ADC1 DR holds both results, DMA moves 32-bit words */
+} Adc_HwDualModeType;
+
 
 
 /**
@@ -419,6 +545,7 @@ typedef struct
     
     /* Hardware Features */
     const Adc_HwDmaAvailable              AdcHw_DMAAvailable;     /*!< DMA availability ADC_DMA_NOT_AVAILABLE or ADC_DMA_AVAILABLE */
+    const Adc_HwDualModeType              AdcHw_DualMode;         /*!< ADC2 as slave for groups with Adc_PairedChannelGroup */
 } Adc_HwUnitDefType;
 
 /**
@@ -456,6 +583,8 @@ typedef struct
  * @brief Get DMA channel from ADC unit ID
  * @param id ADC unit ID
  * @return Pointer to DMA_Channel_TypeDef structure
+ * @note ADC2 has no DMA request on the F1, its results reach DMA1 Channel1 through
+ *       the upper half of ADC1 DR in dual regular simultaneous mode
  */
 #define ADC_HW_GET_DMA_CHANNEL(id) \
     ((id == ADC_INSTANCE_1) ? DMA1_Channel1 : ((DMA_Channel_TypeDef*)0))
@@ -474,6 +603,11 @@ typedef struct
     Adc_ChannelType         CurrentChannelId;       /*!< Current converting channel */
     Adc_StreamNumSampleType SampleCounter;         /*!< Current sample count */
     uint16                  BufferIndex;            /*!< Current buffer index */
+    boolean                 Suspended;              /*!< Preempted with suspend/resume, counters kept */
+    Adc_HwTriggerTimerType  HwTriggerTimer;         /*!< Trigger period set at runtime, 0 = configured value */
+    Adc_ValueGroupType      LimitLow;               /*!< Current analog watchdog low limit */
+    Adc_ValueGroupType      LimitHigh;              /*!< Current analog watchdog high limit */
+    uint32                  QueueTicket;            /*!< FIFO position while the group is queued */
 } Adc_RuntimeGroupType;
 
 /**
@@ -494,13 +628,18 @@ typedef struct
     Adc_HwUnitStateType     HwUnitState;             /*!< Hardware unit state flag */
     
     /* Used for queue and sw conversion*/
-
-    Adc_GroupType*          QueueGroup;             /*!< Group queue*/
-    Adc_GroupType           QueueMaxSize;           /*!< Group queue max size*/ 
-    Adc_GroupType           QueueHead;              /*!< Queue head index */
-    Adc_GroupType           QueueTail;              /*!< Queue tail index */
-    Adc_GroupType           QueueCount;             /*!< Number of queued groups */
+    /* FIFO as a bitmap plus a ticket per group, updated with LDREX/STREX only */
+    uint32                  QueuedMask;             /*!< Bit per group, set while the group waits */
+    uint32                  QueueTicket;            /*!< Next FIFO ticket, free-running, wraps */
+    
+    /* Used for priority scheduling */
+    uint32                  ReadyLevelMask;         /*!< Bit p set while any group of level p is ready */
+    uint32*                 ReadyGroupMask;         /*!< Ready groups per priority level, bit = group ID */
+    uint8                   CurrentPriority;        /*!< Effective priority of the current group */
+    Adc_GroupType           PreemptedGroupId;       /*!< Preempted background (FIFO) group */
     
+    /* Used for injected conversions, independent of the regular group above */
+    Adc_GroupType           InjectedGroupId;        /*!< Group owning JSQR, ADC_INVALID_GROUP_ID if none */
     
 } Adc_RuntimeHwUnitType;
 
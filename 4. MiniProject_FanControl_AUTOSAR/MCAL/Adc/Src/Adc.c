@@ -19,6 +19,7 @@
 #include "Adc_Cfg.h"
 #include "Adc_Hw.h"
 #include "Adc_Types.h"
+#include "Prof.h"
 #include "stm32f10x_adc.h"
 #include "misc.h"
 
@@ -113,10 +114,6 @@ void Adc_Init(const Adc_ConfigType* ConfigPtr)
             return;
         }
     }
-    for (Adc_GroupType i = 0; i < ConfigPtr->NumGroups; i++)
-    {
-        Adc_DisableGroupNotification(i);
-    }
 
     /* Initialize performance counters */
     #if (ADC_ENABLE_DEBUG_SUPPORT == STD_ON)
@@ -125,6 +122,12 @@ void Adc_Init(const Adc_ConfigType* ConfigPtr)
     
     /* Set driver state to initialized */
     Adc_DriverState = ADC_DRIVER_STATE_INITIALIZED;
+    
+    /* After the state change, the API checks it and reports ADC_E_UNINIT otherwise */
+    for (Adc_GroupType i = 0; i < ConfigPtr->NumGroups; i++)
+    {
+        Adc_DisableGroupNotification(i);
+    }
 }
 
 /**
@@ -204,7 +207,7 @@ Std_ReturnType Adc_SetupResultBuffer(Adc_GroupType Group,
 
     /* Set up result buffer */
     // reset buffer
-    for(uint16 i; i < Adc_GroupConfig[Group].Adc_ValueResultSize; i++)
+    for(uint16 i = 0; i < Adc_GroupConfig[Group].Adc_ValueResultSize; i++)
     {
         Adc_GroupConfig[Group].Adc_ValueResultPtr[i] = 0;
     }
@@ -244,10 +247,12 @@ void Adc_StartGroupConversion(Adc_GroupType Group)
     /* Start conversion based on configuration */
 
     /* Software triggered conversion */
+    PROF_BEGIN(PROF_PROBE_ADC_START_GROUP);
     if (AdcHw_StartSwConversion(HwUnit, Group) == E_OK)
     {
         // do something
     }
+    PROF_END(PROF_PROBE_ADC_START_GROUP);
 
 }
 
@@ -276,10 +281,12 @@ void Adc_StopGroupConversion(Adc_GroupType Group)
     /* Stop conversion based on configuration */
 
     /* Software triggered conversion */
+    PROF_BEGIN(PROF_PROBE_ADC_STOP_GROUP);
     if (AdcHw_StopSwConversion(HwUnit, Group) == E_OK)
     {
         Adc_UpdateGroupStatus(Group, ADC_IDLE);
     }
+    PROF_END(PROF_PROBE_ADC_STOP_GROUP);
     
 
 }
@@ -325,11 +332,11 @@ Std_ReturnType Adc_ReadGroup(Adc_GroupType Group,
     Adc_HwUnitType HwUnit = GroupConfig->Adc_HwUnitId;
     
     /* Read results */
-    if (AdcHw_ReadResult(HwUnit, Group, DataBufferPtr) == E_NOT_OK)
-    {
-        return E_NOT_OK;
-    }
-    return E_OK;
+    PROF_BEGIN(PROF_PROBE_ADC_READ_GROUP);
+    Std_ReturnType Result = AdcHw_ReadResult(HwUnit, Group, DataBufferPtr);
+    PROF_END(PROF_PROBE_ADC_READ_GROUP);
+    
+    return Result;
 }
 
 /****************************************************************************************
@@ -406,6 +413,70 @@ void Adc_DisableHardwareTrigger(Adc_GroupType Group)
     }
 }
 
+/**
+ * @brief   Changes the sampling period of a timer-paced hardware-triggered group
+ * @param[in] Group Numeric ID of the ADC channel group
+ * @param[in] TriggerTimer New period in ADC_HW_TRIGGER_TICK_HZ ticks
+ * @return  void
+ * @note    Allowed while the trigger is enabled, the timer reload is preloaded
+ */
+void Adc_SetHwTriggerTimer(Adc_GroupType Group, Adc_HwTriggerTimerType TriggerTimer)
+{
+    /* Validate parameters */
+    if ((Adc_ValidateInit(ADC_SET_HW_TRIGGER_TIMER_ID) != E_OK) ||
+        (Adc_ValidateGroup(Group, ADC_SET_HW_TRIGGER_TIMER_ID) != E_OK))
+    {
+        return;
+    }
+    
+    /* The period has to fit the 16-bit auto-reload */
+    if ((TriggerTimer < ADC_HW_TRIGGER_TIMER_MIN) || (TriggerTimer > ADC_HW_TRIGGER_TIMER_MAX))
+    {
+        #if (ADC_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(ADC_MODULE_ID, 0, ADC_SET_HW_TRIGGER_TIMER_ID, ADC_E_PARAM_CONFIG);
+        #endif
+        return;
+    }
+    
+    /* Only TIM2/TIM3/TIM4 paced groups own their time base */
+    const Adc_GroupDefType* GroupConfig = &Adc_ConfigPtr->Groups[Group];
+    if ((GroupConfig->Adc_TriggerSource == ADC_TRIGG_SRC_SW) ||
+        (AdcHw_SetHwTriggerTimer(Group, TriggerTimer) != E_OK))
+    {
+        #if (ADC_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(ADC_MODULE_ID, 0, ADC_SET_HW_TRIGGER_TIMER_ID, ADC_E_WRONG_TRIGG_SRC);
+        #endif
+        return;
+    }
+}
+
+#if (ADC_ENABLE_LIMIT_CHECKING == STD_ON)
+/**
+ * @brief   Moves the analog watchdog window of a group configured with limit checking
+ * @param[in] Group Numeric ID of the ADC channel group
+ * @param[in] LowLimit Lowest in-range value, 12-bit
+ * @param[in] HighLimit Highest in-range value, 12-bit
+ * @return  void
+ */
+void Adc_SetGroupLimits(Adc_GroupType Group, Adc_ValueGroupType LowLimit, Adc_ValueGroupType HighLimit)
+{
+    /* Validate parameters */
+    if ((Adc_ValidateInit(ADC_SET_GROUP_LIMITS_ID) != E_OK) ||
+        (Adc_ValidateGroup(Group, ADC_SET_GROUP_LIMITS_ID) != E_OK))
+    {
+        return;
+    }
+    
+    if (AdcHw_SetGroupLimits(Group, LowLimit, HighLimit) != E_OK)
+    {
+        #if (ADC_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(ADC_MODULE_ID, 0, ADC_SET_GROUP_LIMITS_ID, ADC_E_PARAM_CONFIG);
+        #endif
+        return;
+    }
+}
+#endif
+
 /****************************************************************************************
 *                                 NOTIFICATION FUNCTIONS                              *
 ****************************************************************************************/
@@ -510,8 +581,27 @@ Adc_StreamNumSampleType Adc_GetStreamLastPointer(Adc_GroupType Group,
     /* Return streaming information */
     // *PtrToSamplePtr = GroupConfig->Adc_ValueResultPtr[Adc_RuntimeGroups[Group].SampleCounter];
     Adc_StreamNumSampleType NbrOfSample = AdcHw_GetGroupRuntimeSampCounter(Group);
-    Adc_ChannelType NbrOfChannel = GroupConfig->Adc_NbrOfChannel;
-    *PtrToSamplePtr = &GroupConfig->Adc_ValueResultPtr[(NbrOfSample - 1) * NbrOfChannel];
+    /* Dual groups keep ADC1/ADC2 pairs interleaved, one pair per rank */
+    uint16 NbrOfChannel = GroupConfig->Adc_NbrOfChannel *
+                          ADC_HW_VALUES_PER_RANK(&Adc_HwUnitConfig[GroupConfig->Adc_HwUnitId], GroupConfig);
+    if (NbrOfSample == 0)
+    {
+        /* Nothing converted yet */
+        *PtrToSamplePtr = NULL_PTR;
+        return 0;
+    }
+
+    if (ADC_HW_IS_PING_PONG_GROUP(&Adc_HwUnitConfig[GroupConfig->Adc_HwUnitId], GroupConfig))
+    {
+        /* Hand out the half DMA just finished, the other half is being filled */
+        Adc_StreamNumSampleType HalfSamples = GroupConfig->Adc_StreamNumSamples >> 1;
+        *PtrToSamplePtr = &GroupConfig->Adc_ValueResultPtr[(NbrOfSample - HalfSamples) * NbrOfChannel];
+        NbrOfSample = HalfSamples;
+    }
+    else
+    {
+        *PtrToSamplePtr = &GroupConfig->Adc_ValueResultPtr[(NbrOfSample - 1) * NbrOfChannel];
+    }
 
     AdcHw_HandleReadResultState(GroupConfig->Adc_HwUnitId, Group);
     return NbrOfSample;
@@ -601,7 +691,7 @@ void Adc_GetVersionInfo(Std_VersionInfoType* versioninfo)
  * @param[in] ADCx ADC hardware module
  * @return void
  */
-void Adc_TransferComplete_Callback(ADC_TypeDef* ADCx)
+RAMFUNC void Adc_TransferComplete_Callback(ADC_TypeDef* ADCx)
 {
     /* Determine hardware unit */
     Adc_HwUnitType HwUnit = (ADCx == ADC1) ? 0 : 1;  /* Unit 0 for ADC1, Unit 1 for ADC2 */
@@ -610,12 +700,40 @@ void Adc_TransferComplete_Callback(ADC_TypeDef* ADCx)
     AdcHw_InterruptHandler(ADCx,HwUnit);
 }
 
+/**
+ * @brief Injected transfer complete callback
+ * @param[in] ADCx ADC hardware module
+ * @return void
+ */
+RAMFUNC void Adc_InjectedTransferComplete_Callback(ADC_TypeDef* ADCx)
+{
+    /* Determine hardware unit */
+    Adc_HwUnitType HwUnit = (ADCx == ADC1) ? 0 : 1;  /* Unit 0 for ADC1, Unit 1 for ADC2 */
+    
+    /* Call hardware interrupt handler */
+    AdcHw_InjectedInterruptHandler(ADCx, HwUnit);
+}
+
+/**
+ * @brief Analog watchdog callback
+ * @param[in] ADCx ADC hardware module
+ * @return void
+ */
+void Adc_Watchdog_Callback(ADC_TypeDef* ADCx)
+{
+    /* Determine hardware unit */
+    Adc_HwUnitType HwUnit = (ADCx == ADC1) ? 0 : 1;  /* Unit 0 for ADC1, Unit 1 for ADC2 */
+    
+    /* Call hardware interrupt handler */
+    AdcHw_WatchdogInterruptHandler(ADCx, HwUnit);
+}
+
 /**
  * @brief DMA transfer complete callback
  * @param[in] DMAx_Channely DMA channel
  * @return void
  */
-void Adc_DmaTransferComplete_Callback(DMA_Channel_TypeDef* DMAx_Channely)
+RAMFUNC void Adc_DmaTransferComplete_Callback(DMA_Channel_TypeDef* DMAx_Channely)
 {
     /* Determine hardware unit based on DMA channel */
     // Adc_HwUnitType HwUnit = (DMAx_Channely == DMA1_Channel1) ? 0 : 1;  /* Unit 0 for ADC1, Unit 1 for ADC2 */
@@ -624,26 +742,17 @@ void Adc_DmaTransferComplete_Callback(DMA_Channel_TypeDef* DMAx_Channely)
     AdcHw_DmaInterruptHandler(DMAx_Channely, HwUnit);
 }
 
-/****************************************************************************************
-*                                 DEFERRED PROCESSING FUNCTIONS                       *
-****************************************************************************************/
-#if(ADC_ENABLE_QUEUEING == STD_ON)
 /**
- * @brief   Main function for deferred ADC processing
- * @return  void
+ * @brief DMA half transfer callback
+ * @param[in] DMAx_Channely DMA channel
+ * @return void
  */
-void Adc_MainFunction(void)
+RAMFUNC void Adc_DmaHalfTransfer_Callback(DMA_Channel_TypeDef* DMAx_Channely)
 {
-    /* Only process if driver is initialized */
-    if (Adc_DriverState != ADC_DRIVER_STATE_INITIALIZED)
-    {
-        return;
-    }
-    
-    AdcHw_MainFunction();
+    Adc_HwUnitType HwUnit = 0;  /* ADC1 uses Hardware Unit 0 */
+    /* Call DMA half transfer handler */
+    AdcHw_DmaHalfTransferHandler(DMAx_Channely, HwUnit);
 }
-#endif
-
 
 /****************************************************************************************
 *                                 STATIC HELPER FUNCTIONS                             *
@@ -782,9 +891,10 @@ static Std_ReturnType Adc_ValidateGroupForStop(Adc_GroupType Group)
 {
     const Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[Group];
     
-    /* Check if group is busy */
+    /* Check if group is busy, a continuous group keeps converting after its buffer is full */
     if ((AdcHw_GetGroupRuntimeStatus(Group) == ADC_IDLE) || 
-        (AdcHw_GetGroupRuntimeStatus(Group) == ADC_STREAM_COMPLETED))
+        ((AdcHw_GetGroupRuntimeStatus(Group) == ADC_STREAM_COMPLETED) &&
+         (GroupConfig->Adc_GroupConvMode != ADC_CONV_MODE_CONTINUOUS)))
     {
         #if (ADC_DEV_ERROR_DETECT == STD_ON)
         Det_ReportError(ADC_MODULE_ID, 0, ADC_STOP_GROUP_CONVERSION_ID, ADC_E_IDLE);
@@ -852,8 +962,7 @@ static void Adc_HandleGroupCompletion(Adc_GroupType Group)
  */
 static void Adc_UpdateGroupStatus(Adc_GroupType Group, Adc_StatusType NewStatus)
 {
-    // Adc_RuntimeGroups[Group].Status = NewStatus;
-    AdcHw_SetGroupStatus(Group, ADC_IDLE);
+    AdcHw_SetGroupStatus(Group, NewStatus);
     
     /* Update performance counters */
     #if (ADC_ENABLE_DEBUG_SUPPORT == STD_ON)
@@ -23,6 +23,7 @@
 #include "stm32f10x_dma.h"
 #include "stm32f10x_rcc.h"
 #include "stm32f10x_gpio.h"
+#include "stm32f10x_tim.h"
 #include "misc.h"
 
 /****************************************************************************************
@@ -32,12 +33,9 @@
 /****************************************************************************************
 *                                 QUEUE CONFIGURATIONS                                 *
 ****************************************************************************************/
- #if(ADC_ENABLE_QUEUEING == STD_ON)
-/* Queue for ADC Hardware Unit 1 */
-static Adc_GroupType AdcHw_GroupQueueHw1[ADC1_QUEUE_SIZE] = {ADC_INVALID_GROUP_ID};
-
-/* Queue for ADC Hardware Unit 2 */
-static Adc_GroupType AdcHw_GroupQueueHw2[ADC2_QUEUE_SIZE] = {ADC_INVALID_GROUP_ID};
+#if (ADC_ENABLE_PRIORITY == STD_ON)
+/* Ready groups per priority level for ADC Hardware Unit 1 */
+static uint32 AdcHw_ReadyGroupMaskHw1[ADC_PRIORITY_LEVELS] = {0};
 #endif
 /* Runtime data arrays */
 static volatile Adc_RuntimeGroupType Adc_RuntimeGroups[ADC_MAX_GROUPS] = {0};
@@ -47,21 +45,44 @@ static volatile Adc_RuntimeHwUnitType Adc_RuntimeHwUnits[ADC_MAX_HW_UNITS] =
     {
         .CurrentGroupId = ADC_INVALID_GROUP_ID,
         .HwUnitState    = HW_STATE_IDLE,
-        #if(ADC_ENABLE_QUEUEING == STD_ON)
-        .QueueGroup     = AdcHw_GroupQueueHw1,        
-        .QueueMaxSize   = ADC_DEFAULT_QUEUE_SIZE,         
-        .QueueHead      = 0,              
-        .QueueTail      = 0,
-        .QueueCount     = 0,     
+        .InjectedGroupId = ADC_INVALID_GROUP_ID,
+        #if(ADC_ENABLE_QUEUING == STD_ON)
+        .QueuedMask     = 0,
+        .QueueTicket    = ADC_HW_QUEUE_TICKET_INIT,
         #endif        
+        #if (ADC_ENABLE_PRIORITY == STD_ON)
+        .ReadyLevelMask   = 0,
+        .ReadyGroupMask   = AdcHw_ReadyGroupMaskHw1,
+        .CurrentPriority  = 0,
+        .PreemptedGroupId = ADC_INVALID_GROUP_ID,
+        #endif
     },
 };
 
 
-/* Deferred processing variables */
-static volatile uint8 AdcHw_DeferredProcessingFlag[ADC_MAX_HW_UNITS] = {0};
-static volatile Adc_HwUnitType AdcHw_PendingUnits[ADC_MAX_HW_UNITS];
-static volatile uint8 AdcHw_PendingCount = 0;
+/* EXTSEL value and timer channel per Adc_HwTriggerEventType */
+static const uint32 AdcHw_TriggerExtSel[ADC_HW_TRIG_EVT_COUNT] =
+{
+    ADC_ExternalTrigConv_T1_CC1,
+    ADC_ExternalTrigConv_T1_CC2,
+    ADC_ExternalTrigConv_T1_CC3,
+    ADC_ExternalTrigConv_T2_CC2,
+    ADC_ExternalTrigConv_T3_TRGO,
+    ADC_ExternalTrigConv_T4_CC4,
+    ADC_ExternalTrigConv_Ext_IT11_TIM8_TRGO,
+    ADC_ExternalTrigInjecConv_T1_TRGO,
+    ADC_ExternalTrigInjecConv_T1_CC4,
+    ADC_ExternalTrigInjecConv_T2_TRGO,
+    ADC_ExternalTrigInjecConv_T2_CC1,
+    ADC_ExternalTrigInjecConv_T3_CC4,
+    ADC_ExternalTrigInjecConv_T4_TRGO,
+    ADC_ExternalTrigInjecConv_Ext_IT15_TIM8_CC4,
+};
+static const uint16 AdcHw_TriggerChannel[ADC_HW_TRIG_EVT_COUNT] =
+{
+    TIM_Channel_1, TIM_Channel_2, TIM_Channel_3, TIM_Channel_2, 0U, TIM_Channel_4, 0U,
+    0U, TIM_Channel_4, 0U, TIM_Channel_1, TIM_Channel_4, 0U, 0U
+};
 
 /****************************************************************************************
 *                                 STATIC FUNCTION PROTOTYPES                          *
@@ -73,7 +94,37 @@ static inline Std_ReturnType AdcHw_ConfigureNvic(Adc_HwUnitType HwUnitId);
 static void AdcHw_HandleChannelSequencing(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
 static void AdcHw_StartNextConversion(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
 static void AdcHw_CallNotification(Adc_GroupType GroupId);
-static uint32 AdcHw_GetCurrentTime(void);
+static void AdcHw_ReleaseHwUnit(Adc_HwUnitType HwUnitId);
+static Std_ReturnType AdcHw_ConfigureTriggerTimer(Adc_GroupType GroupId);
+static void AdcHw_TriggerTimerCmd(Adc_GroupType GroupId, FunctionalState NewState);
+static inline void AdcHw_PowerUp(ADC_TypeDef* ADCx);
+static inline void AdcHw_PowerDown(Adc_HwUnitType HwUnitId, ADC_TypeDef* ADCx);
+#if (ADC_ENABLE_DMA == STD_ON)
+static Std_ReturnType AdcHw_ConfigureDualSlave(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
+#endif
+#if (ADC_ENABLE_LIMIT_CHECKING == STD_ON)
+static void AdcHw_ConfigureWatchdog(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
+#endif
+
+#if (ADC_ENABLE_QUEUING == STD_ON)
+static inline uint32 AdcHw_QueueMaskSet(volatile uint32* Addr, uint32 Bits);
+static inline uint32 AdcHw_QueueMaskClear(volatile uint32* Addr, uint32 Bits);
+static inline uint32 AdcHw_QueueTakeTicket(Adc_HwUnitType HwUnitId);
+static inline Std_ReturnType AdcHw_ClaimHwUnit(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
+#endif
+
+#if (ADC_ENABLE_PRIORITY == STD_ON)
+static inline uint32 AdcHw_EnterCritical(void);
+static inline void AdcHw_ExitCritical(uint32 SavedPrimask);
+static inline uint8 AdcHw_SchedPriority(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
+static Std_ReturnType AdcHw_SchedRequest(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
+static Std_ReturnType AdcHw_SchedCancel(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
+static void AdcHw_SchedDispatch(Adc_HwUnitType HwUnitId);
+static Std_ReturnType AdcHw_SchedMakeReady(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId, uint8 Priority);
+static Adc_GroupType AdcHw_SchedPopHighest(Adc_HwUnitType HwUnitId);
+static void AdcHw_SchedSuspendCurrent(Adc_HwUnitType HwUnitId);
+static Std_ReturnType AdcHw_SchedStart(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId, uint8 Priority);
+#endif
 
 static inline Std_ReturnType AdcHw_ConfigureHwModuleGroup(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
 static inline Std_ReturnType AdcHw_ConfigureHwModuleGroupDMA(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId);
@@ -120,16 +171,7 @@ Std_ReturnType AdcHw_Init(Adc_HwUnitType HwUnitId)
         return E_NOT_OK;
     }
     
-    /* Initialize DMA if enabled */
-    #if (ADC_ENABLE_DMA == STD_ON)
-    if (Adc_HwUnitConfig[HwUnitId].AdcHw_DMAAvailable)
-    {
-        if (AdcHw_InitDma(HwUnitId, 0) != E_OK)
-        {
-            return E_NOT_OK;
-        }
-    }
-    #endif
+    /* DMA is programmed per group on start, AdcHw_InitDma sizes it from that group */
     
     /* Perform calibration - Commented out for now */
     // ADC_StartCalibration(ADCx);
@@ -210,6 +252,32 @@ Std_ReturnType AdcHw_StartSwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType Gr
         return E_NOT_OK;
     }
     
+    /* Injected groups do not compete for the regular sequence */
+    if (ADC_HW_IS_INJECTED_GROUP(&Adc_GroupConfig[GroupId]))
+    {
+        return AdcHw_StartInjectedConversion(HwUnitId, GroupId);
+    }
+    
+    #if (ADC_ENABLE_PRIORITY == STD_ON)
+    /* Request from the API: the scheduler starts, preempts or parks the group */
+    if (Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId != GroupId)
+    {
+        return AdcHw_SchedRequest(HwUnitId, GroupId);
+    }
+    #elif (ADC_ENABLE_QUEUING == STD_ON)
+    /* Request from the API: every request goes through the queue, the dispatch claims
+     * the unit with LDREX/STREX. Dispatching after the add also covers an owner that
+     * released the unit while the group was being queued. */
+    if (Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId != GroupId)
+    {
+        if (AdcHw_AddGroupToQueue(HwUnitId, GroupId) != E_OK)
+        {
+            return E_NOT_OK;
+        }
+        (void)AdcHw_RecallSwConversion(HwUnitId);
+        return (Adc_RuntimeGroups[GroupId].Status == ADC_IDLE) ? E_NOT_OK : E_OK;
+    }
+    #else 
     /* Check if hardware unit is busy */
     /* If Hw trigger is enabled not allow any conversion request*/
     if (AdcHw_GetHwUnitState(HwUnitId) == HW_STATE_HW)
@@ -217,14 +285,6 @@ Std_ReturnType AdcHw_StartSwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType Gr
         return E_NOT_OK;
     }
 
-    #if (ADC_ENABLE_QUEUEING == STD_ON)
-    /* Check is it called from start software not from recall or stop software */
-    if (Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId != GroupId)
-    {
-        /* Add to queue if enable*/
-        return AdcHw_AddGroupToQueue(HwUnitId, GroupId);
-    }
-    #else 
     /* Check if there is any conversion on progess */
     if (Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId != ADC_INVALID_GROUP_ID)
     {
@@ -253,24 +313,43 @@ Std_ReturnType AdcHw_StartSwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType Gr
     Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = GroupId;
     Adc_RuntimeHwUnits[HwUnitId].HwUnitState = HW_STATE_SW;
     
-    /** Reset Runtime Group status */
-    Adc_RuntimeGroups[GroupId].CurrentChannelId = 0;
-    Adc_RuntimeGroups[GroupId].SampleCounter = 0;
-    Adc_RuntimeGroups[GroupId].BufferIndex = 0;
+    /** Reset Runtime Group status, a suspended group continues where it was preempted */
+    if (Adc_RuntimeGroups[GroupId].Suspended == FALSE)
+    {
+        Adc_RuntimeGroups[GroupId].CurrentChannelId = 0;
+        Adc_RuntimeGroups[GroupId].SampleCounter = 0;
+        Adc_RuntimeGroups[GroupId].BufferIndex = 0;
+    }
+    else if (ADC_HW_IS_SCAN_DMA_GROUP(HwUnitConfig, GroupConfig) == FALSE)
+    {
+        /* Rank 1 back to the channel that was interrupted */
+        const Adc_ChannelDefType* ChannelConfig = &GroupConfig->Adc_ChannelGroup[Adc_RuntimeGroups[GroupId].CurrentChannelId];
+        ADC_RegularChannelConfig(ADCx, ChannelConfig->Adc_ChannelId, 1, ChannelConfig->Adc_ChannelSampTime);
+    }
+    Adc_RuntimeGroups[GroupId].Suspended = FALSE;
     
     /* Enable interrupts */
-    if (HwUnitConfig->AdcHw_DMAAvailable && GroupConfig->Adc_InterruptType == ADC_HW_DMA)
+    if (ADC_HW_IS_SCAN_DMA_GROUP(HwUnitConfig, GroupConfig))
     {
         #if (ADC_ENABLE_DMA == STD_ON)
+        /* One DMA block per group, no per-conversion interrupt */
         if (AdcHw_InitDma(HwUnitId, GroupId) != E_OK)
         {
             return E_NOT_OK;
         }
         AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_EOC);
-        AdcHw_EnableInterrupt(HwUnitId, ADC_INTERRUPT_DMA_TC);
+        if (ADC_HW_IS_PING_PONG_GROUP(HwUnitConfig, GroupConfig) ||
+            (ADC_HW_IS_OVERSAMPLED_GROUP(HwUnitConfig, GroupConfig) &&
+             (GroupConfig->Adc_GroupConvMode == ADC_CONV_MODE_CONTINUOUS)))
+        {
+            /* Notify once per buffer half */
+            AdcHw_EnableInterrupt(HwUnitId, ADC_INTERRUPT_DMA_TC | ADC_INTERRUPT_DMA_HT);
+        }
+        else
+        {
+            AdcHw_EnableInterrupt(HwUnitId, ADC_INTERRUPT_DMA_TC);
+        }
         ADC_DMACmd(ADCx, ENABLE);
-        #else    
-        AdcHw_EnableInterrupt(HwUnitId, ADC_INTERRUPT_EOC);
         #endif
     }
     else 
@@ -279,7 +358,7 @@ Std_ReturnType AdcHw_StartSwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType Gr
     }
     
     AdcHw_SetGroupStatus(GroupId, ADC_BUSY);
-    ADC_Cmd(ADCx, ENABLE);
+    AdcHw_PowerUp(ADCx);
     
     /* Start conversion */
     ADC_SoftwareStartConvCmd(ADCx, ENABLE);
@@ -301,10 +380,18 @@ Std_ReturnType AdcHw_StopSwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType Gro
         return E_NOT_OK;
     }
     
+    if (ADC_HW_IS_INJECTED_GROUP(&Adc_GroupConfig[GroupId]))
+    {
+        return AdcHw_StopInjectedConversion(HwUnitId, GroupId);
+    }
+    
     /* Check if this group is currently converting */
     if (Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId != GroupId)
     {
-        #if (ADC_ENABLE_QUEUEING == STD_ON)
+        #if (ADC_ENABLE_PRIORITY == STD_ON)
+        /* Drop it from the ready bitmap or the queue */
+        return AdcHw_SchedCancel(HwUnitId, GroupId);
+        #elif (ADC_ENABLE_QUEUING == STD_ON)
         /* Try to remove from queue */
         return AdcHw_RemoveGroupFromQueue(HwUnitId, GroupId);
         #else
@@ -319,68 +406,106 @@ Std_ReturnType AdcHw_StopSwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType Gro
         return E_NOT_OK;
     }
     
-    #if (ADC_ENABLE_DMA == STD_ON)
     /* Disable DMA if it was enabled for this group */
-    if (Adc_HwUnitConfig[HwUnitId].AdcHw_DMAAvailable && 
-        Adc_GroupConfig[GroupId].Adc_InterruptType == ADC_HW_DMA)
+    if (ADC_HW_IS_SCAN_DMA_GROUP(&Adc_HwUnitConfig[HwUnitId], &Adc_GroupConfig[GroupId]))
     {
+        #if (ADC_ENABLE_DMA == STD_ON)
         AdcHw_DeInitDma(HwUnitId);
+        #endif
     }
     else
     {
         AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_EOC);
     }
-    #endif
     /* Stop conversion - common hardware operation */
     ADC_SoftwareStartConvCmd(ADCx, DISABLE);
-    ADC_Cmd(ADCx, DISABLE);
+    AdcHw_PowerDown(HwUnitId, ADCx);
     
-    #if (ADC_ENABLE_QUEUEING == STD_ON)
-        /* Try to process next group from queue if available */
-        Adc_GroupType NextGroup = AdcHw_GetNextGroupFromQueue(HwUnitId);
-        if (NextGroup != ADC_INVALID_GROUP_ID)
-        {
-            Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = NextGroup;
-            return AdcHw_StartSwConversion(HwUnitId, NextGroup);
-        }
+    AdcHw_SetGroupStatus(GroupId, ADC_IDLE);
+    Adc_RuntimeGroups[GroupId].Suspended = FALSE;
+    
+    /* Release the unit, waiting groups keep their place. The owner goes last, a
+     * start from an interrupt may claim the unit as soon as it is free. */
+    Adc_RuntimeHwUnits[HwUnitId].HwUnitState = HW_STATE_IDLE;
+    __DMB();
+    Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = ADC_INVALID_GROUP_ID;
+
+    #if (ADC_ENABLE_PRIORITY == STD_ON)
+    /* Hand the unit to the highest ready group */
+    AdcHw_SchedDispatch(HwUnitId);
+    #elif (ADC_ENABLE_QUEUING == STD_ON)
+    /* Try to process next group from queue if available */
+    (void)AdcHw_RecallSwConversion(HwUnitId);
     #endif
     
-    /* If no next group or queuing disabled, reset everything */
-    AdcHw_ResetHwRuntime(HwUnitId);
-    AdcHw_SetGroupStatus(GroupId, ADC_IDLE);
     return E_OK;
 }
 
-#if (ADC_ENABLE_QUEUEING == STD_ON)
+#if (ADC_ENABLE_QUEUING == STD_ON)
+/**
+ * @brief Claim a free hardware unit for a group
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @param[in] GroupId ADC group ID
+ * @return E_OK if the unit was free and now belongs to the group, E_NOT_OK otherwise
+ * @note Compare-and-swap of the owner with LDREX/STREX, one of two racing callers wins
+ */
+static inline Std_ReturnType AdcHw_ClaimHwUnit(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
+{
+    volatile uint8_t* Owner = (volatile uint8_t*)&Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId;
+    do
+    {
+        if (__LDREXB(Owner) != ADC_INVALID_GROUP_ID)
+        {
+            __CLREX();
+            return E_NOT_OK;
+        }
+    } while (__STREXB(GroupId, Owner) != 0U);
+    return E_OK;
+}
+
 /**
  * @brief Recall software-triggered conversion  
  * @param[in] HwUnitId ADC hardware unit ID
  * @return E_OK if successful, E_NOT_OK otherwise
- * @note : call after finishing hw conversion or hw conversion is stopped
- *         Only used when queue enabled
+ * @note : Called after a request was queued and whenever the unit is released, from
+ *         thread or interrupt context. Lock-free: the oldest group is taken from the
+ *         queue, then the unit is claimed. A group that loses the unit to another
+ *         caller goes back with its ticket and the loop looks again, the new owner
+ *         may have finished in between. A stop that hits this window reports
+ *         E_NOT_OK and the group runs once more.
  */
 Std_ReturnType AdcHw_RecallSwConversion(Adc_HwUnitType HwUnitId)
 {
-    // No queue in the list 
-    if(Adc_RuntimeHwUnits[HwUnitId].QueueCount == 0)
-    {
-        return E_NOT_OK;
-    }
-    
-    Adc_RuntimeHwUnits[HwUnitId].HwUnitState = HW_STATE_SW;
-    // Adc_RuntimeGroups[GroupId].Status = ADC_IDLE;
-
-    // Get the group id from head of the queue
-    Adc_GroupType CurrentGroup = Adc_RuntimeHwUnits[HwUnitId].QueueGroup[Adc_RuntimeHwUnits[HwUnitId].QueueHead];
-    if(CurrentGroup != ADC_INVALID_GROUP_ID)
+    /* Each pass either starts a group, drops a group that failed to start, or
+     * follows a start from a context that interrupted this one */
+    while (Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId == ADC_INVALID_GROUP_ID)
     {
-        Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = CurrentGroup;
-        AdcHw_StartSwConversion(HwUnitId, CurrentGroup);
+        Adc_GroupType NextGroup = AdcHw_GetNextGroupFromQueue(HwUnitId);
+        if (NextGroup == ADC_INVALID_GROUP_ID)
+        {
+            return E_NOT_OK;
+        }
+        
+        /* Owned before the start so the request is not queued again */
+        if (AdcHw_ClaimHwUnit(HwUnitId, NextGroup) != E_OK)
+        {
+            (void)AdcHw_QueueMaskSet(&Adc_RuntimeHwUnits[HwUnitId].QueuedMask, 1UL << NextGroup);
+            continue;
+        }
+        
+        if (AdcHw_StartSwConversion(HwUnitId, NextGroup) == E_OK)
+        {
+            return E_OK;
+        }
+        AdcHw_SetGroupStatus(NextGroup, ADC_IDLE);
+        Adc_RuntimeHwUnits[HwUnitId].HwUnitState = HW_STATE_IDLE;
+        __DMB();
+        Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = ADC_INVALID_GROUP_ID;
     }
     
-    return E_OK;
+    return E_NOT_OK;
 }
- #endif
+#endif
 /****************************************************************************************
 *                               HW CONVERSION CONTROL FUNCTIONS                        *
 ****************************************************************************************/
@@ -399,6 +524,12 @@ Std_ReturnType AdcHw_StartHwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType Gr
         return E_NOT_OK;
     }
     
+    /* Injected groups do not compete for the regular sequence */
+    if (ADC_HW_IS_INJECTED_GROUP(&Adc_GroupConfig[GroupId]))
+    {
+        return AdcHw_StartInjectedConversion(HwUnitId, GroupId);
+    }
+    
     /* Get ADC hardware module */
     ADC_TypeDef* ADCx = ADC_HW_GET_MODULE_ID(HwUnitId);
     if (ADCx == NULL_PTR)
@@ -406,40 +537,87 @@ Std_ReturnType AdcHw_StartHwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType Gr
         return E_NOT_OK;
     }
     
-    /* Configure group */
-    if (AdcHw_ConfigureGroup(HwUnitId, GroupId) != E_OK)
+    #if (ADC_ENABLE_PRIORITY == STD_ON)
+    /* Request from the API: the scheduler arms the trigger when the group wins the unit */
+    if (Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId != GroupId)
     {
-        return E_NOT_OK;
+        return AdcHw_SchedRequest(HwUnitId, GroupId);
     }
+    #else
     // Already have a trigger
     if (AdcHw_GetHwUnitState(HwUnitId) == HW_STATE_HW)
     {
         return E_NOT_OK;
     }
+    #endif
 
-    AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_DMA_TC);
-    // should be make into inline function
-    ADC_Cmd(ADCx,DISABLE);
     /* Get group configuration */
     Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[GroupId];
+    const Adc_HwUnitDefType* HwUnitConfig = &Adc_HwUnitConfig[HwUnitId];
     
-    /* Configure hardware trigger */
-    // TODO get trigger source hw and set
-    // uint32 TriggerSource = AdcHw_GetHwTriggerSource(GroupConfig->Adc_TriggerSource);
-    ADC_ExternalTrigConvCmd(ADCx, ENABLE);
+    /* EXTTRIG only detects rising edges, JEXTSEL events cannot start the regular sequence */
+    if ((GroupConfig->Adc_HwTriggerSignal != ADC_HW_TRIG_RISING_EDGE) ||
+        ADC_HW_IS_INJECTED_EVENT(GroupConfig->Adc_HwTriggerEvent))
+    {
+        return E_NOT_OK;
+    }
+    
+    /* Off before the group is configured, powering down disarms the watchdog and dual mode */
+    AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_DMA_TC);
+    AdcHw_PowerDown(HwUnitId, ADCx);
+    
+    /* Configure group */
+    if (AdcHw_ConfigureGroup(HwUnitId, GroupId) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+    
+    /* Program the trigger timer, the counter stays off until the ADC is armed */
+    if (AdcHw_ConfigureTriggerTimer(GroupId) != E_OK)
+    {
+        return E_NOT_OK;
+    }
     
-    /* Configure trigger signal */
-    if (GroupConfig->Adc_HwTriggerSignal == ADC_HW_TRIG_RISING_EDGE)
+    /* A suspended group continues at the channel that was interrupted */
+    if (Adc_RuntimeGroups[GroupId].Suspended == FALSE)
+    {
+        Adc_RuntimeGroups[GroupId].CurrentChannelId = 0;
+        Adc_RuntimeGroups[GroupId].SampleCounter = 0;
+        Adc_RuntimeGroups[GroupId].BufferIndex = 0;
+    }
+    else if (ADC_HW_IS_SCAN_DMA_GROUP(HwUnitConfig, GroupConfig) == FALSE)
     {
-        /* Configure for rising edge */
+        const Adc_ChannelDefType* ChannelConfig = &GroupConfig->Adc_ChannelGroup[Adc_RuntimeGroups[GroupId].CurrentChannelId];
+        ADC_RegularChannelConfig(ADCx, ChannelConfig->Adc_ChannelId, 1, ChannelConfig->Adc_ChannelSampTime);
     }
-    else if (GroupConfig->Adc_HwTriggerSignal == ADC_HW_TRIG_FALLING_EDGE)
+    Adc_RuntimeGroups[GroupId].Suspended = FALSE;
+    
+    /* Enable interrupts */
+    if (ADC_HW_IS_SCAN_DMA_GROUP(HwUnitConfig, GroupConfig))
     {
-        /* Configure for falling edge */
+        #if (ADC_ENABLE_DMA == STD_ON)
+        /* Each trigger converts the whole sequence, DMA stores it without CPU work */
+        if (AdcHw_InitDma(HwUnitId, GroupId) != E_OK)
+        {
+            return E_NOT_OK;
+        }
+        AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_EOC);
+        if (ADC_HW_IS_PING_PONG_GROUP(HwUnitConfig, GroupConfig) ||
+            (ADC_HW_IS_OVERSAMPLED_GROUP(HwUnitConfig, GroupConfig) &&
+             (GroupConfig->Adc_GroupConvMode == ADC_CONV_MODE_CONTINUOUS)))
+        {
+            AdcHw_EnableInterrupt(HwUnitId, ADC_INTERRUPT_DMA_TC | ADC_INTERRUPT_DMA_HT);
+        }
+        else
+        {
+            AdcHw_EnableInterrupt(HwUnitId, ADC_INTERRUPT_DMA_TC);
+        }
+        ADC_DMACmd(ADCx, ENABLE);
+        #endif
     }
     else
     {
-        /* Configure for both edges */
+        AdcHw_EnableInterrupt(HwUnitId, ADC_INTERRUPT_EOC);
     }
     
     /* Update runtime data */
@@ -447,10 +625,10 @@ Std_ReturnType AdcHw_StartHwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType Gr
     Adc_RuntimeHwUnits[HwUnitId].HwUnitState = HW_STATE_HW;
     AdcHw_SetGroupStatus(GroupId, ADC_BUSY);
     
-    /* Enable interrupts */
-
-    AdcHw_EnableInterrupt(HwUnitId, ADC_INTERRUPT_EOC);
-    ADC_Cmd(ADCx,ENABLE);
+    /* Arm the trigger input, then start the timer so the first event finds ADC and DMA ready */
+    AdcHw_PowerUp(ADCx);
+    ADC_ExternalTrigConvCmd(ADCx, ENABLE);
+    AdcHw_TriggerTimerCmd(GroupId, ENABLE);
     return E_OK;
 }
 
@@ -468,6 +646,11 @@ Std_ReturnType AdcHw_StopHwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType Gro
         return E_NOT_OK;
     }
     
+    if (ADC_HW_IS_INJECTED_GROUP(&Adc_GroupConfig[GroupId]))
+    {
+        return AdcHw_StopInjectedConversion(HwUnitId, GroupId);
+    }
+    
     /* Get ADC hardware module */
     ADC_TypeDef* ADCx = ADC_HW_GET_MODULE_ID(HwUnitId);
     if (ADCx == NULL_PTR)
@@ -475,102 +658,312 @@ Std_ReturnType AdcHw_StopHwConversion(Adc_HwUnitType HwUnitId, Adc_GroupType Gro
         return E_NOT_OK;
     }
     
+    #if (ADC_ENABLE_PRIORITY == STD_ON)
+    /* Group still waiting for the unit, the trigger was never armed */
+    if (Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId != GroupId)
+    {
+        return AdcHw_SchedCancel(HwUnitId, GroupId);
+    }
+    #endif
+    
     /* Disable hardware trigger */
+    AdcHw_TriggerTimerCmd(GroupId, DISABLE);
     ADC_ExternalTrigConvCmd(ADCx, DISABLE);
     
     /* Disable interrupts */
-    AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_EOC);
+    if (ADC_HW_IS_SCAN_DMA_GROUP(&Adc_HwUnitConfig[HwUnitId], &Adc_GroupConfig[GroupId]))
+    {
+        #if (ADC_ENABLE_DMA == STD_ON)
+        AdcHw_DeInitDma(HwUnitId);
+        #endif
+    }
+    else
+    {
+        AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_EOC);
+    }
+    AdcHw_PowerDown(HwUnitId, ADCx);
     
     /* Update runtime data */
     Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = ADC_INVALID_GROUP_ID;
     // Adc_RuntimeHwUnits[HwUnitId].HwUnitState = FALSE;
     Adc_RuntimeHwUnits[HwUnitId].HwUnitState = HW_STATE_IDLE;
     AdcHw_SetGroupStatus(GroupId, ADC_IDLE);
-    #if (ADC_ENABLE_QUEUEING == STD_ON)
-        AdcHw_RecallSwConversion(HwUnitId);
+    Adc_RuntimeGroups[GroupId].Suspended = FALSE;
+    #if (ADC_ENABLE_PRIORITY == STD_ON)
+        AdcHw_SchedDispatch(HwUnitId);
+    #elif (ADC_ENABLE_QUEUING == STD_ON)
+        (void)AdcHw_RecallSwConversion(HwUnitId);
     #endif
     return E_OK;
 }
 
 
 /****************************************************************************************
-*                                  CONFIGURATION FUNCTIONS                              *
+*                               INJECTED CONVERSION FUNCTIONS                          *
 ****************************************************************************************/
 /**
- * @brief Configure ADC channels for a group
+ * @brief Start an injected group
  * @param[in] HwUnitId ADC hardware unit ID
  * @param[in] GroupId ADC group ID
  * @return E_OK if successful, E_NOT_OK otherwise
+ * @note Only JSQR, JEXTSEL and JEOCIE are touched, a running regular group and its
+ *       DMA stream keep going. The ADC converts the injected ranks between two
+ *       regular conversions and resumes the regular sequence afterwards.
+ * @note SW groups are one-shot, back to back JSWSTART would starve the regular group
  */
-Std_ReturnType AdcHw_ConfigureChannels(ADC_TypeDef* ADCx, Adc_HwUnitDefType* HwUnitConfig, Adc_GroupDefType* GroupConfig)
+Std_ReturnType AdcHw_StartInjectedConversion(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
 {
-    if(GroupConfig->Adc_InterruptType == ADC_HW_EOC)
-    {    
-        const Adc_ChannelDefType* ChannelConfig = &GroupConfig->Adc_ChannelGroup[0];
-        ADC_RegularChannelConfig(ADCx, ChannelConfig->Adc_ChannelId, 1, ChannelConfig->Adc_ChannelSampTime);
-    }
-    else
+    /* Validate parameters */
+    if ((ADC_HW_IS_VALID_UNIT(HwUnitId) == FALSE) || (ADC_HW_IS_VALID_GROUP(GroupId) == FALSE))
     {
-        /* Configure each channel in the group */
-        for (uint8 i = 0; i < GroupConfig->Adc_NbrOfChannel; i++)
-        {
-            const Adc_ChannelDefType* ChannelConfig = &GroupConfig->Adc_ChannelGroup[i];
-            ADC_RegularChannelConfig(ADCx, ChannelConfig->Adc_ChannelId, i + 1, ChannelConfig->Adc_ChannelSampTime);
-        }
+        return E_NOT_OK;
     }
-    return E_OK;
-}
-/**
- * @brief Configure ADC hardware module for a specific group
- * @param[in] HwUnitId ADC hardware unit ID
- * @param[in] GroupId ADC group ID
- * @return E_OK if successful, E_NOT_OK otherwise
- */
-Std_ReturnType AdcHw_ConfigureGroup(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
-{
-    /* Configure channels for this group */
+    
     ADC_TypeDef* ADCx = ADC_HW_GET_MODULE_ID(HwUnitId);
+    const Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[GroupId];
+    uint8 NbrOfChannel = (uint8)GroupConfig->Adc_NbrOfChannel;
+    boolean HwTrigger = (GroupConfig->Adc_TriggerSource == ADC_TRIGG_SRC_HW) ? TRUE : FALSE;
+    
     if (ADCx == NULL_PTR)
     {
         return E_NOT_OK;
     }
-
-    Adc_HwUnitDefType* HwUnitConfig = &Adc_HwUnitConfig[HwUnitId];
-    Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[GroupId];
-
-    AdcHw_ConfigureHwModuleGroup(HwUnitId, GroupId);
-
-    if (AdcHw_ConfigureChannels(ADCx, HwUnitConfig, GroupConfig) != E_OK)
+    
+    /* One injected sequence per unit */
+    if ((Adc_RuntimeHwUnits[HwUnitId].InjectedGroupId != ADC_INVALID_GROUP_ID) &&
+        (Adc_RuntimeHwUnits[HwUnitId].InjectedGroupId != GroupId))
+    {
+        return E_NOT_OK;
+    }
+    
+    if ((NbrOfChannel == 0U) || (NbrOfChannel > ADC_HW_MAX_INJECTED_CHANNELS))
+    {
+        return E_NOT_OK;
+    }
+    
+    if (HwTrigger == TRUE)
+    {
+        /* JEXTTRIG only detects rising edges and only listens to the JEXTSEL events */
+        if ((GroupConfig->Adc_HwTriggerSignal != ADC_HW_TRIG_RISING_EDGE) ||
+            (ADC_HW_IS_INJECTED_EVENT(GroupConfig->Adc_HwTriggerEvent) == FALSE))
+        {
+            return E_NOT_OK;
+        }
+        if (AdcHw_ConfigureTriggerTimer(GroupId) != E_OK)
+        {
+            return E_NOT_OK;
+        }
+    }
+    else if (GroupConfig->Adc_GroupConvMode == ADC_CONV_MODE_CONTINUOUS)
     {
         return E_NOT_OK;
     }
+    
+    /* Length first, SPL places rank 1 relative to JL */
+    ADC_InjectedSequencerLengthConfig(ADCx, NbrOfChannel);
+    for (uint8 i = 0; i < NbrOfChannel; i++)
+    {
+        const Adc_ChannelDefType* ChannelConfig = &GroupConfig->Adc_ChannelGroup[i];
+        ADC_InjectedChannelConfig(ADCx, ChannelConfig->Adc_ChannelId, i + 1, ChannelConfig->Adc_ChannelSampTime);
+    }
+    
+    /* Several ranks need SCAN, a single regular rank behaves the same with it set */
+    if (NbrOfChannel > 1U)
+    {
+        ADCx->CR1 |= ADC_CR1_SCAN;
+    }
+    ADC_AutoInjectedConvCmd(ADCx, DISABLE);
+    ADC_InjectedDiscModeCmd(ADCx, DISABLE);
+    ADC_ExternalTrigInjectedConvConfig(ADCx, (HwTrigger == TRUE) ?
+                                       AdcHw_TriggerExtSel[GroupConfig->Adc_HwTriggerEvent] :
+                                       ADC_ExternalTrigInjecConv_None);
+    
+    /* Update runtime data */
+    Adc_RuntimeHwUnits[HwUnitId].InjectedGroupId = GroupId;
+    Adc_RuntimeGroups[GroupId].CurrentChannelId = 0;
+    Adc_RuntimeGroups[GroupId].SampleCounter = 0;
+    Adc_RuntimeGroups[GroupId].BufferIndex = 0;
+    AdcHw_SetGroupStatus(GroupId, ADC_BUSY);
+    
+    ADC_ClearFlag(ADCx, ADC_FLAG_JEOC);
+    AdcHw_EnableInterrupt(HwUnitId, ADC_INTERRUPT_JEOC);
+    AdcHw_PowerUp(ADCx);
+    
+    /* JSWSTART also needs JEXTTRIG on the F1 */
+    ADC_ExternalTrigInjectedConvCmd(ADCx, ENABLE);
+    if (HwTrigger == TRUE)
+    {
+        AdcHw_TriggerTimerCmd(GroupId, ENABLE);
+    }
+    else
+    {
+        ADC_SoftwareStartInjectedConvCmd(ADCx, ENABLE);
+    }
+    
     return E_OK;
 }
 
-
-/****************************************************************************************
-*                                 RESULT HANDLING FUNCTIONS                           *
-****************************************************************************************/
 /**
- * @brief Read conversion result
+ * @brief Stop an injected group
  * @param[in] HwUnitId ADC hardware unit ID
  * @param[in] GroupId ADC group ID
- * @param[out] ResultPtr Pointer to result buffer
  * @return E_OK if successful, E_NOT_OK otherwise
+ * @note SCAN is left as is, the regular group owns it again on its next start
  */
-Std_ReturnType AdcHw_ReadResult(Adc_HwUnitType HwUnitId, 
-                               Adc_GroupType GroupId, 
-                               Adc_ValueGroupType* ResultPtr)
+Std_ReturnType AdcHw_StopInjectedConversion(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
 {
     /* Validate parameters */
-    if ((ADC_HW_IS_VALID_UNIT(HwUnitId) == FALSE) || (ADC_HW_IS_VALID_GROUP(GroupId) == FALSE) || (ResultPtr == NULL_PTR))
+    if ((ADC_HW_IS_VALID_UNIT(HwUnitId) == FALSE) || (ADC_HW_IS_VALID_GROUP(GroupId) == FALSE))
     {
         return E_NOT_OK;
     }
     
-    /* Get group configuration */
-    Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[GroupId];
-    
+    ADC_TypeDef* ADCx = ADC_HW_GET_MODULE_ID(HwUnitId);
+    if ((ADCx == NULL_PTR) || (Adc_RuntimeHwUnits[HwUnitId].InjectedGroupId != GroupId))
+    {
+        return E_NOT_OK;
+    }
+    
+    if (Adc_GroupConfig[GroupId].Adc_TriggerSource == ADC_TRIGG_SRC_HW)
+    {
+        AdcHw_TriggerTimerCmd(GroupId, DISABLE);
+    }
+    ADC_ExternalTrigInjectedConvCmd(ADCx, DISABLE);
+    AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_JEOC);
+    ADC_ClearFlag(ADCx, ADC_FLAG_JEOC);
+    
+    /* Update runtime data */
+    Adc_RuntimeHwUnits[HwUnitId].InjectedGroupId = ADC_INVALID_GROUP_ID;
+    AdcHw_SetGroupStatus(GroupId, ADC_IDLE);
+    
+    /* Power down only if no regular group is using the unit either */
+    if (Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId == ADC_INVALID_GROUP_ID)
+    {
+        ADC_Cmd(ADCx, DISABLE);
+    }
+    
+    return E_OK;
+}
+
+/****************************************************************************************
+*                                  CONFIGURATION FUNCTIONS                              *
+****************************************************************************************/
+/**
+ * @brief Configure ADC channels for a group
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @param[in] GroupId ADC group ID
+ * @return E_OK if successful, E_NOT_OK otherwise
+ */
+Std_ReturnType AdcHw_ConfigureChannels(ADC_TypeDef* ADCx, Adc_HwUnitDefType* HwUnitConfig, Adc_GroupDefType* GroupConfig)
+{
+    if (GroupConfig->Adc_NbrOfChannel > ADC_HW_MAX_CHANNELS_PER_GROUP)
+    {
+        return E_NOT_OK;
+    }
+
+    if (ADC_HW_IS_SCAN_DMA_GROUP(HwUnitConfig, GroupConfig))
+    {
+        /* Scan mode: program the whole regular sequence once, DMA walks the ranks */
+        for (uint8 i = 0; i < GroupConfig->Adc_NbrOfChannel; i++)
+        {
+            const Adc_ChannelDefType* ChannelConfig = &GroupConfig->Adc_ChannelGroup[i];
+            ADC_RegularChannelConfig(ADCx, ChannelConfig->Adc_ChannelId, i + 1, ChannelConfig->Adc_ChannelSampTime);
+        }
+    }
+    else
+    {    
+        /* Interrupt mode: rank 1 is reprogrammed per channel by AdcHw_StartNextConversion */
+        const Adc_ChannelDefType* ChannelConfig = &GroupConfig->Adc_ChannelGroup[0];
+        ADC_RegularChannelConfig(ADCx, ChannelConfig->Adc_ChannelId, 1, ChannelConfig->Adc_ChannelSampTime);
+    }
+    return E_OK;
+}
+/**
+ * @brief Configure ADC hardware module for a specific group
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @param[in] GroupId ADC group ID
+ * @return E_OK if successful, E_NOT_OK otherwise
+ */
+Std_ReturnType AdcHw_ConfigureGroup(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
+{
+    /* Configure channels for this group */
+    ADC_TypeDef* ADCx = ADC_HW_GET_MODULE_ID(HwUnitId);
+    if (ADCx == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+
+    Adc_HwUnitDefType* HwUnitConfig = &Adc_HwUnitConfig[HwUnitId];
+    Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[GroupId];
+
+    if (AdcHw_ConfigureHwModuleGroup(HwUnitId, GroupId) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+    
+    /* ADC_Init clears SCAN, an armed injected sequence of several ranks still needs it */
+    Adc_GroupType InjectedGroup = Adc_RuntimeHwUnits[HwUnitId].InjectedGroupId;
+    if ((InjectedGroup != ADC_INVALID_GROUP_ID) && (Adc_GroupConfig[InjectedGroup].Adc_NbrOfChannel > 1U))
+    {
+        ADCx->CR1 |= ADC_CR1_SCAN;
+    }
+
+    if (AdcHw_ConfigureChannels(ADCx, HwUnitConfig, GroupConfig) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+    
+    #if (ADC_ENABLE_LIMIT_CHECKING == STD_ON)
+    AdcHw_ConfigureWatchdog(HwUnitId, GroupId);
+    #endif
+    
+    #if (ADC_ENABLE_DMA == STD_ON)
+    if (ADC_HW_IS_DUAL_GROUP(HwUnitConfig, GroupConfig))
+    {
+        return AdcHw_ConfigureDualSlave(HwUnitId, GroupId);
+    }
+    #endif
+    return E_OK;
+}
+
+/**
+ * @brief Get hardware trigger source
+ * @param[in] TriggerEvent Timer or pin event of the group
+ * @return ADC_ExternalTrigConv_xxx value for ADC_Init, software start for an invalid event
+ */
+uint32 AdcHw_GetHwTriggerSource(Adc_HwTriggerEventType TriggerEvent)
+{
+    if ((TriggerEvent >= ADC_HW_TRIG_EVT_COUNT) || ADC_HW_IS_INJECTED_EVENT(TriggerEvent))
+    {
+        return ADC_ExternalTrigConv_None;
+    }
+    return AdcHw_TriggerExtSel[TriggerEvent];
+}
+
+
+/****************************************************************************************
+*                                 RESULT HANDLING FUNCTIONS                           *
+****************************************************************************************/
+/**
+ * @brief Read conversion result
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @param[in] GroupId ADC group ID
+ * @param[out] ResultPtr Pointer to result buffer
+ * @return E_OK if successful, E_NOT_OK otherwise
+ */
+Std_ReturnType AdcHw_ReadResult(Adc_HwUnitType HwUnitId, 
+                               Adc_GroupType GroupId, 
+                               Adc_ValueGroupType* ResultPtr)
+{
+    /* Validate parameters */
+    if ((ADC_HW_IS_VALID_UNIT(HwUnitId) == FALSE) || (ADC_HW_IS_VALID_GROUP(GroupId) == FALSE) || (ResultPtr == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+    
+    /* Get group configuration */
+    Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[GroupId];
+    
     /* Check if results are available */
     if ((Adc_RuntimeGroups[GroupId].Status != ADC_COMPLETED) &&
         (Adc_RuntimeGroups[GroupId].Status != ADC_STREAM_COMPLETED))
@@ -582,9 +975,22 @@ Std_ReturnType AdcHw_ReadResult(Adc_HwUnitType HwUnitId,
     uint16 ResultSize = GroupConfig->Adc_NbrOfChannel;
     Adc_StreamNumSampleType SampleCounter = (Adc_RuntimeGroups[GroupId].SampleCounter - 1) * ResultSize;
 
-    for (uint16 i = 0; i < ResultSize; i++)
+    if (ADC_HW_IS_DUAL_GROUP(&Adc_HwUnitConfig[HwUnitId], GroupConfig))
+    {
+        /* Unpack on read: low half-word ADC1, high half-word ADC2 (little endian) */
+        const Adc_ValueGroupType* Packed = &GroupConfig->Adc_ValueResultPtr[SampleCounter << 1];
+        for (uint16 i = 0; i < ResultSize; i++)
+        {
+            ResultPtr[i] = Packed[i << 1];
+            ResultPtr[ResultSize + i] = Packed[(i << 1) + 1U];
+        }
+    }
+    else
     {
-        ResultPtr[i] = GroupConfig->Adc_ValueResultPtr[i + SampleCounter] ;
+        for (uint16 i = 0; i < ResultSize; i++)
+        {
+            ResultPtr[i] = GroupConfig->Adc_ValueResultPtr[i + SampleCounter] ;
+        }
     }
     AdcHw_HandleReadResultState(HwUnitId, GroupId);
     return E_OK;
@@ -602,6 +1008,23 @@ Std_ReturnType AdcHw_ReadResult(Adc_HwUnitType HwUnitId,
 void AdcHw_HandleReadResultState(Adc_HwUnitType HwUnitId, 
                                Adc_GroupType GroupId)
 {
+    /* Injected groups only give back the injected sequence, the regular group is untouched */
+    if (ADC_HW_IS_INJECTED_GROUP(&Adc_GroupConfig[GroupId]))
+    {
+        if (Adc_RuntimeGroups[GroupId].Status == ADC_STREAM_COMPLETED)
+        {
+            if (Adc_GroupConfig[GroupId].Adc_GroupConvMode == ADC_CONV_MODE_CONTINUOUS)
+            {
+                AdcHw_SetGroupStatus(GroupId, ADC_BUSY);
+            }
+            else
+            {
+                (void)AdcHw_StopInjectedConversion(HwUnitId, GroupId);
+            }
+        }
+        return;
+    }
+    
     if(Adc_RuntimeGroups[GroupId].Status == ADC_STREAM_COMPLETED)
     {
         if(Adc_GroupConfig[GroupId].Adc_GroupConvMode == ADC_CONV_MODE_CONTINUOUS &&
@@ -615,23 +1038,90 @@ void AdcHw_HandleReadResultState(Adc_HwUnitType HwUnitId,
         {
             /* Reset sample counter for next single conversion */
             AdcHw_SetGroupStatus(GroupId, ADC_IDLE);
-            /* Handle oneshot mode completion */
-            ADC_TypeDef* ADCx = ADC_HW_GET_MODULE_ID(HwUnitId);
-            ADC_Cmd(ADCx, DISABLE);
-            
-            #if (ADC_ENABLE_QUEUEING == STD_ON)
-            /* Signal group completion for deferred processing */
-            AdcHw_DeferredProcessingFlag[HwUnitId] = 1;
-            if (AdcHw_PendingCount < ADC_MAX_HW_UNITS)
+            /* One-shot groups gave the unit back on completion, it may already run the
+             * next group. Only a group that still owns the unit stops it here. */
+            if (Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId == GroupId)
             {
-                AdcHw_PendingUnits[AdcHw_PendingCount] = HwUnitId;
-                AdcHw_PendingCount++;
-            } 
-            #else 
-            Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = ADC_INVALID_GROUP_ID;
-            Adc_RuntimeHwUnits[HwUnitId].HwUnitState = HW_STATE_IDLE;  
-            #endif     
+                ADC_TypeDef* ADCx = ADC_HW_GET_MODULE_ID(HwUnitId);
+                AdcHw_PowerDown(HwUnitId, ADCx);
+                
+                AdcHw_ReleaseHwUnit(HwUnitId);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Reduce one staging block of an oversampled group to one result per rank
+ * @param[in] Staging Word aligned raw samples, rank interleaved, ratio rounds
+ * @param[in] NbrOfChannel Number of ranks per round
+ * @param[in] Oversampling log2 of the number of rounds
+ * @param[out] ResultPtr One decimated value per rank
+ * @return void
+ * @note Each 32-bit load adds two right aligned 12-bit samples at once, one per
+ *       half-word lane. The lanes are folded every ADC_HW_OVERSAMPLING_LANE_WORDS
+ *       words before the low lane can carry into the high one.
+ */
+RAMFUNC void AdcHw_Decimate(const Adc_ValueGroupType* Staging,
+                    Adc_ChannelType NbrOfChannel,
+                    Adc_OversamplingType Oversampling,
+                    Adc_ValueGroupType* ResultPtr)
+{
+    const uint32* Words = (const uint32*)Staging;
+    uint32 Rounds = 1UL << Oversampling;
+    uint8 Shift = (uint8)(Oversampling - (Oversampling >> 1));
     
+    if (NbrOfChannel == 1U)
+    {
+        /* Both half-words of every word belong to the one rank */
+        uint32 NbrOfWords = Rounds >> 1;
+        uint32 Sum = 0;
+        for (uint32 w = 0; w < NbrOfWords; w += ADC_HW_OVERSAMPLING_LANE_WORDS)
+        {
+            uint32 End = ((w + ADC_HW_OVERSAMPLING_LANE_WORDS) < NbrOfWords) ? (w + ADC_HW_OVERSAMPLING_LANE_WORDS) : NbrOfWords;
+            uint32 Lanes = 0;
+            for (uint32 k = w; k < End; k++)
+            {
+                Lanes += Words[k];
+            }
+            Sum += (Lanes & 0xFFFFU) + (Lanes >> 16);
+        }
+        ResultPtr[0] = (Adc_ValueGroupType)(Sum >> Shift);
+    }
+    else if ((NbrOfChannel & 1U) == 0U)
+    {
+        /* Rank 2p sits in the low, rank 2p+1 in the high half-word of word p of a round */
+        uint32 Stride = NbrOfChannel >> 1;
+        for (uint32 p = 0; p < Stride; p++)
+        {
+            uint32 SumLow = 0;
+            uint32 SumHigh = 0;
+            for (uint32 r = 0; r < Rounds; r += ADC_HW_OVERSAMPLING_LANE_WORDS)
+            {
+                uint32 End = ((r + ADC_HW_OVERSAMPLING_LANE_WORDS) < Rounds) ? (r + ADC_HW_OVERSAMPLING_LANE_WORDS) : Rounds;
+                uint32 Lanes = 0;
+                for (uint32 k = r; k < End; k++)
+                {
+                    Lanes += Words[(k * Stride) + p];
+                }
+                SumLow += Lanes & 0xFFFFU;
+                SumHigh += Lanes >> 16;
+            }
+            ResultPtr[p << 1] = (Adc_ValueGroupType)(SumLow >> Shift);
+            ResultPtr[(p << 1) + 1U] = (Adc_ValueGroupType)(SumHigh >> Shift);
+        }
+    }
+    else
+    {
+        /* Odd rank counts straddle word boundaries, sum half-word by half-word */
+        for (uint32 c = 0; c < NbrOfChannel; c++)
+        {
+            uint32 Sum = 0;
+            for (uint32 r = 0; r < Rounds; r++)
+            {
+                Sum += Staging[(r * NbrOfChannel) + c];
+            }
+            ResultPtr[c] = (Adc_ValueGroupType)(Sum >> Shift);
         }
     }
 }
@@ -687,6 +1177,11 @@ Std_ReturnType  AdcHw_ResetGroupRuntime(Adc_GroupType GroupId)
     Adc_RuntimeGroups[GroupId].CurrentChannelId = 0;
     Adc_RuntimeGroups[GroupId].SampleCounter = 0;
     Adc_RuntimeGroups[GroupId].BufferIndex = 0;
+    
+    /* Watchdog window starts from the configured limits */
+    const Adc_LimitCheckDefType* LimitCheck = Adc_GroupConfig[GroupId].Adc_LimitCheck;
+    Adc_RuntimeGroups[GroupId].LimitLow = (LimitCheck != NULL_PTR) ? LimitCheck->Adc_LowLimit : 0U;
+    Adc_RuntimeGroups[GroupId].LimitHigh = (LimitCheck != NULL_PTR) ? LimitCheck->Adc_HighLimit : ADC_LIMIT_MAX_VALUE;
 
     return E_OK;
 }
@@ -717,20 +1212,23 @@ Std_ReturnType AdcHw_ResetHwRuntime(Adc_HwUnitType HwUnitId)
 
     Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = ADC_INVALID_GROUP_ID;
     Adc_RuntimeHwUnits[HwUnitId].HwUnitState = HW_STATE_IDLE;
+    Adc_RuntimeHwUnits[HwUnitId].InjectedGroupId = ADC_INVALID_GROUP_ID;
 
-    #if( ADC_ENABLE_QUEUEING == STD_ON)
+    #if( ADC_ENABLE_QUEUING == STD_ON)
     /* Reset runtime data */
-    if(Adc_RuntimeHwUnits[HwUnitId].QueueCount != 0)
+    Adc_RuntimeHwUnits[HwUnitId].QueuedMask = 0;
+    Adc_RuntimeHwUnits[HwUnitId].QueueTicket = ADC_HW_QUEUE_TICKET_INIT;
+
+    #endif
+
+    #if (ADC_ENABLE_PRIORITY == STD_ON)
+    for (uint8 Level = 0; Level < ADC_PRIORITY_LEVELS; Level++)
     {
-        for(Adc_GroupType i = 0; i < Adc_RuntimeHwUnits[HwUnitId].QueueMaxSize;i++ )
-        {
-            Adc_RuntimeHwUnits[HwUnitId].QueueGroup[i] = ADC_INVALID_GROUP_ID ;
-        }
+        Adc_RuntimeHwUnits[HwUnitId].ReadyGroupMask[Level] = 0;
     }
-    Adc_RuntimeHwUnits[HwUnitId].QueueHead = 0;
-    Adc_RuntimeHwUnits[HwUnitId].QueueTail = 0;
-    Adc_RuntimeHwUnits[HwUnitId].QueueCount = 0;
-
+    Adc_RuntimeHwUnits[HwUnitId].ReadyLevelMask = 0;
+    Adc_RuntimeHwUnits[HwUnitId].CurrentPriority = 0;
+    Adc_RuntimeHwUnits[HwUnitId].PreemptedGroupId = ADC_INVALID_GROUP_ID;
     #endif
     return E_OK;
 }
@@ -793,6 +1291,18 @@ Std_ReturnType AdcHw_EnableInterrupt(Adc_HwUnitType HwUnitId, uint8 InterruptTyp
         NVIC_EnableIRQ(ADC1_2_IRQn);
     }
     
+    if (InterruptType & ADC_INTERRUPT_JEOC)
+    {
+        ADC_ITConfig(ADCx, ADC_IT_JEOC, ENABLE);
+        NVIC_EnableIRQ(ADC1_2_IRQn);
+    }
+    
+    if (InterruptType & ADC_INTERRUPT_AWD)
+    {
+        ADC_ITConfig(ADCx, ADC_IT_AWD, ENABLE);
+        NVIC_EnableIRQ(ADC1_2_IRQn);
+    }
+    
     if (InterruptType & ADC_INTERRUPT_DMA_TC)
     {
         /* Enable DMA transfer complete interrupt */
@@ -804,6 +1314,17 @@ Std_ReturnType AdcHw_EnableInterrupt(Adc_HwUnitType HwUnitId, uint8 InterruptTyp
         }
     }
     
+    if (InterruptType & ADC_INTERRUPT_DMA_HT)
+    {
+        /* Enable DMA half transfer interrupt */
+        DMA_Channel_TypeDef* DMAx = ADC_HW_GET_DMA_CHANNEL(HwUnitId);
+        if (DMAx != NULL_PTR)
+        {
+            DMA_ITConfig(DMAx, DMA_IT_HT, ENABLE);
+            NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+        }
+    }
+    
     return E_OK;
 }
 
@@ -832,6 +1353,22 @@ Std_ReturnType AdcHw_DisableInterrupt(Adc_HwUnitType HwUnitId, uint8 InterruptTy
     if (InterruptType & ADC_INTERRUPT_EOC)
     {
         ADC_ITConfig(ADCx, ADC_IT_EOC, DISABLE);
+    }
+    
+    if (InterruptType & ADC_INTERRUPT_JEOC)
+    {
+        ADC_ITConfig(ADCx, ADC_IT_JEOC, DISABLE);
+    }
+    
+    if (InterruptType & ADC_INTERRUPT_AWD)
+    {
+        ADC_ITConfig(ADCx, ADC_IT_AWD, DISABLE);
+    }
+    
+    /* Shared vector: keep it while the other sequence or the watchdog still interrupts */
+    if ((InterruptType & (ADC_INTERRUPT_EOC | ADC_INTERRUPT_JEOC | ADC_INTERRUPT_AWD)) &&
+        ((ADCx->CR1 & (ADC_CR1_EOCIE | ADC_CR1_JEOCIE | ADC_CR1_AWDIE)) == 0U))
+    {
         NVIC_DisableIRQ(ADC1_2_IRQn);
     }
     
@@ -846,6 +1383,16 @@ Std_ReturnType AdcHw_DisableInterrupt(Adc_HwUnitType HwUnitId, uint8 InterruptTy
         }
     }
     
+    if (InterruptType & ADC_INTERRUPT_DMA_HT)
+    {
+        /* Disable DMA half transfer interrupt */
+        DMA_Channel_TypeDef* DMAx = ADC_HW_GET_DMA_CHANNEL(HwUnitId);
+        if (DMAx != NULL_PTR)
+        {
+            DMA_ITConfig(DMAx, DMA_IT_HT, DISABLE);
+        }
+    }
+    
     return E_OK;
 }
 
@@ -865,7 +1412,7 @@ Std_ReturnType AdcHw_DisableInterrupt(Adc_HwUnitType HwUnitId, uint8 InterruptTy
  * @param[in] HwUnitId ADC hardware unit ID
  * @return void
  */
-void AdcHw_InterruptHandler(ADC_TypeDef* ADCx, Adc_HwUnitType HwUnitId)
+RAMFUNC void AdcHw_InterruptHandler(ADC_TypeDef* ADCx, Adc_HwUnitType HwUnitId)
 {    
     /* Validate hardware unit */
     if (ADC_HW_IS_VALID_UNIT(HwUnitId) == FALSE)
@@ -892,13 +1439,133 @@ void AdcHw_InterruptHandler(ADC_TypeDef* ADCx, Adc_HwUnitType HwUnitId)
     
 }
 
+/**
+ * @brief ADC analog watchdog interrupt service routine
+ * @param[in] ADCx ADC hardware module pointer
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @return void
+ * @note The value handed to the callback is the last regular result in DR, exact for
+ *       single rank groups. AWD is set again on every conversion outside the window,
+ *       so the interrupt is switched off unless the callback moved the window.
+ */
+void AdcHw_WatchdogInterruptHandler(ADC_TypeDef* ADCx, Adc_HwUnitType HwUnitId)
+{
+    /* Validate hardware unit */
+    if (ADC_HW_IS_VALID_UNIT(HwUnitId) == FALSE)
+    {
+        return;
+    }
+    
+    #if (ADC_ENABLE_LIMIT_CHECKING == STD_ON)
+    Adc_GroupType CurrentGroup = Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId;
+    if ((CurrentGroup == ADC_INVALID_GROUP_ID) || (Adc_GroupConfig[CurrentGroup].Adc_LimitCheck == NULL_PTR))
+    {
+        AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_AWD);
+        return;
+    }
+    const Adc_LimitCheckDefType* LimitCheck = Adc_GroupConfig[CurrentGroup].Adc_LimitCheck;
+    
+    /* Low half-word is this ADC in dual mode too, bring left aligned data back to 12 bits */
+    Adc_ValueGroupType Value = (Adc_ValueGroupType)(ADCx->DR & 0xFFFFU);
+    if ((ADCx->CR2 & ADC_CR2_ALIGN) != 0U)
+    {
+        Value >>= 4;
+    }
+    Adc_LimitEventType Event = (Value > Adc_RuntimeGroups[CurrentGroup].LimitHigh) ? ADC_LIMIT_ABOVE_HIGH : ADC_LIMIT_BELOW_LOW;
+    
+    if (LimitCheck->Adc_LimitNotificationCb != NULL_PTR)
+    {
+        LimitCheck->Adc_LimitNotificationCb(CurrentGroup, Event, Value);
+    }
+    
+    /* Window not moved around the value: one event per crossing, not one per sample */
+    if ((Value < Adc_RuntimeGroups[CurrentGroup].LimitLow) || (Value > Adc_RuntimeGroups[CurrentGroup].LimitHigh))
+    {
+        AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_AWD);
+    }
+    #else
+    (void)ADCx;
+    AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_AWD);
+    #endif
+}
+
+/**
+ * @brief ADC injected end of sequence interrupt service routine
+ * @param[in] ADCx ADC hardware module pointer
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @return void
+ * @note One interrupt per injected sequence, all ranks are read from JDR1..JDRn
+ */
+RAMFUNC void AdcHw_InjectedInterruptHandler(ADC_TypeDef* ADCx, Adc_HwUnitType HwUnitId)
+{
+    /* Validate hardware unit */
+    if (ADC_HW_IS_VALID_UNIT(HwUnitId) == FALSE)
+    {
+        return;
+    }
+    
+    Adc_GroupType Group = Adc_RuntimeHwUnits[HwUnitId].InjectedGroupId;
+    if (Group == ADC_INVALID_GROUP_ID)
+    {
+        return;
+    }
+    Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[Group];
+    volatile Adc_RuntimeGroupType* Runtime = &Adc_RuntimeGroups[Group];
+    uint8 NbrOfChannel = (uint8)GroupConfig->Adc_NbrOfChannel;
+    
+    /* A full circular or continuous buffer wraps on the next sequence */
+    if (Runtime->SampleCounter >= GroupConfig->Adc_StreamNumSamples)
+    {
+        Runtime->SampleCounter = 0;
+    }
+    
+    /* JDRx are 4 bytes apart, ADC_InjectedChannel_x is the register offset */
+    uint16 Base = (uint16)(Runtime->SampleCounter * NbrOfChannel);
+    for (uint8 i = 0; i < NbrOfChannel; i++)
+    {
+        GroupConfig->Adc_ValueResultPtr[Base + i] =
+            ADC_GetInjectedConversionValue(ADCx, (uint8)(ADC_InjectedChannel_1 + (i << 2)));
+    }
+    Runtime->CurrentChannelId = NbrOfChannel - 1;
+    Runtime->BufferIndex = Base + NbrOfChannel - 1;
+    Runtime->SampleCounter++;
+    
+    if (Runtime->SampleCounter >= GroupConfig->Adc_StreamNumSamples)
+    {
+        AdcHw_SetGroupStatus(Group, ADC_STREAM_COMPLETED);
+        
+        /* A full linear buffer takes no more triggers, results wait for Adc_ReadGroup */
+        if ((GroupConfig->Adc_TriggerSource == ADC_TRIGG_SRC_HW) &&
+            (GroupConfig->Adc_StreamBufferMode != ADC_STREAM_BUFFER_CIRCULAR) &&
+            (GroupConfig->Adc_GroupConvMode != ADC_CONV_MODE_CONTINUOUS))
+        {
+            AdcHw_TriggerTimerCmd(Group, DISABLE);
+            ADC_ExternalTrigInjectedConvCmd(ADCx, DISABLE);
+        }
+    }
+    else
+    {
+        if (Runtime->Status == ADC_BUSY)
+        {
+            AdcHw_SetGroupStatus(Group, ADC_COMPLETED);
+        }
+        /* Streaming SW group: next sample straight away */
+        if (GroupConfig->Adc_TriggerSource == ADC_TRIGG_SRC_SW)
+        {
+            ADC_SoftwareStartInjectedConvCmd(ADCx, ENABLE);
+        }
+    }
+    
+    AdcHw_CallNotification(Group);
+}
+
 /**
  * @brief DMA interrupt service routine
  * @param[in] DMAx DMA channel pointer
  * @param[in] HwUnitId ADC hardware unit ID
  * @return void
  */
-void AdcHw_DmaInterruptHandler(DMA_Channel_TypeDef* DMAx, Adc_HwUnitType HwUnitId)
+RAMFUNC void AdcHw_DmaInterruptHandler(DMA_Channel_TypeDef* DMAx, Adc_HwUnitType HwUnitId)
 {
     /* Validate hardware unit */
     if (ADC_HW_IS_VALID_UNIT(HwUnitId) == FALSE)
@@ -908,9 +1575,21 @@ void AdcHw_DmaInterruptHandler(DMA_Channel_TypeDef* DMAx, Adc_HwUnitType HwUnitI
         
     /* Get current group */
     Adc_GroupType CurrentGroup = Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId;
+    if (CurrentGroup == ADC_INVALID_GROUP_ID)
+    {
+        return;
+    }
     Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[CurrentGroup];
     
-    /* Update runtime data with completion status */
+    if (ADC_HW_IS_OVERSAMPLED_GROUP(&Adc_HwUnitConfig[HwUnitId], GroupConfig))
+    {
+        /* Continuous groups just finished the second staging half */
+        uint16 Offset = (GroupConfig->Adc_GroupConvMode == ADC_CONV_MODE_CONTINUOUS) ? ADC_HW_OVERSAMPLING_BLOCK_SIZE(GroupConfig) : 0U;
+        AdcHw_Decimate(&GroupConfig->Adc_OversamplingBufferPtr[Offset], GroupConfig->Adc_NbrOfChannel,
+                       GroupConfig->Adc_Oversampling, GroupConfig->Adc_ValueResultPtr);
+    }
+    
+    /* Update runtime data with completion status, one interrupt per DMA block */
     Adc_RuntimeGroups[CurrentGroup].SampleCounter = GroupConfig->Adc_StreamNumSamples;
     Adc_RuntimeGroups[CurrentGroup].CurrentChannelId = GroupConfig->Adc_NbrOfChannel - 1;
     Adc_RuntimeGroups[CurrentGroup].BufferIndex = GroupConfig->Adc_StreamNumSamples * GroupConfig->Adc_NbrOfChannel - 1;
@@ -920,258 +1599,602 @@ void AdcHw_DmaInterruptHandler(DMA_Channel_TypeDef* DMAx, Adc_HwUnitType HwUnitI
     /* Call notification when done conversion */
     AdcHw_CallNotification(CurrentGroup);
     
-    /* Handle continuous vs oneshot mode - this should be fix in ver 3.0 */
-    if (GroupConfig->Adc_GroupConvMode == ADC_CONV_MODE_CONTINUOUS)
+    if (GroupConfig->Adc_TriggerSource == ADC_TRIGG_SRC_HW)
     {
-        /* Reset parameters for continuous mode */
-        Adc_RuntimeGroups[CurrentGroup].SampleCounter = 0;
-        Adc_RuntimeGroups[CurrentGroup].CurrentChannelId = 0;
-        Adc_RuntimeGroups[CurrentGroup].BufferIndex = 0;
-        ADC_SoftwareStartConvCmd(ADC_HW_GET_MODULE_ID(HwUnitId), ENABLE); 
+        /* Group stays armed until Adc_DisableHardwareTrigger, a full linear buffer takes no more triggers */
+        if ((GroupConfig->Adc_StreamBufferMode != ADC_STREAM_BUFFER_CIRCULAR) &&
+            (GroupConfig->Adc_GroupConvMode != ADC_CONV_MODE_CONTINUOUS))
+        {
+            ADC_ExternalTrigConvCmd(ADC_HW_GET_MODULE_ID(HwUnitId), DISABLE);
+        }
     }
-    else 
+    /* Continuous groups: ADC keeps scanning and DMA wraps in circular mode, no restart needed */
+    else if (GroupConfig->Adc_GroupConvMode != ADC_CONV_MODE_CONTINUOUS)
     {
-        /* Handle oneshot mode completion */
+        /* One-shot, single or streaming: the block is the whole request, the ADC
+         * stops and the unit goes to the next waiting software group */
         ADC_TypeDef* ADCx = ADC_HW_GET_MODULE_ID(HwUnitId);
-        ADC_Cmd(ADCx, DISABLE);
+        AdcHw_PowerDown(HwUnitId, ADCx);
         
-        #if (ADC_ENABLE_QUEUEING == STD_ON)
-        /* Signal group completion for deferred processing */
-        AdcHw_DeferredProcessingFlag[HwUnitId] = 1;
-        if (AdcHw_PendingCount < ADC_MAX_HW_UNITS)
-        {
-            AdcHw_PendingUnits[AdcHw_PendingCount] = HwUnitId;
-            AdcHw_PendingCount++;
-        } 
-        #else 
-        Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = ADC_INVALID_GROUP_ID;
-        Adc_RuntimeHwUnits[HwUnitId].HwUnitState = HW_STATE_IDLE;  
-        #endif     
+        AdcHw_ReleaseHwUnit(HwUnitId);
+    }
+}
+
+/**
+ * @brief DMA half transfer interrupt service routine
+ * @param[in] DMAx DMA channel pointer
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @return void
+ * @note First half of a ping-pong buffer is stable, DMA is filling the second half
+ */
+RAMFUNC void AdcHw_DmaHalfTransferHandler(DMA_Channel_TypeDef* DMAx, Adc_HwUnitType HwUnitId)
+{
+    /* Validate hardware unit */
+    if (ADC_HW_IS_VALID_UNIT(HwUnitId) == FALSE)
+    {
+        return;
+    }
+        
+    /* Get current group */
+    Adc_GroupType CurrentGroup = Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId;
+    if (CurrentGroup == ADC_INVALID_GROUP_ID)
+    {
+        return;
+    }
+    Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[CurrentGroup];
+    
+    if (ADC_HW_IS_OVERSAMPLED_GROUP(&Adc_HwUnitConfig[HwUnitId], GroupConfig))
+    {
+        /* First staging half holds a whole result round, publish it like the TC does */
+        AdcHw_Decimate(GroupConfig->Adc_OversamplingBufferPtr, GroupConfig->Adc_NbrOfChannel,
+                       GroupConfig->Adc_Oversampling, GroupConfig->Adc_ValueResultPtr);
+        Adc_RuntimeGroups[CurrentGroup].SampleCounter = GroupConfig->Adc_StreamNumSamples;
+        Adc_RuntimeGroups[CurrentGroup].CurrentChannelId = GroupConfig->Adc_NbrOfChannel - 1;
+        Adc_RuntimeGroups[CurrentGroup].BufferIndex = GroupConfig->Adc_NbrOfChannel - 1;
+        AdcHw_SetGroupStatus(CurrentGroup, ADC_STREAM_COMPLETED);
+        AdcHw_CallNotification(CurrentGroup);
+        return;
+    }
+    
+    Adc_StreamNumSampleType HalfSamples = GroupConfig->Adc_StreamNumSamples >> 1;
+    
+    /* Runtime data points at the last sample of the first half */
+    Adc_RuntimeGroups[CurrentGroup].SampleCounter = HalfSamples;
+    Adc_RuntimeGroups[CurrentGroup].CurrentChannelId = GroupConfig->Adc_NbrOfChannel - 1;
+    Adc_RuntimeGroups[CurrentGroup].BufferIndex = HalfSamples * GroupConfig->Adc_NbrOfChannel - 1;
+    
+    if (Adc_RuntimeGroups[CurrentGroup].Status == ADC_BUSY)
+    {
+        AdcHw_SetGroupStatus(CurrentGroup, ADC_COMPLETED);
     }
     
-    /* TODO: add check if not streaming */
-    /* TODO: check if linear or one shot get out call next software */
+    /* Call notification for the first half */
+    AdcHw_CallNotification(CurrentGroup);
 }
 /****************************************************************************************
 *                              QUEUE MANAGEMENT FUNCTIONS                             *
 ****************************************************************************************/
-#if (ADC_ENABLE_QUEUEING == STD_ON)
+#if (ADC_ENABLE_QUEUING == STD_ON)
+/*
+ * The queue is a bitmap of waiting groups plus a ticket per group: the oldest ticket
+ * among the set bits is the head. Every update is one read-modify-write of a 32-bit
+ * word, so thread and interrupt context can add, remove and take groups without a
+ * critical section. Taking a group is a test-and-clear of its bit, only one caller
+ * gets it. With ADC_ENABLE_PRIORITY the scheduler already holds PRIMASK around every
+ * queue call and the helpers below are plain read-modify-write.
+ * A single-producer/single-consumer ring does not fit: notifications request groups
+ * from the DMA interrupt, and both Adc_StartGroupConversion and the release in the
+ * interrupt take the head. Tickets are compared by distance to the counter, so the
+ * order holds across the 32-bit wrap.
+ */
+
+/**
+ * @brief Set bits in a queue mask
+ * @param[in] Addr Mask to update
+ * @param[in] Bits Bits to set
+ * @return Mask value before the update
+ * @note LDREX/STREX, retried when an interrupt touched the mask in between
+ */
+static inline uint32 AdcHw_QueueMaskSet(volatile uint32* Addr, uint32 Bits)
+{
+    uint32 Old;
+    #if (ADC_ENABLE_PRIORITY == STD_ON)
+    Old = *Addr;
+    *Addr = Old | Bits;
+    #else
+    do
+    {
+        Old = __LDREXW((volatile uint32_t*)Addr);
+    } while (__STREXW(Old | Bits, (volatile uint32_t*)Addr) != 0U);
+    #endif
+    return Old;
+}
+
+/**
+ * @brief Clear bits in a queue mask
+ * @param[in] Addr Mask to update
+ * @param[in] Bits Bits to clear
+ * @return Mask value before the update
+ */
+static inline uint32 AdcHw_QueueMaskClear(volatile uint32* Addr, uint32 Bits)
+{
+    uint32 Old;
+    #if (ADC_ENABLE_PRIORITY == STD_ON)
+    Old = *Addr;
+    *Addr = Old & ~Bits;
+    #else
+    do
+    {
+        Old = __LDREXW((volatile uint32_t*)Addr);
+    } while (__STREXW(Old & ~Bits, (volatile uint32_t*)Addr) != 0U);
+    #endif
+    return Old;
+}
+
+/**
+ * @brief Draw the next FIFO ticket of a hardware unit
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @return Ticket, free-running
+ */
+static inline uint32 AdcHw_QueueTakeTicket(Adc_HwUnitType HwUnitId)
+{
+    volatile uint32* Counter = &Adc_RuntimeHwUnits[HwUnitId].QueueTicket;
+    uint32 Ticket;
+    #if (ADC_ENABLE_PRIORITY == STD_ON)
+    Ticket = *Counter;
+    *Counter = Ticket + 1U;
+    #else
+    do
+    {
+        Ticket = __LDREXW((volatile uint32_t*)Counter);
+    } while (__STREXW(Ticket + 1U, (volatile uint32_t*)Counter) != 0U);
+    #endif
+    return Ticket;
+}
+
 /**
  * @brief Add group to conversion queue
  * @param[in] HwUnitId ADC hardware unit ID
  * @param[in] GroupId ADC group ID
- * @return E_OK if successful, E_NOT_OK otherwise
+ * @return E_OK if successful, E_NOT_OK if the group is already queued
+ * @note The ticket is written before the bit is published, a reader that sees the
+ *       bit also sees the ticket. Two adds of the same group racing each other both
+ *       set the bit, the later ticket wins and one of them reports E_NOT_OK.
  */
 Std_ReturnType AdcHw_AddGroupToQueue(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
 {
-    if(Adc_RuntimeHwUnits[HwUnitId].QueueCount < Adc_RuntimeHwUnits[HwUnitId].QueueMaxSize||
-        AdcHw_IsGroupInQueue(HwUnitId, GroupId) == ADC_INVALID_GROUP_ID) 
+    volatile Adc_RuntimeHwUnitType* HwUnit = &Adc_RuntimeHwUnits[HwUnitId];
+    uint32 GroupBit = 1UL << GroupId;
+    
+    if ((HwUnit->QueuedMask & GroupBit) != 0U)
     {
-        Adc_RuntimeHwUnits[HwUnitId].QueueCount++;
-        // if you add the first group of this queue
-        if(Adc_RuntimeHwUnits[HwUnitId].QueueCount == 1) 
-        {
-            Adc_RuntimeHwUnits[HwUnitId].QueueGroup[Adc_RuntimeHwUnits[HwUnitId].QueueTail] = GroupId;
-            Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId =  GroupId;
-        }
-        else 
-        {
-            Adc_RuntimeHwUnits[HwUnitId].QueueTail = (++Adc_RuntimeHwUnits[HwUnitId].QueueTail == Adc_RuntimeHwUnits[HwUnitId].QueueMaxSize) ? 0 : Adc_RuntimeHwUnits[HwUnitId].QueueTail;
-            Adc_RuntimeHwUnits[HwUnitId].QueueGroup[Adc_RuntimeHwUnits[HwUnitId].QueueTail] = GroupId;
-        }
-        return E_OK;
+        return E_NOT_OK;
     }
-    return E_NOT_OK;
+    
+    /* Busy before it is visible, the group may be started and finished right away */
+    AdcHw_SetGroupStatus(GroupId, ADC_BUSY);
+    Adc_RuntimeGroups[GroupId].QueueTicket = AdcHw_QueueTakeTicket(HwUnitId);
+    __DMB();
+    if ((AdcHw_QueueMaskSet(&HwUnit->QueuedMask, GroupBit) & GroupBit) != 0U)
+    {
+        return E_NOT_OK;
+    }
+    return E_OK;
 }
 
 /**
  * @brief Remove group from conversion queue
  * @param[in] HwUnitId ADC hardware unit ID
  * @param[in] GroupId ADC group ID
- * @return E_OK if successful, E_NOT_OK otherwise
+ * @return E_OK if the group was queued and removed, E_NOT_OK otherwise
+ * @note O(1), test and clear of the queued bit
  */
-// TODO : Need to fix this and document this
 Std_ReturnType AdcHw_RemoveGroupFromQueue(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
 {
-    Adc_GroupType index = AdcHw_IsGroupInQueue(HwUnitId, GroupId);
-    if(index != ADC_INVALID_GROUP_ID) 
+    uint32 GroupBit = 1UL << GroupId;
+    
+    /* Test and clear in one step, a dispatch may be taking the same group */
+    if ((AdcHw_QueueMaskClear(&Adc_RuntimeHwUnits[HwUnitId].QueuedMask, GroupBit) & GroupBit) == 0U)
+    {
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+
+/**
+ * @brief Get next group from queue
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @return Group ID or ADC_INVALID_GROUP_ID if queue is empty
+ * @note The returned group is removed from the queue. The scan is bounded by the
+ *       number of queued groups, it starts over only when another context took or
+ *       removed the chosen group in between.
+ */
+Adc_GroupType AdcHw_GetNextGroupFromQueue(Adc_HwUnitType HwUnitId)
+{
+    volatile Adc_RuntimeHwUnitType* HwUnit = &Adc_RuntimeHwUnits[HwUnitId];
+    
+    for (;;)
     {
-        if(index == Adc_RuntimeHwUnits[HwUnitId].QueueHead )
-        {
-            Adc_RuntimeHwUnits[HwUnitId].QueueGroup[index] = ADC_INVALID_GROUP_ID;
-            Adc_RuntimeHwUnits[HwUnitId].QueueHead = (++index == Adc_RuntimeHwUnits[HwUnitId].QueueMaxSize) ? 0 : index;
-            Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = Adc_RuntimeHwUnits[HwUnitId].QueueGroup[index] ;
-        }
-        else if(index ==  Adc_RuntimeHwUnits[HwUnitId].QueueTail)
+        uint32 Pending = HwUnit->QueuedMask;
+        uint32 Now = HwUnit->QueueTicket;
+        Adc_GroupType Oldest = ADC_INVALID_GROUP_ID;
+        uint32 OldestAge = 0U;
+        
+        if (Pending == 0U)
         {
-            Adc_RuntimeHwUnits[HwUnitId].QueueGroup[index] = ADC_INVALID_GROUP_ID;
-            Adc_RuntimeHwUnits[HwUnitId].QueueTail = (--index == 0) ? Adc_RuntimeHwUnits[HwUnitId].QueueMaxSize - 1 : index;
+            return ADC_INVALID_GROUP_ID;
         }
-        // 0 h 0 x t 0 0 0
-        // t 0 0 0 h 0 x 0
-        // 0 x t 0 0 0 0 h
-        // index always < tail
-        // if(index > head) if(tail > head) index -> tail
-        //                  if(tail < head) index -> max, 0 -> tail
-        // if(index < head) -> tail < head index->tail
-        else
+        __DMB();
+        
+        /* Oldest = largest distance to the ticket counter, wrap-safe */
+        while (Pending != 0U)
         {
-            // if(index > Adc_RuntimeHwUnits[HwUnitId].QueueHead && Adc_RuntimeHwUnits[HwUnitId].QueueHead > Adc_RuntimeHwUnits[HwUnitId].QueueTail)
-            if(index > Adc_RuntimeHwUnits[HwUnitId].QueueTail)
-            {
-                for(Adc_GroupType i = index; i < Adc_RuntimeHwUnits[HwUnitId].QueueMaxSize - 1; i++)
-                {
-                    Adc_RuntimeHwUnits[HwUnitId].QueueGroup[i] = Adc_RuntimeHwUnits[HwUnitId].QueueGroup[i + 1];
-                }
-                Adc_RuntimeHwUnits[HwUnitId].QueueGroup[Adc_RuntimeHwUnits[HwUnitId].QueueMaxSize - 1] = Adc_RuntimeHwUnits[HwUnitId].QueueGroup[0];
-                
-            }
-            for (index = 0; index < Adc_RuntimeHwUnits[HwUnitId].QueueTail - 1; index++)
+            Adc_GroupType GroupId = (Adc_GroupType)(31U - __CLZ(Pending));
+            uint32 Age = Now - Adc_RuntimeGroups[GroupId].QueueTicket;
+            if ((Oldest == ADC_INVALID_GROUP_ID) || (Age > OldestAge))
             {
-                Adc_RuntimeHwUnits[HwUnitId].QueueGroup[index] = Adc_RuntimeHwUnits[HwUnitId].QueueGroup[index + 1 ];
+                Oldest = GroupId;
+                OldestAge = Age;
             }
-            Adc_RuntimeHwUnits[HwUnitId].QueueTail = index;
+            Pending &= ~(1UL << GroupId);
+        }
+        
+        if ((AdcHw_QueueMaskClear(&HwUnit->QueuedMask, 1UL << Oldest) & (1UL << Oldest)) != 0U)
+        {
+            return Oldest;
         }
-        // Decrease number of group in queue
-        Adc_RuntimeHwUnits[HwUnitId].QueueCount--;
     }
-    return E_NOT_OK;
 }
 
 /**
- * @brief Get next group from queue
+ * @brief Check if group is in queue
  * @param[in] HwUnitId ADC hardware unit ID
- * @return Group ID or ADC_INVALID_GROUP_ID if queue is empty
+ * @param[in] GroupId ADC group ID
+ * @return TRUE if in queue, FALSE otherwise
  */
-Adc_GroupType AdcHw_GetNextGroupFromQueue(Adc_HwUnitType HwUnitId)
+boolean AdcHw_IsGroupInQueue(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
 {
-    Adc_GroupType ret = ADC_INVALID_GROUP_ID;
-    if(Adc_RuntimeHwUnits[HwUnitId].QueueCount > 1) 
-    {
-        // Get the current group index
-        Adc_GroupType id = Adc_RuntimeHwUnits[HwUnitId].QueueHead;
+    return ((Adc_RuntimeHwUnits[HwUnitId].QueuedMask & (1UL << GroupId)) != 0U) ? TRUE : FALSE;
+}
 
-        // This is fix to remove using AdcHw_RemoveGroupFromQueue in interrupt handler
-        // Clear the current group registered before go to next group
-        Adc_RuntimeHwUnits[HwUnitId].QueueGroup[id] = ADC_INVALID_GROUP_ID;
+/**
+ * @brief Clear conversion queue
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @return E_OK if successful, E_NOT_OK otherwise
+ */
+Std_ReturnType AdcHw_ClearQueue(Adc_HwUnitType HwUnitId)
+{
+    return AdcHw_ResetHwRuntime(HwUnitId);
+}
+#endif /* ADC_ENABLE_QUEUING */
 
-        // Check if head is at the end of the queue
-        if(++id == Adc_RuntimeHwUnits[HwUnitId].QueueMaxSize - 1)
-            ret =  Adc_RuntimeHwUnits[HwUnitId].QueueGroup[0];
-        else 
-            ret = Adc_RuntimeHwUnits[HwUnitId].QueueGroup[id];
-    }
-    return ret;
+/****************************************************************************************
+*                              PRIORITY SCHEDULER FUNCTIONS                           *
+****************************************************************************************/
+#if (ADC_ENABLE_PRIORITY == STD_ON)
+/**
+ * @brief Enter a critical section shared with the ADC and DMA interrupts
+ * @return Saved PRIMASK, to be passed to AdcHw_ExitCritical
+ * @note PRIMASK is restored rather than cleared so the pair also nests inside an ISR
+ */
+static inline uint32 AdcHw_EnterCritical(void)
+{
+    uint32 SavedPrimask = __get_PRIMASK();
+    __disable_irq();
+    return SavedPrimask;
+}
 
+/**
+ * @brief Leave a critical section opened by AdcHw_EnterCritical
+ * @param[in] SavedPrimask Value returned by AdcHw_EnterCritical
+ * @return void
+ */
+static inline void AdcHw_ExitCritical(uint32 SavedPrimask)
+{
+    __set_PRIMASK(SavedPrimask);
 }
 
 /**
- * @brief Check if group is in queue
+ * @brief Get effective scheduling priority of a group
  * @param[in] HwUnitId ADC hardware unit ID
  * @param[in] GroupId ADC group ID
- * @return TRUE if in queue, FALSE otherwise
+ * @return 0 for background groups served in request order, otherwise ready level + 1
+ * @note ADC_PRIORITY_HW ranks hardware triggered groups only, software triggered
+ *       groups stay in the FIFO queue. ADC_PRIORITY_HW_SW ranks every group.
  */
-Adc_GroupType AdcHw_IsGroupInQueue(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
+static inline uint8 AdcHw_SchedPriority(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
 {
-    if(Adc_RuntimeHwUnits[HwUnitId].QueueHead > Adc_RuntimeHwUnits[HwUnitId].QueueTail)
+    const Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[GroupId];
+    Adc_PriorityImplementationType Mode = Adc_HwUnitConfig[HwUnitId].AdcHw_PriorityEnable;
+    
+    if ((Mode == ADC_PRIORITY_NONE) ||
+        ((Mode == ADC_PRIORITY_HW) && (GroupConfig->Adc_TriggerSource == ADC_TRIGG_SRC_SW)))
     {
-        for(Adc_GroupType i = Adc_RuntimeHwUnits[HwUnitId].QueueHead; i < Adc_RuntimeHwUnits[HwUnitId].QueueMaxSize;i++ )
-        {
-            if(Adc_RuntimeHwUnits[HwUnitId].QueueGroup[i] == GroupId) return i;
-        }        
-        for(Adc_GroupType i = 0; i <= Adc_RuntimeHwUnits[HwUnitId].QueueTail;i++ )
+        return 0;
+    }
+    
+    /* Priorities above the configured levels share the top level */
+    if (GroupConfig->Adc_GroupPriority >= ADC_PRIORITY_LEVELS)
+    {
+        return ADC_PRIORITY_LEVELS;
+    }
+    return GroupConfig->Adc_GroupPriority + 1;
+}
+
+/**
+ * @brief Handle a start request for a group that does not own the unit
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @param[in] GroupId ADC group ID
+ * @return E_OK if the group started or is waiting, E_NOT_OK otherwise
+ * @note : A strictly higher priority replaces the current group, equal or lower waits
+ */
+static Std_ReturnType AdcHw_SchedRequest(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
+{
+    volatile Adc_RuntimeHwUnitType* HwUnit = &Adc_RuntimeHwUnits[HwUnitId];
+    uint8 Priority = AdcHw_SchedPriority(HwUnitId, GroupId);
+    Std_ReturnType Ret;
+    
+    uint32 SavedPrimask = AdcHw_EnterCritical();
+    if (HwUnit->CurrentGroupId == ADC_INVALID_GROUP_ID)
+    {
+        /* Unit free */
+        Ret = AdcHw_SchedStart(HwUnitId, GroupId, Priority);
+    }
+    else if (Priority > HwUnit->CurrentPriority)
+    {
+        /* Replace the current group as its Adc_GroupReplacement asks */
+        AdcHw_SchedSuspendCurrent(HwUnitId);
+        Ret = AdcHw_SchedStart(HwUnitId, GroupId, Priority);
+        if (Ret != E_OK)
         {
-            if(Adc_RuntimeHwUnits[HwUnitId].QueueGroup[i] == GroupId) return i;
+            /* Give the unit back to the replaced group */
+            AdcHw_SchedDispatch(HwUnitId);
         }
     }
     else
     {
-        for(Adc_GroupType i = Adc_RuntimeHwUnits[HwUnitId].QueueHead; i <= Adc_RuntimeHwUnits[HwUnitId].QueueTail;i++ )
+        /* Wait for the unit */
+        Ret = AdcHw_SchedMakeReady(HwUnitId, GroupId, Priority);
+    }
+    AdcHw_ExitCritical(SavedPrimask);
+    
+    return Ret;
+}
+
+/**
+ * @brief Drop a waiting group from the scheduler
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @param[in] GroupId ADC group ID
+ * @return E_OK if the group was waiting and is now idle, E_NOT_OK otherwise
+ */
+static Std_ReturnType AdcHw_SchedCancel(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
+{
+    volatile Adc_RuntimeHwUnitType* HwUnit = &Adc_RuntimeHwUnits[HwUnitId];
+    uint8 Priority = AdcHw_SchedPriority(HwUnitId, GroupId);
+    uint32 GroupBit = 1UL << GroupId;
+    Std_ReturnType Ret = E_NOT_OK;
+    
+    uint32 SavedPrimask = AdcHw_EnterCritical();
+    if (HwUnit->PreemptedGroupId == GroupId)
+    {
+        HwUnit->PreemptedGroupId = ADC_INVALID_GROUP_ID;
+        Ret = E_OK;
+    }
+    else if (Priority == 0)
+    {
+        Ret = AdcHw_RemoveGroupFromQueue(HwUnitId, GroupId);
+    }
+    else if ((HwUnit->ReadyGroupMask[Priority - 1] & GroupBit) != 0)
+    {
+        HwUnit->ReadyGroupMask[Priority - 1] &= ~GroupBit;
+        if (HwUnit->ReadyGroupMask[Priority - 1] == 0)
         {
-            if(Adc_RuntimeHwUnits[HwUnitId].QueueGroup[i] == GroupId) return i;
+            HwUnit->ReadyLevelMask &= ~(1UL << (Priority - 1));
         }
+        Ret = E_OK;
     }
-    return ADC_INVALID_GROUP_ID;
+    AdcHw_ExitCritical(SavedPrimask);
+    
+    if (Ret == E_OK)
+    {
+        AdcHw_SetGroupStatus(GroupId, ADC_IDLE);
+        Adc_RuntimeGroups[GroupId].Suspended = FALSE;
+    }
+    return Ret;
 }
 
 /**
- * @brief Clear conversion queue
+ * @brief Start the next waiting group on a free unit
  * @param[in] HwUnitId ADC hardware unit ID
- * @return E_OK if successful, E_NOT_OK otherwise
+ * @return void
+ * @note : Order is highest ready level, then the preempted background group, then
+ *         the FIFO queue. Safe from thread and interrupt context.
  */
-Std_ReturnType AdcHw_ClearQueue(Adc_HwUnitType HwUnitId)
+static void AdcHw_SchedDispatch(Adc_HwUnitType HwUnitId)
 {
-    return AdcHw_ResetHwRuntime(HwUnitId);
+    volatile Adc_RuntimeHwUnitType* HwUnit = &Adc_RuntimeHwUnits[HwUnitId];
+    
+    uint32 SavedPrimask = AdcHw_EnterCritical();
+    /* Bounded by ADC_MAX_GROUPS, each failed start drops one group */
+    while (HwUnit->CurrentGroupId == ADC_INVALID_GROUP_ID)
+    {
+        Adc_GroupType NextGroup = AdcHw_SchedPopHighest(HwUnitId);
+        if (NextGroup == ADC_INVALID_GROUP_ID)
+        {
+            NextGroup = HwUnit->PreemptedGroupId;
+            HwUnit->PreemptedGroupId = ADC_INVALID_GROUP_ID;
+        }
+        if (NextGroup == ADC_INVALID_GROUP_ID)
+        {
+            NextGroup = AdcHw_GetNextGroupFromQueue(HwUnitId);
+        }
+        if (NextGroup == ADC_INVALID_GROUP_ID)
+        {
+            break;
+        }
+        
+        if (AdcHw_SchedStart(HwUnitId, NextGroup, AdcHw_SchedPriority(HwUnitId, NextGroup)) != E_OK)
+        {
+            AdcHw_SetGroupStatus(NextGroup, ADC_IDLE);
+            Adc_RuntimeGroups[NextGroup].Suspended = FALSE;
+        }
+    }
+    AdcHw_ExitCritical(SavedPrimask);
+}
+
+/**
+ * @brief Park a group until the unit is free
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @param[in] GroupId ADC group ID
+ * @param[in] Priority Effective priority from AdcHw_SchedPriority
+ * @return E_OK if parked, E_NOT_OK if the group is already queued
+ * @note : Caller holds the critical section
+ */
+static Std_ReturnType AdcHw_SchedMakeReady(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId, uint8 Priority)
+{
+    volatile Adc_RuntimeHwUnitType* HwUnit = &Adc_RuntimeHwUnits[HwUnitId];
+    
+    if (Priority == 0)
+    {
+        return AdcHw_AddGroupToQueue(HwUnitId, GroupId);
+    }
+    
+    HwUnit->ReadyGroupMask[Priority - 1] |= (1UL << GroupId);
+    HwUnit->ReadyLevelMask |= (1UL << (Priority - 1));
+    
+    /* A preempted group keeps its status, a new request is reported busy */
+    if (Adc_RuntimeGroups[GroupId].Status == ADC_IDLE)
+    {
+        AdcHw_SetGroupStatus(GroupId, ADC_BUSY);
+    }
+    return E_OK;
+}
+
+/**
+ * @brief Take the highest priority ready group out of the bitmap
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @return Group ID or ADC_INVALID_GROUP_ID if no group is ready
+ * @note : O(1), top level from CLZ on the level mask, lowest group ID wins a tie
+ */
+static Adc_GroupType AdcHw_SchedPopHighest(Adc_HwUnitType HwUnitId)
+{
+    volatile Adc_RuntimeHwUnitType* HwUnit = &Adc_RuntimeHwUnits[HwUnitId];
+    
+    if (HwUnit->ReadyLevelMask == 0)
+    {
+        return ADC_INVALID_GROUP_ID;
+    }
+    
+    uint8 Level = 31U - __CLZ(HwUnit->ReadyLevelMask);
+    uint32 GroupMask = HwUnit->ReadyGroupMask[Level];
+    Adc_GroupType GroupId = __CLZ(__RBIT(GroupMask));
+    
+    GroupMask &= ~(1UL << GroupId);
+    HwUnit->ReadyGroupMask[Level] = GroupMask;
+    if (GroupMask == 0)
+    {
+        HwUnit->ReadyLevelMask &= ~(1UL << Level);
+    }
+    return GroupId;
 }
-#endif /* ADC_ENABLE_QUEUEING */
 
-/****************************************************************************************
-*                                 DEFERRED PROCESSING FUNCTIONS                       *
-****************************************************************************************/
-// TODO : FOCUS Remove this function
-#if (ADC_ENABLE_QUEUEING == STD_ON)
 /**
- * @brief Main function for deferred processing
+ * @brief Take the unit away from the current group
+ * @param[in] HwUnitId ADC hardware unit ID
  * @return void
+ * @note : Caller holds the critical section.
+ *         ADC_GROUP_REPL_ABORT_RESTART: the group restarts from its first channel.
+ *         ADC_GROUP_REPL_SUSPEND_RESUME: counters are kept, EOC groups continue at the
+ *         interrupted channel, DMA groups redo the interrupted block.
  */
-void AdcHw_MainFunction(void)
+static void AdcHw_SchedSuspendCurrent(Adc_HwUnitType HwUnitId)
 {
-    /* Process all pending units */
-    for (uint8 i = 0; i < AdcHw_PendingCount; i++)
+    volatile Adc_RuntimeHwUnitType* HwUnit = &Adc_RuntimeHwUnits[HwUnitId];
+    Adc_GroupType GroupId = HwUnit->CurrentGroupId;
+    Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[GroupId];
+    ADC_TypeDef* ADCx = ADC_HW_GET_MODULE_ID(HwUnitId);
+    
+    /* Stop the hardware, a late EOC must not land in the next group's buffer */
+    if (HwUnit->HwUnitState == HW_STATE_HW)
+    {
+        AdcHw_TriggerTimerCmd(GroupId, DISABLE);
+        ADC_ExternalTrigConvCmd(ADCx, DISABLE);
+    }
+    ADC_SoftwareStartConvCmd(ADCx, DISABLE);
+    AdcHw_PowerDown(HwUnitId, ADCx);
+    if (ADC_HW_IS_SCAN_DMA_GROUP(&Adc_HwUnitConfig[HwUnitId], GroupConfig))
+    {
+        #if (ADC_ENABLE_DMA == STD_ON)
+        AdcHw_DeInitDma(HwUnitId);
+        #endif
+    }
+    else
+    {
+        AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_EOC);
+        ADC_ClearITPendingBit(ADCx, ADC_IT_EOC);
+    }
+    
+    if (GroupConfig->Adc_GroupReplacement == ADC_GROUP_REPL_SUSPEND_RESUME)
     {
-        Adc_HwUnitType HwUnitId = AdcHw_PendingUnits[i];
-        
-        if (AdcHw_DeferredProcessingFlag[HwUnitId])
-        {
-            /* Clear flag atomically */
-            __disable_irq();
-            AdcHw_DeferredProcessingFlag[HwUnitId] = 0;
-            __enable_irq();
-            
-            /* Process completed conversions */
-            AdcHw_ProcessCompletedConversions(HwUnitId);
-        }
+        Adc_RuntimeGroups[GroupId].Suspended = TRUE;
+    }
+    else
+    {
+        Adc_RuntimeGroups[GroupId].Suspended = FALSE;
+        Adc_RuntimeGroups[GroupId].CurrentChannelId = 0;
+        Adc_RuntimeGroups[GroupId].SampleCounter = 0;
+        Adc_RuntimeGroups[GroupId].BufferIndex = 0;
     }
     
-    /* Reset pending count */
-    AdcHw_PendingCount = 0;
+    HwUnit->CurrentGroupId = ADC_INVALID_GROUP_ID;
+    HwUnit->HwUnitState = HW_STATE_IDLE;
+    
+    /* Only one background group can run, so one slot holds it while preempted */
+    if (HwUnit->CurrentPriority == 0)
+    {
+        HwUnit->PreemptedGroupId = GroupId;
+    }
+    else
+    {
+        (void)AdcHw_SchedMakeReady(HwUnitId, GroupId, HwUnit->CurrentPriority);
+    }
 }
 
 /**
- * @brief Process completed conversions
+ * @brief Give the unit to a group and start it
  * @param[in] HwUnitId ADC hardware unit ID
- * @return void
+ * @param[in] GroupId ADC group ID
+ * @param[in] Priority Effective priority from AdcHw_SchedPriority
+ * @return E_OK if started, E_NOT_OK otherwise (unit left free)
+ * @note : Caller holds the critical section
  */
-void AdcHw_ProcessCompletedConversions(Adc_HwUnitType HwUnitId)
+static Std_ReturnType AdcHw_SchedStart(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId, uint8 Priority)
 {
-    /* Get current group */
-    Adc_GroupType CurrentGroup = Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId;
-    if (CurrentGroup == ADC_INVALID_GROUP_ID)
+    volatile Adc_RuntimeHwUnitType* HwUnit = &Adc_RuntimeHwUnits[HwUnitId];
+    Std_ReturnType Ret;
+    
+    /* Register the group first so the start is not routed back to the scheduler */
+    HwUnit->CurrentGroupId = GroupId;
+    HwUnit->CurrentPriority = Priority;
+    
+    if (Adc_GroupConfig[GroupId].Adc_TriggerSource == ADC_TRIGG_SRC_HW)
     {
-        return;
+        Ret = AdcHw_StartHwConversion(HwUnitId, GroupId);
     }
-    Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = ADC_INVALID_GROUP_ID;
-    if(AdcHw_GetHwUnitState(HwUnitId) == HW_STATE_HW)
+    else
     {
-        AdcHw_RecallSwConversion(HwUnitId);
+        Ret = AdcHw_StartSwConversion(HwUnitId, GroupId);
     }
-    else 
+    
+    if (Ret != E_OK)
     {
-        Adc_GroupType NextGroup = AdcHw_GetNextGroupFromQueue(HwUnitId);
-        if (NextGroup != ADC_INVALID_GROUP_ID)
-        {
-            Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = CurrentGroup;
-            AdcHw_StartSwConversion(HwUnitId, NextGroup);
-        }
-        else 
-        {
-            AdcHw_ResetHwRuntime(HwUnitId);             
-        }
+        HwUnit->CurrentGroupId = ADC_INVALID_GROUP_ID;
+        HwUnit->HwUnitState = HW_STATE_IDLE;
+        HwUnit->CurrentPriority = 0;
     }
-    
+    return Ret;
 }
-#endif
-
+#endif /* ADC_ENABLE_PRIORITY */
 
 /****************************************************************************************
 *                                 VALIDATION FUNCTIONS                                *
@@ -1244,7 +2267,7 @@ static inline Std_ReturnType AdcHw_ConfigureHwModuleGroup(Adc_HwUnitType HwUnitI
     // add checks
     Std_ReturnType ret = E_NOT_OK;
     #if(ADC_ENABLE_DMA == STD_ON)  
-    if (ADC_DMA_AVAILABLE == Adc_HwUnitConfig[HwUnitId].AdcHw_DMAAvailable)
+    if (ADC_HW_IS_SCAN_DMA_GROUP(&Adc_HwUnitConfig[HwUnitId], &Adc_GroupConfig[GroupId]))
     {
         /* Get ADC hardware module */
         ret = AdcHw_ConfigureHwModuleGroupDMA(HwUnitId, GroupId);
@@ -1267,10 +2290,15 @@ static inline Std_ReturnType AdcHw_ConfigureHwModuleGroupDMA(Adc_HwUnitType HwUn
         return E_NOT_OK;
     }
     ADC_InitTypeDef adc;
+    /* DUALMOD lives in ADC1 CR1, every group start rewrites it */
+    adc.ADC_Mode = ADC_HW_IS_DUAL_GROUP(&Adc_HwUnitConfig[HwUnitId], GroupConfig) ? ADC_Mode_RegSimult : ADC_Mode_Independent;
     adc.ADC_NbrOfChannel = GroupConfig->Adc_NbrOfChannel;              // Number of channels to be converted
     adc.ADC_ScanConvMode = (GroupConfig->Adc_NbrOfChannel == 1) ? DISABLE : ENABLE;       // Multi channel conversion
-    if(GroupConfig->Adc_GroupConvMode == ADC_CONV_MODE_CONTINUOUS || \
-        GroupConfig->Adc_GroupAccessMode == ADC_ACCESS_MODE_STREAMING)
+    /* HW groups convert one sequence per trigger event, the timer sets the rate */
+    if((GroupConfig->Adc_TriggerSource == ADC_TRIGG_SRC_SW) && \
+       (GroupConfig->Adc_GroupConvMode == ADC_CONV_MODE_CONTINUOUS || \
+        GroupConfig->Adc_GroupAccessMode == ADC_ACCESS_MODE_STREAMING || \
+        ADC_HW_IS_OVERSAMPLED_GROUP(&Adc_HwUnitConfig[HwUnitId], GroupConfig)))
     {
         adc.ADC_ContinuousConvMode = ENABLE;
     }
@@ -1283,8 +2311,7 @@ static inline Std_ReturnType AdcHw_ConfigureHwModuleGroupDMA(Adc_HwUnitType HwUn
         adc.ADC_ExternalTrigConv = ADC_ExternalTrigConv_None; // No external trigger
     }
     else{
-        //do nothing now
-        adc.ADC_ExternalTrigConv = ADC_ExternalTrigConv_T1_CC1; // No external trigger
+        adc.ADC_ExternalTrigConv = AdcHw_GetHwTriggerSource(GroupConfig->Adc_HwTriggerEvent);
     }
     adc.ADC_DataAlign = (GroupConfig->Adc_ResultAlignment == ADC_ALIGN_RIGHT) ? ADC_DataAlign_Right : ADC_DataAlign_Left; // Right alignment
     ADC_Init(ADCx, &adc);
@@ -1309,13 +2336,15 @@ static inline Std_ReturnType AdcHw_ConfigureHwModuleGroupIT( Adc_HwUnitType HwUn
         return E_NOT_OK;
     }
     ADC_InitTypeDef adc ;
+    adc.ADC_Mode = ADC_Mode_Independent;
     adc.ADC_ScanConvMode = DISABLE;
     adc.ADC_NbrOfChannel = 1 ;              // Number of channels to be converted
-    if(GroupConfig->Adc_NbrOfChannel == 1 && \
-       GroupConfig->Adc_GroupConvMode == ADC_CONV_MODE_ONESHOT && \
-       GroupConfig->Adc_GroupAccessMode == ADC_ACCESS_MODE_SINGLE)
+    if((GroupConfig->Adc_TriggerSource == ADC_TRIGG_SRC_HW) || \
+       (GroupConfig->Adc_NbrOfChannel == 1 && \
+        GroupConfig->Adc_GroupConvMode == ADC_CONV_MODE_ONESHOT && \
+        GroupConfig->Adc_GroupAccessMode == ADC_ACCESS_MODE_SINGLE))
     {
-        adc.ADC_ContinuousConvMode = DISABLE; // Oneshot mode
+        adc.ADC_ContinuousConvMode = DISABLE; // Oneshot mode or one conversion per trigger
     }
     else 
     {
@@ -1327,8 +2356,7 @@ static inline Std_ReturnType AdcHw_ConfigureHwModuleGroupIT( Adc_HwUnitType HwUn
     }
     // HW trigger
     else{
-        //do nothing now
-        adc.ADC_ExternalTrigConv = ADC_ExternalTrigConv_T1_CC1; // No external trigger
+        adc.ADC_ExternalTrigConv = AdcHw_GetHwTriggerSource(GroupConfig->Adc_HwTriggerEvent);
     }
     adc.ADC_DataAlign = (GroupConfig->Adc_ResultAlignment == ADC_ALIGN_RIGHT) ? ADC_DataAlign_Right : ADC_DataAlign_Left; // Right alignment
     ADC_Init(ADCx, &adc);
@@ -1340,6 +2368,87 @@ static inline Std_ReturnType AdcHw_ConfigureHwModuleGroupIT( Adc_HwUnitType HwUn
     return E_OK;
 }
 
+/**
+ * @brief Switch the ADC on without starting a conversion
+ * @param[in] ADCx ADC hardware module pointer
+ * @return void
+ * @note Writing ADON=1 while it is already set starts a regular conversion on the F1,
+ *       which would shift a running DMA stream when an injected group keeps the ADC on
+ */
+static inline void AdcHw_PowerUp(ADC_TypeDef* ADCx)
+{
+    if ((ADCx->CR2 & ADC_CR2_ADON) == 0U)
+    {
+        ADC_Cmd(ADCx, ENABLE);
+    }
+}
+
+/**
+ * @brief Switch the ADC off unless an injected group still uses it
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @param[in] ADCx ADC hardware module pointer
+ * @return void
+ * @note Regular paths only, the injected stop path checks the regular group itself
+ * @note A dual mode slave always goes off with its regular group
+ */
+static inline void AdcHw_PowerDown(Adc_HwUnitType HwUnitId, ADC_TypeDef* ADCx)
+{
+    #if (ADC_ENABLE_LIMIT_CHECKING == STD_ON)
+    /* The watchdog window belongs to the regular group that just ended */
+    ADC_AnalogWatchdogCmd(ADCx, ADC_AnalogWatchdog_None);
+    AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_AWD);
+    #endif
+    
+    if ((ADCx == ADC1) && ((ADC1->CR1 & ADC_CR1_DUALMOD) != 0U))
+    {
+        ADC1->CR1 &= ~ADC_CR1_DUALMOD;
+        ADC_ExternalTrigConvCmd(ADC2, DISABLE);
+        ADC_Cmd(ADC2, DISABLE);
+    }
+    
+    if (Adc_RuntimeHwUnits[HwUnitId].InjectedGroupId == ADC_INVALID_GROUP_ID)
+    {
+        ADC_Cmd(ADCx, DISABLE);
+    }
+}
+
+#if (ADC_ENABLE_LIMIT_CHECKING == STD_ON)
+/**
+ * @brief Arm the analog watchdog for a regular group, or disarm it if the group has no limit check
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @param[in] GroupId ADC group ID
+ * @return void
+ * @note ADC_Init leaves AWDEN/AWDSGL/AWDCH alone, they are rewritten for every group
+ */
+static void AdcHw_ConfigureWatchdog(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
+{
+    ADC_TypeDef* ADCx = ADC_HW_GET_MODULE_ID(HwUnitId);
+    const Adc_LimitCheckDefType* LimitCheck = Adc_GroupConfig[GroupId].Adc_LimitCheck;
+    
+    if (LimitCheck == NULL_PTR)
+    {
+        ADC_AnalogWatchdogCmd(ADCx, ADC_AnalogWatchdog_None);
+        AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_AWD);
+        return;
+    }
+    
+    ADC_AnalogWatchdogThresholdsConfig(ADCx, Adc_RuntimeGroups[GroupId].LimitHigh, Adc_RuntimeGroups[GroupId].LimitLow);
+    if (LimitCheck->Adc_LimitChannel == ADC_LIMIT_ALL_CHANNELS)
+    {
+        ADC_AnalogWatchdogCmd(ADCx, ADC_AnalogWatchdog_AllRegEnable);
+    }
+    else
+    {
+        ADC_AnalogWatchdogSingleChannelConfig(ADCx, LimitCheck->Adc_LimitChannel);
+        ADC_AnalogWatchdogCmd(ADCx, ADC_AnalogWatchdog_SingleRegEnable);
+    }
+    
+    /* Stale flag of the previous group would fire right away */
+    ADC_ClearITPendingBit(ADCx, ADC_IT_AWD);
+    AdcHw_EnableInterrupt(HwUnitId, ADC_INTERRUPT_AWD);
+}
+#endif
+
 /**
  * @brief Configure clocks
  * @param[in] HwUnitId ADC hardware unit ID
@@ -1362,9 +2471,8 @@ static inline Std_ReturnType AdcHw_ConfigureClocks(Adc_HwUnitType HwUnitId)
         return E_NOT_OK;
     }
     
-    /* Configure ADC clock prescaler */
-    // TODO BIG BUG
-    RCC_ADCCLKConfig(RCC_PCLK2_Div6);
+    /* Configure ADC clock prescaler, Adc_Timing derives conversion times from the same value */
+    RCC_ADCCLKConfig(ADC_CLOCK_PRESCALER);
     
     return E_OK;
 }
@@ -1411,17 +2519,55 @@ inline Std_ReturnType AdcHw_InitDma(Adc_HwUnitType HwUnitId, Adc_GroupType Group
     ADC_TypeDef* ADCx = ADC_HW_GET_MODULE_ID(HwUnitId);
     DMA_Channel_TypeDef* DMAx = ADC_HW_GET_DMA_CHANNEL(HwUnitId);
 
+    /* Whole NbrOfChannel x StreamNumSamples block in one transfer */
+    uint16 BlockSize = ADC_HW_GROUP_BLOCK_SIZE(GroupConfig);
+    boolean Dual = ADC_HW_IS_DUAL_GROUP(&Adc_HwUnitConfig[HwUnitId], GroupConfig) ? TRUE : FALSE;
+    if ((ADCx == NULL_PTR) || (DMAx == NULL_PTR) || (BlockSize == 0) ||
+        ((BlockSize * ADC_HW_VALUES_PER_RANK(&Adc_HwUnitConfig[HwUnitId], GroupConfig)) > GroupConfig->Adc_ValueResultSize))
+    {
+        return E_NOT_OK;
+    }
+    
+    /* Dual: one 32-bit word per rank, the buffer has to be word aligned */
+    if ((Dual == TRUE) && (((uint32)GroupConfig->Adc_ValueResultPtr & 0x3U) != 0U))
+    {
+        return E_NOT_OK;
+    }
+    
+    /* Oversampled: DMA fills the staging buffer, the TC/HT handler decimates into the results */
+    Adc_ValueGroupType* DmaBuffer = GroupConfig->Adc_ValueResultPtr;
+    boolean Continuous = (GroupConfig->Adc_GroupConvMode == ADC_CONV_MODE_CONTINUOUS) ? TRUE : FALSE;
+    if (ADC_HW_IS_OVERSAMPLED_GROUP(&Adc_HwUnitConfig[HwUnitId], GroupConfig))
+    {
+        /* The word kernel needs aligned 12-bit samples and one result round */
+        if ((Dual == TRUE) || (GroupConfig->Adc_ResultAlignment != ADC_ALIGN_RIGHT) ||
+            (GroupConfig->Adc_GroupAccessMode != ADC_ACCESS_MODE_SINGLE) ||
+            (GroupConfig->Adc_Oversampling > ADC_OVERSAMPLING_X256) ||
+            (((uint32)GroupConfig->Adc_OversamplingBufferPtr & 0x3U) != 0U))
+        {
+            return E_NOT_OK;
+        }
+        DmaBuffer = GroupConfig->Adc_OversamplingBufferPtr;
+        /* Continuous: two halves, one is decimated while DMA fills the other */
+        BlockSize = ADC_HW_OVERSAMPLING_BLOCK_SIZE(GroupConfig) << ((Continuous == TRUE) ? 1U : 0U);
+    }
+
+    /* CNDTR and CMAR are only writable while the channel is disabled */
+    DMA_Cmd(DMAx, DISABLE);
+
     DMA_InitTypeDef dma;
     // Configure DMA for ADC1 and ADC2
     dma.DMA_PeripheralBaseAddr = (uint32)&ADCx->DR;
-    dma.DMA_MemoryBaseAddr = (uint32)GroupConfig->Adc_ValueResultPtr;
+    dma.DMA_MemoryBaseAddr = (uint32)DmaBuffer;
     dma.DMA_DIR = DMA_DIR_PeripheralSRC;
-    dma.DMA_BufferSize = GroupConfig->Adc_ValueResultSize;
+    dma.DMA_BufferSize = BlockSize;
     dma.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
     dma.DMA_MemoryInc = DMA_MemoryInc_Enable;
-    dma.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
-    dma.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
-    dma.DMA_Mode = (GroupConfig->Adc_StreamBufferMode == ADC_STREAM_BUFFER_CIRCULAR) ? DMA_Mode_Circular : DMA_Mode_Normal;
+    dma.DMA_PeripheralDataSize = (Dual == TRUE) ? DMA_PeripheralDataSize_Word : DMA_PeripheralDataSize_HalfWord;
+    dma.DMA_MemoryDataSize = (Dual == TRUE) ? DMA_MemoryDataSize_Word : DMA_MemoryDataSize_HalfWord;
+    /* Continuous groups keep the ADC running, DMA must wrap instead of stopping */
+    dma.DMA_Mode = ((GroupConfig->Adc_StreamBufferMode == ADC_STREAM_BUFFER_CIRCULAR) ||
+                    (Continuous == TRUE)) ? DMA_Mode_Circular : DMA_Mode_Normal;
     dma.DMA_Priority = DMA_Priority_High;
     dma.DMA_M2M = DMA_M2M_Disable;
     DMA_Init(DMAx, &dma);
@@ -1456,6 +2602,284 @@ inline Std_ReturnType AdcHw_DeInitDma(Adc_HwUnitType HwUnitId)
     
     return E_OK;
 }
+
+/**
+ * @brief Program ADC2 as regular simultaneous slave of ADC1 for a dual group
+ * @param[in] HwUnitId ADC hardware unit ID, must be ADC1
+ * @param[in] GroupId ADC group ID
+ * @return E_OK if successful, E_NOT_OK otherwise
+ * @note ADC2 uses the same sequence length, scan and continuous settings as ADC1.
+ *       Its trigger is SWSTART with EXTTRIG set so only ADC1 reacts to the event.
+ * @note A rank pair must not convert the same channel and needs the same sampling
+ *       time, otherwise the two converters drift apart
+ */
+static Std_ReturnType AdcHw_ConfigureDualSlave(Adc_HwUnitType HwUnitId, Adc_GroupType GroupId)
+{
+    const Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[GroupId];
+    
+    if (ADC_HW_GET_MODULE_ID(HwUnitId) != ADC1)
+    {
+        return E_NOT_OK;
+    }
+    
+    for (uint8 i = 0; i < GroupConfig->Adc_NbrOfChannel; i++)
+    {
+        if ((GroupConfig->Adc_PairedChannelGroup[i].Adc_ChannelId == GroupConfig->Adc_ChannelGroup[i].Adc_ChannelId) ||
+            (GroupConfig->Adc_PairedChannelGroup[i].Adc_ChannelSampTime != GroupConfig->Adc_ChannelGroup[i].Adc_ChannelSampTime))
+        {
+            return E_NOT_OK;
+        }
+    }
+    
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC2, ENABLE);
+    
+    ADC_InitTypeDef adc;
+    adc.ADC_Mode = ADC_Mode_RegSimult;
+    adc.ADC_ScanConvMode = (ADC1->CR1 & ADC_CR1_SCAN) ? ENABLE : DISABLE;
+    adc.ADC_ContinuousConvMode = (ADC1->CR2 & ADC_CR2_CONT) ? ENABLE : DISABLE;
+    adc.ADC_ExternalTrigConv = ADC_ExternalTrigConv_None;
+    adc.ADC_DataAlign = (GroupConfig->Adc_ResultAlignment == ADC_ALIGN_RIGHT) ? ADC_DataAlign_Right : ADC_DataAlign_Left;
+    adc.ADC_NbrOfChannel = GroupConfig->Adc_NbrOfChannel;
+    ADC_Init(ADC2, &adc);
+    
+    for (uint8 i = 0; i < GroupConfig->Adc_NbrOfChannel; i++)
+    {
+        const Adc_ChannelDefType* ChannelConfig = &GroupConfig->Adc_PairedChannelGroup[i];
+        ADC_RegularChannelConfig(ADC2, ChannelConfig->Adc_ChannelId, i + 1, ChannelConfig->Adc_ChannelSampTime);
+    }
+    
+    /* Slave must be on before the master starts the first pair */
+    ADC_ExternalTrigConvCmd(ADC2, ENABLE);
+    AdcHw_PowerUp(ADC2);
+    
+    return E_OK;
+}
+#endif
+
+/****************************************************************************************
+*                              HW TRIGGER TIMER FUNCTIONS                              *
+****************************************************************************************/
+/**
+ * @brief Program the timer event that paces a hardware-triggered group
+ * @param[in] GroupId ADC group ID
+ * @return E_OK if successful, E_NOT_OK otherwise
+ * @note TIM2/TIM3/TIM4: time base is owned here, one event every Adc_HwTriggerTimer ticks
+ * @note TIM1: time base and compare channel are owned by Pwm, the event fires once
+ *       per PWM period at the offset set through Pwm_SetAdcTriggerOffset
+ */
+static Std_ReturnType AdcHw_ConfigureTriggerTimer(Adc_GroupType GroupId)
+{
+    const Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[GroupId];
+    Adc_HwTriggerEventType Event = GroupConfig->Adc_HwTriggerEvent;
+    uint32 Period = (Adc_RuntimeGroups[GroupId].HwTriggerTimer != 0U) ?
+                    Adc_RuntimeGroups[GroupId].HwTriggerTimer : GroupConfig->Adc_HwTriggerTimer;
+    
+    if (Event >= ADC_HW_TRIG_EVT_COUNT)
+    {
+        return E_NOT_OK;
+    }
+    
+    TIM_TypeDef* TIMx = ADC_HW_GET_TRIGGER_TIMER(Event);
+    if (TIMx == NULL_PTR)
+    {
+        /* EXTI11/EXTI15 pin, nothing to program */
+        return E_OK;
+    }
+    
+    if (TIMx == TIM1)
+    {
+        /* Pwm_Init has to run first, the ADC rate follows the PWM frequency */
+        if ((TIM1->CR1 & TIM_CR1_CEN) == 0U)
+        {
+            return E_NOT_OK;
+        }
+        /* Pwm leaves TRGO on reset, route the update event to it */
+        if (Event == ADC_HW_TRIG_EVT_TIM1_TRGO)
+        {
+            TIM_SelectOutputTrigger(TIM1, TIM_TRGOSource_Update);
+        }
+        return E_OK;
+    }
+    else
+    {
+        /* 16-bit reload, at least two ticks per period */
+        if ((Period < 2U) || (Period > 0x10000UL))
+        {
+            return E_NOT_OK;
+        }
+        
+        if (TIMx == TIM2)
+        {
+            RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, ENABLE);
+        }
+        else if (TIMx == TIM3)
+        {
+            RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM3, ENABLE);
+        }
+        else
+        {
+            RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM4, ENABLE);
+        }
+        TIM_Cmd(TIMx, DISABLE);
+        
+        /* APB1 timers run at 2 x PCLK1 = HCLK with the APB1 /2 setup */
+        TIM_TimeBaseInitTypeDef tim;
+        TIM_TimeBaseStructInit(&tim);
+        tim.TIM_Prescaler = (uint16)((SystemCoreClock / ADC_HW_TRIGGER_TICK_HZ) - 1U);
+        tim.TIM_Period = (uint16)(Period - 1U);
+        tim.TIM_CounterMode = TIM_CounterMode_Up;
+        tim.TIM_ClockDivision = TIM_CKD_DIV1;
+        TIM_TimeBaseInit(TIMx, &tim);
+        TIM_ARRPreloadConfig(TIMx, ENABLE);
+    }
+    
+    if (ADC_HW_IS_TRGO_EVENT(Event))
+    {
+        TIM_SelectOutputTrigger(TIMx, TIM_TRGOSource_Update);
+    }
+    else
+    {
+        /* Compare channel has no pin mapped, its CCx event only feeds the ADC */
+        TIM_OCInitTypeDef oc;
+        TIM_OCStructInit(&oc);
+        oc.TIM_OCMode = TIM_OCMode_PWM1;
+        oc.TIM_OutputState = TIM_OutputState_Disable;
+        oc.TIM_Pulse = (uint16)(Period >> 1);
+        oc.TIM_OCPolarity = TIM_OCPolarity_High;
+        switch (AdcHw_TriggerChannel[Event])
+        {
+            case TIM_Channel_1:
+                TIM_OC1Init(TIMx, &oc);
+                TIM_OC1PreloadConfig(TIMx, TIM_OCPreload_Enable);
+                break;
+            case TIM_Channel_2:
+                TIM_OC2Init(TIMx, &oc);
+                TIM_OC2PreloadConfig(TIMx, TIM_OCPreload_Enable);
+                break;
+            case TIM_Channel_3:
+                TIM_OC3Init(TIMx, &oc);
+                TIM_OC3PreloadConfig(TIMx, TIM_OCPreload_Enable);
+                break;
+            case TIM_Channel_4:
+                TIM_OC4Init(TIMx, &oc);
+                TIM_OC4PreloadConfig(TIMx, TIM_OCPreload_Enable);
+                break;
+            default:
+                break;
+        }
+    }
+    
+    return E_OK;
+}
+
+/**
+ * @brief Start or stop the trigger event of a hardware-triggered group
+ * @param[in] GroupId ADC group ID
+ * @param[in] NewState ENABLE or DISABLE
+ * @return void
+ * @note TIM1 is left alone, it keeps counting and comparing for the PWM
+ */
+static void AdcHw_TriggerTimerCmd(Adc_GroupType GroupId, FunctionalState NewState)
+{
+    Adc_HwTriggerEventType Event = Adc_GroupConfig[GroupId].Adc_HwTriggerEvent;
+    if (Event >= ADC_HW_TRIG_EVT_COUNT)
+    {
+        return;
+    }
+    
+    TIM_TypeDef* TIMx = ADC_HW_GET_TRIGGER_TIMER(Event);
+    if ((TIMx == NULL_PTR) || (TIMx == TIM1))
+    {
+        return;
+    }
+    
+    if (!ADC_HW_IS_TRGO_EVENT(Event))
+    {
+        TIM_CCxCmd(TIMx, AdcHw_TriggerChannel[Event], (NewState == ENABLE) ? TIM_CCx_Enable : TIM_CCx_Disable);
+    }
+    TIM_SetCounter(TIMx, 0U);
+    TIM_Cmd(TIMx, NewState);
+}
+
+/**
+ * @brief Change the sampling period of a timer-paced hardware-triggered group
+ * @param[in] GroupId ADC group ID
+ * @param[in] TriggerTimer New period in ADC_HW_TRIGGER_TICK_HZ ticks
+ * @return E_OK if successful, E_NOT_OK otherwise
+ * @note ARR and CCR are preloaded, a running group switches at the next update event
+ *       without a short or long sampling interval in between
+ */
+Std_ReturnType AdcHw_SetHwTriggerTimer(Adc_GroupType GroupId, Adc_HwTriggerTimerType TriggerTimer)
+{
+    if (ADC_HW_IS_VALID_GROUP(GroupId) == FALSE)
+    {
+        return E_NOT_OK;
+    }
+    
+    Adc_HwTriggerEventType Event = Adc_GroupConfig[GroupId].Adc_HwTriggerEvent;
+    if (Event >= ADC_HW_TRIG_EVT_COUNT)
+    {
+        return E_NOT_OK;
+    }
+    
+    /* TIM1 is paced by Pwm, EXTI11 by the pin */
+    TIM_TypeDef* TIMx = ADC_HW_GET_TRIGGER_TIMER(Event);
+    if ((TIMx == NULL_PTR) || (TIMx == TIM1) ||
+        (TriggerTimer < ADC_HW_TRIGGER_TIMER_MIN) || (TriggerTimer > ADC_HW_TRIGGER_TIMER_MAX))
+    {
+        return E_NOT_OK;
+    }
+    
+    Adc_RuntimeGroups[GroupId].HwTriggerTimer = TriggerTimer;
+    
+    if (AdcHw_GetGroupRuntimeStatus(GroupId) != ADC_IDLE)
+    {
+        TIM_SetAutoreload(TIMx, (uint16)(TriggerTimer - 1U));
+        switch (ADC_HW_IS_TRGO_EVENT(Event) ? 0xFFFFU : AdcHw_TriggerChannel[Event])
+        {
+            case TIM_Channel_1: TIM_SetCompare1(TIMx, (uint16)(TriggerTimer >> 1)); break;
+            case TIM_Channel_2: TIM_SetCompare2(TIMx, (uint16)(TriggerTimer >> 1)); break;
+            case TIM_Channel_3: TIM_SetCompare3(TIMx, (uint16)(TriggerTimer >> 1)); break;
+            case TIM_Channel_4: TIM_SetCompare4(TIMx, (uint16)(TriggerTimer >> 1)); break;
+            default: break;
+        }
+    }
+    
+    return E_OK;
+}
+
+#if (ADC_ENABLE_LIMIT_CHECKING == STD_ON)
+/**
+ * @brief Move the analog watchdog window of a group with limit checking
+ * @param[in] GroupId ADC group ID
+ * @param[in] LowLimit New low limit, 12-bit
+ * @param[in] HighLimit New high limit, 12-bit
+ * @return E_OK if successful, E_NOT_OK if the group has no limit check or the window is invalid
+ * @note Safe from the limit notification, HTR/LTR are only written while the group owns the ADC
+ */
+Std_ReturnType AdcHw_SetGroupLimits(Adc_GroupType GroupId, Adc_ValueGroupType LowLimit, Adc_ValueGroupType HighLimit)
+{
+    if ((ADC_HW_IS_VALID_GROUP(GroupId) == FALSE) ||
+        (Adc_GroupConfig[GroupId].Adc_LimitCheck == NULL_PTR) ||
+        (LowLimit > HighLimit) || (HighLimit > ADC_LIMIT_MAX_VALUE))
+    {
+        return E_NOT_OK;
+    }
+    
+    Adc_RuntimeGroups[GroupId].LimitLow = LowLimit;
+    Adc_RuntimeGroups[GroupId].LimitHigh = HighLimit;
+    
+    Adc_HwUnitType HwUnitId = Adc_GroupConfig[GroupId].Adc_HwUnitId;
+    if (Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId == GroupId)
+    {
+        ADC_TypeDef* ADCx = ADC_HW_GET_MODULE_ID(HwUnitId);
+        ADC_AnalogWatchdogThresholdsConfig(ADCx, HighLimit, LowLimit);
+        ADC_ClearITPendingBit(ADCx, ADC_IT_AWD);
+        AdcHw_EnableInterrupt(HwUnitId, ADC_INTERRUPT_AWD);
+    }
+    
+    return E_OK;
+}
 #endif
 
 /****************************************************************************************
@@ -1525,21 +2949,10 @@ static void AdcHw_HandleChannelSequencing(Adc_HwUnitType HwUnitId, Adc_GroupType
                 AdcHw_DisableInterrupt(HwUnitId, ADC_INTERRUPT_EOC);
                 /* Disable ADC */
                 ADC_SoftwareStartConvCmd(ADCx, DISABLE);
-                ADC_Cmd(ADCx, DISABLE);
+                AdcHw_PowerDown(HwUnitId, ADCx);
                
-                #if (ADC_ENABLE_QUEUEING == STD_ON)
-                    /* All samples completed */
-                    /* Tell the adc main function to do next task */
-                    AdcHw_DeferredProcessingFlag[HwUnitId] = 1;
-                    if (AdcHw_PendingCount < ADC_MAX_HW_UNITS)
-                    {
-                        AdcHw_PendingUnits[AdcHw_PendingCount] = HwUnitId;
-                        AdcHw_PendingCount++;
-                    }
-                #else 
-                    Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = ADC_INVALID_GROUP_ID;
-                    Adc_RuntimeHwUnits[HwUnitId].HwUnitState = HW_STATE_IDLE;
-                #endif
+                /* All samples completed */
+                AdcHw_ReleaseHwUnit(HwUnitId);
             }
 
         }
@@ -1584,6 +2997,31 @@ static void AdcHw_StartNextConversion(Adc_HwUnitType HwUnitId, Adc_GroupType Gro
 }
 
 
+/**
+ * @brief Release the hardware unit after the current group finished
+ * @param[in] HwUnitId ADC hardware unit ID
+ * @return void
+ * @note : Called from interrupt context or from the read result path
+ */
+static void AdcHw_ReleaseHwUnit(Adc_HwUnitType HwUnitId)
+{
+    #if (ADC_ENABLE_PRIORITY == STD_ON)
+    /* Next group starts straight away, the pick is O(1) so the ISR stays bounded */
+    Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = ADC_INVALID_GROUP_ID;
+    Adc_RuntimeHwUnits[HwUnitId].HwUnitState = HW_STATE_IDLE;
+    AdcHw_SchedDispatch(HwUnitId);
+    #elif (ADC_ENABLE_QUEUING == STD_ON)
+    /* Lock-free hand over, the oldest waiting group starts from this interrupt */
+    Adc_RuntimeHwUnits[HwUnitId].HwUnitState = HW_STATE_IDLE;
+    __DMB();
+    Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = ADC_INVALID_GROUP_ID;
+    (void)AdcHw_RecallSwConversion(HwUnitId);
+    #else 
+    Adc_RuntimeHwUnits[HwUnitId].CurrentGroupId = ADC_INVALID_GROUP_ID;
+    Adc_RuntimeHwUnits[HwUnitId].HwUnitState = HW_STATE_IDLE;
+    #endif
+}
+
 /**
  * @brief Call notification callback
  * @param[in] GroupId ADC group ID
@@ -1600,17 +3038,6 @@ static void AdcHw_CallNotification(Adc_GroupType GroupId)
     }
 }
 
-/**
- * @brief Get current time for performance monitoring
- * @return Current time in microseconds
- */
-static uint32 AdcHw_GetCurrentTime(void)
-{
-    /* Implementation depends on system timer */
-    /* This is a placeholder - should be implemented based on system requirements */
-    return 0;
-}
-
 /****************************************************************************************
 *                                 END OF FILE                                          *
 ****************************************************************************************/
@@ -0,0 +1,254 @@
+/****************************************************************************************
+*                                ADC_TIMING.C                                          *
+****************************************************************************************
+* File Name   : Adc_Timing.c
+* Module      : Analog to Digital Converter (ADC) - Timing Model
+* Description : Conversion time, sample rate and interrupt load of the configured groups
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * Cycle-approximate: a channel takes its sample time plus 12.5 ADCCLK (RM0008
+ * 11.6), a round takes the sum of its ranks, a hardware trigger that arrives
+ * while the sequence is still converting is lost. Handler costs come from
+ * Adc_Cfg.h. Not modelled: the trigger to start latency, DMA bus stalls and
+ * injected groups stretching the regular sequence they preempt.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "Adc_Timing.h"
+#include "Adc_Hw.h"
+#include "stm32f10x.h"
+#include "stm32f10x_rcc.h"
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+/* Sample time + 12.5 ADCCLK conversion, indexed by the ADC_SampleTime_xCycles5 code */
+static const uint16 Adc_TimingConversionClocks[8] = { 14U, 20U, 26U, 41U, 54U, 68U, 84U, 252U };
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static uint32 Adc_TimingApbDivider(uint32 Ppre);
+static uint32 Adc_TimingTimerClockDivider(const TIM_TypeDef* TIMx);
+static uint32 Adc_TimingPerSecond(uint64 Events, uint64 Cycles);
+
+/****************************************************************************************
+*                              TIMING FUNCTIONS                                        *
+****************************************************************************************/
+/**
+ * @brief ADCCLK cycles to sample and convert one channel
+ * @param[in] SampleTime ADC_SampleTime_xCycles5 code of the channel
+ * @return Sample time plus 12.5 cycles, rounded up (14 .. 252)
+ */
+uint16 Adc_TimingChannelClocks(Adc_SamplingTimeType SampleTime)
+{
+    return Adc_TimingConversionClocks[SampleTime & 0x7U];
+}
+
+/**
+ * @brief HCLK cycles per ADCCLK
+ * @return APB2 divider from RCC_CFGR times ADC_TIMING_PRESCALER_DIV(ADC_CLOCK_PRESCALER)
+ */
+uint32 Adc_TimingAdcClockDivider(void)
+{
+    uint32 Ppre2 = (RCC->CFGR & RCC_CFGR_PPRE2) >> 11;
+
+    return Adc_TimingApbDivider(Ppre2) * ADC_TIMING_PRESCALER_DIV(ADC_CLOCK_PRESCALER);
+}
+
+/**
+ * @brief HCLK cycles to convert every rank of a group once
+ * @param[in] Group ADC group ID
+ * @return Conversion time, dual groups take the slower rank of each pair
+ */
+Adc_ConversionTimeType Adc_TimingSequenceCycles(Adc_GroupType Group)
+{
+    const Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[Group];
+    boolean Dual = ADC_HW_IS_DUAL_GROUP(&Adc_HwUnitConfig[GroupConfig->Adc_HwUnitId], GroupConfig) ? TRUE : FALSE;
+    uint32 Clocks = 0U;
+
+    for (uint8 i = 0U; i < GroupConfig->Adc_NbrOfChannel; i++)
+    {
+        uint16 RankClocks = Adc_TimingChannelClocks(GroupConfig->Adc_ChannelGroup[i].Adc_ChannelSampTime);
+
+        /* Both ADCs start each rank together, the next one waits for the slower */
+        if (Dual == TRUE)
+        {
+            uint16 PairedClocks = Adc_TimingChannelClocks(GroupConfig->Adc_PairedChannelGroup[i].Adc_ChannelSampTime);
+            if (PairedClocks > RankClocks)
+            {
+                RankClocks = PairedClocks;
+            }
+        }
+        Clocks += RankClocks;
+    }
+
+    return (Adc_ConversionTimeType)(Clocks * Adc_TimingAdcClockDivider());
+}
+
+/**
+ * @brief HCLK cycles between two hardware triggers of a group
+ * @param[in] Group ADC group ID
+ * @return Trigger period, 0 for software groups and EXTI pin triggers
+ * @note A running trigger timer is read back, so the PWM period and a period set
+ *       with Adc_SetHwTriggerTimer are included. Otherwise Adc_HwTriggerTimer is used.
+ */
+Adc_ConversionTimeType Adc_TimingTriggerCycles(Adc_GroupType Group)
+{
+    const Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[Group];
+
+    if ((GroupConfig->Adc_TriggerSource != ADC_TRIGG_SRC_HW) || (GroupConfig->Adc_HwTriggerEvent >= ADC_HW_TRIG_EVT_COUNT))
+    {
+        return 0U;
+    }
+
+    TIM_TypeDef* TIMx = ADC_HW_GET_TRIGGER_TIMER(GroupConfig->Adc_HwTriggerEvent);
+    if (TIMx == NULL_PTR)
+    {
+        return 0U;
+    }
+
+    if ((TIMx->CR1 & TIM_CR1_CEN) != 0U)
+    {
+        /* Center-aligned counters count up and down, one CCx event per turn either way */
+        uint32 Ticks = (TIMx->ARR & 0xFFFFU) + 1U;
+        if ((TIMx->CR1 & TIM_CR1_CMS) != 0U)
+        {
+            Ticks = 2U * (TIMx->ARR & 0xFFFFU);
+        }
+        return (Adc_ConversionTimeType)(Ticks * ((TIMx->PSC & 0xFFFFU) + 1U) * Adc_TimingTimerClockDivider(TIMx));
+    }
+
+    return (Adc_ConversionTimeType)(GroupConfig->Adc_HwTriggerTimer * (SystemCoreClock / ADC_HW_TRIGGER_TICK_HZ));
+}
+
+/**
+ * @brief Achievable sample rate and interrupt load of a group
+ * @param[in] Group ADC group ID
+ * @param[out] TimingPtr Timing of the group
+ * @return E_OK, E_NOT_OK for an invalid group or pointer
+ */
+Std_ReturnType Adc_TimingGetGroupTiming(Adc_GroupType Group, Adc_GroupTimingType* TimingPtr)
+{
+    if ((ADC_HW_IS_VALID_GROUP(Group) == FALSE) || (TimingPtr == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+
+    const Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[Group];
+    const Adc_HwUnitDefType* HwUnitConfig = &Adc_HwUnitConfig[GroupConfig->Adc_HwUnitId];
+    Adc_ConversionTimeType Sequence = Adc_TimingSequenceCycles(Group);
+    Adc_ConversionTimeType Trigger = Adc_TimingTriggerCycles(Group);
+    uint64 Ranks = GroupConfig->Adc_NbrOfChannel;
+    uint64 Round = Sequence;
+    uint64 RoundsPerBlock;
+    uint64 IrqsPerBlock;
+    uint64 IsrCycles;
+    uint64 Load;
+    boolean OnDemand = ((GroupConfig->Adc_TriggerSource == ADC_TRIGG_SRC_SW) &&
+                        (GroupConfig->Adc_GroupConvMode == ADC_CONV_MODE_ONESHOT)) ? TRUE : FALSE;
+
+    if (Sequence == 0U)
+    {
+        return E_NOT_OK;
+    }
+
+    /* Triggers during the sequence are ignored, the round ends on the next one after it */
+    if (Trigger != 0U)
+    {
+        Round = ((Sequence + Trigger - 1U) / Trigger) * Trigger;
+    }
+
+    /* Interrupts per block of rounds and the core cycles each handler call takes */
+    if (ADC_HW_IS_INJECTED_GROUP(GroupConfig))
+    {
+        RoundsPerBlock = 1U;
+        IrqsPerBlock = 1U;
+        IsrCycles = ADC_TIMING_EOC_ISR_CYCLES;
+    }
+    else if (ADC_HW_IS_OVERSAMPLED_GROUP(HwUnitConfig, GroupConfig))
+    {
+        /* One staging half per result, the handler sums it */
+        RoundsPerBlock = 1ULL << GroupConfig->Adc_Oversampling;
+        IrqsPerBlock = 1U;
+        IsrCycles = ADC_TIMING_DMA_ISR_CYCLES + (Ranks * RoundsPerBlock * ADC_TIMING_DECIMATE_CYCLES);
+    }
+    else if (ADC_HW_IS_SCAN_DMA_GROUP(HwUnitConfig, GroupConfig))
+    {
+        RoundsPerBlock = (GroupConfig->Adc_StreamNumSamples != 0U) ? GroupConfig->Adc_StreamNumSamples : 1U;
+        IrqsPerBlock = ADC_HW_IS_PING_PONG_GROUP(HwUnitConfig, GroupConfig) ? 2U : 1U;
+        IsrCycles = ADC_TIMING_DMA_ISR_CYCLES;
+    }
+    else
+    {
+        /* Interrupt mode: one EOC per rank */
+        RoundsPerBlock = 1U;
+        IrqsPerBlock = Ranks;
+        IsrCycles = ADC_TIMING_EOC_ISR_CYCLES;
+    }
+    /* A one-shot software group only converts when started, the load follows the caller */
+    Load = (OnDemand == TRUE) ? 0U : ((IrqsPerBlock * IsrCycles * 1000U) / (Round * RoundsPerBlock));
+
+    TimingPtr->SequenceCycles = Sequence;
+    TimingPtr->TriggerCycles = Trigger;
+    TimingPtr->RoundCycles = (Adc_ConversionTimeType)Round;
+    TimingPtr->ConversionsPerSecond = Adc_TimingPerSecond(Ranks, Round);
+    TimingPtr->ResultsPerSecond = Adc_TimingPerSecond(Ranks * ADC_HW_VALUES_PER_RANK(HwUnitConfig, GroupConfig),
+                                                      ADC_HW_IS_OVERSAMPLED_GROUP(HwUnitConfig, GroupConfig) ?
+                                                      (Round << GroupConfig->Adc_Oversampling) : Round);
+    TimingPtr->InterruptsPerSecond = Adc_TimingPerSecond(IrqsPerBlock, Round * RoundsPerBlock);
+    TimingPtr->CpuLoadPermille = (uint16)((Load > 0xFFFFU) ? 0xFFFFU : Load);
+    TimingPtr->IsrCyclesPerRound = (uint32)((IrqsPerBlock * IsrCycles) / RoundsPerBlock);
+    TimingPtr->TriggerOverrun = ((Trigger != 0U) && (Sequence > Trigger)) ? TRUE : FALSE;
+    TimingPtr->OnDemand = OnDemand;
+
+    return E_OK;
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief HCLK cycles per PCLK for a PPRE1/PPRE2 field
+ * @param[in] Ppre Field value, 0xx = /1, 100 = /2 .. 111 = /16
+ * @return 1, 2, 4, 8 or 16
+ */
+static uint32 Adc_TimingApbDivider(uint32 Ppre)
+{
+    return ((Ppre & 0x4U) != 0U) ? (2UL << (Ppre & 0x3U)) : 1UL;
+}
+
+/**
+ * @brief HCLK cycles per timer kernel clock
+ * @param[in] TIMx Trigger timer
+ * @return 1 unless the APB divides by 4 or more, the timer clock is 2 x PCLK then
+ */
+static uint32 Adc_TimingTimerClockDivider(const TIM_TypeDef* TIMx)
+{
+    uint32 Divider = (TIMx == TIM1) ? Adc_TimingApbDivider((RCC->CFGR & RCC_CFGR_PPRE2) >> 11) :
+                                      Adc_TimingApbDivider((RCC->CFGR & RCC_CFGR_PPRE1) >> 8);
+
+    return (Divider > 1U) ? (Divider / 2U) : 1U;
+}
+
+/**
+ * @brief Rate of events spread over a number of HCLK cycles
+ * @param[in] Events Events in the interval
+ * @param[in] Cycles Length of the interval
+ * @return Events per second of SystemCoreClock, rounded down
+ */
+static uint32 Adc_TimingPerSecond(uint64 Events, uint64 Cycles)
+{
+    return (Cycles != 0U) ? (uint32)((Events * SystemCoreClock) / Cycles) : 0U;
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -3,8 +3,8 @@
 ****************************************************************************************
 * File Name   : Det.h
 * Module      : Development Error Tracer
-* Description : Development Error Tracer stub for PWM module
-* Version     : 1.0.0
+* Description : Development Error Tracer with an ISR-safe error ring buffer
+* Version     : 1.1.0
 * Date        : 27/06/2025
 * Author      : hoangphuc540202@gmail.com
 * Github      : https://github.com/HoangPhuc02
@@ -17,43 +17,118 @@
 *                                 INCLUDE FILES                                        *
 ****************************************************************************************/
 #include "Std_Types.h"
+#include "Det_Cfg.h"
+
+/****************************************************************************************
+*                                 TYPE DEFINITIONS                                     *
+****************************************************************************************/
+/**
+ * @brief Which report service recorded an entry
+ */
+typedef enum
+{
+    DET_KIND_DEVELOPMENT = 0,           /*!< Det_ReportError */
+    DET_KIND_RUNTIME,                   /*!< Det_ReportRuntimeError */
+    DET_KIND_TRANSIENT                  /*!< Det_ReportTransientFault */
+} Det_ErrorKindType;
+
+/**
+ * @brief One recorded error
+ */
+typedef struct
+{
+    uint32 Timestamp;                   /*!< Prof_GetCycles() when reported */
+    uint16 ModuleId;                    /*!< Reporting module */
+    uint8  InstanceId;                  /*!< Instance of the module */
+    uint8  ApiId;                       /*!< Service that detected the error */
+    uint8  ErrorId;                     /*!< Error or fault ID */
+    uint8  Kind;                        /*!< Det_ErrorKindType */
+} Det_ErrorEntryType;
 
 /****************************************************************************************
 *                              DEVELOPMENT ERROR TRACER                               *
 ****************************************************************************************/
+#if (DET_ENABLED == STD_ON)
+
+/**
+ * @brief Clears the ring buffer and all counters
+ * @details Static storage starts cleared, reports made before Det_Init are kept
+ *          if it is never called.
+ * @return void
+ */
+void Det_Init(void);
 
 /**
  * @brief Reports a development error
- * @details Stub implementation for development error reporting
+ * @details Records the error in the ring buffer and counts it. Callable from
+ *          any context, no lock is taken.
  * @param[in] ModuleId Module ID
  * @param[in] InstanceId Instance ID
  * @param[in] ApiId API ID
  * @param[in] ErrorId Error ID
- * @return Always returns E_OK in stub implementation
+ * @return Always E_OK
  */
-#define Det_ReportError(ModuleId, InstanceId, ApiId, ErrorId) (E_OK)
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId);
 
 /**
  * @brief Reports a runtime error
- * @details Stub implementation for runtime error reporting
+ * @details Same recording as Det_ReportError
  * @param[in] ModuleId Module ID
  * @param[in] InstanceId Instance ID
  * @param[in] ApiId API ID
  * @param[in] ErrorId Error ID
- * @return Always returns E_OK in stub implementation
+ * @return Always E_OK
  */
-#define Det_ReportRuntimeError(ModuleId, InstanceId, ApiId, ErrorId) (E_OK)
+Std_ReturnType Det_ReportRuntimeError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId);
 
 /**
  * @brief Reports a transient fault
- * @details Stub implementation for transient fault reporting
+ * @details Same recording as Det_ReportError
  * @param[in] ModuleId Module ID
  * @param[in] InstanceId Instance ID
  * @param[in] ApiId API ID
  * @param[in] FaultId Fault ID
- * @return Always returns E_OK in stub implementation
+ * @return Always E_OK
  */
-#define Det_ReportTransientFault(ModuleId, InstanceId, ApiId, FaultId) (E_OK)
+Std_ReturnType Det_ReportTransientFault(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 FaultId);
+
+/**
+ * @brief Copies the oldest unread entries out of the ring buffer
+ * @details Single reader, e.g. a background task or a debugger script. Entries
+ *          overwritten before they were read are only counted by
+ *          Det_GetOverflowCount. An entry whose report is still in progress
+ *          ends the drain, it is returned by the next call.
+ * @param[out] Entries Destination array
+ * @param[in] MaxEntries Size of Entries
+ * @return Number of entries copied
+ */
+uint8 Det_Drain(Det_ErrorEntryType* Entries, uint8 MaxEntries);
+
+/**
+ * @brief Number of reports with an error ID since Det_Init
+ * @details IDs are shared between modules, the ring entries tell them apart.
+ * @param[in] ErrorId Error or fault ID, IDs above the counter table share the last counter
+ * @return Report count
+ */
+uint32 Det_GetErrorCount(uint8 ErrorId);
+
+/**
+ * @brief Number of entries overwritten before they were drained
+ * @return Overflow count
+ */
+uint32 Det_GetOverflowCount(void);
+
+#else
+
+#define Det_Init()                                                      do { } while (0)
+#define Det_ReportError(ModuleId, InstanceId, ApiId, ErrorId)           (E_OK)
+#define Det_ReportRuntimeError(ModuleId, InstanceId, ApiId, ErrorId)    (E_OK)
+#define Det_ReportTransientFault(ModuleId, InstanceId, ApiId, FaultId)  (E_OK)
+#define Det_Drain(Entries, MaxEntries)                                  (0U)
+#define Det_GetErrorCount(ErrorId)                                      (0UL)
+#define Det_GetOverflowCount()                                          (0UL)
+
+#endif /* DET_ENABLED */
 
 #endif /* DET_H */
 
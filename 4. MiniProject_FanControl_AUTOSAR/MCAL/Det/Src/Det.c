@@ -0,0 +1,214 @@
+/****************************************************************************************
+*                                  DET.C                                               *
+****************************************************************************************
+* File Name   : Det.c
+* Module      : Development Error Tracer
+* Description : Development Error Tracer with an ISR-safe error ring buffer
+* Version     : 1.1.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+***************************************************************************************/
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "Det.h"
+#include "Prof.h"
+
+#if (DET_ENABLED == STD_ON)
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define DET_BUFFER_MASK         (DET_BUFFER_SIZE - 1U)
+#define DET_LAST_COUNTER        (DET_NBR_OF_ERROR_COUNTERS - 1U)
+
+/****************************************************************************************
+*                              LOCAL TYPES                                             *
+****************************************************************************************/
+/**
+ * @brief Ring slot
+ * @details Seq is the claimed sequence number + 1 once the entry is complete and
+ *          0 while it is being written, so the reader can tell a finished entry
+ *          from one that is in progress or was overwritten.
+ */
+typedef struct
+{
+    uint32             Seq;
+    Det_ErrorEntryType Entry;
+} Det_SlotType;
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static Det_SlotType Det_Ring[DET_BUFFER_SIZE];
+static uint32 Det_WriteCount;                           /*!< Next sequence number, writers only */
+static uint32 Det_ReadCount;                            /*!< Next sequence number to drain, reader only */
+static uint32 Det_ErrorCounts[DET_NBR_OF_ERROR_COUNTERS];
+static uint32 Det_OverflowCount;
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void Det_Record(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId, Det_ErrorKindType Kind);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+/**
+ * @brief Clears the ring buffer and all counters
+ */
+void Det_Init(void)
+{
+    uint8 Idx;
+
+    /* Discard unread entries, the sequence keeps running for writers in flight */
+    Det_ReadCount = __atomic_load_n(&Det_WriteCount, __ATOMIC_ACQUIRE);
+    Det_OverflowCount = 0U;
+    for (Idx = 0U; Idx < DET_NBR_OF_ERROR_COUNTERS; Idx++)
+    {
+        Det_ErrorCounts[Idx] = 0U;
+    }
+}
+
+/**
+ * @brief Reports a development error
+ */
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    Det_Record(ModuleId, InstanceId, ApiId, ErrorId, DET_KIND_DEVELOPMENT);
+    return E_OK;
+}
+
+/**
+ * @brief Reports a runtime error
+ */
+Std_ReturnType Det_ReportRuntimeError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    Det_Record(ModuleId, InstanceId, ApiId, ErrorId, DET_KIND_RUNTIME);
+    return E_OK;
+}
+
+/**
+ * @brief Reports a transient fault
+ */
+Std_ReturnType Det_ReportTransientFault(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 FaultId)
+{
+    Det_Record(ModuleId, InstanceId, ApiId, FaultId, DET_KIND_TRANSIENT);
+    return E_OK;
+}
+
+/**
+ * @brief Copies the oldest unread entries out of the ring buffer
+ */
+uint8 Det_Drain(Det_ErrorEntryType* Entries, uint8 MaxEntries)
+{
+    uint8 Count = 0U;
+    uint32 Read = Det_ReadCount;
+    uint32 Write;
+    Det_SlotType* Slot;
+
+    if (Entries == NULL_PTR)
+    {
+        return 0U;
+    }
+
+    while (Count < MaxEntries)
+    {
+        Write = __atomic_load_n(&Det_WriteCount, __ATOMIC_ACQUIRE);
+        if (Read == Write)
+        {
+            break;
+        }
+
+        /* Entries older than one buffer are gone, writers counted them */
+        if ((Write - Read) > DET_BUFFER_SIZE)
+        {
+            Read = Write - DET_BUFFER_SIZE;
+        }
+
+        Slot = &Det_Ring[Read & DET_BUFFER_MASK];
+        if (__atomic_load_n(&Slot->Seq, __ATOMIC_ACQUIRE) != (Read + 1U))
+        {
+            /* Overwritten since Write was loaded, or the report is still in progress */
+            if ((__atomic_load_n(&Det_WriteCount, __ATOMIC_ACQUIRE) - Read) > DET_BUFFER_SIZE)
+            {
+                continue;
+            }
+            break;
+        }
+
+        Entries[Count] = Slot->Entry;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        /* A writer that wrapped around during the copy has cleared Seq first */
+        if (__atomic_load_n(&Slot->Seq, __ATOMIC_RELAXED) != (Read + 1U))
+        {
+            continue;
+        }
+
+        Count++;
+        Read++;
+    }
+
+    Det_ReadCount = Read;
+    return Count;
+}
+
+/**
+ * @brief Number of reports with an error ID since Det_Init
+ */
+uint32 Det_GetErrorCount(uint8 ErrorId)
+{
+    uint8 Idx = (ErrorId < DET_LAST_COUNTER) ? ErrorId : (uint8)DET_LAST_COUNTER;
+
+    return __atomic_load_n(&Det_ErrorCounts[Idx], __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Number of entries overwritten before they were drained
+ */
+uint32 Det_GetOverflowCount(void)
+{
+    return __atomic_load_n(&Det_OverflowCount, __ATOMIC_RELAXED);
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief Claims a slot with one atomic increment and fills it
+ * @details The increment is an LDREX/STREX loop on Cortex-M3, an ISR that
+ *          preempts the report claims the next slot instead of sharing this one.
+ */
+static void Det_Record(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId, Det_ErrorKindType Kind)
+{
+    uint32 Seq = __atomic_fetch_add(&Det_WriteCount, 1U, __ATOMIC_RELAXED);
+    Det_SlotType* Slot = &Det_Ring[Seq & DET_BUFFER_MASK];
+    uint8 Idx = (ErrorId < DET_LAST_COUNTER) ? ErrorId : (uint8)DET_LAST_COUNTER;
+
+    /* The slot still holds an entry the reader has not drained */
+    if ((Seq - Det_ReadCount) >= DET_BUFFER_SIZE)
+    {
+        (void)__atomic_fetch_add(&Det_OverflowCount, 1U, __ATOMIC_RELAXED);
+    }
+
+    __atomic_store_n(&Slot->Seq, 0U, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    Slot->Entry.Timestamp  = Prof_GetCycles();
+    Slot->Entry.ModuleId   = ModuleId;
+    Slot->Entry.InstanceId = InstanceId;
+    Slot->Entry.ApiId      = ApiId;
+    Slot->Entry.ErrorId    = ErrorId;
+    Slot->Entry.Kind       = (uint8)Kind;
+    __atomic_store_n(&Slot->Seq, Seq + 1U, __ATOMIC_RELEASE);
+
+    (void)__atomic_fetch_add(&Det_ErrorCounts[Idx], 1U, __ATOMIC_RELAXED);
+}
+
+#endif /* DET_ENABLED */
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -33,6 +33,10 @@
 #define DIO_SW_MINOR_VERSION    0
 #define DIO_SW_PATCH_VERSION    0 
 
+/* Service IDs reported to Det */
+#define DIO_READCHANNEL_ID      0x00    /* Service ID for Dio_ReadChannel */
+#define DIO_WRITECHANNEL_ID     0x01    /* Service ID for Dio_WriteChannel */
+
 
 /****************************************************************************************
 *                                   MACRO                                               *
@@ -48,9 +52,19 @@
                                    (ChannelId < 48) ? GPIOC : \
                                    (ChannelId < 64) ? GPIOD : NULL_PTR)
 */
+/* Macro to check a channel ID against the configured ports */
+#define DIO_IS_VALID_CHANNEL(ChannelId)      ((uint32)(ChannelId) < ((uint32)DIO_NUM_PORTS * 16U))
+
 /* Macro to identify GPIO pin */
 #define DIO_GET_PIN_CHANNEL_ID(ChannelId)    (1U << ((ChannelId) % 16))
 
+/*
+* Macro to build a BSRR value: low half sets the masked pins that are high in Level,
+* high half resets the masked pins that are low. One store, no read of the port.
+*/
+#define DIO_GET_BSRR_VALUE(Level, Mask) \
+    ((uint32)((Level) & (Mask) & 0xFFFFU) | ((uint32)(~(Level) & (Mask) & 0xFFFFU) << 16))
+
 /* 
 * Macro to identify Channel ID
 * @param[in] GPIOx: GPIO port (A, B, C, D, etc.)
@@ -69,6 +83,32 @@
                                         (PortId == DIO_PORT_D) ? GPIOD : NULL_PTR)
 */   
 
+/*
+* Cortex-M3 peripheral bit-band: every bit of 0x40000000-0x400FFFFF has a word alias
+* at 0x42000000 + (offset * 32) + (bit * 4). A load returns the bit, a store writes
+* only that bit. With a constant ChannelId the address folds at compile time.
+*/
+#define DIO_BITBAND_PERIPH_REGION   0x40000000UL    // Start of the peripheral bit-band region
+#define DIO_BITBAND_PERIPH_ALIAS    0x42000000UL    // Start of its alias region
+#define DIO_GPIO_IDR_OFFSET         0x08UL          // GPIOx_IDR offset in the port
+#define DIO_GPIO_ODR_OFFSET         0x0CUL          // GPIOx_ODR offset in the port
+
+#define DIO_BITBAND_PORT_STRIDE     (0x400UL << 5)  // Alias distance of two GPIO ports
+
+#define DIO_GET_BITBAND_ADDRESS(RegAddr, Bit) \
+    (DIO_BITBAND_PERIPH_ALIAS + (((uint32)(RegAddr) - DIO_BITBAND_PERIPH_REGION) << 5) + ((uint32)(Bit) << 2))
+#define DIO_GET_BITBAND_ALIAS(RegAddr, Bit) \
+    ((volatile uint32 *)DIO_GET_BITBAND_ADDRESS(RegAddr, Bit))
+
+/* Alias of the channel bit in IDR (read) and ODR (write): the GPIOA bit 0 alias is a
+   constant, the channel adds one port stride per 16 channels and 4 per pin */
+#define DIO_GET_CHANNEL_BITBAND(RegOffset, ChannelId) \
+    ((volatile uint32 *)(DIO_GET_BITBAND_ADDRESS(GPIOA_BASE + (RegOffset), 0U) + \
+                         ((uint32)(ChannelId) >> 4) * DIO_BITBAND_PORT_STRIDE + \
+                         (((uint32)(ChannelId) & 0xFU) << 2)))
+#define DIO_GET_IDR_BITBAND_CHANNEL_ID(ChannelId)   DIO_GET_CHANNEL_BITBAND(DIO_GPIO_IDR_OFFSET, ChannelId)
+#define DIO_GET_ODR_BITBAND_CHANNEL_ID(ChannelId)   DIO_GET_CHANNEL_BITBAND(DIO_GPIO_ODR_OFFSET, ChannelId)
+
 
 /***************************************************************************************
  *                              TYPE DEFINITIONS                                        *
@@ -138,7 +178,7 @@ typedef uint16 Dio_PortLevelType; // Size of the largest port (4/8/16/... bits)
  * @return Dio_LevelType: The level of the channel (high or low).
  * @note STD_HIGH: The physical level of the pin is high.
  *       STD_LOW: The physical level of the pin is low.
- * @error DIO_E_PARAM_INVALID_CHANNEL_ID: If the channel ID is invalid.
+ * @error DIO_E_PARAM_INVALID_CHANNEL_ID: If the channel ID is invalid, STD_LOW is returned.
 */
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
 
@@ -148,7 +188,7 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
     * @param Level: The level to be written to the channel (high or low).
     * @note If the channel is configured as an output, it will set the physical level of the pin.
     *       If the channel is configured as an input, it will not affect the physical level of the pin.
-    
+    * @error DIO_E_PARAM_INVALID_CHANNEL_ID: If the channel ID is invalid, nothing is written.
 */
 void Dio_WriteChannel(Dio_ChannelType ChannelId, 
                       Dio_LevelType Level);
@@ -227,6 +267,35 @@ void Dio_MaskWritePort(Dio_PortType PortId,
                         Dio_PortLevelType Level, 
                         Dio_PortLevelType Mask);
 
+/****************************************************************************************
+*                              BIT-BAND FAST PATH                                      *
+****************************************************************************************/
+/*
+    * @brief Read a channel with one load from its bit-band alias.
+    * @param ChannelId: ID of the channel, ideally a DIO_CHANNEL_xx constant.
+    * @return Dio_LevelType: STD_HIGH or STD_LOW.
+    * @note No validation and no profiling probe, use Dio_ReadChannel for channel IDs
+    *       that come from data. An ID past the last port reads an unrelated register.
+*/
+static inline Dio_LevelType Dio_FastReadChannel(Dio_ChannelType ChannelId)
+{
+    return (Dio_LevelType)*DIO_GET_IDR_BITBAND_CHANNEL_ID(ChannelId);
+}
+
+/*
+    * @brief Write a channel with one store to its bit-band alias.
+    * @param ChannelId: ID of the channel, ideally a DIO_CHANNEL_xx constant.
+    * @param Level: STD_HIGH or STD_LOW.
+    * @note The bus performs the read-modify-write of ODR, so the store is atomic
+    *       with respect to interrupts. Same restrictions as Dio_FastReadChannel.
+*/
+static inline void Dio_FastWriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    /* Bit 0 is the level. Not STD_HIGH: units that get the top level Std_Types.h
+       first (same include guard) do not see it */
+    *DIO_GET_ODR_BITBAND_CHANNEL_ID(ChannelId) = (uint32)(Level & 1U);
+}
+
 
 #endif /* DIO_H */
 
@@ -14,56 +14,47 @@
 *                                 INCLUDE FILES                                        *
 ****************************************************************************************/
 #include "Dio.h"
+#include "Prof.h"
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+#include "Det.h"
+#endif
 /****************************************************************************************
 *                              FUNCTION IMPLEMENTATIONS                                 *
 ****************************************************************************************/
 
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
-    GPIO_TypeDef *GPIO_Port;  // Pointer to the GPIO port
-    uint16_t GPIO_Pin;         // Pin number within the port
-    Dio_LevelType retLevel;        
-    // Step 1: Get the GPIO port and pin from the channel ID
-    GPIO_Port = DIO_GET_PORT_CHANNEL_ID(ChannelId);
-
-    if (GPIO_Port == NULL_PTR) {
-        // Handle error: Invalid channel ID
-        retLevel = STD_LOW; // or some error handling
+    Dio_LevelType retLevel;
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    // Step 0: An ID past the last port would alias another peripheral
+    if (DIO_IS_VALID_CHANNEL(ChannelId) == FALSE)
+    {
+        (void)Det_ReportError(DIO_MODULE_ID, 0, DIO_READCHANNEL_ID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return STD_LOW;
     }
-    else {
-        // Step 2: Get the pin number from the channel ID
-        GPIO_Pin = DIO_GET_PIN_CHANNEL_ID(ChannelId);
-
-        // Step 3: Read the pin state
-        if (GPIO_ReadInputDataBit(GPIO_Port, GPIO_Pin) == Bit_SET) {
-            retLevel = STD_HIGH; // Pin is high
-        } else {
-            retLevel = STD_LOW;  // Pin is low
-        }
-    }
-    // Step 4: Return the level
+#endif
+    PROF_BEGIN(PROF_PROBE_DIO_READ_CHANNEL);
+    // Step 1: Load the pin state from the IDR bit-band alias of the channel
+    retLevel = (Dio_LevelType)*DIO_GET_IDR_BITBAND_CHANNEL_ID(ChannelId);
+    PROF_END(PROF_PROBE_DIO_READ_CHANNEL);
+    // Step 2: Return the level
     return retLevel;
 }
 
 void Dio_WriteChannel(Dio_ChannelType ChannelId, 
                       Dio_LevelType Level)
 {
-    GPIO_TypeDef *GPIO_Port;  // Pointer to the GPIO port
-    uint16_t GPIO_Pin;         // Pin number within the port   
-    BitAction BitVal = (Level == STD_HIGH) ? Bit_SET : Bit_RESET; // Convert level to BitAction    
-    // Step 1: Get the GPIO port and pin from the channel ID
-    GPIO_Port = DIO_GET_PORT_CHANNEL_ID(ChannelId);
-
-    if (GPIO_Port == NULL_PTR) {
-        // Handle error: Invalid channel ID
-        return; // or some error handling
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (DIO_IS_VALID_CHANNEL(ChannelId) == FALSE)
+    {
+        (void)Det_ReportError(DIO_MODULE_ID, 0, DIO_WRITECHANNEL_ID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return;
     }
-    
-    // Step 2: Get the pin number from the channel ID
-    GPIO_Pin = DIO_GET_PIN_CHANNEL_ID(ChannelId);
-
-    // Step 3: Write the pin state 
-    GPIO_WriteBit(GPIO_Port, GPIO_Pin, BitVal) ;
+#endif
+    // Step 1: Store the pin state to the ODR bit-band alias of the channel, no branch on Level
+    PROF_BEGIN(PROF_PROBE_DIO_WRITE_CHANNEL);
+    *DIO_GET_ODR_BITBAND_CHANNEL_ID(ChannelId) = (uint32)(Level & STD_HIGH);
+    PROF_END(PROF_PROBE_DIO_WRITE_CHANNEL);
 }
 
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
@@ -129,17 +120,9 @@ void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr,
         // Handle error: Invalid channel group
         return; // or some error handling
     }
-    // Step 2: Read the entire state of all channels in the channel group 
-    // Read the input data register of the port
-    uint16 portData = GPIO_ReadInputData(GPIO_Port);
-    
-    // Step 3: Clear the bits corresponding to the channel group mask and set the new level
-    // Clear the bits corresponding to the channel group mask
-    portData &= ~(ChannelGroupIdPtr->mask); 
-    // Set the bits corresponding to the channel group mask with the new level
-    portData |= ((Level << ChannelGroupIdPtr->offset) & ChannelGroupIdPtr->mask); 
-    GPIO_Write(GPIO_Port, portData);
-        
+    // Step 2: Set and reset the group pins in one BSRR write, other pins are untouched
+    GPIO_Port->BSRR = DIO_GET_BSRR_VALUE((uint32)Level << ChannelGroupIdPtr->offset,
+                                         ChannelGroupIdPtr->mask);
 }
 
 void Dio_GetVersionInfo(Std_VersionInfoType* versioninfo)
@@ -170,13 +153,6 @@ void Dio_MaskWritePort(Dio_PortType PortId,
         // Handle error: Invalid port ID
         return;
     }
-    // Step 2: Write the masked level to the port
-    uint16 portData = GPIO_ReadInputData(GPIO_Port);
-       // Step 3: Clear the bits corresponding to the channel group mask and set the new level
-    // Clear the bits corresponding to the channel group mask
-    portData &= ~Mask; 
-    // Set the bits corresponding to the channel group mask with the new level
-    portData |= (Level & Mask); 
-
-    GPIO_Write(GPIO_Port, portData);
+    // Step 2: Set and reset the masked pins in one BSRR write, other pins are untouched
+    GPIO_Port->BSRR = DIO_GET_BSRR_VALUE((uint32)Level, (uint32)Mask);
 }
\ No newline at end of file
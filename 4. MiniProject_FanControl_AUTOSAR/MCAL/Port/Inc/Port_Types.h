@@ -141,6 +141,20 @@ typedef struct {
     Port_PinSpeedType       Speed ;              // PORT_PIN_SPEED_10MHZ, PORT_PIN_SPEED_2MHZ, PORT_PIN_SPEED_50MHZ
 } Port_PinConfigType;
 
+/**
+ * @brief Register image of one GPIO port
+ * @details Built at compile time from the pin list, Port_Init writes it without
+ *          looking at the pins. Only the bits covered by the masks are changed.
+ */
+typedef struct
+{
+    uint32                  CrlMask;            /**< CNF/MODE fields of the configured pins 0..7 */
+    uint32                  Crl;                /**< CRL value for these fields */
+    uint32                  CrhMask;            /**< CNF/MODE fields of the configured pins 8..15 */
+    uint32                  Crh;                /**< CRH value for these fields */
+    uint32                  Bsrr;               /**< Output levels and pull-up/down, set low half, reset high half */
+} Port_PortImageType;
+
 /**
  * @brief Port driver configuration type
  * @details Main configuration structure containing all pin configurations
@@ -149,6 +163,8 @@ typedef struct
 {
     uint8                        PinCount;  /**< Total number of configured pins */
     const Port_PinConfigType*    PinConfigs;    /**< Array of pin configurations */
+    uint32                       Apb2EnableMask; /**< RCC APB2 clocks of all ports with a configured pin */
+    const Port_PortImageType*    PortImages;    /**< One image per port, PORT_ID_A..PORT_ID_D */
 } Port_ConfigType;
 
 /****************************************************************************************
@@ -160,6 +176,7 @@ typedef struct
 #define PORT_ID_B   1   /* GPIOB */
 #define PORT_ID_C   2   /* GPIOC */
 #define PORT_ID_D   3   /* GPIOD */
+#define PORT_NBR_OF_PORTS   4U  /* Ports with a register image */
 
 
 /* MACRO TO IDENTIFY GPIO PORT FROM PORT ID*/
@@ -171,6 +188,38 @@ typedef struct
 
 /*MACRO TO GET PIN MASK FROM PIN NUMBER*/
 #define PORT_GET_PIN_MASK(PinNum)   (1U << (PinNum))
+
+/* MACRO TO GET THE RCC APB2 CLOCK OF A PORT (RCC_APB2Periph_GPIOA << PortNum) */
+#define PORT_GET_APB2_CLOCK(PortNum)    (0x00000004UL << (PortNum))
+
+/****************************************************************************************
+*                                REGISTER IMAGE MACROS                                 *
+****************************************************************************************/
+/* Modes the driver configures, the others are skipped like in Port_Init */
+#define PORT_PIN_HAS_IMAGE(Mode) \
+    (((Mode) == PORT_PIN_MODE_DIO) || ((Mode) == PORT_PIN_MODE_ADC) || ((Mode) == PORT_PIN_MODE_PWM))
+
+/*
+ * CNF[1:0]:MODE[1:0] of one pin, the nibble GPIO_Init writes for the mode chosen by
+ * Port_ApplyPinConfig: AIN 0x0, IN_FLOATING 0x4, IPU/IPD 0x8, Out_PP 0x0|Speed,
+ * Out_OD 0x4|Speed, AF_PP 0x8|Speed
+ */
+#define PORT_PIN_CNF_MODE(Mode, Direction, Pull, Speed) \
+    (((Mode) == PORT_PIN_MODE_ADC) ? 0x0UL : \
+     ((Mode) == PORT_PIN_MODE_PWM) ? (0x8UL | (uint32)(Speed)) : \
+     ((Direction) == PORT_PIN_OUT) ? ((((Pull) == PORT_PIN_PULL_UP) ? 0x0UL : 0x4UL) | (uint32)(Speed)) : \
+     ((Pull) == PORT_PIN_PULL_NONE) ? 0x4UL : 0x8UL)
+
+/* BSRR bits of one pin: initial level of a DIO output, pull direction of a DIO input */
+#define PORT_PIN_BSRR(PinNum, Mode, Direction, Level, Pull) \
+    (((Mode) != PORT_PIN_MODE_DIO) ? 0UL : \
+     ((Direction) == PORT_PIN_OUT) ? \
+        (((Level) == PORT_PIN_LEVEL_HIGH) ? (1UL << (PinNum)) : (1UL << ((PinNum) + 16U))) : \
+     ((Pull) == PORT_PIN_PULL_UP) ? (1UL << (PinNum)) : \
+     ((Pull) == PORT_PIN_PULL_DOWN) ? (1UL << ((PinNum) + 16U)) : 0UL)
+
+/* Shift of the pin nibble in CRL (pins 0..7) or CRH (pins 8..15) */
+#define PORT_PIN_CR_SHIFT(PinNum)   (((uint32)(PinNum) & 7U) * 4U)
 /* Pin IDs (0-15 for each port) */
 #define PORT_PIN_0   0U   /**< Pin 0 */
 #define PORT_PIN_1   1U   /**< Pin 1 */
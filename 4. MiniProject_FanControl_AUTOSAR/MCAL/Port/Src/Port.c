@@ -16,7 +16,7 @@
 *                                 INCLUDE FILES                                        *
 ****************************************************************************************/
 #include "Port.h"
-#include "Port_cfg.h"
+#include "Port_Cfg.h"
 #include "stm32f10x_rcc.h"
 
 /****************************************************************************************
@@ -136,9 +136,17 @@ static void Port_ApplyPinConfig(const Port_PinConfigType* pinCfg) {
 
 void Port_Init(const Port_ConfigType* ConfigPtr) {
     if (ConfigPtr == NULL_PTR) return;
-    // Initialize the Pin 
-    for (uint16_t i = 0; i < ConfigPtr->PinCount; i++) {
-        Port_ApplyPinConfig(&ConfigPtr->PinConfigs[i]);
+    // Enable the clock of every used port at once
+    RCC_APB2PeriphClockCmd(ConfigPtr->Apb2EnableMask, ENABLE);
+    // Write the precomputed register images, the cost does not depend on the pin count
+    for (uint8 port = 0; port < PORT_NBR_OF_PORTS; port++) {
+        const Port_PortImageType* image = &ConfigPtr->PortImages[port];
+        GPIO_TypeDef* GPIO_Port = PORT_GET_PORT(port);
+        if ((image->CrlMask | image->CrhMask) == 0U) continue;
+        // Levels and pulls first, so outputs start driving the configured level
+        GPIO_Port->BSRR = image->Bsrr;
+        GPIO_Port->CRL = (GPIO_Port->CRL & ~image->CrlMask) | image->Crl;
+        GPIO_Port->CRH = (GPIO_Port->CRH & ~image->CrhMask) | image->Crh;
     }
     Port_Config = ConfigPtr; 
     Port_Initialized = 1;
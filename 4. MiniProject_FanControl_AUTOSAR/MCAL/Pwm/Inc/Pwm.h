@@ -48,6 +48,7 @@
 #define PWM_DISABLE_NOTIFICATION_ID    0x06    /*!< Service ID for Pwm_DisableNotification */
 #define PWM_ENABLE_NOTIFICATION_ID     0x07    /*!< Service ID for Pwm_EnableNotification */
 #define PWM_GET_VERSION_INFO_ID        0x08    /*!< Service ID for Pwm_GetVersionInfo */
+#define PWM_SET_ADC_TRIGGER_OFFSET_ID  0x0D    /*!< Service ID for Pwm_SetAdcTriggerOffset */
 
 /* NOT USED */
 #define PWM_SET_POWER_STATE_ID          0x09    /*!< Service ID for Pwm_SetPowerState */
@@ -90,10 +91,10 @@ extern const Pwm_ConfigType* Pwm_ConfigPtr;
 /**
  * @brief PWM notification handler
  * @details Called from interrupt service routine when PWM notification occurs
- * @param[in] ChannelNumber Channel identifier that generated the notification
+ * @param[in] HwUnit Hardware unit that raised the interrupt
  * @return void
  */
-void Pwm_NotificationHandler(Pwm_HwUnitType HwUnit, uint16 TIM_IT);
+RAMFUNC void Pwm_NotificationHandler(Pwm_HwUnitType HwUnit);
 
 /* === INITIALIZATION === */
 /**
@@ -192,6 +193,23 @@ void Pwm_DisableNotification(Pwm_ChannelType ChannelNumber);
 void Pwm_EnableNotification(Pwm_ChannelType ChannelNumber, Pwm_EdgeNotificationType Notification);
 #endif
 
+#if (PWM_ADC_TRIGGER_API == STD_ON)
+/**
+ * @brief Service to move the ADC sample point inside the PWM period
+ * @details The spare compare channel configured in AdcTriggerChannel fires at
+ *          Offset x Period, an ADC group using that compare event as hardware
+ *          trigger samples at the same point of every period
+ * @param[in] ChannelNumber Numeric identifier of the PWM channel
+ * @param[in] Offset Min=0x0000 Max=0x8000, same scale as the duty cycle
+ * @return void
+ * @ServiceID 0x0D
+ * @Sync Synchronous
+ * @Reentrancy Reentrant for different channel numbers
+ * @note The point stays at the same fraction of the period after Pwm_SetPeriodAndDuty
+ */
+void Pwm_SetAdcTriggerOffset(Pwm_ChannelType ChannelNumber, uint16 Offset);
+#endif
+
 /****************************************************************************************
 *                              UTILITY FUNCTIONS                                       *
 ****************************************************************************************/
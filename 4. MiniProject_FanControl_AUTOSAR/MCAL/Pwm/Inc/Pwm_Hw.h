@@ -64,6 +64,10 @@
      ((ChannelId) % 4) == 1 ? TIM_Channel_2 : \
      ((ChannelId) % 4) == 2 ? TIM_Channel_3 : TIM_Channel_4)
 
+/* Interrupt flags handled by PwmHw_IrqHandler, same bits in SR and DIER */
+#define PWM_HW_IRQ_CC_FLAGS_MASK    ((uint32)(TIM_IT_CC1 | TIM_IT_CC2 | TIM_IT_CC3 | TIM_IT_CC4))
+#define PWM_HW_IRQ_FLAGS_MASK       ((uint32)TIM_IT_Update | PWM_HW_IRQ_CC_FLAGS_MASK)
+
 /****************************************************************************************
 *                              HARDWARE VALIDATION MACROS                             *
 ****************************************************************************************/
@@ -133,6 +137,21 @@ Std_ReturnType PwmHw_SetPeriodAndDuty(Pwm_ChannelType ChannelId,
                                       Pwm_PeriodType Period,
                                       Pwm_DutyCycleType DutyCycle);
 
+/**
+ * @brief Initialize the ADC sample point compare channel of a PWM channel
+ * @param[in] ChannelId Channel identifier
+ * @return E_OK: Success, E_NOT_OK: Failed or no sample point configured
+ */
+Std_ReturnType PwmHw_InitAdcTrigger(Pwm_ChannelType ChannelId);
+
+/**
+ * @brief Set the ADC sample point of a PWM channel
+ * @param[in] ChannelId Channel identifier
+ * @param[in] Offset Sample point in the period (0x0000-0x8000)
+ * @return E_OK: Success, E_NOT_OK: Failed
+ */
+Std_ReturnType PwmHw_SetAdcTriggerOffset(Pwm_ChannelType ChannelId, uint16 Offset);
+
 /**
  * @brief Set PWM output to idle state
  * @param[in] ChannelId Channel identifier
@@ -204,6 +223,13 @@ Std_ReturnType PwmHw_EnableNotification(Pwm_ChannelType ChannelId,
  */
 Std_ReturnType PwmHw_DisableNotification(Pwm_ChannelType ChannelId);
 
+/**
+ * @brief Dispatch pending timer notifications, called from the TIMx ISRs
+ * @param[in] HwUnit Hardware unit identifier
+ * @return void
+ */
+RAMFUNC void PwmHw_IrqHandler(Pwm_HwUnitType HwUnit);
+
 /****************************************************************************************
 *                              UTILITY FUNCTIONS                                       *
 ****************************************************************************************/
@@ -178,6 +178,8 @@ typedef struct
     Pwm_EdgeNotificationType        NotificationEdge;       /*!< Notification edge type */
     boolean                         NotificationEnabled;    /*!< Notification enabled flag */
     boolean                         IdleStateSet;           /*!< Idle state set flag */
+    uint8                           AdcTriggerChannel;      /*!< Spare compare channel of the same timer marking the ADC sample point */
+    uint16                          AdcTriggerOffset;       /*!< ADC sample point in the period, 0x0000-0x8000 like a duty cycle */
 } Pwm_ChannelConfigType;
 
 
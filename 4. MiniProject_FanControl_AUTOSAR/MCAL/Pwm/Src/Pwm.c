@@ -17,6 +17,7 @@
 #include "Pwm_Types.h"
 #include "Pwm_Hw.h"
 #include "Det.h"
+#include "Prof.h"
 
 
 /****************************************************************************************
@@ -119,6 +120,12 @@ void Pwm_Init(const Pwm_ConfigType* ConfigPtr)
         {
             (void)PwmHw_InitChannel(ChannelConfig->ChannelId);
             ChannelConfig->NotificationEnabled = FALSE;
+            
+            /* Sample point for a PWM-synchronized ADC group */
+            if (ChannelConfig->AdcTriggerChannel != PWM_ADC_TRIGGER_NONE)
+            {
+                (void)PwmHw_InitAdcTrigger(ChannelConfig->ChannelId);
+            }
         }
     }
     NVIC_EnableIRQ(TIM1_UP_IRQn);
@@ -207,7 +214,9 @@ void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
 #endif
     
     /* Set duty cycle */
+    PROF_BEGIN(PROF_PROBE_PWM_SET_DUTY);
     (void)PwmHw_SetDutyCycle(ChannelNumber, DutyCycle);
+    PROF_END(PROF_PROBE_PWM_SET_DUTY);
 }
 #endif
 
@@ -454,75 +463,63 @@ void Pwm_GetVersionInfo(Std_VersionInfoType* VersionInfo)
 }
 #endif /* PWM_VERSION_INFO_API */
 
-/****************************************************************************************
-*                              INTERRUPT SERVICE ROUTINES                             *
-****************************************************************************************/
-
+#if (PWM_ADC_TRIGGER_API == STD_ON)
 /**
- * @brief PWM notification handler
- * @details Called from interrupt service routine when PWM notification occurs
- * @param[in] ChannelNumber Channel identifier that generated the notification
+ * @brief Service to move the ADC sample point inside the PWM period
+ * @param[in] ChannelNumber Numeric identifier of the PWM channel
+ * @param[in] Offset Min=0x0000 Max=0x8000
  * @return void
+ * @ServiceID 0x0D
+ * @Sync Synchronous
+ * @Reentrancy Reentrant for different channel numbers
  */
-void Pwm_NotificationHandler(Pwm_HwUnitType HwUnit, uint16 TIM_IT)
+void Pwm_SetAdcTriggerOffset(Pwm_ChannelType ChannelNumber, uint16 Offset)
 {
-    if(TIM_IT == TIM_IT_Update)
-    {
-        for(uint8 i = 0; i < PWM_CHANNELS_PER_HW_UNIT; i++)
-        {
-            Pwm_ChannelType ChannelId = HwUnit * PWM_CHANNELS_PER_HW_UNIT + i;
-            /* Check if notification is enabled for the channel */
-            if((Pwm_ChannelConfig[ChannelId].NotificationEnabled == TRUE) &&
-               (Pwm_ChannelConfig[ChannelId].NotificationEdge == PWM_BOTH_EDGES ||\
-                Pwm_ChannelConfig[ChannelId].NotificationEdge == PWM_RISING_EDGE))
-            {
-                Pwm_ChannelConfig[ChannelId].NotificationPtr();
-            }
-
-        }
-    }
-    else if(TIM_IT == TIM_IT_CC1)
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+    /* Check if driver is initialized */
+    if (Pwm_ValidateInit(PWM_SET_ADC_TRIGGER_OFFSET_ID) != E_OK)
     {
-        Pwm_ChannelType ChannelId = HwUnit * PWM_CHANNELS_PER_HW_UNIT + PWM_CHANNEL_0;
-        if((Pwm_ChannelConfig[ChannelId].NotificationEnabled == TRUE) &&
-            (Pwm_ChannelConfig[ChannelId].NotificationEdge == PWM_BOTH_EDGES ||\
-            Pwm_ChannelConfig[ChannelId].NotificationEdge == PWM_FALLING_EDGE))
-        {
-            Pwm_ChannelConfig[ChannelId].NotificationPtr();
-        }
+        return;
     }
-    /*
-    else if(TIM_IT == TIM_IT_CC2)
+    
+    /* Validate channel ID */
+    if (Pwm_ValidateChannel(ChannelNumber, PWM_SET_ADC_TRIGGER_OFFSET_ID) != E_OK)
     {
-        Pwm_ChannelType ChannelId = HwUnit * PWM_CHANNELS_PER_HW_UNIT + PWM_CHANNEL_1;
-        if((Pwm_ChannelConfig[ChannelId].NotificationEnabled == TRUE) &&
-            (Pwm_ChannelConfig[ChannelId].NotificationEdge == PWM_BOTH_EDGES ||\
-            Pwm_ChannelConfig[ChannelId].NotificationEdge == PWM_FALLING_EDGE))
-        {
-            Pwm_ChannelConfig[ChannelId].NotificationPtr();
-        }
+        return;
     }
-    else if(TIM_IT == TIM_IT_CC3)
+    
+    /* Offset uses the duty cycle scale */
+    if (Pwm_ValidateDutyCycle(Offset, PWM_SET_ADC_TRIGGER_OFFSET_ID) != E_OK)
     {
-        Pwm_ChannelType ChannelId = HwUnit * PWM_CHANNELS_PER_HW_UNIT + PWM_CHANNEL_2;
-        if((Pwm_ChannelConfig[ChannelId].NotificationEnabled == TRUE) &&
-            (Pwm_ChannelConfig[ChannelId].NotificationEdge == PWM_BOTH_EDGES ||\
-            Pwm_ChannelConfig[ChannelId].NotificationEdge == PWM_FALLING_EDGE))
-        {
-            Pwm_ChannelConfig[ChannelId].NotificationPtr();
-        }
+        return;
     }
-    else if(TIM_IT == TIM_IT_CC4)
+    
+    /* Channel has no sample point configured */
+    if (Pwm_ChannelConfig[ChannelNumber].AdcTriggerChannel == PWM_ADC_TRIGGER_NONE)
     {
-        Pwm_ChannelType ChannelId = HwUnit * PWM_CHANNELS_PER_HW_UNIT + PWM_CHANNEL_3;
-        if((Pwm_ChannelConfig[ChannelId].NotificationEnabled == TRUE) &&
-            (Pwm_ChannelConfig[ChannelId].NotificationEdge == PWM_BOTH_EDGES ||\
-            Pwm_ChannelConfig[ChannelId].NotificationEdge == PWM_FALLING_EDGE))
-        {
-            Pwm_ChannelConfig[ChannelId].NotificationPtr();
-        }
+        (void)Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_SET_ADC_TRIGGER_OFFSET_ID, PWM_E_PARAM_CHANNEL);
+        return;
     }
-    */
+#endif
+    
+    (void)PwmHw_SetAdcTriggerOffset(ChannelNumber, Offset);
+}
+#endif /* PWM_ADC_TRIGGER_API */
+
+/****************************************************************************************
+*                              INTERRUPT SERVICE ROUTINES                             *
+****************************************************************************************/
+
+/**
+ * @brief PWM notification handler
+ * @details Called from the timer interrupt service routines, dispatches every
+ *          pending update and compare event of the hardware unit
+ * @param[in] HwUnit Hardware unit that raised the interrupt
+ * @return void
+ */
+RAMFUNC void Pwm_NotificationHandler(Pwm_HwUnitType HwUnit)
+{
+    PwmHw_IrqHandler(HwUnit);
 }
 
 /****************************************************************************************
@@ -643,7 +640,7 @@ static inline Std_ReturnType Pwm_ValidateDutyCycle(uint16 DutyCycle, uint8 Servi
     /* Check duty cycle range */
     if (DutyCycle > 0x8000)
     {
-        (void)Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, ServiceId, PWM_E_DUTY_CYCLE_OUT_OF_RANGE);
+        (void)Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, ServiceId, PWM_E_PARAM_VALUE);
         RetVal = E_NOT_OK;
     }
     
@@ -663,7 +660,7 @@ static inline Std_ReturnType Pwm_ValidatePeriod(Pwm_PeriodType Period, uint8 Ser
     /* Check period range */
     if ((Period < PWM_MIN_PERIOD) || (Period > PWM_MAX_PERIOD))
     {
-        (void)Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, ServiceId, PWM_E_PERIOD_OUT_OF_RANGE);
+        (void)Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, ServiceId, PWM_E_PARAM_VALUE);
         RetVal = E_NOT_OK;
     }
     
@@ -22,6 +22,18 @@
 ****************************************************************************************/
 static uint8 Pwm_UpdateInterruptUsers[PWM_MAX_HW_UNITS] = {0};
 
+/* Timer instance per hardware unit, indexed by PWM_HW_UNIT_TIMx */
+static TIM_TypeDef* const PwmHw_TimerTable[PWM_HW_UNIT_TIM4 + 1] =
+{
+    [PWM_HW_UNIT_TIM1] = TIM1,
+    [PWM_HW_UNIT_TIM2] = TIM2,
+    [PWM_HW_UNIT_TIM3] = TIM3,
+    [PWM_HW_UNIT_TIM4] = TIM4
+};
+
+/* Notification per timer channel, filled by PwmHw_InitChannel for the ISR */
+static Pwm_NotificationFunctionType PwmHw_IrqCallbackTable[PWM_MAX_HW_UNITS][PWM_CHANNELS_PER_HW_UNIT];
+
 /****************************************************************************************
 *                              INITIALIZATION FUNCTIONS                               *
 ****************************************************************************************/
@@ -45,6 +57,13 @@ Std_ReturnType PwmHw_InitHwUnit(Pwm_HwUnitType HwUnit, const Pwm_HwUnitConfigTyp
     }
     else
     {
+        /* No channel of this unit is mapped yet */
+        for (uint8 i = 0; i < PWM_CHANNELS_PER_HW_UNIT; i++)
+        {
+            PwmHw_IrqCallbackTable[HwUnit][i] = NULL_PTR;
+        }
+        Pwm_UpdateInterruptUsers[HwUnit] = 0;
+
         /* Enable timer clock */
         PWM_HW_ENABLE_TIMER_CLOCK(HwUnit);
         TIM_TypeDef* TIM_Instance = PWM_HW_GET_TIMER(HwUnit);
@@ -169,6 +188,9 @@ Std_ReturnType PwmHw_InitChannel(Pwm_ChannelType ChannelId)
 
             ChannelConfigPtr->IdleStateSet = FALSE;
 
+            /* Same index as the Update user bit and CCxIF - 1 */
+            PwmHw_IrqCallbackTable[HwUnitId][TIM_Channel >> 2] = ChannelConfigPtr->NotificationPtr;
+
             /* Enable main output for advanced timers */
             if (ChannelConfigPtr->HwUnit == PWM_HW_UNIT_TIM1)
             {
@@ -278,8 +300,8 @@ Std_ReturnType PwmHw_SetPeriodAndDuty(Pwm_ChannelType ChannelId, Pwm_PeriodType
         /* Update timer period */
         TIM_SetAutoreload(TIM_Instance, Period - 1);
         
-        /* Calculate compare value */
-        CompareValue = (uint16)(((uint32)(DutyCycle) * (uint32)(Pwm_ChannelConfig[ChannelId].Period)) >> 15);
+        /* Calculate compare value against the new period */
+        CompareValue = (uint16)(((uint32)(DutyCycle) * (uint32)(Period)) >> 15);
         
         /* Update compare value based on channel */
         switch (TIM_Channel)
@@ -307,12 +329,110 @@ Std_ReturnType PwmHw_SetPeriodAndDuty(Pwm_ChannelType ChannelId, Pwm_PeriodType
             Pwm_ChannelConfig[ChannelId].Period = Period;
             Pwm_ChannelConfig[ChannelId].DutyCycle = DutyCycle;
             Pwm_HwUnitConfig[Pwm_ChannelConfig[ChannelId].HwUnit].MaxPeriod = Period;
+            
+            /* Keep the ADC sample point at the same fraction of the new period */
+            if (Pwm_ChannelConfig[ChannelId].AdcTriggerChannel != PWM_ADC_TRIGGER_NONE)
+            {
+                (void)PwmHw_SetAdcTriggerOffset(ChannelId, Pwm_ChannelConfig[ChannelId].AdcTriggerOffset);
+            }
         }
     }
     
     return RetVal;
 }
 #endif
+
+/****************************************************************************************
+*                              ADC TRIGGER FUNCTIONS                                   *
+****************************************************************************************/
+/**
+ * @brief Initialize the ADC sample point compare channel of a PWM channel
+ * @details Programs the spare compare channel in PWM2 mode without output pin, so its
+ *          CCx event and rising OCxREF edge both land on the sample point
+ * @param[in] ChannelId Channel identifier
+ * @return E_OK if successful, E_NOT_OK otherwise
+ */
+Std_ReturnType PwmHw_InitAdcTrigger(Pwm_ChannelType ChannelId)
+{
+    TIM_OCInitTypeDef TIM_OCInitStructure;
+    
+    if ((ChannelId >= PWM_MAX_CHANNELS) ||
+        (Pwm_ChannelConfig[ChannelId].AdcTriggerChannel == PWM_ADC_TRIGGER_NONE))
+    {
+        return E_NOT_OK;
+    }
+    
+    TIM_TypeDef* TIM_Instance = PWM_HW_GET_TIMER(Pwm_ChannelConfig[ChannelId].HwUnit);
+    TIM_OCStructInit(&TIM_OCInitStructure);
+    TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM2;
+    TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Enable;
+    TIM_OCInitStructure.TIM_OCPolarity = TIM_OCPolarity_High;
+    TIM_OCInitStructure.TIM_OCIdleState = TIM_OCIdleState_Reset;
+    
+    switch (Pwm_ChannelConfig[ChannelId].AdcTriggerChannel)
+    {
+        case PWM_ADC_TRIGGER_CC2:
+            TIM_OC2Init(TIM_Instance, &TIM_OCInitStructure);
+            TIM_OC2PreloadConfig(TIM_Instance, TIM_OCPreload_Enable);
+            break;
+        case PWM_ADC_TRIGGER_CC3:
+            TIM_OC3Init(TIM_Instance, &TIM_OCInitStructure);
+            TIM_OC3PreloadConfig(TIM_Instance, TIM_OCPreload_Enable);
+            break;
+        case PWM_ADC_TRIGGER_CC4:
+            TIM_OC4Init(TIM_Instance, &TIM_OCInitStructure);
+            TIM_OC4PreloadConfig(TIM_Instance, TIM_OCPreload_Enable);
+            break;
+        default:
+            return E_NOT_OK;
+    }
+    
+    return PwmHw_SetAdcTriggerOffset(ChannelId, Pwm_ChannelConfig[ChannelId].AdcTriggerOffset);
+}
+
+/**
+ * @brief Set the ADC sample point of a PWM channel
+ * @details Compare value is Offset x Period like a duty cycle, preloaded so the
+ *          point moves at the next update event and never mid-period
+ * @param[in] ChannelId Channel identifier
+ * @param[in] Offset Sample point in the period (0x0000 to 0x8000)
+ * @return E_OK if successful, E_NOT_OK otherwise
+ */
+Std_ReturnType PwmHw_SetAdcTriggerOffset(Pwm_ChannelType ChannelId, uint16 Offset)
+{
+    if ((ChannelId >= PWM_MAX_CHANNELS) || (Offset > 0x8000))
+    {
+        return E_NOT_OK;
+    }
+    
+    Pwm_ChannelConfigType* ChannelConfigPtr = &Pwm_ChannelConfig[ChannelId];
+    TIM_TypeDef* TIM_Instance = PWM_HW_GET_TIMER(ChannelConfigPtr->HwUnit);
+    uint16 CompareValue = (uint16)(((uint32)Offset * (uint32)ChannelConfigPtr->Period) >> 15);
+    
+    /* A compare equal to the reload never matches past ARR, keep 100% inside the period */
+    if ((CompareValue >= ChannelConfigPtr->Period) && (ChannelConfigPtr->Period > 0U))
+    {
+        CompareValue = ChannelConfigPtr->Period - 1U;
+    }
+    
+    switch (ChannelConfigPtr->AdcTriggerChannel)
+    {
+        case PWM_ADC_TRIGGER_CC2:
+            TIM_SetCompare2(TIM_Instance, CompareValue);
+            break;
+        case PWM_ADC_TRIGGER_CC3:
+            TIM_SetCompare3(TIM_Instance, CompareValue);
+            break;
+        case PWM_ADC_TRIGGER_CC4:
+            TIM_SetCompare4(TIM_Instance, CompareValue);
+            break;
+        default:
+            return E_NOT_OK;
+    }
+    
+    ChannelConfigPtr->AdcTriggerOffset = Offset;
+    return E_OK;
+}
 /****************************************************************************************
 *                              OUTPUT CONTROL FUNCTIONS                               *
 ****************************************************************************************/
@@ -440,6 +560,8 @@ Std_ReturnType PwmHw_EnableNotification(Pwm_ChannelType ChannelId, Pwm_EdgeNotif
             /* Only enable Update interrupt if it having enable */
             if (!(TIM_Instance->DIER & TIM_IT_Update))
             {
+                /* [SWS_Pwm_00081] Drop the update flag left by Pwm_Init or an earlier period */
+                TIM_ClearITPendingBit(TIM_Instance, TIM_IT_Update);
                 TIM_ITConfig(TIM_Instance, TIM_IT_Update, ENABLE);
             }
             // if(Pwm_UpdateInterruptUsers[HwUnit] == 0)
@@ -452,19 +574,23 @@ Std_ReturnType PwmHw_EnableNotification(Pwm_ChannelType ChannelId, Pwm_EdgeNotif
         /* Falling Edge (CC interrupt) */
         if(Notification == PWM_FALLING_EDGE || Notification == PWM_BOTH_EDGES)
         {
-            /* Enable CC interrupt cho channel cụ thể */
+            /* Enable CC interrupt cho channel cụ thể, stale match flag dropped first */
             switch (TIM_Channel)
             {
                 case TIM_Channel_1:
+                    TIM_ClearITPendingBit(TIM_Instance, TIM_IT_CC1);
                     TIM_ITConfig(TIM_Instance, TIM_IT_CC1, ENABLE);
                     break;
                 case TIM_Channel_2:
+                    TIM_ClearITPendingBit(TIM_Instance, TIM_IT_CC2);
                     TIM_ITConfig(TIM_Instance, TIM_IT_CC2, ENABLE);
                     break;
                 case TIM_Channel_3:
+                    TIM_ClearITPendingBit(TIM_Instance, TIM_IT_CC3);
                     TIM_ITConfig(TIM_Instance, TIM_IT_CC3, ENABLE);
                     break;
                 case TIM_Channel_4:
+                    TIM_ClearITPendingBit(TIM_Instance, TIM_IT_CC4);
                     TIM_ITConfig(TIM_Instance, TIM_IT_CC4, ENABLE);
                     break;
                 default:
@@ -555,4 +681,63 @@ Std_ReturnType PwmHw_DisableNotification(Pwm_ChannelType ChannelId)
     return RetVal;
 }
 
+/****************************************************************************************
+*                              INTERRUPT DISPATCH                                     *
+****************************************************************************************/
+/**
+ * @brief Dispatches all pending notifications of one timer
+ * @details SR and DIER are read once and every handled flag is cleared with a
+ *          single write. Set bits are walked with CLZ so the cost follows the
+ *          number of pending events, not the number of channels.
+ * @param[in] HwUnit Hardware unit identifier
+ * @return void
+ */
+RAMFUNC void PwmHw_IrqHandler(Pwm_HwUnitType HwUnit)
+{
+    TIM_TypeDef* TIM_Instance;
+    Pwm_NotificationFunctionType* Callbacks;
+    uint32 Pending;
+    uint32 Users;
+    uint32 Bit;
 
+    if (HwUnit >= PWM_MAX_HW_UNITS)
+    {
+        return;
+    }
+
+    TIM_Instance = PwmHw_TimerTable[HwUnit];
+    Callbacks = PwmHw_IrqCallbackTable[HwUnit];
+
+    /* UIF and CC1IF..CC4IF that are also enabled */
+    Pending = (uint32)TIM_Instance->SR & (uint32)TIM_Instance->DIER & PWM_HW_IRQ_FLAGS_MASK;
+
+    /* rc_w0: zeros clear the handled flags, ones leave new events pending */
+    TIM_Instance->SR = (uint16)~Pending;
+
+    /* Rising edge: one update event for every channel that asked for it */
+    if ((Pending & TIM_IT_Update) != 0U)
+    {
+        Users = Pwm_UpdateInterruptUsers[HwUnit];
+        while (Users != 0U)
+        {
+            Bit = 31U - __CLZ(Users);
+            Users &= ~(1UL << Bit);
+            if (Callbacks[Bit] != NULL_PTR)
+            {
+                Callbacks[Bit]();
+            }
+        }
+    }
+
+    /* Falling edge: CCxIF is bit x, channel index x - 1 */
+    Pending &= PWM_HW_IRQ_CC_FLAGS_MASK;
+    while (Pending != 0U)
+    {
+        Bit = 31U - __CLZ(Pending);
+        Pending &= ~(1UL << Bit);
+        if (Callbacks[Bit - 1U] != NULL_PTR)
+        {
+            Callbacks[Bit - 1U]();
+        }
+    }
+}
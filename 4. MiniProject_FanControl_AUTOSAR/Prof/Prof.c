@@ -0,0 +1,209 @@
+/****************************************************************************************
+*                                PROF.C                                                 *
+****************************************************************************************
+* File Name   : Prof.c
+* Module      : Profiling (PROF)
+* Description : Cycle-count probes for ISR and driver API latency
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "Prof.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define PROF_MIN_INIT           0xFFFFFFFFUL    /*!< Min before the first sample */
+#define PROF_LINE_SIZE          80U             /*!< One CSV line */
+#define PROF_DEC_DIGITS         10U             /*!< Digits of a uint32 */
+
+#if defined(HOST_BUILD)
+#define PROF_ENTER_CRITICAL()   do { } while (0)
+#define PROF_EXIT_CRITICAL()    do { } while (0)
+#else
+#define PROF_ENTER_CRITICAL()   uint32 Prof_Primask = __get_PRIMASK(); __disable_irq()
+#define PROF_EXIT_CRITICAL()    __set_PRIMASK(Prof_Primask)
+#endif
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static Prof_StatsType Prof_Stats[PROF_NBR_OF_PROBES];
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static uint32 Prof_AppendText(char* Line, uint32 Pos, const char* Text);
+static uint32 Prof_AppendDec(char* Line, uint32 Pos, uint32 Value);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+/**
+ * @brief   Enable the cycle counter and clear all statistics
+ * @details Reset_Handler starts CYCCNT from 0, its value here is the time from
+ *          reset to main and becomes the only sample of PROF_PROBE_STARTUP.
+ */
+void Prof_Init(void)
+{
+#if !defined(HOST_BUILD)
+    uint32 StartupCycles = DWT->CYCCNT;
+
+    /* DWT is gated by the trace enable in the debug monitor register */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    Prof_Reset();
+
+#if !defined(HOST_BUILD)
+    Prof_Record(PROF_PROBE_STARTUP, StartupCycles);
+#endif
+}
+
+/**
+ * @brief   Clear all statistics
+ */
+void Prof_Reset(void)
+{
+    uint8 Probe;
+
+    for (Probe = 0U; Probe < (uint8)PROF_NBR_OF_PROBES; Probe++)
+    {
+        PROF_ENTER_CRITICAL();
+        Prof_Stats[Probe].Count = 0U;
+        Prof_Stats[Probe].Min = PROF_MIN_INIT;
+        Prof_Stats[Probe].Max = 0U;
+        Prof_Stats[Probe].Total = 0U;
+        PROF_EXIT_CRITICAL();
+    }
+}
+
+/**
+ * @brief   Add one sample to a probe
+ */
+void Prof_Record(Prof_ProbeType Probe, uint32 Cycles)
+{
+    Prof_StatsType* Stats;
+
+    if (Probe >= PROF_NBR_OF_PROBES)
+    {
+        return;
+    }
+
+    Stats = &Prof_Stats[Probe];
+    Stats->Count++;
+    Stats->Total += Cycles;
+    if (Cycles < Stats->Min)
+    {
+        Stats->Min = Cycles;
+    }
+    if (Cycles > Stats->Max)
+    {
+        Stats->Max = Cycles;
+    }
+}
+
+/**
+ * @brief   Consistent copy of the statistics of one probe
+ */
+Std_ReturnType Prof_GetStats(Prof_ProbeType Probe, Prof_StatsType* StatsPtr)
+{
+    if ((Probe >= PROF_NBR_OF_PROBES) || (StatsPtr == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+
+    /* ISR probes may update the entry while it is copied */
+    PROF_ENTER_CRITICAL();
+    *StatsPtr = Prof_Stats[Probe];
+    PROF_EXIT_CRITICAL();
+
+    return E_OK;
+}
+
+/**
+ * @brief   Serialize the statistics table as CSV
+ */
+void Prof_Dump(Prof_WriteFuncType Write)
+{
+    Prof_StatsType Stats;
+    char Line[PROF_LINE_SIZE];
+    uint32 Pos;
+    uint8 Probe;
+
+    if (Write == NULL_PTR)
+    {
+        return;
+    }
+
+    Write("probe,count,min,max,avg\n");
+
+    for (Probe = 0U; Probe < (uint8)PROF_NBR_OF_PROBES; Probe++)
+    {
+        (void)Prof_GetStats((Prof_ProbeType)Probe, &Stats);
+        if (Stats.Count == 0U)
+        {
+            continue;
+        }
+
+        Pos = Prof_AppendText(Line, 0U, Prof_ProbeNames[Probe]);
+        Pos = Prof_AppendText(Line, Pos, ",");
+        Pos = Prof_AppendDec(Line, Pos, Stats.Count);
+        Pos = Prof_AppendText(Line, Pos, ",");
+        Pos = Prof_AppendDec(Line, Pos, Stats.Min);
+        Pos = Prof_AppendText(Line, Pos, ",");
+        Pos = Prof_AppendDec(Line, Pos, Stats.Max);
+        Pos = Prof_AppendText(Line, Pos, ",");
+        Pos = Prof_AppendDec(Line, Pos, (uint32)(Stats.Total / Stats.Count));
+        Pos = Prof_AppendText(Line, Pos, "\n");
+        Line[Pos] = '\0';
+
+        Write(Line);
+    }
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   Append a string, truncated to the line buffer
+ * @return  New end of the line
+ */
+static uint32 Prof_AppendText(char* Line, uint32 Pos, const char* Text)
+{
+    while ((*Text != '\0') && (Pos < (PROF_LINE_SIZE - 1U)))
+    {
+        Line[Pos] = *Text;
+        Pos++;
+        Text++;
+    }
+
+    return Pos;
+}
+
+/**
+ * @brief   Append an unsigned decimal number, no libc on target
+ * @return  New end of the line
+ */
+static uint32 Prof_AppendDec(char* Line, uint32 Pos, uint32 Value)
+{
+    char Digits[PROF_DEC_DIGITS + 1U];
+    uint32 Idx = PROF_DEC_DIGITS;
+
+    Digits[Idx] = '\0';
+    do
+    {
+        Idx--;
+        Digits[Idx] = (char)('0' + (Value % 10U));
+        Value /= 10U;
+    } while (Value != 0U);
+
+    return Prof_AppendText(Line, Pos, &Digits[Idx]);
+}
@@ -0,0 +1,119 @@
+/****************************************************************************************
+*                                PROF.H                                                 *
+****************************************************************************************
+* File Name   : Prof.h
+* Module      : Profiling (PROF)
+* Description : Cycle-count probes for ISR and driver API latency
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+#ifndef PROF_H
+#define PROF_H
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "Std_Types.h"
+#include "Prof_Cfg.h"
+
+#if defined(HOST_BUILD)
+#include <time.h>
+#else
+#include "stm32f10x.h"
+#endif
+
+/****************************************************************************************
+*                                 TYPE DEFINITIONS                                     *
+****************************************************************************************/
+/**
+ * @brief   Statistics of one probe
+ * @details Units are core cycles on target and nanoseconds on the host build.
+ */
+typedef struct
+{
+    uint32 Count;                       /*!< Recorded samples */
+    uint32 Min;                         /*!< Shortest sample, 0xFFFFFFFF before the first */
+    uint32 Max;                         /*!< Longest sample */
+    uint64 Total;                       /*!< Sum of all samples, Total / Count is the average */
+} Prof_StatsType;
+
+/**
+ * @brief   Text sink for Prof_Dump, e.g. a UART or semihosting write
+ */
+typedef void (*Prof_WriteFuncType)(const char* Text);
+
+/****************************************************************************************
+*                                 TIME SOURCE                                          *
+****************************************************************************************/
+/**
+ * @brief   Free-running timestamp, wraps at 32 bits
+ * @return  DWT CYCCNT on target, CLOCK_MONOTONIC in ns on the host build
+ */
+static inline uint32 Prof_GetCycles(void)
+{
+#if defined(HOST_BUILD)
+    struct timespec Now;
+    (void)clock_gettime(CLOCK_MONOTONIC, &Now);
+    return (uint32)(((uint64)Now.tv_sec * 1000000000ULL) + (uint64)Now.tv_nsec);
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+/****************************************************************************************
+*                                 PROBE MACROS                                         *
+****************************************************************************************/
+/**
+ * @brief   Open and close a probe in the same block
+ * @details Both expand to nothing when PROF_ENABLED is STD_OFF. An interrupt
+ *          that preempts the block is included in the measured time.
+ */
+#if (PROF_ENABLED == STD_ON)
+#define PROF_BEGIN(Probe)       uint32 Prof_Start_##Probe = Prof_GetCycles()
+#define PROF_END(Probe)         Prof_Record((Probe), Prof_GetCycles() - Prof_Start_##Probe)
+#else
+#define PROF_BEGIN(Probe)
+#define PROF_END(Probe)
+#endif
+
+/****************************************************************************************
+*                              FUNCTION PROTOTYPES                                     *
+****************************************************************************************/
+/**
+ * @brief   Enable the cycle counter and clear all statistics
+ */
+void Prof_Init(void);
+
+/**
+ * @brief   Clear all statistics
+ */
+void Prof_Reset(void);
+
+/**
+ * @brief   Add one sample to a probe
+ * @param   Probe   Probe ID
+ * @param   Cycles  Measured duration
+ * @note    A probe must only be recorded from one context.
+ */
+void Prof_Record(Prof_ProbeType Probe, uint32 Cycles);
+
+/**
+ * @brief   Consistent copy of the statistics of one probe
+ * @param   Probe       Probe ID
+ * @param   StatsPtr    Copy of the statistics
+ * @return  E_OK, E_NOT_OK for an invalid probe or pointer
+ */
+Std_ReturnType Prof_GetStats(Prof_ProbeType Probe, Prof_StatsType* StatsPtr);
+
+/**
+ * @brief   Serialize the statistics table as CSV
+ * @details One header line "probe,count,min,max,avg" followed by one line per
+ *          probe that has samples. Each line is passed to Write separately.
+ * @param   Write   Text sink
+ */
+void Prof_Dump(Prof_WriteFuncType Write);
+
+#endif /* PROF_H */
@@ -0,0 +1,229 @@
+/****************************************************************************************
+*                                SCH.C                                                  *
+****************************************************************************************
+* File Name   : Sch.c
+* Module      : Scheduler (SCH)
+* Description : Cooperative time-triggered scheduler driven by SysTick
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "Sch.h"
+#include "Sch_Cfg.h"
+#include "stm32f10x.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define SCH_SYSTICK_MAX_RELOAD      0x01000000UL    /*!< 24-bit SysTick counter */
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static const Sch_ConfigType* Sch_ConfigPtr = NULL_PTR;
+
+static volatile uint32 Sch_TickCount = 0U;          /*!< Ticks raised by SysTick */
+static uint32 Sch_DispatchedTicks = 0U;             /*!< Ticks handled by the dispatcher */
+static uint32 Sch_LostTicks = 0U;                   /*!< Ticks handled late */
+static uint32 Sch_CyclesPerTick = 0U;               /*!< SysTick reload + 1 */
+
+static uint16 Sch_TaskCountdown[SCH_MAX_TASKS];     /*!< Ticks until the next release */
+static uint32 Sch_TaskBudgetCycles[SCH_MAX_TASKS];  /*!< Budget converted to core cycles */
+static Sch_TaskStatsType Sch_TaskStats[SCH_MAX_TASKS];
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static uint32 Sch_GetCycleStamp(void);
+static void Sch_DispatchTick(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+/**
+ * @brief   Initialize the scheduler and start the SysTick tick
+ */
+Std_ReturnType Sch_Init(const Sch_ConfigType* ConfigPtr)
+{
+    uint32 CyclesPerUs;
+    uint8 TaskId;
+
+    if ((ConfigPtr == NULL_PTR) || (ConfigPtr->Sch_Tasks == NULL_PTR) ||
+        (ConfigPtr->Sch_NbrOfTasks > SCH_MAX_TASKS) || (ConfigPtr->Sch_TickHz == 0U))
+    {
+        return E_NOT_OK;
+    }
+
+    for (TaskId = 0U; TaskId < ConfigPtr->Sch_NbrOfTasks; TaskId++)
+    {
+        if ((ConfigPtr->Sch_Tasks[TaskId].Sch_TaskFunc == NULL_PTR) ||
+            (ConfigPtr->Sch_Tasks[TaskId].Sch_PeriodTicks == 0U))
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    Sch_CyclesPerTick = SystemCoreClock / ConfigPtr->Sch_TickHz;
+    if ((Sch_CyclesPerTick == 0U) || (Sch_CyclesPerTick > SCH_SYSTICK_MAX_RELOAD))
+    {
+        return E_NOT_OK;
+    }
+    CyclesPerUs = SystemCoreClock / 1000000UL;
+
+    for (TaskId = 0U; TaskId < ConfigPtr->Sch_NbrOfTasks; TaskId++)
+    {
+        Sch_TaskCountdown[TaskId] = ConfigPtr->Sch_Tasks[TaskId].Sch_OffsetTicks;
+        Sch_TaskBudgetCycles[TaskId] = (uint32)ConfigPtr->Sch_Tasks[TaskId].Sch_BudgetUs * CyclesPerUs;
+        Sch_TaskStats[TaskId].RunCount = 0U;
+        Sch_TaskStats[TaskId].Overruns = 0U;
+        Sch_TaskStats[TaskId].MaxExecCycles = 0U;
+    }
+
+    Sch_ConfigPtr = ConfigPtr;
+    Sch_TickCount = 0U;
+    Sch_DispatchedTicks = 0U;
+    Sch_LostTicks = 0U;
+
+    /* Lowest priority, peripheral interrupts preempt the tick */
+    if (SysTick_Config(Sch_CyclesPerTick) != 0U)
+    {
+        Sch_ConfigPtr = NULL_PTR;
+        return E_NOT_OK;
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief   Dispatch loop, never returns
+ */
+void Sch_Start(void)
+{
+    if (Sch_ConfigPtr == NULL_PTR)
+    {
+        return;
+    }
+
+    for (;;)
+    {
+        /* Masked so a tick between the check and WFI still wakes the core */
+        __disable_irq();
+        if (Sch_TickCount == Sch_DispatchedTicks)
+        {
+            __WFI();
+        }
+        __enable_irq();
+
+        while (Sch_DispatchedTicks != Sch_TickCount)
+        {
+            if ((Sch_TickCount - Sch_DispatchedTicks) > 1U)
+            {
+                Sch_LostTicks++;
+            }
+            Sch_DispatchedTicks++;
+            Sch_DispatchTick();
+        }
+    }
+}
+
+/**
+ * @brief   Tick handler, called from SysTick_Handler
+ */
+void Sch_TickHandler(void)
+{
+    Sch_TickCount++;
+}
+
+/**
+ * @brief   Read the statistics of one task
+ */
+Std_ReturnType Sch_GetTaskStats(uint8 TaskId, Sch_TaskStatsType* StatsPtr)
+{
+    if ((Sch_ConfigPtr == NULL_PTR) || (TaskId >= Sch_ConfigPtr->Sch_NbrOfTasks) ||
+        (StatsPtr == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+
+    *StatsPtr = Sch_TaskStats[TaskId];
+    return E_OK;
+}
+
+/**
+ * @brief   Ticks that were dispatched late
+ */
+uint32 Sch_GetLostTicks(void)
+{
+    return Sch_LostTicks;
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   Free-running core cycle count built from the tick count and SysTick
+ * @note    A reload whose interrupt is still pending is folded into the tick count.
+ */
+static uint32 Sch_GetCycleStamp(void)
+{
+    uint32 Ticks;
+    uint32 Value;
+    uint32 Pending;
+
+    do
+    {
+        Ticks = Sch_TickCount;
+        Value = SysTick->VAL;
+        Pending = SCB->ICSR & SCB_ICSR_PENDSTSET_Msk;
+    } while (Ticks != Sch_TickCount);
+
+    if ((Pending != 0U) && (Value > (Sch_CyclesPerTick >> 1)))
+    {
+        Ticks++;
+    }
+
+    /* SysTick counts down from the reload value */
+    return (Ticks * Sch_CyclesPerTick) + (Sch_CyclesPerTick - 1U - Value);
+}
+
+/**
+ * @brief   Run every task released on the current tick
+ */
+static void Sch_DispatchTick(void)
+{
+    const Sch_TaskConfigType* Task;
+    uint32 Start;
+    uint32 Exec;
+    uint8 TaskId;
+
+    for (TaskId = 0U; TaskId < Sch_ConfigPtr->Sch_NbrOfTasks; TaskId++)
+    {
+        if (Sch_TaskCountdown[TaskId] != 0U)
+        {
+            Sch_TaskCountdown[TaskId]--;
+            continue;
+        }
+
+        Task = &Sch_ConfigPtr->Sch_Tasks[TaskId];
+        Sch_TaskCountdown[TaskId] = Task->Sch_PeriodTicks - 1U;
+
+        Start = Sch_GetCycleStamp();
+        Task->Sch_TaskFunc();
+        Exec = Sch_GetCycleStamp() - Start;
+
+        Sch_TaskStats[TaskId].RunCount++;
+        if (Exec > Sch_TaskStats[TaskId].MaxExecCycles)
+        {
+            Sch_TaskStats[TaskId].MaxExecCycles = Exec;
+        }
+        if (Exec > Sch_TaskBudgetCycles[TaskId])
+        {
+            Sch_TaskStats[TaskId].Overruns++;
+        }
+    }
+}
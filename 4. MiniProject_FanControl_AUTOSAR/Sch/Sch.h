@@ -0,0 +1,101 @@
+/****************************************************************************************
+*                                SCH.H                                                  *
+****************************************************************************************
+* File Name   : Sch.h
+* Module      : Scheduler (SCH)
+* Description : Cooperative time-triggered scheduler driven by SysTick
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+#ifndef SCH_H
+#define SCH_H
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include "Std_Types.h"
+
+/****************************************************************************************
+*                                 TYPE DEFINITIONS                                     *
+****************************************************************************************/
+/**
+ * @brief   Task body, runs to completion
+ */
+typedef void (*Sch_TaskFuncType)(void);
+
+/**
+ * @brief   Static task description
+ * @details A task is released on every tick where
+ *          (tick - Sch_OffsetTicks) is a multiple of Sch_PeriodTicks.
+ *          Tasks released on the same tick run in table order.
+ */
+typedef struct
+{
+    Sch_TaskFuncType Sch_TaskFunc;      /*!< Task body */
+    uint16 Sch_PeriodTicks;             /*!< Release period in ticks, > 0 */
+    uint16 Sch_OffsetTicks;             /*!< First release tick, spreads tasks over ticks */
+    uint16 Sch_BudgetUs;                /*!< Execution budget, longer runs count as overrun */
+} Sch_TaskConfigType;
+
+/**
+ * @brief   Scheduler configuration
+ */
+typedef struct
+{
+    const Sch_TaskConfigType* Sch_Tasks;    /*!< Task table */
+    uint8 Sch_NbrOfTasks;                   /*!< Entries in the task table */
+    uint16 Sch_TickHz;                      /*!< Tick rate */
+} Sch_ConfigType;
+
+/**
+ * @brief   Runtime statistics of one task
+ */
+typedef struct
+{
+    uint32 RunCount;                    /*!< Completed activations */
+    uint32 Overruns;                    /*!< Activations longer than the budget */
+    uint32 MaxExecCycles;               /*!< Longest activation in core cycles */
+} Sch_TaskStatsType;
+
+/****************************************************************************************
+*                              FUNCTION PROTOTYPES                                     *
+****************************************************************************************/
+/**
+ * @brief   Initialize the scheduler and start the SysTick tick
+ * @param   ConfigPtr   Scheduler configuration
+ * @return  E_OK, E_NOT_OK for an invalid configuration or tick rate
+ */
+Std_ReturnType Sch_Init(const Sch_ConfigType* ConfigPtr);
+
+/**
+ * @brief   Dispatch loop, never returns
+ * @details Runs the released tasks of every tick, sleeps with WFI when no
+ *          tick is pending. Ticks that arrive while tasks still run are
+ *          processed late, the ones dispatched with another tick still
+ *          waiting behind them are counted in Sch_GetLostTicks.
+ */
+void Sch_Start(void);
+
+/**
+ * @brief   Tick handler, called from SysTick_Handler
+ */
+void Sch_TickHandler(void);
+
+/**
+ * @brief   Read the statistics of one task
+ * @param   TaskId      Index in the task table
+ * @param   StatsPtr    Copy of the statistics
+ * @return  E_OK, E_NOT_OK for an invalid task or pointer
+ */
+Std_ReturnType Sch_GetTaskStats(uint8 TaskId, Sch_TaskStatsType* StatsPtr);
+
+/**
+ * @brief   Ticks dispatched with another tick already waiting behind them
+ * @return  Number of late ticks since Sch_Init
+ */
+uint32 Sch_GetLostTicks(void);
+
+#endif /* SCH_H */
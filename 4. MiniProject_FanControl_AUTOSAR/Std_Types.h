@@ -32,8 +32,13 @@ typedef signed char         sint8;
 typedef unsigned char       uint8;
 typedef signed short        sint16;
 typedef unsigned short      uint16;
+#if defined(HOST_BUILD)
+typedef signed int          sint32;     /* long is 64-bit on LP64 hosts */
+typedef unsigned int        uint32;
+#else
 typedef signed long         sint32;
 typedef unsigned long       uint32;
+#endif
 typedef signed long long    sint64;
 typedef unsigned long long  uint64;
 
@@ -101,6 +106,22 @@ typedef struct
 /* Compiler specific attributes */
 #define STATIC              static
 
+/* Interrupt path code, copied to SRAM by Reset_Handler and run without flash wait
+ * states. long_call: SRAM is out of BL range from flash, noinline: keep it in SRAM. */
+#if defined(HOST_BUILD)
+#define RAMFUNC
+#else
+#define RAMFUNC             __attribute__((section(".ramfunc"), noinline, long_call))
+#endif
+
+/* Large buffers the code fills before reading, left out of the .bss clear at reset.
+ * Their content after reset is undefined. */
+#if defined(HOST_BUILD)
+#define NOINIT
+#else
+#define NOINIT              __attribute__((section(".noinit")))
+#endif
+
 /*
  * =====================================================
  *  MEMORY CLASSIFICATION MACROS
@@ -0,0 +1,183 @@
+/****************************************************************************************
+*                                TESTHOST.C                                             *
+****************************************************************************************
+* File Name   : TestHost.c
+* Module      : Host Tests (TEST)
+* Description : Assertions, case runner and benchmark output for the tests on the
+*               host peripheral model
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "TestHost.h"
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static const char* TestHost_Suite = "";
+static const char* TestHost_Case = "";
+static unsigned TestHost_Passed;
+static unsigned TestHost_Failed;
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void TestHost_Fail(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+/**
+ * @brief   Map the peripheral model, must run before the first case
+ */
+void TestHost_Begin(const char* Suite)
+{
+    TestHost_Suite = Suite;
+    TestHost_Passed = 0U;
+    TestHost_Failed = 0U;
+
+    /* Unbuffered, a child that crashes must not lose or duplicate output */
+    (void)setvbuf(stdout, NULL, _IONBF, 0);
+    HostSim_Init();
+}
+
+/**
+ * @brief   Run one case in a child process
+ */
+void TestHost_Run(const char* Name, void (*Case)(void))
+{
+    int Status = 0;
+    pid_t Pid;
+
+    TestHost_Case = Name;
+    Pid = fork();
+    if (Pid == 0)
+    {
+        (void)alarm(TESTHOST_CASE_TIMEOUT_S);
+        Case();
+        _exit(EXIT_SUCCESS);
+    }
+
+    if ((Pid > 0) && (waitpid(Pid, &Status, 0) == Pid) &&
+        WIFEXITED(Status) && (WEXITSTATUS(Status) == EXIT_SUCCESS))
+    {
+        printf("PASS %s.%s\n", TestHost_Suite, Name);
+        TestHost_Passed++;
+        return;
+    }
+
+    /* Assertion failures already printed their reason */
+    if ((Pid > 0) && WIFSIGNALED(Status))
+    {
+        printf("FAIL %s.%s: %s\n", TestHost_Suite, Name,
+               (WTERMSIG(Status) == SIGALRM) ? "timeout" : strsignal(WTERMSIG(Status)));
+    }
+    else if (Pid < 0)
+    {
+        printf("FAIL %s.%s: fork failed\n", TestHost_Suite, Name);
+    }
+    TestHost_Failed++;
+}
+
+/**
+ * @brief   Print the summary
+ */
+int TestHost_End(void)
+{
+    printf("%s: %u passed, %u failed\n", TestHost_Suite, TestHost_Passed, TestHost_Failed);
+    return (TestHost_Failed == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief   Print one benchmark result
+ */
+void TestHost_Bench(const char* Name, double Value, const char* Unit)
+{
+    printf("BENCH %s.%s,%.2f,%s\n", TestHost_Suite, Name, Value, Unit);
+}
+
+/**
+ * @brief   Monotonic host clock for benchmarks of code without register accesses
+ */
+uint64_t TestHost_HostNs(void)
+{
+    struct timespec Now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec;
+}
+
+/**
+ * @brief   Advance the model in slices until a flag is set
+ */
+int TestHost_AdvanceUntil(volatile const uint8_t* Flag, uint64_t Slice, uint64_t MaxCycles)
+{
+    uint64_t Start = HostSim_GetCycles();
+
+    while (*Flag == 0U)
+    {
+        if ((HostSim_GetCycles() - Start) >= MaxCycles)
+        {
+            return 0;
+        }
+        HostSim_Advance(Slice);
+    }
+    return 1;
+}
+
+void TestHost_Check(int Passed, const char* Text, const char* File, int Line)
+{
+    if (Passed == 0)
+    {
+        printf("FAIL %s.%s: %s:%d: %s\n", TestHost_Suite, TestHost_Case, File, Line, Text);
+        TestHost_Fail();
+    }
+}
+
+void TestHost_CheckEq(long long Expected, long long Actual, const char* Text, const char* File, int Line)
+{
+    if (Expected != Actual)
+    {
+        printf("FAIL %s.%s: %s:%d: %s is %lld, expected %lld\n",
+               TestHost_Suite, TestHost_Case, File, Line, Text, Actual, Expected);
+        TestHost_Fail();
+    }
+}
+
+void TestHost_CheckRange(long long Low, long long High, long long Actual, const char* Text, const char* File, int Line)
+{
+    if ((Actual < Low) || (Actual > High))
+    {
+        printf("FAIL %s.%s: %s:%d: %s is %lld, expected %lld..%lld\n",
+               TestHost_Suite, TestHost_Case, File, Line, Text, Actual, Low, High);
+        TestHost_Fail();
+    }
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   End the child, the parent counts the case as failed
+ */
+static void TestHost_Fail(void)
+{
+    _exit(EXIT_FAILURE);
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
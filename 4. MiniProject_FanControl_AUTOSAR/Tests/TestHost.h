@@ -0,0 +1,119 @@
+/****************************************************************************************
+*                                TESTHOST.H                                             *
+****************************************************************************************
+* File Name   : TestHost.h
+* Module      : Host Tests (TEST)
+* Description : Assertions, case runner and benchmark output for the tests on the
+*               host peripheral model
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * Every Tests/Test_*.c file is one executable with its own main(). TestHost_Begin
+ * maps the model once, TestHost_Run forks for each case so every case starts from
+ * an MCU fresh out of reset with the driver variables at their initial values.
+ * A failed assertion, a crash or a hang ends the child and fails the case. Output:
+ *   PASS <suite>.<case>
+ *   FAIL <suite>.<case>: <file>:<line>: <reason>
+ *   BENCH <suite>.<name>,<value>,<unit>
+ */
+
+#ifndef TESTHOST_H
+#define TESTHOST_H
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdint.h>
+
+#include "HostSim.h"
+
+/****************************************************************************************
+*                                 CONFIGURATION                                        *
+****************************************************************************************/
+#define TESTHOST_CASE_TIMEOUT_S     20U     /*!< Wall clock limit of one case */
+
+/****************************************************************************************
+*                                 ASSERTIONS                                           *
+****************************************************************************************/
+/**
+ * @brief   Fail the running case when Cond is false
+ */
+#define TEST_ASSERT(Cond) \
+    TestHost_Check(((Cond) ? 1 : 0), #Cond, __FILE__, __LINE__)
+
+/**
+ * @brief   Fail the running case when Actual differs from Expected, both printed
+ */
+#define TEST_ASSERT_EQ(Expected, Actual) \
+    TestHost_CheckEq((long long)(Expected), (long long)(Actual), #Actual, __FILE__, __LINE__)
+
+/**
+ * @brief   Fail the running case when Actual is outside [Low, High]
+ */
+#define TEST_ASSERT_RANGE(Low, High, Actual) \
+    TestHost_CheckRange((long long)(Low), (long long)(High), (long long)(Actual), #Actual, __FILE__, __LINE__)
+
+/****************************************************************************************
+*                                 FUNCTION PROTOTYPES                                  *
+****************************************************************************************/
+/**
+ * @brief   Map the peripheral model, must run before the first case
+ * @param[in] Suite Name printed in front of every case
+ * @return  void
+ */
+void TestHost_Begin(const char* Suite);
+
+/**
+ * @brief   Run one case in a child process
+ * @param[in] Name Case name
+ * @param[in] Case Test body, returning from it passes the case
+ * @return  void
+ */
+void TestHost_Run(const char* Name, void (*Case)(void));
+
+/**
+ * @brief   Print the summary
+ * @return  Exit status for main(), EXIT_FAILURE when any case failed
+ */
+int TestHost_End(void);
+
+/**
+ * @brief   Print one benchmark result
+ * @param[in] Name Benchmark name
+ * @param[in] Value Measured value
+ * @param[in] Unit Unit of Value, e.g. "sim_cycles" or "host_ns"
+ * @return  void
+ */
+void TestHost_Bench(const char* Name, double Value, const char* Unit);
+
+/**
+ * @brief   Monotonic host clock for benchmarks of code without register accesses
+ * @return  Nanoseconds
+ */
+uint64_t TestHost_HostNs(void);
+
+/**
+ * @brief   Advance the model in slices until a flag is set
+ * @details Every slice opens and closes the register windows, a slice much shorter
+ *          than the event being waited for costs wall clock time and nothing else.
+ * @param[in] Flag Set from an interrupt handler or the model
+ * @param[in] Slice HCLK cycles between two checks of the flag
+ * @param[in] MaxCycles Give up after this many HCLK cycles
+ * @return  1 if the flag was seen, 0 on timeout
+ */
+int TestHost_AdvanceUntil(volatile const uint8_t* Flag, uint64_t Slice, uint64_t MaxCycles);
+
+/* Used by the assertion macros */
+void TestHost_Check(int Passed, const char* Text, const char* File, int Line);
+void TestHost_CheckEq(long long Expected, long long Actual, const char* Text, const char* File, int Line);
+void TestHost_CheckRange(long long Low, long long High, long long Actual, const char* Text, const char* File, int Line);
+
+#endif /* TESTHOST_H */
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -0,0 +1,405 @@
+/****************************************************************************************
+*                                TESTQUEUE_ADCQUEUE.C                                   *
+****************************************************************************************
+* File Name   : TestQueue_AdcQueue.c
+* Module      : Host Tests (TEST)
+* Description : Lock-free ADC group queue against a reference FIFO: random add, remove
+*               and take on the queue, FIFO order across the ticket wrap, random start
+*               and stop requests on the driver
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * Built with ADC_ENABLE_QUEUING on and ADC_ENABLE_PRIORITY off (make test, queue
+ * variant). The reference model is a plain array in request order.
+ * The driver case replaces the group table with seven software one-shot groups on
+ * ADC1. Requests come from the test thread and from the completion notifications,
+ * which run in the DMA interrupt, so the queue is filled from both contexts and the
+ * unit is handed over from the interrupt. Every request must complete exactly once,
+ * in request order, unless it was stopped first.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "TestHost.h"
+#include "Adc.h"
+#include "Adc_Hw.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_HW_UNIT                0U
+#define TEST_QUEUE_OPS              20000U  /*!< Random operations on the bare queue */
+#define TEST_DRIVER_STEPS           600U    /*!< Random driver requests */
+#define TEST_MAX_GAP                600U    /*!< Random advance between requests, cycles */
+#define TEST_DRAIN_CYCLES           200000ULL /*!< Every queued group is done within this */
+#define TEST_SEED                   0x0FEEDU
+#define TEST_TICKETS_TO_WRAP        (0U - (uint32_t)ADC_HW_QUEUE_TICKET_INIT)  /*!< Adds before the wrap */
+
+/* Software one-shot on its own channel and buffer, notification on completion */
+#define TEST_ONESHOT(Id)                                                             \
+    {                                                                                \
+        .Adc_HwUnitId           = ADC_INSTANCE_1,                                    \
+        .Adc_GroupId            = (Id),                                              \
+        .Adc_GroupPriority      = 0,                                                 \
+        .Adc_GroupKind          = ADC_GROUP_KIND_REGULAR,                            \
+        .Adc_GroupAccessMode    = ADC_ACCESS_MODE_SINGLE,                            \
+        .Adc_ValueResultSize    = 1,                                                 \
+        .Adc_StreamNumSamples   = 1,                                                 \
+        .Adc_GroupConvMode      = ADC_CONV_MODE_ONESHOT,                             \
+        .Adc_GroupReplacement   = ADC_GROUP_REPL_ABORT_RESTART,                      \
+        .Adc_Status             = ADC_IDLE,                                          \
+        .Adc_ResultAlignment    = ADC_ALIGN_RIGHT,                                   \
+        .Adc_ChannelGroup       = &Test_Channels[Id],                                \
+        .Adc_NbrOfChannel       = 1,                                                 \
+        .Adc_PairedChannelGroup = NULL_PTR,                                          \
+        .Adc_TriggerSource      = ADC_TRIGG_SRC_SW,                                  \
+        .Adc_HwTriggerSignal    = ADC_HW_TRIG_RISING_EDGE,                           \
+        .Adc_HwTriggerEvent     = ADC_HW_TRIG_EVT_TIM3_TRGO,                         \
+        .Adc_HwTriggerTimer     = 0,                                                 \
+        .Adc_StreamBufferMode   = ADC_STREAM_BUFFER_LINEAR,                          \
+        .Adc_ValueResultPtr     = &Test_Buffers[Id],                                 \
+        .Adc_SetupBufferFlag    = 1,                                                 \
+        .Adc_Oversampling       = ADC_OVERSAMPLING_NONE,                             \
+        .Adc_OversamplingBufferPtr = NULL_PTR,                                       \
+        .Adc_LimitCheck         = NULL_PTR,                                          \
+        .Adc_NotificationCb     = Test_Notification##Id,                             \
+        .Adc_NotificationEnable = ADC_NOTIFICATION_DISABLE,                          \
+        .Adc_InterruptType      = ADC_HW_DMA                                         \
+    }
+
+#define TEST_NOTIFICATION(Id)                                                        \
+    static void Test_Notification##Id(void)                                          \
+    {                                                                                \
+        Test_Complete(Id);                                                           \
+    }
+
+/****************************************************************************************
+*                              LOCAL TYPES                                             *
+****************************************************************************************/
+/* Reference FIFO, the head is the group that owns or gets the unit next */
+typedef struct
+{
+    Adc_GroupType Group[ADC_MAX_GROUPS];
+    uint8_t Count;
+} Test_ModelType;
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void Test_ModelAdd(Adc_GroupType Group);
+static boolean Test_ModelRemove(Adc_GroupType Group);
+static boolean Test_ModelHas(Adc_GroupType Group);
+static void Test_Complete(Adc_GroupType Group);
+static void Test_Request(Adc_GroupType Group);
+static void Test_CollectAll(void);
+static void Test_RandomQueueOps(void);
+static void Test_QueueMatchesModel(void);
+static void Test_TicketWrapKeepsOrder(void);
+static void Test_RequestsRunInOrder(void);
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static const Adc_ChannelDefType Test_Channels[ADC_MAX_GROUPS] =
+{
+    { .Adc_ChannelId = 1, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 2, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 3, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 4, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 5, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 6, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 7, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+};
+static Adc_ValueGroupType Test_Buffers[ADC_MAX_GROUPS];
+
+static Test_ModelType Test_Model;
+static uint32_t Test_Requests;
+static uint32_t Test_Stops;
+static uint32_t Test_Completions;
+static uint32_t Test_IsrRequests;
+static uint32_t Test_OutOfOrder;
+
+TEST_NOTIFICATION(0)
+TEST_NOTIFICATION(1)
+TEST_NOTIFICATION(2)
+TEST_NOTIFICATION(3)
+TEST_NOTIFICATION(4)
+TEST_NOTIFICATION(5)
+TEST_NOTIFICATION(6)
+
+static const Adc_GroupDefType Test_Groups[ADC_MAX_GROUPS] =
+{
+    TEST_ONESHOT(0), TEST_ONESHOT(1), TEST_ONESHOT(2), TEST_ONESHOT(3),
+    TEST_ONESHOT(4), TEST_ONESHOT(5), TEST_ONESHOT(6),
+};
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("AdcQueue");
+    TestHost_Run("QueueMatchesModel", Test_QueueMatchesModel);
+    TestHost_Run("TicketWrapKeepsOrder", Test_TicketWrapKeepsOrder);
+    TestHost_Run("RequestsRunInOrder", Test_RequestsRunInOrder);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+static void Test_ModelAdd(Adc_GroupType Group)
+{
+    Test_Model.Group[Test_Model.Count] = Group;
+    Test_Model.Count++;
+}
+
+static boolean Test_ModelRemove(Adc_GroupType Group)
+{
+    uint8_t Idx;
+
+    for (Idx = 0U; Idx < Test_Model.Count; Idx++)
+    {
+        if (Test_Model.Group[Idx] == Group)
+        {
+            (void)memmove(&Test_Model.Group[Idx], &Test_Model.Group[Idx + 1U], Test_Model.Count - Idx - 1U);
+            Test_Model.Count--;
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static boolean Test_ModelHas(Adc_GroupType Group)
+{
+    uint8_t Idx;
+
+    for (Idx = 0U; Idx < Test_Model.Count; Idx++)
+    {
+        if (Test_Model.Group[Idx] == Group)
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**
+ * @brief   Completion of a one-shot group, interrupt context: must be the model head,
+ *          sometimes requests another idle group from here
+ */
+static void Test_Complete(Adc_GroupType Group)
+{
+    Adc_GroupType Next = (Adc_GroupType)(rand() % ADC_MAX_GROUPS);
+
+    if ((Test_Model.Count == 0U) || (Test_Model.Group[0] != Group))
+    {
+        Test_OutOfOrder++;
+    }
+    (void)Test_ModelRemove(Group);
+    Test_Completions++;
+
+    if (((rand() & 3) == 0) && (Adc_GetGroupStatus(Next) == ADC_IDLE))
+    {
+        Test_Request(Next);
+        Test_IsrRequests++;
+    }
+}
+
+/**
+ * @brief   Start request, the model appends the group when the driver accepts it
+ */
+static void Test_Request(Adc_GroupType Group)
+{
+    Adc_StartGroupConversion(Group);
+    if (Adc_GetGroupStatus(Group) != ADC_IDLE)
+    {
+        Test_ModelAdd(Group);
+        Test_Requests++;
+    }
+}
+
+/**
+ * @brief   Read every finished group, it goes back to idle
+ */
+static void Test_CollectAll(void)
+{
+    Adc_ValueGroupType Result = 0U;
+    Adc_GroupType Group;
+
+    for (Group = 0U; Group < ADC_MAX_GROUPS; Group++)
+    {
+        if (Adc_GetGroupStatus(Group) == ADC_STREAM_COMPLETED)
+        {
+            TEST_ASSERT_EQ(E_OK, Adc_ReadGroup(Group, &Result));
+            TEST_ASSERT_EQ(300U * (Group + 1U), Result);
+        }
+    }
+}
+
+/**
+ * @brief   Random add, remove and take on the bare queue give the same answers as
+ *          the reference FIFO, including the queued state of every group
+ */
+static void Test_QueueMatchesModel(void)
+{
+    Adc_Init(&Adc_Config);
+    Test_RandomQueueOps();
+}
+
+/**
+ * @brief   TEST_QUEUE_OPS random add, remove and take calls, each checked against
+ *          the reference FIFO, on an empty queue
+ */
+static void Test_RandomQueueOps(void)
+{
+    uint32_t Op;
+    Adc_GroupType Group;
+
+    srand(TEST_SEED);
+
+    for (Op = 0U; Op < TEST_QUEUE_OPS; Op++)
+    {
+        Group = (Adc_GroupType)(rand() % ADC_MAX_GROUPS);
+        switch (rand() % 3)
+        {
+            case 0:
+                TEST_ASSERT_EQ(Test_ModelHas(Group) ? E_NOT_OK : E_OK, AdcHw_AddGroupToQueue(TEST_HW_UNIT, Group));
+                if (Test_ModelHas(Group) == FALSE)
+                {
+                    Test_ModelAdd(Group);
+                }
+                break;
+            case 1:
+                TEST_ASSERT_EQ(Test_ModelRemove(Group) ? E_OK : E_NOT_OK, AdcHw_RemoveGroupFromQueue(TEST_HW_UNIT, Group));
+                break;
+            default:
+                TEST_ASSERT_EQ((Test_Model.Count == 0U) ? ADC_INVALID_GROUP_ID : Test_Model.Group[0],
+                               AdcHw_GetNextGroupFromQueue(TEST_HW_UNIT));
+                if (Test_Model.Count != 0U)
+                {
+                    (void)Test_ModelRemove(Test_Model.Group[0]);
+                }
+                break;
+        }
+
+        for (Group = 0U; Group < ADC_MAX_GROUPS; Group++)
+        {
+            TEST_ASSERT_EQ(Test_ModelHas(Group), AdcHw_IsGroupInQueue(TEST_HW_UNIT, Group));
+        }
+    }
+}
+
+/**
+ * @brief   Groups queued just before the ticket counter wraps stay ahead of the ones
+ *          queued after it, for every position of the wrap in the queue
+ */
+static void Test_TicketWrapKeepsOrder(void)
+{
+    uint32_t Burn;
+    uint8_t Before;
+    uint8_t Idx;
+
+    Adc_Init(&Adc_Config);
+
+    /* 0..ADC_MAX_GROUPS groups get their ticket before the wrap, the rest after it */
+    for (Before = 0U; Before <= ADC_MAX_GROUPS; Before++)
+    {
+        TEST_ASSERT_EQ(E_OK, AdcHw_ClearQueue(TEST_HW_UNIT));
+        for (Burn = 0U; Burn < (TEST_TICKETS_TO_WRAP - Before); Burn++)
+        {
+            TEST_ASSERT_EQ(E_OK, AdcHw_AddGroupToQueue(TEST_HW_UNIT, 0U));
+            TEST_ASSERT_EQ(E_OK, AdcHw_RemoveGroupFromQueue(TEST_HW_UNIT, 0U));
+        }
+
+        /* Last group first, a wrong order cannot come out as ascending IDs by accident */
+        for (Idx = 0U; Idx < ADC_MAX_GROUPS; Idx++)
+        {
+            TEST_ASSERT_EQ(E_OK, AdcHw_AddGroupToQueue(TEST_HW_UNIT, (Adc_GroupType)(ADC_MAX_GROUPS - 1U - Idx)));
+        }
+        for (Idx = 0U; Idx < ADC_MAX_GROUPS; Idx++)
+        {
+            TEST_ASSERT_EQ(ADC_MAX_GROUPS - 1U - Idx, AdcHw_GetNextGroupFromQueue(TEST_HW_UNIT));
+        }
+        TEST_ASSERT_EQ(ADC_INVALID_GROUP_ID, AdcHw_GetNextGroupFromQueue(TEST_HW_UNIT));
+    }
+
+    /* The random sequence of QueueMatchesModel again, many tickets past the wrap */
+    Test_RandomQueueOps();
+}
+
+/**
+ * @brief   Random start and stop requests from thread and interrupt context: every
+ *          accepted request completes once and in request order, none is lost
+ */
+static void Test_RequestsRunInOrder(void)
+{
+    uint32_t Step;
+    uint64_t Start;
+    Adc_GroupType Group;
+
+    for (Group = 0U; Group < ADC_MAX_GROUPS; Group++)
+    {
+        HostSim_SetAnalogInput(Test_Channels[Group].Adc_ChannelId, (uint16_t)(300U * (Group + 1U)));
+    }
+    (void)memcpy(Adc_GroupConfig, Test_Groups, sizeof(Test_Groups));
+    Adc_Init(&Adc_Config);
+    for (Group = 0U; Group < ADC_MAX_GROUPS; Group++)
+    {
+        Adc_EnableGroupNotification(Group);
+    }
+    srand(TEST_SEED);
+
+    for (Step = 0U; Step < TEST_DRIVER_STEPS; Step++)
+    {
+        Group = (Adc_GroupType)(rand() % ADC_MAX_GROUPS);
+        if ((rand() % 8) == 0)
+        {
+            /* Stop a waiting or running group, it never notifies */
+            if (Adc_GetGroupStatus(Group) == ADC_BUSY)
+            {
+                Adc_StopGroupConversion(Group);
+                TEST_ASSERT_EQ(ADC_IDLE, Adc_GetGroupStatus(Group));
+                TEST_ASSERT(Test_ModelRemove(Group));
+                Test_Stops++;
+            }
+        }
+        else if (Adc_GetGroupStatus(Group) == ADC_IDLE)
+        {
+            Test_Request(Group);
+        }
+        HostSim_Advance((uint64_t)(rand() % TEST_MAX_GAP) + 1U);
+        Test_CollectAll();
+    }
+
+    /* Drain: no wakeup may be lost, the unit ends idle with an empty queue */
+    Start = HostSim_GetCycles();
+    while ((Test_Model.Count != 0U) && (HostSim_GetCycles() - Start < TEST_DRAIN_CYCLES))
+    {
+        HostSim_Advance(1000U);
+        Test_CollectAll();
+    }
+    TEST_ASSERT_EQ(0U, Test_Model.Count);
+    TEST_ASSERT_EQ(0U, Test_OutOfOrder);
+    TEST_ASSERT_EQ(Test_Requests - Test_Stops, Test_Completions);
+    TEST_ASSERT(Test_IsrRequests > 0U);
+    for (Group = 0U; Group < ADC_MAX_GROUPS; Group++)
+    {
+        TEST_ASSERT_EQ(FALSE, AdcHw_IsGroupInQueue(TEST_HW_UNIT, Group));
+        TEST_ASSERT(Adc_GetGroupStatus(Group) != ADC_BUSY);
+    }
+    TestHost_Bench("QueueRequests", (double)Test_Requests, "req");
+    TestHost_Bench("QueueIsrRequests", (double)Test_IsrRequests, "req");
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
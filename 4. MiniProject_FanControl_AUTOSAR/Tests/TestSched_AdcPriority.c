@@ -0,0 +1,432 @@
+/****************************************************************************************
+*                                TESTSCHED_ADCPRIORITY.C                                *
+****************************************************************************************
+* File Name   : TestSched_AdcPriority.c
+* Module      : Host Tests (TEST)
+* Description : ADC priority scheduler under load: worst-case wait of the one-shot
+*               groups per priority with five lower priority streams requested
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * Built with ADC_ENABLE_QUEUING and ADC_ENABLE_PRIORITY on (make test, scheduler
+ * variant, ADC_PRIORITY_HW_SW). The group table is replaced by a test set on ADC1:
+ *   0..2  streams, priority 0
+ *   3..4  streams, priority 1
+ *   5     one-shot, priority 2
+ *   6     one-shot, priority 3
+ * One unit converts one group at a time: the running stream owns ADC1, the other
+ * four wait in the ready bitmap, lowest group ID first within a level. The wait of
+ * a one-shot request is
+ * the time from Adc_StartGroupConversion to its notification, so it holds the
+ * preemption of the stream, the ADC power-up, the conversion and the DMA interrupt.
+ * The owner of the unit is read back from DMA1_Channel1 CMAR, every group has its
+ * own buffer.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "TestHost.h"
+#include "Adc.h"
+#include "Adc_Hw.h"
+#include "Adc_Hw.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_STREAMS                5U
+#define TEST_MID_GROUP              5U      /*!< One-shot, priority 2 */
+#define TEST_TOP_GROUP              6U      /*!< One-shot, priority 3 */
+#define TEST_STREAM_SAMPLES         8U
+#define TEST_CYCLES_PER_MS          72000ULL
+
+#define TEST_REQUESTS               250U    /*!< Random request rounds */
+#define TEST_MAX_GAP                3000U   /*!< Random gap between rounds, cycles */
+#define TEST_TOP_MIN_GAP            6000U   /*!< Priority 3 spacing, longer than any priority 2 wait */
+#define TEST_MAX_WAIT               20000ULL /*!< Request never completes past this */
+/* Scheduler cost of one preemption on top of the isolated wait: stop the running
+ * group, park it and start the new one, every register access is charged
+ * HOSTSIM_ACCESS_CYCLES */
+#define TEST_PREEMPT_BUDGET         150ULL
+#define TEST_SEED                   0x5EEDU
+
+/* Circular DMA stream on its own channel and buffer */
+#define TEST_STREAM(Id, Prio, Repl, Trigger, Event, Period)                          \
+    {                                                                                \
+        .Adc_HwUnitId           = ADC_INSTANCE_1,                                    \
+        .Adc_GroupId            = (Id),                                              \
+        .Adc_GroupPriority      = (Prio),                                            \
+        .Adc_GroupKind          = ADC_GROUP_KIND_REGULAR,                            \
+        .Adc_GroupAccessMode    = ADC_ACCESS_MODE_STREAMING,                         \
+        .Adc_ValueResultSize    = TEST_STREAM_SAMPLES,                               \
+        .Adc_StreamNumSamples   = TEST_STREAM_SAMPLES,                               \
+        .Adc_GroupConvMode      = ADC_CONV_MODE_CONTINUOUS,                          \
+        .Adc_GroupReplacement   = (Repl),                                            \
+        .Adc_Status             = ADC_IDLE,                                          \
+        .Adc_ResultAlignment    = ADC_ALIGN_RIGHT,                                   \
+        .Adc_ChannelGroup       = &Test_Channels[Id],                                \
+        .Adc_NbrOfChannel       = 1,                                                 \
+        .Adc_PairedChannelGroup = NULL_PTR,                                          \
+        .Adc_TriggerSource      = (Trigger),                                         \
+        .Adc_HwTriggerSignal    = ADC_HW_TRIG_RISING_EDGE,                           \
+        .Adc_HwTriggerEvent     = (Event),                                           \
+        .Adc_HwTriggerTimer     = (Period),                                          \
+        .Adc_StreamBufferMode   = ADC_STREAM_BUFFER_CIRCULAR,                        \
+        .Adc_ValueResultPtr     = Test_Buffers[Id],                                  \
+        .Adc_SetupBufferFlag    = 1,                                                 \
+        .Adc_Oversampling       = ADC_OVERSAMPLING_NONE,                             \
+        .Adc_OversamplingBufferPtr = NULL_PTR,                                       \
+        .Adc_LimitCheck         = NULL_PTR,                                          \
+        .Adc_NotificationCb     = NULL_PTR,                                          \
+        .Adc_NotificationEnable = ADC_NOTIFICATION_DISABLE,                          \
+        .Adc_InterruptType      = ADC_HW_DMA                                         \
+    }
+
+/* Software one-shot, one channel, notification on completion */
+#define TEST_ONESHOT(Id, Prio, Callback)                                             \
+    {                                                                                \
+        .Adc_HwUnitId           = ADC_INSTANCE_1,                                    \
+        .Adc_GroupId            = (Id),                                              \
+        .Adc_GroupPriority      = (Prio),                                            \
+        .Adc_GroupKind          = ADC_GROUP_KIND_REGULAR,                            \
+        .Adc_GroupAccessMode    = ADC_ACCESS_MODE_SINGLE,                            \
+        .Adc_ValueResultSize    = 1,                                                 \
+        .Adc_StreamNumSamples   = 1,                                                 \
+        .Adc_GroupConvMode      = ADC_CONV_MODE_ONESHOT,                             \
+        .Adc_GroupReplacement   = ADC_GROUP_REPL_ABORT_RESTART,                      \
+        .Adc_Status             = ADC_IDLE,                                          \
+        .Adc_ResultAlignment    = ADC_ALIGN_RIGHT,                                   \
+        .Adc_ChannelGroup       = &Test_Channels[Id],                                \
+        .Adc_NbrOfChannel       = 1,                                                 \
+        .Adc_PairedChannelGroup = NULL_PTR,                                          \
+        .Adc_TriggerSource      = ADC_TRIGG_SRC_SW,                                  \
+        .Adc_HwTriggerSignal    = ADC_HW_TRIG_RISING_EDGE,                           \
+        .Adc_HwTriggerEvent     = ADC_HW_TRIG_EVT_TIM3_TRGO,                         \
+        .Adc_HwTriggerTimer     = 0,                                                 \
+        .Adc_StreamBufferMode   = ADC_STREAM_BUFFER_LINEAR,                          \
+        .Adc_ValueResultPtr     = Test_Buffers[Id],                                  \
+        .Adc_SetupBufferFlag    = 1,                                                 \
+        .Adc_Oversampling       = ADC_OVERSAMPLING_NONE,                             \
+        .Adc_OversamplingBufferPtr = NULL_PTR,                                       \
+        .Adc_LimitCheck         = NULL_PTR,                                          \
+        .Adc_NotificationCb     = (Callback),                                        \
+        .Adc_NotificationEnable = ADC_NOTIFICATION_DISABLE,                          \
+        .Adc_InterruptType      = ADC_HW_DMA                                         \
+    }
+
+/****************************************************************************************
+*                              LOCAL TYPES                                             *
+****************************************************************************************/
+typedef struct
+{
+    uint64_t RequestCycle;      /*!< Adc_StartGroupConversion */
+    uint64_t WorstWait;         /*!< Longest request to notification */
+    uint32_t Completed;         /*!< Notifications */
+    volatile uint8_t Done;      /*!< Set by the notification */
+} Test_WaitType;
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void Test_Complete(Adc_GroupType Group);
+static void Test_MidNotification(void);
+static void Test_TopNotification(void);
+static void Test_Setup(void);
+static void Test_StartStreams(void);
+static void Test_StartGroup(Adc_GroupType Group);
+static void Test_Collect(Adc_GroupType Group);
+static uint64_t Test_IsolatedWait(Adc_GroupType Group);
+static Adc_GroupType Test_Owner(void);
+static void Test_StreamsWaitInOrder(void);
+static void Test_BoundedWaitPerPriority(void);
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static const Adc_ChannelDefType Test_Channels[ADC_MAX_GROUPS] =
+{
+    { .Adc_ChannelId = 1, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 2, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 3, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 4, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 5, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 6, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 7, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+};
+static Adc_ValueGroupType Test_Buffers[ADC_MAX_GROUPS][TEST_STREAM_SAMPLES];
+
+static const Adc_GroupDefType Test_Groups[ADC_MAX_GROUPS] =
+{
+    TEST_STREAM(0, 0, ADC_GROUP_REPL_ABORT_RESTART, ADC_TRIGG_SRC_SW, ADC_HW_TRIG_EVT_TIM3_TRGO, 0),
+    TEST_STREAM(1, 0, ADC_GROUP_REPL_ABORT_RESTART, ADC_TRIGG_SRC_HW, ADC_HW_TRIG_EVT_TIM3_TRGO,
+                ADC_HW_TRIGGER_PERIOD(1000)),
+    TEST_STREAM(2, 0, ADC_GROUP_REPL_SUSPEND_RESUME, ADC_TRIGG_SRC_SW, ADC_HW_TRIG_EVT_TIM3_TRGO, 0),
+    TEST_STREAM(3, 1, ADC_GROUP_REPL_SUSPEND_RESUME, ADC_TRIGG_SRC_HW, ADC_HW_TRIG_EVT_TIM3_TRGO,
+                ADC_HW_TRIGGER_PERIOD(10000)),
+    TEST_STREAM(4, 1, ADC_GROUP_REPL_ABORT_RESTART, ADC_TRIGG_SRC_SW, ADC_HW_TRIG_EVT_TIM3_TRGO, 0),
+    TEST_ONESHOT(TEST_MID_GROUP, 2, Test_MidNotification),
+    TEST_ONESHOT(TEST_TOP_GROUP, 3, Test_TopNotification),
+};
+
+static Test_WaitType Test_Wait[ADC_MAX_GROUPS];
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("AdcPriority");
+    TestHost_Run("StreamsWaitInOrder", Test_StreamsWaitInOrder);
+    TestHost_Run("BoundedWaitPerPriority", Test_BoundedWaitPerPriority);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   Completion of a one-shot group, interrupt context
+ */
+static void Test_Complete(Adc_GroupType Group)
+{
+    Test_WaitType* Wait = &Test_Wait[Group];
+    uint64_t Elapsed = HostSim_GetCycles() - Wait->RequestCycle;
+
+    if (Elapsed > Wait->WorstWait)
+    {
+        Wait->WorstWait = Elapsed;
+    }
+    Wait->Completed++;
+    Wait->Done = 1U;
+}
+
+static void Test_MidNotification(void)
+{
+    Test_Complete(TEST_MID_GROUP);
+}
+
+static void Test_TopNotification(void)
+{
+    Test_Complete(TEST_TOP_GROUP);
+}
+
+/**
+ * @brief   Load the test group table and start the driver
+ */
+static void Test_Setup(void)
+{
+    uint8_t Channel;
+
+    for (Channel = 0U; Channel < ADC_MAX_GROUPS; Channel++)
+    {
+        HostSim_SetAnalogInput(Test_Channels[Channel].Adc_ChannelId, (uint16_t)(500U * (Channel + 1U)));
+    }
+    (void)memcpy(Adc_GroupConfig, Test_Groups, sizeof(Test_Groups));
+    Adc_Init(&Adc_Config);
+    Adc_EnableGroupNotification(TEST_MID_GROUP);
+    Adc_EnableGroupNotification(TEST_TOP_GROUP);
+}
+
+/**
+ * @brief   Request the five streams, lowest group ID first
+ */
+static void Test_StartStreams(void)
+{
+    Adc_GroupType Group;
+
+    for (Group = 0U; Group < TEST_STREAMS; Group++)
+    {
+        if (Test_Groups[Group].Adc_TriggerSource == ADC_TRIGG_SRC_HW)
+        {
+            Adc_EnableHardwareTrigger(Group);
+        }
+        else
+        {
+            Adc_StartGroupConversion(Group);
+        }
+        TEST_ASSERT_EQ(ADC_BUSY, Adc_GetGroupStatus(Group));
+    }
+}
+
+/**
+ * @brief   Request a one-shot group and stamp the request time
+ */
+static void Test_StartGroup(Adc_GroupType Group)
+{
+    Test_Wait[Group].Done = 0U;
+    Test_Wait[Group].RequestCycle = HostSim_GetCycles();
+    Adc_StartGroupConversion(Group);
+}
+
+/**
+ * @brief   Take the result of a finished one-shot group, the group goes back to idle
+ */
+static void Test_Collect(Adc_GroupType Group)
+{
+    Adc_ValueGroupType Result = 0U;
+
+    TEST_ASSERT_EQ(ADC_STREAM_COMPLETED, Adc_GetGroupStatus(Group));
+    TEST_ASSERT_EQ(E_OK, Adc_ReadGroup(Group, &Result));
+    TEST_ASSERT_EQ(500U * (Group + 1U), Result);
+    TEST_ASSERT_EQ(ADC_IDLE, Adc_GetGroupStatus(Group));
+    Test_Wait[Group].Done = 0U;
+}
+
+/**
+ * @brief   Wait of one request on an idle unit
+ */
+static uint64_t Test_IsolatedWait(Adc_GroupType Group)
+{
+    uint64_t Wait;
+
+    Test_Wait[Group].WorstWait = 0U;
+    Test_StartGroup(Group);
+    TEST_ASSERT(TestHost_AdvanceUntil(&Test_Wait[Group].Done, 64U, TEST_MAX_WAIT));
+    Test_Collect(Group);
+    Wait = Test_Wait[Group].WorstWait;
+    Test_Wait[Group].WorstWait = 0U;
+    return Wait;
+}
+
+/**
+ * @brief   Group whose buffer DMA1_Channel1 writes, ADC_INVALID_GROUP_ID when off
+ */
+static Adc_GroupType Test_Owner(void)
+{
+    uint32_t Address = HostSim_PeekRegister(&DMA1_Channel1->CMAR);
+    Adc_GroupType Group;
+
+    if ((HostSim_PeekRegister(&DMA1_Channel1->CCR) & DMA_CCR1_EN) == 0U)
+    {
+        return ADC_INVALID_GROUP_ID;
+    }
+    for (Group = 0U; Group < ADC_MAX_GROUPS; Group++)
+    {
+        if (Address == (uint32_t)(uintptr_t)Test_Buffers[Group])
+        {
+            return Group;
+        }
+    }
+    return ADC_INVALID_GROUP_ID;
+}
+
+/**
+ * @brief   The unit goes to the highest ready stream, then the preempted background
+ *          stream, then the queue in request order
+ */
+static void Test_StreamsWaitInOrder(void)
+{
+    static const Adc_GroupType Order[TEST_STREAMS] = { 3U, 4U, 0U, 1U, 2U };
+    uint32_t Conversions;
+    uint8_t Idx;
+
+    Test_Setup();
+    Test_StartStreams();
+
+    for (Idx = 0U; Idx < TEST_STREAMS; Idx++)
+    {
+        Adc_GroupType Group = Order[Idx];
+
+        TEST_ASSERT_EQ(Group, Test_Owner());
+        Conversions = HostSim_GetConversionCount(ADC1);
+        HostSim_Advance(2U * TEST_CYCLES_PER_MS);
+        TEST_ASSERT(HostSim_GetConversionCount(ADC1) > Conversions);
+
+        if (Test_Groups[Group].Adc_TriggerSource == ADC_TRIGG_SRC_HW)
+        {
+            Adc_DisableHardwareTrigger(Group);
+        }
+        else
+        {
+            Adc_StopGroupConversion(Group);
+        }
+        TEST_ASSERT_EQ(ADC_IDLE, Adc_GetGroupStatus(Group));
+    }
+    TEST_ASSERT_EQ(ADC_INVALID_GROUP_ID, Test_Owner());
+}
+
+/**
+ * @brief   Random one-shot requests over the running streams. The top group waits at
+ *          most its isolated time and one preemption. The middle group can also be
+ *          preempted once by the top group, it then loses the conversion in progress
+ *          (ABORT_RESTART) and waits for the top group before it restarts.
+ */
+static void Test_BoundedWaitPerPriority(void)
+{
+    uint64_t IsolatedMid;
+    uint64_t IsolatedTop;
+    uint64_t LastTop = 0U;
+    uint32_t Round;
+    uint32_t Conversions;
+    Adc_GroupType Group;
+
+    Test_Setup();
+    IsolatedMid = Test_IsolatedWait(TEST_MID_GROUP);
+    IsolatedTop = Test_IsolatedWait(TEST_TOP_GROUP);
+
+    Test_StartStreams();
+    srand(TEST_SEED);
+    for (Round = 0U; Round < TEST_REQUESTS; Round++)
+    {
+        HostSim_Advance((uint64_t)(rand() % TEST_MAX_GAP) + 1U);
+
+        for (Group = TEST_MID_GROUP; Group <= TEST_TOP_GROUP; Group++)
+        {
+            if (Test_Wait[Group].Done != 0U)
+            {
+                Test_Collect(Group);
+            }
+            else if (Adc_GetGroupStatus(Group) != ADC_IDLE)
+            {
+                /* Still waiting, nothing may take longer than TEST_MAX_WAIT */
+                TEST_ASSERT(HostSim_GetCycles() - Test_Wait[Group].RequestCycle < TEST_MAX_WAIT);
+                continue;
+            }
+
+            if ((Group == TEST_TOP_GROUP) && (HostSim_GetCycles() - LastTop < TEST_TOP_MIN_GAP))
+            {
+                continue;
+            }
+            if ((rand() & 1) != 0)
+            {
+                if (Group == TEST_TOP_GROUP)
+                {
+                    LastTop = HostSim_GetCycles();
+                }
+                Test_StartGroup(Group);
+            }
+        }
+    }
+
+    /* Last requests finish, the streams keep converting behind them */
+    HostSim_Advance(TEST_MAX_WAIT);
+    TEST_ASSERT(Test_Wait[TEST_MID_GROUP].Completed > (TEST_REQUESTS / 4U));
+    TEST_ASSERT(Test_Wait[TEST_TOP_GROUP].Completed > (TEST_REQUESTS / 8U));
+    /* No stream was dropped, the highest one owns the unit again */
+    for (Group = 0U; Group < TEST_STREAMS; Group++)
+    {
+        TEST_ASSERT(Adc_GetGroupStatus(Group) != ADC_IDLE);
+    }
+    TEST_ASSERT_EQ(3U, Test_Owner());
+    Conversions = HostSim_GetConversionCount(ADC1);
+    HostSim_Advance(TEST_CYCLES_PER_MS);
+    TEST_ASSERT(HostSim_GetConversionCount(ADC1) > Conversions);
+
+    TestHost_Bench("IsolatedWaitPrio3", (double)IsolatedTop, "cycles");
+    TestHost_Bench("WorstWaitPrio3", (double)Test_Wait[TEST_TOP_GROUP].WorstWait, "cycles");
+    TestHost_Bench("IsolatedWaitPrio2", (double)IsolatedMid, "cycles");
+    TestHost_Bench("WorstWaitPrio2", (double)Test_Wait[TEST_MID_GROUP].WorstWait, "cycles");
+    TEST_ASSERT(Test_Wait[TEST_TOP_GROUP].WorstWait <= IsolatedTop + TEST_PREEMPT_BUDGET);
+    TEST_ASSERT(Test_Wait[TEST_MID_GROUP].WorstWait <= (2U * IsolatedMid) + IsolatedTop + (2U * TEST_PREEMPT_BUDGET));
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -0,0 +1,232 @@
+/****************************************************************************************
+*                                TEST_ADCDMA.C                                          *
+****************************************************************************************
+* File Name   : Test_AdcDma.c
+* Module      : Host Tests (TEST)
+* Description : Scan groups moved by one DMA block: configuration of the one-shot
+*               temperature group and the interrupt count against the EOC path
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * The benchmark reuses group 0 with an 8-channel sequence patched into
+ * Adc_GroupConfig before Adc_Init, once with ADC_HW_DMA and once with ADC_HW_EOC.
+ * Interrupts are counted by the model, every handler entry counts once.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "TestHost.h"
+#include "Adc.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_GROUP                  0U      /*!< SW one-shot temperature group */
+#define TEST_TEMP_CHANNEL           0U      /*!< PA0 */
+#define TEST_TEMP_RAW               1860U
+#define TEST_SCAN_CHANNELS          8U
+#define TEST_SCAN_ROUNDS            16U
+#define TEST_MAX_CYCLES             100000ULL /*!< One scan takes well under this */
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static const Adc_ChannelDefType Test_ScanChannels[TEST_SCAN_CHANNELS] =
+{
+    { .Adc_ChannelId = 0, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 1, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 2, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 3, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 4, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 5, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 6, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+    { .Adc_ChannelId = 7, .Adc_ChannelSampTime = ADC_SAMPLING_TIME_DEFAULT },
+};
+static Adc_ValueGroupType Test_ScanBuffer[TEST_SCAN_CHANNELS];
+
+/* Group 0 widened to 8 ranks, most fields are const so the whole entry is replaced */
+static const Adc_GroupDefType Test_ScanGroup =
+{
+    .Adc_HwUnitId           = ADC_INSTANCE_1,
+    .Adc_GroupId            = TEST_GROUP,
+    .Adc_GroupPriority      = 1,
+    .Adc_GroupKind          = ADC_GROUP_KIND_REGULAR,
+    .Adc_GroupAccessMode    = ADC_ACCESS_MODE_SINGLE,
+    .Adc_ValueResultSize    = TEST_SCAN_CHANNELS,
+    .Adc_StreamNumSamples   = 1,
+    .Adc_GroupConvMode      = ADC_CONV_MODE_ONESHOT,
+    .Adc_GroupReplacement   = ADC_GROUP_REPL_ABORT_RESTART,
+    .Adc_Status             = ADC_IDLE,
+    .Adc_ResultAlignment    = ADC_ALIGN_RIGHT,
+    .Adc_ChannelGroup       = Test_ScanChannels,
+    .Adc_NbrOfChannel       = TEST_SCAN_CHANNELS,
+    .Adc_PairedChannelGroup = NULL_PTR,
+    .Adc_TriggerSource      = ADC_TRIGG_SRC_SW,
+    .Adc_HwTriggerSignal    = ADC_HW_TRIG_RISING_EDGE,
+    .Adc_HwTriggerEvent     = ADC_HW_TRIG_EVT_TIM3_TRGO,
+    .Adc_HwTriggerTimer     = 0,
+    .Adc_StreamBufferMode   = ADC_STREAM_BUFFER_LINEAR,
+    .Adc_ValueResultPtr     = Test_ScanBuffer,
+    .Adc_SetupBufferFlag    = 0,
+    .Adc_Oversampling       = ADC_OVERSAMPLING_NONE,
+    .Adc_OversamplingBufferPtr = NULL_PTR,
+    .Adc_LimitCheck         = NULL_PTR,
+    .Adc_NotificationCb     = NULL_PTR,
+    .Adc_NotificationEnable = ADC_NOTIFICATION_DISABLE,
+    .Adc_InterruptType      = ADC_HW_DMA
+};
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void Test_RunGroup(Adc_GroupType Group);
+static uint32_t Test_ScanIrqs(Adc_NvicType InterruptType);
+static void Test_InitLeavesDmaOff(void);
+static void Test_OneShotIsLinear(void);
+static void Test_ScanDmaOneIrqPerBlock(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("AdcDma");
+    TestHost_Run("InitLeavesDmaOff", Test_InitLeavesDmaOff);
+    TestHost_Run("OneShotIsLinear", Test_OneShotIsLinear);
+    TestHost_Run("ScanDmaOneIrqPerBlock", Test_ScanDmaOneIrqPerBlock);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   One software start, run until the group has its results
+ */
+static void Test_RunGroup(Adc_GroupType Group)
+{
+    uint64_t Start = HostSim_GetCycles();
+
+    Adc_StartGroupConversion(Group);
+    while (Adc_GetGroupStatus(Group) != ADC_STREAM_COMPLETED)
+    {
+        TEST_ASSERT(HostSim_GetCycles() - Start < TEST_MAX_CYCLES);
+        HostSim_Advance(64U);
+    }
+}
+
+/**
+ * @brief   Interrupts taken for TEST_SCAN_ROUNDS scans of the 8-channel group
+ */
+static uint32_t Test_ScanIrqs(Adc_NvicType InterruptType)
+{
+    Adc_GroupDefType* Group = &Adc_GroupConfig[TEST_GROUP];
+    Adc_ValueGroupType Results[TEST_SCAN_CHANNELS];
+    uint32_t Irqs;
+    uint8_t Round;
+    uint8_t Channel;
+
+    for (Channel = 0U; Channel < TEST_SCAN_CHANNELS; Channel++)
+    {
+        HostSim_SetAnalogInput(Channel, (uint16_t)(100U * (Channel + 1U)));
+    }
+
+    (void)memcpy(Group, &Test_ScanGroup, sizeof(Test_ScanGroup));
+    Group->Adc_InterruptType = InterruptType;
+    Adc_Init(&Adc_Config);
+    TEST_ASSERT_EQ(E_OK, Adc_SetupResultBuffer(TEST_GROUP, Test_ScanBuffer));
+
+    for (Round = 0U; Round < TEST_SCAN_ROUNDS; Round++)
+    {
+        Test_RunGroup(TEST_GROUP);
+        TEST_ASSERT_EQ(E_OK, Adc_ReadGroup(TEST_GROUP, Results));
+        for (Channel = 0U; Channel < TEST_SCAN_CHANNELS; Channel++)
+        {
+            TEST_ASSERT_EQ(100U * (Channel + 1U), Results[Channel]);
+        }
+    }
+
+    Irqs = HostSim_GetInterruptCount(ADC1_2_IRQn) + HostSim_GetInterruptCount(DMA1_Channel1_IRQn);
+    TEST_ASSERT_EQ(TEST_SCAN_ROUNDS * TEST_SCAN_CHANNELS, HostSim_GetConversionCount(ADC1));
+    return Irqs;
+}
+
+/**
+ * @brief   Adc_Init programs no DMA channel, the group start does
+ */
+static void Test_InitLeavesDmaOff(void)
+{
+    Adc_Init(&Adc_Config);
+    TEST_ASSERT_EQ(0U, HostSim_PeekRegister(&DMA1_Channel1->CCR) & DMA_CCR1_EN);
+    TEST_ASSERT_EQ(0U, HostSim_PeekRegister(&DMA1_Channel1->CNDTR));
+}
+
+/**
+ * @brief   The one-shot temperature group uses a normal DMA block and one interrupt
+ */
+static void Test_OneShotIsLinear(void)
+{
+    Adc_ValueGroupType Buffer[1];
+    Adc_ValueGroupType Result = 0U;
+
+    HostSim_SetAnalogInput(TEST_TEMP_CHANNEL, TEST_TEMP_RAW);
+    Adc_Init(&Adc_Config);
+    TEST_ASSERT_EQ(E_OK, Adc_SetupResultBuffer(TEST_GROUP, Buffer));
+
+    Test_RunGroup(TEST_GROUP);
+    TEST_ASSERT_EQ(0U, HostSim_PeekRegister(&DMA1_Channel1->CCR) & DMA_CCR1_CIRC);
+    TEST_ASSERT_EQ(1U, HostSim_GetInterruptCount(DMA1_Channel1_IRQn));
+    TEST_ASSERT_EQ(0U, HostSim_GetInterruptCount(ADC1_2_IRQn));
+    TEST_ASSERT_EQ(E_OK, Adc_ReadGroup(TEST_GROUP, &Result));
+    TEST_ASSERT_EQ(TEST_TEMP_RAW, Result);
+
+    /* The converter stopped with the block, nothing more is converted */
+    HostSim_Advance(TEST_MAX_CYCLES);
+    TEST_ASSERT_EQ(1U, HostSim_GetConversionCount(ADC1));
+    TEST_ASSERT_EQ(1U, HostSim_GetInterruptCount(DMA1_Channel1_IRQn));
+}
+
+/**
+ * @brief   8-channel scan: one interrupt per block with DMA, one per channel with EOC
+ */
+static void Test_ScanDmaOneIrqPerBlock(void)
+{
+    int Status = 0;
+    pid_t Pid;
+    uint32_t DmaIrqs;
+    uint32_t EocIrqs;
+    int Pipe[2];
+
+    /* Each path needs a fresh driver, the EOC run goes to a child */
+    TEST_ASSERT_EQ(0, pipe(Pipe));
+    Pid = fork();
+    if (Pid == 0)
+    {
+        EocIrqs = Test_ScanIrqs(ADC_HW_EOC);
+        _exit((write(Pipe[1], &EocIrqs, sizeof(EocIrqs)) == (ssize_t)sizeof(EocIrqs)) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    TEST_ASSERT(Pid > 0);
+    TEST_ASSERT((waitpid(Pid, &Status, 0) == Pid) && WIFEXITED(Status) && (WEXITSTATUS(Status) == EXIT_SUCCESS));
+    TEST_ASSERT_EQ(sizeof(EocIrqs), read(Pipe[0], &EocIrqs, sizeof(EocIrqs)));
+
+    DmaIrqs = Test_ScanIrqs(ADC_HW_DMA);
+
+    TEST_ASSERT_EQ(TEST_SCAN_ROUNDS, DmaIrqs);
+    TEST_ASSERT_EQ(TEST_SCAN_ROUNDS * TEST_SCAN_CHANNELS, EocIrqs);
+    TestHost_Bench("IrqPerScan8Dma", (double)DmaIrqs / TEST_SCAN_ROUNDS, "irq");
+    TestHost_Bench("IrqPerScan8Eoc", (double)EocIrqs / TEST_SCAN_ROUNDS, "irq");
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
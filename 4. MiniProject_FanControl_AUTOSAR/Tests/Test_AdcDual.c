@@ -0,0 +1,191 @@
+/****************************************************************************************
+*                                TEST_ADCDUAL.C                                         *
+****************************************************************************************
+* File Name   : Test_AdcDual.c
+* Module      : Host Tests (TEST)
+* Description : Dual ADC1+ADC2 regular simultaneous group: pairs converted at the
+*               same instant, one packed DMA word per pair and the unpacked views
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * Group 5 converts PA0 on ADC1 and PA1 on ADC2 at TIM1 CC2, once per PWM period.
+ * The analog source numbers the conversions of each channel and records when they
+ * complete, so a result names the round it belongs to and the two halves of a pair
+ * can be checked for the same instant. PA0 returns TEST_RAW_ADC1 + round, PA1
+ * TEST_RAW_ADC2 + round.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+
+#include "TestHost.h"
+#include "Adc.h"
+#include "Pwm.h"
+#include "Det.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_DUAL_GROUP             4U      /*!< PA0 on ADC1, PA1 on ADC2, TIM1 CC2 */
+#define TEST_ADC1_CHANNEL           0U      /*!< PA0 */
+#define TEST_ADC2_CHANNEL           1U      /*!< PA1 */
+#define TEST_PERIOD_CYCLES          (PWM_DEFAULT_PERIOD * 72ULL)    /*!< 1 MHz ticks */
+#define TEST_PAIRS                  (ADC_CHANNEL_GROUP_5_RESULT_SIZE / 2U)
+#define TEST_ROUNDS                 40U     /*!< Five times round the ring */
+
+#define TEST_RAW_ADC1               100U
+#define TEST_RAW_ADC2               2000U
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static volatile uint64_t Test_Cycles[2][TEST_ROUNDS + 2U];
+static volatile uint32_t Test_Count[2];
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static uint16_t Test_Source(uint8_t Channel, uint64_t Cycles);
+static void Test_StartDual(void);
+static void Test_PairsConvertedTogether(void);
+static void Test_OneWordPerPair(void);
+static void Test_ReadGroupUnpacks(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("AdcDual");
+    TestHost_Run("PairsConvertedTogether", Test_PairsConvertedTogether);
+    TestHost_Run("OneWordPerPair", Test_OneWordPerPair);
+    TestHost_Run("ReadGroupUnpacks", Test_ReadGroupUnpacks);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   Analog source: round N of a channel returns its base level + N
+ */
+static uint16_t Test_Source(uint8_t Channel, uint64_t Cycles)
+{
+    uint8_t Adc = (Channel == TEST_ADC2_CHANNEL) ? 1U : 0U;
+    uint32_t Round = Test_Count[Adc];
+
+    if (Round < (TEST_ROUNDS + 2U))
+    {
+        Test_Cycles[Adc][Round] = Cycles;
+    }
+    Test_Count[Adc]++;
+    return (uint16_t)(((Adc != 0U) ? TEST_RAW_ADC2 : TEST_RAW_ADC1) + Round);
+}
+
+/**
+ * @brief   PWM running, dual group armed on TIM1 CC2, TEST_ROUNDS pairs converted
+ */
+static void Test_StartDual(void)
+{
+    HostSim_SetAnalogSource(Test_Source);
+    Det_Init();
+    Pwm_Init(&Pwm_Config);
+    Adc_Init(&Adc_Config);
+    Adc_EnableHardwareTrigger(TEST_DUAL_GROUP);
+    TEST_ASSERT(Adc_GetGroupStatus(TEST_DUAL_GROUP) != ADC_IDLE);
+
+    HostSim_Advance(TEST_ROUNDS * TEST_PERIOD_CYCLES);
+    TEST_ASSERT_RANGE(TEST_ROUNDS - 1U, TEST_ROUNDS, Test_Count[0]);
+}
+
+/**
+ * @brief   ADC1 and ADC2 finish every pair on the same cycle, one pair per period
+ */
+static void Test_PairsConvertedTogether(void)
+{
+    uint32_t Round;
+
+    Test_StartDual();
+    TEST_ASSERT_EQ(Test_Count[0], Test_Count[1]);
+    TEST_ASSERT_EQ(Test_Count[0], HostSim_GetConversionCount(ADC1));
+    TEST_ASSERT_EQ(Test_Count[1], HostSim_GetConversionCount(ADC2));
+    for (Round = 0U; Round < Test_Count[0]; Round++)
+    {
+        TEST_ASSERT_EQ(Test_Cycles[0][Round], Test_Cycles[1][Round]);
+        if (Round > 0U)
+        {
+            TEST_ASSERT_EQ(TEST_PERIOD_CYCLES, Test_Cycles[0][Round] - Test_Cycles[0][Round - 1U]);
+        }
+    }
+    TEST_ASSERT_EQ(ADC_Mode_RegSimult, HostSim_PeekRegister(&ADC1->CR1) & ADC_CR1_DUALMOD);
+
+    TestHost_Bench("SamplesPerConversionTime", (double)(Test_Count[0] + Test_Count[1]) / Test_Count[0], "samples");
+}
+
+/**
+ * @brief   DMA moves one 32-bit word per pair, ADC1 low and ADC2 high half-word,
+ *          and interrupts only at the ring halves
+ */
+static void Test_OneWordPerPair(void)
+{
+    const volatile uint32_t* Words = (const volatile uint32_t*)Adc_Group5_ResultBuffer;
+    uint32_t Ccr;
+    uint32_t Last;
+    uint32_t Pair;
+
+    Test_StartDual();
+    Ccr = HostSim_PeekRegister(&DMA1_Channel1->CCR);
+    TEST_ASSERT_EQ(DMA_PeripheralDataSize_Word, Ccr & DMA_CCR1_PSIZE);
+    TEST_ASSERT_EQ(DMA_MemoryDataSize_Word, Ccr & DMA_CCR1_MSIZE);
+    TEST_ASSERT_EQ(TEST_PAIRS, HostSim_PeekRegister(&DMA1_Channel1->CNDTR) +
+                   (Test_Count[0] % TEST_PAIRS));
+
+    /* The ring holds the last TEST_PAIRS rounds, pair N in word N modulo the ring */
+    Last = Test_Count[0];
+    for (Pair = Last - TEST_PAIRS; Pair < Last; Pair++)
+    {
+        TEST_ASSERT_EQ(((uint32_t)(TEST_RAW_ADC2 + Pair) << 16) | (TEST_RAW_ADC1 + Pair),
+                       Words[Pair % TEST_PAIRS]);
+    }
+
+    TEST_ASSERT_EQ(0U, HostSim_GetInterruptCount(ADC1_2_IRQn));
+    TEST_ASSERT_EQ(Last / (TEST_PAIRS / 2U), HostSim_GetInterruptCount(DMA1_Channel1_IRQn));
+}
+
+/**
+ * @brief   Adc_ReadGroup unpacks the last pair ADC1 first, Adc_GetStreamLastPointer
+ *          hands out the packed pairs as they are
+ */
+static void Test_ReadGroupUnpacks(void)
+{
+    Adc_ValueGroupType Values[2] = { 0U, 0U };
+    Adc_ValueGroupType* Samples = NULL_PTR;
+    Adc_StreamNumSampleType Count;
+    Det_ErrorEntryType Entry;
+    uint32_t Last;
+
+    Test_StartDual();
+    Last = Test_Count[0] - 1U;
+    TEST_ASSERT_EQ(E_OK, Adc_ReadGroup(TEST_DUAL_GROUP, Values));
+    TEST_ASSERT_EQ(TEST_RAW_ADC1 + Last, Values[0]);
+    TEST_ASSERT_EQ(TEST_RAW_ADC2 + Last, Values[1]);
+
+    Count = Adc_GetStreamLastPointer(TEST_DUAL_GROUP, &Samples);
+    TEST_ASSERT(Count > 0U);
+    TEST_ASSERT(Samples != NULL_PTR);
+    TEST_ASSERT_EQ(Samples[0] + (TEST_RAW_ADC2 - TEST_RAW_ADC1), Samples[1]);
+    TEST_ASSERT_EQ(Samples[(2U * Count) - 2U] + (TEST_RAW_ADC2 - TEST_RAW_ADC1), Samples[(2U * Count) - 1U]);
+    TEST_ASSERT_EQ(Samples[0] + Count - 1U, Samples[(2U * Count) - 2U]);
+
+    TEST_ASSERT_EQ(0U, Det_Drain(&Entry, 1U));
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -0,0 +1,247 @@
+/****************************************************************************************
+*                                TEST_ADCINJECTED.C                                     *
+****************************************************************************************
+* File Name   : Test_AdcInjected.c
+* Module      : Host Tests (TEST)
+* Description : Injected group against a running regular DMA stream: response time
+*               of the urgent read, and a stream that loses no sample to it
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * Group 1 streams PA0 at 1 kHz from TIM3 TRGO into its DMA ring, group 3 reads PA0
+ * through the injected sequence. The requests are swept towards the end of a
+ * regular conversion, 16 cycles apart, one per stream period, so some find the ADC
+ * idle and some cut into the regular conversion.
+ *
+ * Every conversion returns its own number from the analog source, so a result
+ * names the conversion it came from. The injected read gives the conversion that
+ * served the request and its completion time, all others are the stream's. A
+ * regular conversion cut by the injected one ends without a result and starts
+ * again from its sampling phase.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+
+#include "TestHost.h"
+#include "Adc.h"
+#include "Det.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_STREAM_GROUP           1U      /*!< Circular TIM3 TRGO stream, 1 kHz */
+#define TEST_INJECTED_GROUP         3U      /*!< Injected, SW trigger */
+#define TEST_PERIOD_CYCLES          72000ULL    /*!< 1 ms at 72 MHz */
+#define TEST_MAX_RESPONSE_CYCLES    720ULL  /*!< 10 us */
+
+#define TEST_REQUESTS               32U     /*!< One per stream period */
+#define TEST_REQUEST_STEP           16U     /*!< Cycles between two request points */
+#define TEST_MAX_CONVERSIONS        128U
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static volatile uint8_t Test_InjectedDone;
+static volatile uint32_t Test_NotifiedCount;
+static volatile uint64_t Test_ConvCycles[TEST_MAX_CONVERSIONS];
+static volatile uint32_t Test_ConvCount;
+static uint8_t Test_Injected[TEST_MAX_CONVERSIONS];
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static uint16_t Test_Source(uint8_t Channel, uint64_t Cycles);
+static uint64_t Test_StartStream(void);
+static void Test_AdvanceTo(uint64_t Cycles);
+static uint64_t Test_Inject(void);
+static uint64_t Test_Sweep(void);
+static void Test_ResponseWithinLimit(void);
+static void Test_StreamKeepsEverySample(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("AdcInjected");
+    TestHost_Run("ResponseWithinLimit", Test_ResponseWithinLimit);
+    TestHost_Run("StreamKeepsEverySample", Test_StreamKeepsEverySample);
+    return TestHost_End();
+}
+
+/**
+ * @brief   Group 3 notification from JEOC, replaces the weak default of Adc_Cfg.c
+ */
+void Adc_Group4_Notification(void)
+{
+    Test_NotifiedCount = Test_ConvCount;
+    Test_InjectedDone = 1U;
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   Analog source: conversion N returns N, numbered from 1
+ */
+static uint16_t Test_Source(uint8_t Channel, uint64_t Cycles)
+{
+    (void)Channel;
+
+    if (Test_ConvCount < TEST_MAX_CONVERSIONS)
+    {
+        Test_ConvCycles[Test_ConvCount] = Cycles;
+    }
+    Test_ConvCount++;
+    return (uint16_t)Test_ConvCount;
+}
+
+/**
+ * @brief   Stream running, returns when its last conversion so far completed
+ */
+static uint64_t Test_StartStream(void)
+{
+    HostSim_SetAnalogSource(Test_Source);
+    Det_Init();
+    Adc_Init(&Adc_Config);
+    Adc_EnableGroupNotification(TEST_INJECTED_GROUP);
+    Adc_EnableHardwareTrigger(TEST_STREAM_GROUP);
+    TEST_ASSERT(Adc_GetGroupStatus(TEST_STREAM_GROUP) != ADC_IDLE);
+
+    HostSim_Advance(2U * TEST_PERIOD_CYCLES);
+    TEST_ASSERT(Test_ConvCount >= 1U);
+    return Test_ConvCycles[Test_ConvCount - 1U];
+}
+
+static void Test_AdvanceTo(uint64_t Cycles)
+{
+    uint64_t Now = HostSim_GetCycles();
+
+    TEST_ASSERT(Cycles >= Now);
+    HostSim_Advance(Cycles - Now);
+}
+
+/**
+ * @brief   One urgent read, returns the cycles from the request to the end of the
+ *          conversion that served it, the last one before the notification
+ */
+static uint64_t Test_Inject(void)
+{
+    Adc_ValueGroupType Value = 0U;
+    uint64_t Request = HostSim_GetCycles();
+    uint32_t Before = Test_ConvCount;
+
+    Test_InjectedDone = 0U;
+    Adc_StartGroupConversion(TEST_INJECTED_GROUP);
+    TEST_ASSERT(TestHost_AdvanceUntil(&Test_InjectedDone, 8U, TEST_PERIOD_CYCLES));
+
+    TEST_ASSERT_EQ(E_OK, Adc_ReadGroup(TEST_INJECTED_GROUP, &Value));
+    TEST_ASSERT_EQ(Test_NotifiedCount, Value);
+    TEST_ASSERT_RANGE(Before + 1U, TEST_MAX_CONVERSIONS, Value);
+    Test_Injected[Value - 1U] = 1U;
+    return Test_ConvCycles[Value - 1U] - Request;
+}
+
+/**
+ * @brief   TEST_REQUESTS reads, request N TEST_REQUEST_STEP x N cycles before the
+ *          N-th regular conversion ends, returns the worst response
+ */
+static uint64_t Test_Sweep(void)
+{
+    uint64_t Last = Test_StartStream();
+    uint64_t Worst = 0U;
+    uint64_t Response;
+    uint32_t Request;
+
+    for (Request = 1U; Request <= TEST_REQUESTS; Request++)
+    {
+        Test_AdvanceTo(Last + (Request * TEST_PERIOD_CYCLES) - (Request * TEST_REQUEST_STEP));
+        Response = Test_Inject();
+        TEST_ASSERT_RANGE(1U, TEST_MAX_RESPONSE_CYCLES, Response);
+        Worst = (Response > Worst) ? Response : Worst;
+    }
+    Test_AdvanceTo(Last + (TEST_REQUESTS * TEST_PERIOD_CYCLES) + (TEST_PERIOD_CYCLES / 2U));
+    return Worst;
+}
+
+/**
+ * @brief   Every request is served within 10 us, wherever it lands in the stream
+ */
+static void Test_ResponseWithinLimit(void)
+{
+    Det_ErrorEntryType Entry;
+    uint64_t Worst = Test_Sweep();
+
+    TEST_ASSERT_EQ(0U, Det_Drain(&Entry, 1U));
+    TEST_ASSERT_EQ(TEST_REQUESTS, HostSim_GetInterruptCount(ADC1_2_IRQn));
+    TestHost_Bench("WorstResponse", (double)Worst, "sim_cycles");
+    TestHost_Bench("WorstResponseUs", (double)Worst / 72.0, "us");
+}
+
+/**
+ * @brief   Same sweep: the stream keeps its trigger, DMA and one sample per period,
+ *          some of its conversions are pushed back by an injected one
+ */
+static void Test_StreamKeepsEverySample(void)
+{
+    uint64_t Expected = 0U;
+    uint64_t Delay;
+    uint64_t WorstDelay = 0U;
+    uint32_t Regular = 0U;
+    uint32_t Delayed = 0U;
+    uint32_t Idx;
+
+    (void)Test_Sweep();
+    TEST_ASSERT(Test_ConvCount <= TEST_MAX_CONVERSIONS);
+
+    /* One regular result per period, never early, late only by an injected one */
+    for (Idx = 0U; Idx < Test_ConvCount; Idx++)
+    {
+        if (Test_Injected[Idx] != 0U)
+        {
+            continue;
+        }
+        if (Regular > 0U)
+        {
+            Expected += TEST_PERIOD_CYCLES;
+            TEST_ASSERT_RANGE(Expected, Expected + TEST_MAX_RESPONSE_CYCLES, Test_ConvCycles[Idx]);
+            Delay = Test_ConvCycles[Idx] - Expected;
+            Delayed += (Delay != 0U) ? 1U : 0U;
+            WorstDelay = (Delay > WorstDelay) ? Delay : WorstDelay;
+        }
+        else
+        {
+            Expected = Test_ConvCycles[Idx];
+        }
+        Regular++;
+    }
+    TEST_ASSERT_EQ(Test_ConvCount - TEST_REQUESTS, Regular);
+    TEST_ASSERT(Delayed > 0U);
+    TEST_ASSERT(Delayed < TEST_REQUESTS);
+
+    /* Still streaming on the same trigger and DMA channel, no injected result in the ring */
+    TEST_ASSERT(Adc_GetGroupStatus(TEST_STREAM_GROUP) != ADC_IDLE);
+    TEST_ASSERT(HostSim_PeekRegister(&ADC1->CR2) & ADC_CR2_ADON);
+    TEST_ASSERT(HostSim_PeekRegister(&ADC1->CR2) & ADC_CR2_DMA);
+    TEST_ASSERT(HostSim_PeekRegister(&ADC1->CR2) & ADC_CR2_EXTTRIG);
+    TEST_ASSERT(HostSim_PeekRegister(&DMA1_Channel1->CCR) & DMA_CCR1_EN);
+    for (Idx = 0U; Idx < ADC_CHANNEL_GROUP_2_RESULT_SIZE; Idx++)
+    {
+        TEST_ASSERT_RANGE(1U, Test_ConvCount, Adc_Group2_ResultBuffer[Idx]);
+        TEST_ASSERT_EQ(0U, Test_Injected[Adc_Group2_ResultBuffer[Idx] - 1U]);
+    }
+
+    TestHost_Bench("DelayedRegular", (double)Delayed, "conversions");
+    TestHost_Bench("WorstRegularDelay", (double)WorstDelay, "sim_cycles");
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
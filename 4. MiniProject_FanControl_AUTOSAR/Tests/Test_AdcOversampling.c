@@ -0,0 +1,344 @@
+/****************************************************************************************
+*                                TEST_ADCOVERSAMPLING.C                                 *
+****************************************************************************************
+* File Name   : Test_AdcOversampling.c
+* Module      : Host Tests (TEST)
+* Description : Oversampled group: AdcHw_Decimate against a plain sum, cost per raw
+*               sample and effective resolution of the x16 group with a noisy input
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * Group 5 converts PA0 back to back and sums 16 rounds into one 14-bit result. The
+ * analog source adds gaussian noise of TEST_NOISE_LSB to a level between two codes,
+ * every conversion rounds to the nearest code. Without noise all 16 samples hold
+ * the same code and oversampling gains nothing, with it the 14-bit result gains
+ * about 2 bits over the raw samples.
+ *
+ * ENOB = bits - log2(rms_error * sqrt(12)), rms_error in LSB of the result after
+ * the mean offset is removed (the shift of AdcHw_Decimate truncates).
+ *
+ * AdcHw_Decimate touches no register, its host time is the time of the C code. It
+ * is reported per raw sample next to the half-word loop it replaces, the target
+ * cost is ADC_TIMING_DECIMATE_CYCLES until measured with Prof.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+
+#include "TestHost.h"
+#include "Adc.h"
+#include "Adc_Hw.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_GROUP                  5U      /*!< PA0 x16, continuous */
+#define TEST_CYCLES_PER_MS          72000ULL
+#define TEST_RUN_MS                 40ULL   /*!< About 730 results at 18 kHz */
+#define TEST_MIN_RESULTS            600U
+
+#define TEST_NOISE_LSB              1.0     /*!< Input noise, 1 sigma */
+#define TEST_RAW_BITS               12.0
+#define TEST_OVERSAMPLED_BITS       14.0
+#define TEST_MIN_ENOB_GAIN          1.8     /*!< log2(16) / 2 = 2 bits in theory */
+
+#define TEST_MAX_RANKS              4U
+#define TEST_MAX_ROUNDS             256U
+#define TEST_BENCH_SAMPLES          4000000UL
+
+/****************************************************************************************
+*                              LOCAL TYPES                                             *
+****************************************************************************************/
+typedef struct
+{
+    uint32_t Count;
+    double   Sum;           /*!< Of the errors */
+    double   SumSquares;    /*!< Of the errors */
+} Test_ErrorStatsType;
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static double Test_Level;                           /*!< Input in 12-bit codes */
+static uint32_t Test_Seed = 0x2545F491U;
+static Test_ErrorStatsType Test_RawStats;
+static Test_ErrorStatsType Test_ResultStats;
+
+__attribute__((aligned(4))) static Adc_ValueGroupType Test_Staging[TEST_MAX_RANKS * TEST_MAX_ROUNDS];
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static uint32_t Test_Random(void);
+static double Test_Noise(void);
+static uint16_t Test_NoisySource(uint8_t Channel, uint64_t Cycles);
+static void Test_AddError(Test_ErrorStatsType* Stats, double Error);
+static double Test_Enob(const Test_ErrorStatsType* Stats, double Bits);
+static void Test_FillStaging(uint32_t Samples);
+static void Test_ReferenceSum(Adc_ChannelType NbrOfChannel, Adc_OversamplingType Oversampling, Adc_ValueGroupType* ResultPtr);
+static double Test_DecimateNsPerSample(Adc_ChannelType NbrOfChannel, Adc_OversamplingType Oversampling);
+static void Test_DecimateMatchesSum(void);
+static void Test_EnobGain(void);
+static void Test_DecimateCost(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("AdcOversampling");
+    TestHost_Run("DecimateMatchesSum", Test_DecimateMatchesSum);
+    TestHost_Run("EnobGain", Test_EnobGain);
+    TestHost_Run("DecimateCost", Test_DecimateCost);
+    return TestHost_End();
+}
+
+/**
+ * @brief   Group 5 notification, replaces the weak default of Adc_Cfg.c
+ */
+void Adc_Group6_Notification(void)
+{
+    Adc_ValueGroupType Result;
+
+    if (Adc_ReadGroup(TEST_GROUP, &Result) == E_OK)
+    {
+        Test_AddError(&Test_ResultStats, (double)Result - (Test_Level * 4.0));
+    }
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   xorshift32, the same sequence in every run
+ */
+static uint32_t Test_Random(void)
+{
+    Test_Seed ^= Test_Seed << 13;
+    Test_Seed ^= Test_Seed >> 17;
+    Test_Seed ^= Test_Seed << 5;
+    return Test_Seed;
+}
+
+/**
+ * @brief   Close to gaussian, sum of 4 uniforms scaled to TEST_NOISE_LSB
+ */
+static double Test_Noise(void)
+{
+    double Sum = 0.0;
+    uint8_t Idx;
+
+    for (Idx = 0U; Idx < 4U; Idx++)
+    {
+        Sum += ((double)Test_Random() / 4294967296.0) - 0.5;
+    }
+    return Sum * (TEST_NOISE_LSB / sqrt(4.0 / 12.0));
+}
+
+/**
+ * @brief   Test_Level plus noise, rounded to the nearest code
+ */
+static uint16_t Test_NoisySource(uint8_t Channel, uint64_t Cycles)
+{
+    double Value = Test_Level + Test_Noise();
+    uint16_t Raw;
+
+    (void)Channel;
+    (void)Cycles;
+
+    Value = floor(Value + 0.5);
+    Raw = (Value < 0.0) ? 0U : ((Value > 4095.0) ? 4095U : (uint16_t)Value);
+    Test_AddError(&Test_RawStats, (double)Raw - Test_Level);
+    return Raw;
+}
+
+static void Test_AddError(Test_ErrorStatsType* Stats, double Error)
+{
+    Stats->Count++;
+    Stats->Sum += Error;
+    Stats->SumSquares += Error * Error;
+}
+
+/**
+ * @brief   Effective bits from the error spread, the mean offset removed
+ */
+static double Test_Enob(const Test_ErrorStatsType* Stats, double Bits)
+{
+    double Mean = Stats->Sum / Stats->Count;
+    double Variance = (Stats->SumSquares / Stats->Count) - (Mean * Mean);
+
+    return Bits - log2(sqrt(Variance) * sqrt(12.0));
+}
+
+/**
+ * @brief   Random 12-bit samples, full scale so the lanes carry as much as they can
+ */
+static void Test_FillStaging(uint32_t Samples)
+{
+    uint32_t Idx;
+
+    for (Idx = 0U; Idx < Samples; Idx++)
+    {
+        Test_Staging[Idx] = (Adc_ValueGroupType)(Test_Random() & 0x0FFFU);
+    }
+}
+
+/**
+ * @brief   One half-word at a time, the loop AdcHw_Decimate replaces
+ */
+static void Test_ReferenceSum(Adc_ChannelType NbrOfChannel, Adc_OversamplingType Oversampling, Adc_ValueGroupType* ResultPtr)
+{
+    uint32_t Rounds = 1UL << Oversampling;
+    uint8_t Shift = (uint8_t)(Oversampling - (Oversampling >> 1));
+    uint32_t Channel;
+    uint32_t Round;
+
+    for (Channel = 0U; Channel < NbrOfChannel; Channel++)
+    {
+        uint32_t Sum = 0U;
+        for (Round = 0U; Round < Rounds; Round++)
+        {
+            Sum += Test_Staging[(Round * NbrOfChannel) + Channel];
+        }
+        ResultPtr[Channel] = (Adc_ValueGroupType)(Sum >> Shift);
+    }
+}
+
+/**
+ * @brief   Host time of AdcHw_Decimate per raw sample, NbrOfChannel 0 times the reference
+ */
+static double Test_DecimateNsPerSample(Adc_ChannelType NbrOfChannel, Adc_OversamplingType Oversampling)
+{
+    Adc_ChannelType Ranks = (NbrOfChannel != 0U) ? NbrOfChannel : 1U;
+    uint32_t Samples = (uint32_t)Ranks << Oversampling;
+    uint32_t Calls = TEST_BENCH_SAMPLES / Samples;
+    volatile Adc_ValueGroupType Sink = 0U;
+    Adc_ValueGroupType Results[TEST_MAX_RANKS];
+    uint64_t Start;
+    uint32_t Call;
+
+    Test_FillStaging(Samples);
+    Start = TestHost_HostNs();
+    for (Call = 0U; Call < Calls; Call++)
+    {
+        if (NbrOfChannel != 0U)
+        {
+            AdcHw_Decimate(Test_Staging, NbrOfChannel, Oversampling, Results);
+        }
+        else
+        {
+            Test_ReferenceSum(1U, Oversampling, Results);
+        }
+        Sink = Results[0];
+    }
+    (void)Sink;
+
+    return (double)(TestHost_HostNs() - Start) / ((double)Calls * Samples);
+}
+
+/**
+ * @brief   Every rank count path and ratio gives the plain sum of full scale samples
+ */
+static void Test_DecimateMatchesSum(void)
+{
+    Adc_ValueGroupType Results[TEST_MAX_RANKS];
+    Adc_ValueGroupType Expected[TEST_MAX_RANKS];
+    Adc_ChannelType Ranks;
+    Adc_OversamplingType Oversampling;
+    uint8_t Fill;
+
+    for (Ranks = 1U; Ranks <= TEST_MAX_RANKS; Ranks++)
+    {
+        for (Oversampling = ADC_OVERSAMPLING_X4; Oversampling <= ADC_OVERSAMPLING_X256; Oversampling++)
+        {
+            for (Fill = 0U; Fill < 3U; Fill++)
+            {
+                uint32_t Idx;
+
+                Test_FillStaging((uint32_t)Ranks << Oversampling);
+                if (Fill == 1U)
+                {
+                    for (Idx = 0U; Idx < ((uint32_t)Ranks << Oversampling); Idx++)
+                    {
+                        Test_Staging[Idx] = 0x0FFFU;
+                    }
+                }
+                Test_ReferenceSum(Ranks, Oversampling, Expected);
+                AdcHw_Decimate(Test_Staging, Ranks, Oversampling, Results);
+                for (Idx = 0U; Idx < Ranks; Idx++)
+                {
+                    TEST_ASSERT_EQ(Expected[Idx], Results[Idx]);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief   The x16 group gains about 2 effective bits over its raw samples
+ */
+static void Test_EnobGain(void)
+{
+    static const double Levels[] = { 1000.3, 3000.7 };
+    double RawEnob;
+    double ResultEnob;
+    uint8_t Idx;
+
+    HostSim_SetAnalogSource(Test_NoisySource);
+    Adc_Init(&Adc_Config);
+    Adc_EnableGroupNotification(TEST_GROUP);
+
+    for (Idx = 0U; Idx < (sizeof(Levels) / sizeof(Levels[0])); Idx++)
+    {
+        Test_RawStats = (Test_ErrorStatsType){ 0 };
+        Test_ResultStats = (Test_ErrorStatsType){ 0 };
+        Test_Level = Levels[Idx];
+
+        Adc_StartGroupConversion(TEST_GROUP);
+        HostSim_Advance(TEST_RUN_MS * TEST_CYCLES_PER_MS);
+        Adc_StopGroupConversion(TEST_GROUP);
+        TEST_ASSERT(Test_ResultStats.Count >= TEST_MIN_RESULTS);
+
+        RawEnob = Test_Enob(&Test_RawStats, TEST_RAW_BITS);
+        ResultEnob = Test_Enob(&Test_ResultStats, TEST_OVERSAMPLED_BITS);
+        TEST_ASSERT((ResultEnob - RawEnob) >= TEST_MIN_ENOB_GAIN);
+
+        /* Mean within one 14-bit code, the level sits between two raw codes */
+        TEST_ASSERT(fabs(Test_ResultStats.Sum / Test_ResultStats.Count) < 1.0);
+
+        if (Idx == 0U)
+        {
+            TestHost_Bench("RawEnob", RawEnob, "bits");
+            TestHost_Bench("OversampledX16Enob", ResultEnob, "bits");
+        }
+    }
+}
+
+/**
+ * @brief   Host time per raw sample of each AdcHw_Decimate path and of the plain sum
+ */
+static void Test_DecimateCost(void)
+{
+    double Reference = Test_DecimateNsPerSample(0U, ADC_OVERSAMPLING_X256);
+    double OneRank = Test_DecimateNsPerSample(1U, ADC_OVERSAMPLING_X256);
+
+    TestHost_Bench("DecimateOneRankX16", Test_DecimateNsPerSample(1U, ADC_OVERSAMPLING_X16), "host_ns_per_sample");
+    TestHost_Bench("DecimateOneRankX256", OneRank, "host_ns_per_sample");
+    TestHost_Bench("DecimateTwoRanksX256", Test_DecimateNsPerSample(2U, ADC_OVERSAMPLING_X256), "host_ns_per_sample");
+    TestHost_Bench("DecimateThreeRanksX256", Test_DecimateNsPerSample(3U, ADC_OVERSAMPLING_X256), "host_ns_per_sample");
+    TestHost_Bench("HalfWordSumX256", Reference, "host_ns_per_sample");
+
+    /* Two samples per load against one */
+    TEST_ASSERT(OneRank < Reference);
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -0,0 +1,349 @@
+/****************************************************************************************
+*                                TEST_ADCSTREAM.C                                       *
+****************************************************************************************
+* File Name   : Test_AdcStream.c
+* Module      : Host Tests (TEST)
+* Description : Ping-pong streaming of a circular DMA group: one notification per
+*               buffer half, a handed out half that DMA does not touch and a sample
+*               period set by the trigger timer alone, or by the PWM sample point
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * Group 1 streams PA0 into a 16-sample circular buffer on TIM3 TRGO at 1 kHz,
+ * so each half of 8 samples is finished every 8 ms, by HT then by TC.
+ *
+ * The rate case timestamps every conversion from the analog source, which the model
+ * calls when the conversion completes. One TRGO starts one conversion, so equal
+ * intervals between timestamps are the period of TIM3, with no CPU in the path.
+ * Group 3 is paced by TIM1 CC2 instead, the compare Pwm places in the fan period, so
+ * its timestamps modulo the PWM period give the sample point.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+
+#include "TestHost.h"
+#include "Adc.h"
+#include "Pwm.h"
+#include "Det.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_GROUP                  1U      /*!< Circular TIM3 TRGO stream */
+#define TEST_TEMP_CHANNEL           0U      /*!< PA0 */
+#define TEST_CYCLES_PER_MS          72000ULL
+#define TEST_HALF_SAMPLES           (ADC_CHANNEL_GROUP_2_RESULT_SIZE / 2U)
+#define TEST_HALF_MS                8ULL    /*!< TEST_HALF_SAMPLES at 1 kHz */
+#define TEST_HALVES                 10U
+
+#define TEST_RAW_FIRST              1000U
+#define TEST_RAW_SECOND             2000U
+
+#define TEST_RATE_SAMPLES           24U     /*!< Timestamps per rate */
+#define TEST_FAST_RATE_HZ           2000U   /*!< Rate set at run time */
+
+#define TEST_SW_GROUP               0U      /*!< One-shot, software trigger */
+#define TEST_PWM_GROUP              2U      /*!< Circular TIM1 CC2 stream */
+#define TEST_PWM_PERIOD_CYCLES      (PWM_DEFAULT_PERIOD * 72ULL)    /*!< 1 MHz ticks */
+#define TEST_OFFSET_HALF            0x4000U /*!< 50 % of the period */
+#define TEST_DUTY_HIGH              0x7000U /*!< 87.5 %, moves both PA8 edges */
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static volatile uint8_t Test_HalfDone;
+static volatile uint32_t Test_NotifyCount;
+static volatile uint64_t Test_SampleCycles[TEST_RATE_SAMPLES];
+static volatile uint32_t Test_SampleCount;
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void Test_StartStream(uint16_t Raw);
+static void Test_WaitHalf(void);
+static void Test_CheckHalf(Adc_ValueGroupType* Expected, uint16_t Raw);
+static void Test_OneNotificationPerHalf(void);
+static void Test_HalvesAlternate(void);
+static void Test_StableHalfNotOverwritten(void);
+static uint16_t Test_StampSample(uint8_t Channel, uint64_t Cycles);
+static void Test_CheckPeriod(uint64_t Period);
+static void Test_SamplePeriodFromTimer(void);
+static uint64_t Test_SamplePhase(void);
+static void Test_SamplePointFollowsOffset(void);
+static void Test_CheckRejected(uint8 ErrorId);
+static void Test_SetTriggerTimerRejects(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("AdcStream");
+    TestHost_Run("OneNotificationPerHalf", Test_OneNotificationPerHalf);
+    TestHost_Run("HalvesAlternate", Test_HalvesAlternate);
+    TestHost_Run("StableHalfNotOverwritten", Test_StableHalfNotOverwritten);
+    TestHost_Run("SamplePeriodFromTimer", Test_SamplePeriodFromTimer);
+    TestHost_Run("SamplePointFollowsOffset", Test_SamplePointFollowsOffset);
+    TestHost_Run("SetTriggerTimerRejects", Test_SetTriggerTimerRejects);
+    return TestHost_End();
+}
+
+/**
+ * @brief   Group 1 notification, replaces the weak default of Adc_Cfg.c
+ */
+void Adc_Group2_Notification(void)
+{
+    Test_NotifyCount++;
+    Test_HalfDone = 1U;
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+static void Test_StartStream(uint16_t Raw)
+{
+    HostSim_SetAnalogInput(TEST_TEMP_CHANNEL, Raw);
+    Adc_Init(&Adc_Config);
+    Adc_EnableGroupNotification(TEST_GROUP);
+    Adc_EnableHardwareTrigger(TEST_GROUP);
+    TEST_ASSERT(Adc_GetGroupStatus(TEST_GROUP) != ADC_IDLE);
+}
+
+/**
+ * @brief   Run until the next half is finished, checked every millisecond
+ */
+static void Test_WaitHalf(void)
+{
+    Test_HalfDone = 0U;
+    TEST_ASSERT(TestHost_AdvanceUntil(&Test_HalfDone, TEST_CYCLES_PER_MS, (TEST_HALF_MS + 2U) * TEST_CYCLES_PER_MS));
+}
+
+/**
+ * @brief   The handed out half starts at Expected and holds Raw only
+ */
+static void Test_CheckHalf(Adc_ValueGroupType* Expected, uint16_t Raw)
+{
+    Adc_ValueGroupType* Samples = NULL_PTR;
+    uint8_t Idx;
+
+    TEST_ASSERT_EQ(TEST_HALF_SAMPLES, Adc_GetStreamLastPointer(TEST_GROUP, &Samples));
+    TEST_ASSERT(Samples == Expected);
+    for (Idx = 0U; Idx < TEST_HALF_SAMPLES; Idx++)
+    {
+        TEST_ASSERT_EQ(Raw, Samples[Idx]);
+    }
+}
+
+/**
+ * @brief   HT and TC each notify once, no per-sample interrupt
+ */
+static void Test_OneNotificationPerHalf(void)
+{
+    uint8_t Half;
+
+    Test_StartStream(TEST_RAW_FIRST);
+    TEST_ASSERT(HostSim_PeekRegister(&DMA1_Channel1->CCR) & DMA_CCR1_HTIE);
+    TEST_ASSERT(HostSim_PeekRegister(&DMA1_Channel1->CCR) & DMA_CCR1_TCIE);
+
+    for (Half = 0U; Half < TEST_HALVES; Half++)
+    {
+        Test_WaitHalf();
+    }
+
+    TEST_ASSERT_EQ(TEST_HALVES, Test_NotifyCount);
+    TEST_ASSERT_EQ(TEST_HALVES, HostSim_GetInterruptCount(DMA1_Channel1_IRQn));
+    TEST_ASSERT_EQ(0U, HostSim_GetInterruptCount(ADC1_2_IRQn));
+    TEST_ASSERT_EQ(TEST_HALVES * TEST_HALF_SAMPLES, HostSim_GetConversionCount(ADC1));
+}
+
+/**
+ * @brief   Adc_GetStreamLastPointer hands out the first half after HT, the second after TC
+ */
+static void Test_HalvesAlternate(void)
+{
+    uint8_t Half;
+
+    Test_StartStream(TEST_RAW_FIRST);
+    for (Half = 0U; Half < TEST_HALVES; Half++)
+    {
+        Test_WaitHalf();
+        Test_CheckHalf(&Adc_Group2_ResultBuffer[((Half & 1U) != 0U) ? TEST_HALF_SAMPLES : 0U], TEST_RAW_FIRST);
+    }
+}
+
+/**
+ * @brief   The consumer half keeps its samples while DMA fills the other one
+ */
+static void Test_StableHalfNotOverwritten(void)
+{
+    Test_StartStream(TEST_RAW_FIRST);
+    Test_WaitHalf();
+
+    /* New level from here on, only the second half may see it */
+    HostSim_SetAnalogInput(TEST_TEMP_CHANNEL, TEST_RAW_SECOND);
+    HostSim_Advance((TEST_HALF_MS - 1U) * TEST_CYCLES_PER_MS);
+    TEST_ASSERT_EQ(1U, Test_NotifyCount);
+    Test_CheckHalf(&Adc_Group2_ResultBuffer[0], TEST_RAW_FIRST);
+
+    /* TC: the second half is complete and entirely new */
+    Test_WaitHalf();
+    Test_CheckHalf(&Adc_Group2_ResultBuffer[TEST_HALF_SAMPLES], TEST_RAW_SECOND);
+}
+
+/**
+ * @brief   Analog source: record when each conversion completes
+ */
+static uint16_t Test_StampSample(uint8_t Channel, uint64_t Cycles)
+{
+    (void)Channel;
+
+    if (Test_SampleCount < TEST_RATE_SAMPLES)
+    {
+        Test_SampleCycles[Test_SampleCount] = Cycles;
+        Test_SampleCount++;
+    }
+    return TEST_RAW_FIRST;
+}
+
+/**
+ * @brief   Take TEST_RATE_SAMPLES timestamps, every interval is Period exactly
+ */
+static void Test_CheckPeriod(uint64_t Period)
+{
+    uint32_t Idx;
+
+    Test_SampleCount = 0U;
+    HostSim_Advance((TEST_RATE_SAMPLES + 1U) * Period);
+    TEST_ASSERT_EQ(TEST_RATE_SAMPLES, Test_SampleCount);
+    for (Idx = 1U; Idx < TEST_RATE_SAMPLES; Idx++)
+    {
+        TEST_ASSERT_EQ(Period, Test_SampleCycles[Idx] - Test_SampleCycles[Idx - 1U]);
+    }
+}
+
+/**
+ * @brief   The configured 1 kHz and a rate set at run time are held to the cycle,
+ *          and no interrupt is taken per sample
+ */
+static void Test_SamplePeriodFromTimer(void)
+{
+    uint32_t Conversions;
+    uint32_t DmaIrqs;
+
+    HostSim_SetAnalogSource(Test_StampSample);
+    Test_StartStream(TEST_RAW_FIRST);
+    Test_CheckPeriod(TEST_CYCLES_PER_MS);
+    TEST_ASSERT_EQ(0U, HostSim_GetInterruptCount(ADC1_2_IRQn));
+
+    Adc_SetHwTriggerTimer(TEST_GROUP, ADC_HW_TRIGGER_PERIOD(TEST_FAST_RATE_HZ));
+    HostSim_Advance(TEST_CYCLES_PER_MS);
+    Conversions = HostSim_GetConversionCount(ADC1);
+    DmaIrqs = HostSim_GetInterruptCount(DMA1_Channel1_IRQn);
+    Test_CheckPeriod((TEST_CYCLES_PER_MS * 1000U) / TEST_FAST_RATE_HZ);
+
+    /* Only the DMA half and full transfer interrupts, one per TEST_HALF_SAMPLES */
+    TEST_ASSERT_EQ(0U, HostSim_GetInterruptCount(ADC1_2_IRQn));
+    TEST_ASSERT_RANGE((HostSim_GetConversionCount(ADC1) - Conversions) / TEST_HALF_SAMPLES,
+                      ((HostSim_GetConversionCount(ADC1) - Conversions) / TEST_HALF_SAMPLES) + 1U,
+                      HostSim_GetInterruptCount(DMA1_Channel1_IRQn) - DmaIrqs);
+}
+
+/**
+ * @brief   One conversion per PWM period, position of the conversions in the period
+ */
+static uint64_t Test_SamplePhase(void)
+{
+    /* The compare is preloaded, let the update event apply it first */
+    HostSim_Advance(2U * TEST_PWM_PERIOD_CYCLES);
+    Test_CheckPeriod(TEST_PWM_PERIOD_CYCLES);
+    return Test_SampleCycles[0] % TEST_PWM_PERIOD_CYCLES;
+}
+
+/**
+ * @brief   The sample point moves with Pwm_SetAdcTriggerOffset, by the same fraction
+ *          of the period, and stays put when the duty cycle changes
+ */
+static void Test_SamplePointFollowsOffset(void)
+{
+    uint64_t Phase;
+
+    HostSim_SetAnalogSource(Test_StampSample);
+    Pwm_Init(&Pwm_Config);
+    Adc_Init(&Adc_Config);
+    Adc_EnableHardwareTrigger(TEST_PWM_GROUP);
+    TEST_ASSERT(Adc_GetGroupStatus(TEST_PWM_GROUP) != ADC_IDLE);
+    Phase = Test_SamplePhase();
+
+    /* 75 % to 50 %: a quarter period earlier */
+    Pwm_SetAdcTriggerOffset(PWM_CHANNEL_0, TEST_OFFSET_HALF);
+    TEST_ASSERT_EQ((Phase + TEST_PWM_PERIOD_CYCLES - (TEST_PWM_PERIOD_CYCLES / 4U)) % TEST_PWM_PERIOD_CYCLES,
+                   Test_SamplePhase());
+    Phase = Test_SamplePhase();
+
+    Pwm_SetDutyCycle(PWM_CHANNEL_0, TEST_DUTY_HIGH);
+    TEST_ASSERT_EQ(Phase, Test_SamplePhase());
+    TEST_ASSERT_EQ(0U, HostSim_GetInterruptCount(ADC1_2_IRQn));
+}
+
+/**
+ * @brief   Exactly one Det entry since the last drain, from Adc_SetHwTriggerTimer
+ */
+static void Test_CheckRejected(uint8 ErrorId)
+{
+    Det_ErrorEntryType Entries[2];
+
+    TEST_ASSERT_EQ(1U, Det_Drain(Entries, 2U));
+    TEST_ASSERT_EQ(ADC_MODULE_ID, Entries[0].ModuleId);
+    TEST_ASSERT_EQ(ADC_SET_HW_TRIGGER_TIMER_ID, Entries[0].ApiId);
+    TEST_ASSERT_EQ(ErrorId, Entries[0].ErrorId);
+}
+
+/**
+ * @brief   Adc_SetHwTriggerTimer before Adc_Init, on an unknown group, with a period
+ *          the timer cannot hold and on a group without its own timer: one Det error
+ *          each, and the running stream keeps its period
+ */
+static void Test_SetTriggerTimerRejects(void)
+{
+    Det_ErrorEntryType Entry;
+
+    Det_Init();
+    Adc_SetHwTriggerTimer(TEST_GROUP, ADC_HW_TRIGGER_PERIOD(TEST_FAST_RATE_HZ));
+    Test_CheckRejected(ADC_E_UNINIT);
+
+    HostSim_SetAnalogSource(Test_StampSample);
+    Test_StartStream(TEST_RAW_FIRST);
+    TEST_ASSERT_EQ(0U, Det_Drain(&Entry, 1U));
+
+    Adc_SetHwTriggerTimer(ADC_MAX_GROUPS, ADC_HW_TRIGGER_PERIOD(TEST_FAST_RATE_HZ));
+    Test_CheckRejected(ADC_E_PARAM_INVALID_GROUP);
+    Adc_SetHwTriggerTimer(TEST_GROUP, ADC_HW_TRIGGER_TIMER_MIN - 1U);
+    Test_CheckRejected(ADC_E_PARAM_CONFIG);
+    Adc_SetHwTriggerTimer(TEST_GROUP, ADC_HW_TRIGGER_TIMER_MAX + 1U);
+    Test_CheckRejected(ADC_E_PARAM_CONFIG);
+    Adc_SetHwTriggerTimer(TEST_SW_GROUP, ADC_HW_TRIGGER_PERIOD(TEST_FAST_RATE_HZ));
+    Test_CheckRejected(ADC_E_WRONG_TRIGG_SRC);
+    Adc_SetHwTriggerTimer(TEST_PWM_GROUP, ADC_HW_TRIGGER_PERIOD(TEST_FAST_RATE_HZ));
+    Test_CheckRejected(ADC_E_WRONG_TRIGG_SRC);
+
+    TEST_ASSERT_EQ(ADC_HW_TRIGGER_PERIOD(1000U) - 1U, HostSim_PeekRegister(&TIM3->ARR));
+    Test_CheckPeriod(TEST_CYCLES_PER_MS);
+
+    /* The limits themselves are accepted */
+    Adc_SetHwTriggerTimer(TEST_GROUP, ADC_HW_TRIGGER_TIMER_MAX);
+    TEST_ASSERT_EQ(ADC_HW_TRIGGER_TIMER_MAX - 1U, HostSim_PeekRegister(&TIM3->ARR));
+    Adc_SetHwTriggerTimer(TEST_GROUP, ADC_HW_TRIGGER_TIMER_MIN);
+    TEST_ASSERT_EQ(ADC_HW_TRIGGER_TIMER_MIN - 1U, HostSim_PeekRegister(&TIM3->ARR));
+    TEST_ASSERT_EQ(0U, Det_Drain(&Entry, 1U));
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
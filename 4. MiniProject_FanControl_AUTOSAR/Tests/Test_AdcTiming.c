@@ -0,0 +1,101 @@
+/****************************************************************************************
+*                                TEST_ADCTIMING.C                                       *
+****************************************************************************************
+* File Name   : Test_AdcTiming.c
+* Module      : Host Tests (TEST)
+* Description : Timing model of the configured groups: one-shot software groups are
+*               on demand, the load of the others follows their handler cost
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+
+#include "TestHost.h"
+#include "Adc.h"
+#include "Adc_Timing.h"
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static boolean Test_IsOneShotSw(Adc_GroupType Group);
+static void Test_OneShotSwGroupsOnDemand(void);
+static void Test_LoadFollowsHandlerCost(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("AdcTiming");
+    TestHost_Run("OneShotSwGroupsOnDemand", Test_OneShotSwGroupsOnDemand);
+    TestHost_Run("LoadFollowsHandlerCost", Test_LoadFollowsHandlerCost);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+static boolean Test_IsOneShotSw(Adc_GroupType Group)
+{
+    return ((Adc_GroupConfig[Group].Adc_TriggerSource == ADC_TRIGG_SRC_SW) &&
+            (Adc_GroupConfig[Group].Adc_GroupConvMode == ADC_CONV_MODE_ONESHOT)) ? TRUE : FALSE;
+}
+
+/**
+ * @brief   Groups 0 and 3 have no load figure but keep their cost per round
+ */
+static void Test_OneShotSwGroupsOnDemand(void)
+{
+    Adc_GroupTimingType Timing;
+    Adc_GroupType Group;
+    uint8_t OnDemandGroups = 0U;
+
+    Adc_Init(&Adc_Config);
+    for (Group = 0; Group < ADC_GROUP_CONFIG_SIZE; Group++)
+    {
+        TEST_ASSERT_EQ(E_OK, Adc_TimingGetGroupTiming(Group, &Timing));
+        TEST_ASSERT_EQ(Test_IsOneShotSw(Group), Timing.OnDemand);
+        TEST_ASSERT(Timing.IsrCyclesPerRound != 0U);
+        if (Timing.OnDemand == TRUE)
+        {
+            TEST_ASSERT_EQ(0U, Timing.CpuLoadPermille);
+            OnDemandGroups++;
+        }
+    }
+    TEST_ASSERT_EQ(2U, OnDemandGroups);
+}
+
+/**
+ * @brief   Load of every periodic group is its handler cost per round over the round
+ */
+static void Test_LoadFollowsHandlerCost(void)
+{
+    Adc_GroupTimingType Timing;
+    Adc_GroupType Group;
+
+    Adc_Init(&Adc_Config);
+    for (Group = 0; Group < ADC_GROUP_CONFIG_SIZE; Group++)
+    {
+        uint32_t Expected;
+
+        if (Test_IsOneShotSw(Group) == TRUE)
+        {
+            continue;
+        }
+
+        TEST_ASSERT_EQ(E_OK, Adc_TimingGetGroupTiming(Group, &Timing));
+        Expected = (uint32_t)(((uint64_t)Timing.IsrCyclesPerRound * 1000U) / Timing.RoundCycles);
+        TEST_ASSERT_RANGE((Expected > 0U) ? (Expected - 1U) : 0U, Expected + 1U, Timing.CpuLoadPermille);
+        TEST_ASSERT(Timing.CpuLoadPermille < 1000U);
+    }
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -0,0 +1,224 @@
+/****************************************************************************************
+*                                TEST_APP.C                                             *
+****************************************************************************************
+* File Name   : Test_App.c
+* Module      : Host Tests (TEST)
+* Description : Fan application end to end on the simulated MCU, the README test cases
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * The application main() runs as HostSim_AppMain until the stop time, the stop
+ * function checks the fan PWM on TIM1 CH1 and the LED on PC13 (active low).
+ * Sensor levels are raw PA0 counts, the thresholds in main.c are 1500 and 2500.
+ * The monitor stall case plays the scheduler itself and stops the TIM3 trigger of
+ * the monitor stream, which is how a dead conversion stream is produced.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "TestHost.h"
+#include "IoHwAb.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_TEMP_CHANNEL           0U      /*!< PA0 */
+#define TEST_LED_PIN                13U     /*!< PC13 */
+#define TEST_CYCLES_PER_MS          72000ULL
+#define TEST_STEP_MS                500ULL
+#define TEST_TASK_MS                10U     /*!< IoHwAb and application task period */
+#define TEST_HALF_MS                400U    /*!< Monitor half buffer, 8 samples at 20 Hz */
+
+#define TEST_RAW_LOW                1000U   /*!< Band 0, fan off */
+#define TEST_RAW_MEDIUM             2100U   /*!< Band 1, fan 50 % */
+#define TEST_RAW_HIGH               3000U   /*!< Band 2, fan 100 % */
+
+/****************************************************************************************
+*                              EXTERNAL FUNCTIONS                                      *
+****************************************************************************************/
+int HostSim_AppMain(void);
+void Application_Init(void);
+void Application_MainFunction(void);
+
+/****************************************************************************************
+*                              LOCAL TYPES                                             *
+****************************************************************************************/
+typedef struct
+{
+    uint16_t Raw;               /*!< PA0 level during the step */
+    uint32_t DutyPermille;      /*!< Expected fan duty at the end of the step */
+    uint8_t  LedOn;             /*!< Expected LED state at the end of the step */
+} Test_StepType;
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static const Test_StepType* Test_Steps;
+static uint8_t Test_NbrOfSteps;
+static uint8_t Test_StepIdx;
+
+static const Test_StepType Test_LowSteps[] = { { TEST_RAW_LOW, 0U, 0U } };
+static const Test_StepType Test_MediumSteps[] = { { TEST_RAW_MEDIUM, 500U, 1U } };
+static const Test_StepType Test_HighSteps[] = { { TEST_RAW_HIGH, 1000U, 1U } };
+static const Test_StepType Test_SweepSteps[] =
+{
+    { TEST_RAW_LOW,    0U,    0U },
+    { TEST_RAW_MEDIUM, 500U,  1U },
+    { TEST_RAW_HIGH,   1000U, 1U },
+    { TEST_RAW_LOW,    0U,    0U },
+};
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void Test_RunSteps(const Test_StepType* Steps, uint8_t NbrOfSteps);
+static void Test_CheckStep(void);
+static void Test_FanOffBelowLow(void);
+static void Test_FanHalfInMedium(void);
+static void Test_FanFullInHigh(void);
+static void Test_FanFollowsSweep(void);
+static void Test_RunTasks(uint32_t Ms);
+static uint32_t Test_DutyPermille(void);
+static void Test_FanFullWhenMonitorStops(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("App");
+    TestHost_Run("FanOffBelowLow", Test_FanOffBelowLow);
+    TestHost_Run("FanHalfInMedium", Test_FanHalfInMedium);
+    TestHost_Run("FanFullInHigh", Test_FanFullInHigh);
+    TestHost_Run("FanFollowsSweep", Test_FanFollowsSweep);
+    TestHost_Run("FanFullWhenMonitorStops", Test_FanFullWhenMonitorStops);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   Boot the application, one step every TEST_STEP_MS
+ */
+static void Test_RunSteps(const Test_StepType* Steps, uint8_t NbrOfSteps)
+{
+    Test_Steps = Steps;
+    Test_NbrOfSteps = NbrOfSteps;
+    Test_StepIdx = 0U;
+
+    HostSim_SetAnalogInput(TEST_TEMP_CHANNEL, Steps[0].Raw);
+    HostSim_SetStopTime(TEST_STEP_MS * TEST_CYCLES_PER_MS, Test_CheckStep);
+    (void)HostSim_AppMain();
+
+    /* Sch_Start only returns when the tick could not be started */
+    TEST_ASSERT(0);
+}
+
+/**
+ * @brief   Stop function: check the outputs, then move to the next step or end
+ */
+static void Test_CheckStep(void)
+{
+    const Test_StepType* Step = &Test_Steps[Test_StepIdx];
+    uint32_t Arr = HostSim_PeekRegister(&TIM1->ARR) & 0xFFFFU;
+    uint32_t Ccr = HostSim_PeekRegister(&TIM1->CCR1) & 0xFFFFU;
+    uint32_t LedLevel = (HostSim_PeekRegister(&GPIOC->ODR) >> TEST_LED_PIN) & 1U;
+
+    TEST_ASSERT_EQ(Step->DutyPermille, (Ccr * 1000U) / (Arr + 1U));
+    TEST_ASSERT_EQ(Step->LedOn, LedLevel ^ 1U);
+
+    Test_StepIdx++;
+    if (Test_StepIdx == Test_NbrOfSteps)
+    {
+        _exit(EXIT_SUCCESS);
+    }
+
+    HostSim_SetAnalogInput(TEST_TEMP_CHANNEL, Test_Steps[Test_StepIdx].Raw);
+    HostSim_SetStopTime(HostSim_GetCycles() + (TEST_STEP_MS * TEST_CYCLES_PER_MS), Test_CheckStep);
+}
+
+static void Test_FanOffBelowLow(void)
+{
+    Test_RunSteps(Test_LowSteps, 1U);
+}
+
+static void Test_FanHalfInMedium(void)
+{
+    Test_RunSteps(Test_MediumSteps, 1U);
+}
+
+static void Test_FanFullInHigh(void)
+{
+    Test_RunSteps(Test_HighSteps, 1U);
+}
+
+/**
+ * @brief   README test case 4: low, medium, high and back to low
+ */
+static void Test_FanFollowsSweep(void)
+{
+    Test_RunSteps(Test_SweepSteps, (uint8_t)(sizeof(Test_SweepSteps) / sizeof(Test_SweepSteps[0])));
+}
+
+/**
+ * @brief   Both tasks once per TEST_TASK_MS for Ms
+ */
+static void Test_RunTasks(uint32_t Ms)
+{
+    uint32_t Elapsed;
+
+    for (Elapsed = 0U; Elapsed < Ms; Elapsed += TEST_TASK_MS)
+    {
+        HostSim_Advance(TEST_TASK_MS * TEST_CYCLES_PER_MS);
+        IoHwAb_MainFunction();
+        Application_MainFunction();
+    }
+}
+
+static uint32_t Test_DutyPermille(void)
+{
+    uint32_t Arr = HostSim_PeekRegister(&TIM1->ARR) & 0xFFFFU;
+    uint32_t Ccr = HostSim_PeekRegister(&TIM1->CCR1) & 0xFFFFU;
+
+    return (Ccr * 1000U) / (Arr + 1U);
+}
+
+/**
+ * @brief   A silent monitor stream drives the fan to full speed after
+ *          IOHWAB_TEMP_STALE_MS, never while it runs, and the band is back once
+ *          the stream resumes
+ */
+static void Test_FanFullWhenMonitorStops(void)
+{
+    HostSim_SetAnalogInput(TEST_TEMP_CHANNEL, TEST_RAW_LOW);
+    Application_Init();
+
+    /* In band for longer than the stale time, the watchdog stays quiet */
+    Test_RunTasks(IOHWAB_TEMP_STALE_MS + TEST_HALF_MS);
+    TEST_ASSERT_EQ(0U, Test_DutyPermille());
+    TEST_ASSERT_EQ(0U, HostSim_GetInterruptCount(ADC1_2_IRQn));
+
+    /* The last half may have been done up to TEST_HALF_MS before the stop */
+    TIM3->CR1 &= ~TIM_CR1_CEN;
+    Test_RunTasks(IOHWAB_TEMP_STALE_MS - TEST_HALF_MS - TEST_TASK_MS);
+    TEST_ASSERT_EQ(0U, Test_DutyPermille());
+    Test_RunTasks(TEST_HALF_MS + TEST_TASK_MS);
+    TEST_ASSERT_EQ(1000U, Test_DutyPermille());
+
+    TIM3->CR1 |= TIM_CR1_CEN;
+    Test_RunTasks(TEST_HALF_MS + (2U * TEST_TASK_MS));
+    TEST_ASSERT_EQ(0U, Test_DutyPermille());
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -0,0 +1,269 @@
+/****************************************************************************************
+*                                TEST_DET.C                                             *
+****************************************************************************************
+* File Name   : Test_Det.c
+* Module      : Host Tests (TEST)
+* Description : Det error ring: recorded fields, per-error and overflow counters,
+*               drain order across a wrapped ring, and the cost of a report
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * Reports are made by hand with the module ID carrying a running number, so a
+ * drained entry names the report it came from. On the host build the timestamp is
+ * Prof_GetCycles(), nanoseconds of host time truncated to 32 bits.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+
+#include "TestHost.h"
+#include "Det.h"
+#include "Prof.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_MODULE_BASE            0x100U
+#define TEST_INSTANCE               3U
+#define TEST_API                    0x21U
+#define TEST_ERROR                  0x0AU
+#define TEST_LAST_COUNTER           (DET_NBR_OF_ERROR_COUNTERS - 1U)
+#define TEST_LOST                   5U      /*!< Reports past a full ring */
+#define TEST_MAX_STAMP_NS           1000000000UL
+#define TEST_BENCH_REPORTS          100000U
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void Test_Report(uint32_t First, uint32_t Count);
+static void Test_CheckDrained(const Det_ErrorEntryType* Entries, uint32_t Count, uint32_t First);
+static void Test_EntryHoldsReport(void);
+static void Test_CountersPerError(void);
+static void Test_DrainKeepsOrder(void);
+static void Test_FullRingOverwritesOldest(void);
+static void Test_ReportCost(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("Det");
+    TestHost_Run("EntryHoldsReport", Test_EntryHoldsReport);
+    TestHost_Run("CountersPerError", Test_CountersPerError);
+    TestHost_Run("DrainKeepsOrder", Test_DrainKeepsOrder);
+    TestHost_Run("FullRingOverwritesOldest", Test_FullRingOverwritesOldest);
+    TestHost_Run("ReportCost", Test_ReportCost);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   Reports First .. First + Count - 1, the number in the module ID
+ */
+static void Test_Report(uint32_t First, uint32_t Count)
+{
+    uint32_t Report;
+
+    for (Report = First; Report < (First + Count); Report++)
+    {
+        TEST_ASSERT_EQ(E_OK, Det_ReportError((uint16)(TEST_MODULE_BASE + Report), TEST_INSTANCE,
+                                             TEST_API, TEST_ERROR));
+    }
+}
+
+/**
+ * @brief   Entries are reports First, First + 1, ... with their timestamps in order
+ */
+static void Test_CheckDrained(const Det_ErrorEntryType* Entries, uint32_t Count, uint32_t First)
+{
+    uint32_t Idx;
+
+    for (Idx = 0U; Idx < Count; Idx++)
+    {
+        TEST_ASSERT_EQ(TEST_MODULE_BASE + First + Idx, Entries[Idx].ModuleId);
+        TEST_ASSERT_EQ(TEST_ERROR, Entries[Idx].ErrorId);
+        if (Idx > 0U)
+        {
+            TEST_ASSERT((uint32_t)(Entries[Idx].Timestamp - Entries[Idx - 1U].Timestamp) < TEST_MAX_STAMP_NS);
+        }
+    }
+}
+
+/**
+ * @brief   Module, instance, API, error, kind and timestamp of each report service
+ */
+static void Test_EntryHoldsReport(void)
+{
+    Det_ErrorEntryType Entries[4];
+    uint32_t Before;
+    uint32_t After;
+
+    Det_Init();
+    Before = Prof_GetCycles();
+    TEST_ASSERT_EQ(E_OK, Det_ReportError(0x7BU, 1U, 0x02U, 0x14U));
+    TEST_ASSERT_EQ(E_OK, Det_ReportRuntimeError(0x7CU, 2U, 0x03U, 0x15U));
+    TEST_ASSERT_EQ(E_OK, Det_ReportTransientFault(0x7DU, 0xFFU, 0xFFU, 0xFFU));
+    After = Prof_GetCycles();
+
+    TEST_ASSERT_EQ(3U, Det_Drain(Entries, 4U));
+    TEST_ASSERT_EQ(0x7BU, Entries[0].ModuleId);
+    TEST_ASSERT_EQ(1U, Entries[0].InstanceId);
+    TEST_ASSERT_EQ(0x02U, Entries[0].ApiId);
+    TEST_ASSERT_EQ(0x14U, Entries[0].ErrorId);
+    TEST_ASSERT_EQ(DET_KIND_DEVELOPMENT, Entries[0].Kind);
+    TEST_ASSERT_EQ(0x7CU, Entries[1].ModuleId);
+    TEST_ASSERT_EQ(2U, Entries[1].InstanceId);
+    TEST_ASSERT_EQ(0x03U, Entries[1].ApiId);
+    TEST_ASSERT_EQ(0x15U, Entries[1].ErrorId);
+    TEST_ASSERT_EQ(DET_KIND_RUNTIME, Entries[1].Kind);
+    TEST_ASSERT_EQ(0x7DU, Entries[2].ModuleId);
+    TEST_ASSERT_EQ(0xFFU, Entries[2].InstanceId);
+    TEST_ASSERT_EQ(0xFFU, Entries[2].ApiId);
+    TEST_ASSERT_EQ(0xFFU, Entries[2].ErrorId);
+    TEST_ASSERT_EQ(DET_KIND_TRANSIENT, Entries[2].Kind);
+
+    /* Stamped between the two reads, in report order, uint32 wrap allowed */
+    TEST_ASSERT((uint32_t)(Entries[0].Timestamp - Before) <= (uint32_t)(Entries[1].Timestamp - Before));
+    TEST_ASSERT((uint32_t)(Entries[1].Timestamp - Before) <= (uint32_t)(Entries[2].Timestamp - Before));
+    TEST_ASSERT((uint32_t)(Entries[2].Timestamp - Before) <= (uint32_t)(After - Before));
+
+    TEST_ASSERT_EQ(0U, Det_Drain(Entries, 4U));
+    TEST_ASSERT_EQ(0U, Det_Drain(NULL_PTR, 4U));
+}
+
+/**
+ * @brief   One counter per error ID across modules and kinds, IDs from the last
+ *          counter up share it, Det_Init clears the counters and the unread entries
+ */
+static void Test_CountersPerError(void)
+{
+    Det_ErrorEntryType Entry;
+
+    Det_Init();
+    (void)Det_ReportError(0x7BU, 0U, 0U, 0x14U);
+    (void)Det_ReportRuntimeError(0x7CU, 0U, 0U, 0x14U);
+    (void)Det_ReportTransientFault(0x7DU, 0U, 0U, 0x14U);
+    (void)Det_ReportError(0x7BU, 0U, 0U, 0x15U);
+    (void)Det_ReportError(0x7BU, 0U, 0U, (uint8)TEST_LAST_COUNTER);
+    (void)Det_ReportError(0x7BU, 0U, 0U, 0xFFU);
+
+    TEST_ASSERT_EQ(3U, Det_GetErrorCount(0x14U));
+    TEST_ASSERT_EQ(1U, Det_GetErrorCount(0x15U));
+    TEST_ASSERT_EQ(0U, Det_GetErrorCount(0x16U));
+    TEST_ASSERT_EQ(2U, Det_GetErrorCount((uint8)TEST_LAST_COUNTER));
+    TEST_ASSERT_EQ(2U, Det_GetErrorCount(0xFFU));
+    TEST_ASSERT_EQ(0U, Det_GetOverflowCount());
+
+    Det_Init();
+    TEST_ASSERT_EQ(0U, Det_GetErrorCount(0x14U));
+    TEST_ASSERT_EQ(0U, Det_GetErrorCount((uint8)TEST_LAST_COUNTER));
+    TEST_ASSERT_EQ(0U, Det_Drain(&Entry, 1U));
+
+    /* Reports after Det_Init are kept */
+    (void)Det_ReportError(0x7BU, 0U, 0U, 0x14U);
+    TEST_ASSERT_EQ(1U, Det_Drain(&Entry, 1U));
+    TEST_ASSERT_EQ(1U, Det_GetErrorCount(0x14U));
+}
+
+/**
+ * @brief   Drains of any size hand out every report once, oldest first, also when
+ *          reports and drains interleave across the end of the ring
+ */
+static void Test_DrainKeepsOrder(void)
+{
+    Det_ErrorEntryType Entries[DET_BUFFER_SIZE];
+    uint32_t Next = 0U;
+    uint32_t Reported = 0U;
+    uint32_t Round;
+    uint8 Count;
+
+    Det_Init();
+    for (Round = 0U; Round < (4U * DET_BUFFER_SIZE); Round++)
+    {
+        /* 1..7 reports, 1..5 entries drained, never more than a ring behind */
+        Test_Report(Reported, (Round % 7U) + 1U);
+        Reported += (Round % 7U) + 1U;
+        do
+        {
+            Count = Det_Drain(Entries, (uint8)((Round % 5U) + 1U));
+            Test_CheckDrained(Entries, Count, Next);
+            Next += Count;
+        } while ((Reported - Next) > (DET_BUFFER_SIZE / 2U));
+    }
+    Count = Det_Drain(Entries, DET_BUFFER_SIZE);
+    Test_CheckDrained(Entries, Count, Next);
+    Next += Count;
+
+    TEST_ASSERT(Reported > (8U * DET_BUFFER_SIZE));
+    TEST_ASSERT_EQ(Reported, Next);
+    TEST_ASSERT_EQ(Reported, Det_GetErrorCount(TEST_ERROR));
+    TEST_ASSERT_EQ(0U, Det_GetOverflowCount());
+}
+
+/**
+ * @brief   TEST_LOST reports past a full ring overwrite the oldest entries, are
+ *          counted as overflow, and the drain resumes at the oldest survivor
+ */
+static void Test_FullRingOverwritesOldest(void)
+{
+    Det_ErrorEntryType Entries[DET_BUFFER_SIZE + 1U];
+
+    Det_Init();
+    Test_Report(0U, DET_BUFFER_SIZE);
+    TEST_ASSERT_EQ(0U, Det_GetOverflowCount());
+    Test_Report(DET_BUFFER_SIZE, TEST_LOST);
+    TEST_ASSERT_EQ(TEST_LOST, Det_GetOverflowCount());
+
+    TEST_ASSERT_EQ(DET_BUFFER_SIZE, Det_Drain(Entries, DET_BUFFER_SIZE + 1U));
+    Test_CheckDrained(Entries, DET_BUFFER_SIZE, TEST_LOST);
+    TEST_ASSERT_EQ(DET_BUFFER_SIZE + TEST_LOST, Det_GetErrorCount(TEST_ERROR));
+
+    /* Drained ring takes a full buffer again without loss */
+    Test_Report(DET_BUFFER_SIZE + TEST_LOST, DET_BUFFER_SIZE);
+    TEST_ASSERT_EQ(TEST_LOST, Det_GetOverflowCount());
+    TEST_ASSERT_EQ(DET_BUFFER_SIZE, Det_Drain(Entries, DET_BUFFER_SIZE + 1U));
+    Test_CheckDrained(Entries, DET_BUFFER_SIZE, DET_BUFFER_SIZE + TEST_LOST);
+}
+
+/**
+ * @brief   Host cost of one report and of draining one entry
+ */
+static void Test_ReportCost(void)
+{
+    Det_ErrorEntryType Entries[DET_BUFFER_SIZE];
+    uint64_t Start;
+    uint64_t Drained = 0U;
+    uint32_t Report;
+
+    Det_Init();
+    Start = TestHost_HostNs();
+    for (Report = 0U; Report < TEST_BENCH_REPORTS; Report++)
+    {
+        (void)Det_ReportError(TEST_MODULE_BASE, TEST_INSTANCE, TEST_API, TEST_ERROR);
+    }
+    TestHost_Bench("Report", (double)(TestHost_HostNs() - Start) / TEST_BENCH_REPORTS, "host_ns");
+    TEST_ASSERT_EQ(TEST_BENCH_REPORTS, Det_GetErrorCount(TEST_ERROR));
+    TEST_ASSERT_EQ(TEST_BENCH_REPORTS - DET_BUFFER_SIZE, Det_GetOverflowCount());
+
+    Start = TestHost_HostNs();
+    for (Report = 0U; Report < (TEST_BENCH_REPORTS / DET_BUFFER_SIZE); Report++)
+    {
+        Test_Report(0U, DET_BUFFER_SIZE);
+        Drained += Det_Drain(Entries, DET_BUFFER_SIZE);
+    }
+    TEST_ASSERT_EQ((uint64_t)(TEST_BENCH_REPORTS / DET_BUFFER_SIZE) * DET_BUFFER_SIZE, Drained);
+    TestHost_Bench("ReportAndDrain", (double)(TestHost_HostNs() - Start) / Drained, "host_ns");
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -0,0 +1,345 @@
+/****************************************************************************************
+*                                TEST_DIO.C                                             *
+****************************************************************************************
+* File Name   : Test_Dio.c
+* Module      : Host Tests (TEST)
+* Description : DIO channel access through the bit-band alias: checked and fast
+*               variants against the port registers, Det report of bad channel IDs,
+*               executed instructions against the SPL path
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * The model resolves a bit-band alias access to its IDR/ODR bit and charges one
+ * bus access, like the core. The cost benchmark counts the host instructions of
+ * one call: the SPL path the driver used before (GPIO_ReadInputDataBit and
+ * GPIO_WriteBit behind the channel to port/pin macros), the checked functions and
+ * the inline fast variants. The SPL reference carries the same Prof probe pair as
+ * the checked functions, so the pair, about 190 instructions with clock_gettime on
+ * the host, cancels out. x86-64 counts are a relative measure of the same C code,
+ * not Cortex-M3 cycles.
+ *
+ * The lost update cases take an "interrupt" from the access hook right after the
+ * first port access of the thread. On the core that is an ISR entered between the
+ * load and the store of a read-modify-write.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+
+#include "TestHost.h"
+#include "Dio.h"
+#include "Det.h"
+#include "Prof.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_BAD_CHANNEL            (DIO_NUM_PORTS * 16U)   /*!< First ID past port D */
+#define TEST_COUNT_RUNS             8U      /*!< Runs per path, the fewest instructions count */
+#define TEST_NBR_OF_PATHS           6U      /*!< SPL, checked, fast for read then write */
+
+#define TEST_GROUP_MASK             0x000FU     /*!< PB0..PB3, written by the thread */
+#define TEST_ISR_PIN                8U          /*!< PB8, set by the ISR */
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static volatile uint8_t Test_IsrArmed;    /*!< Cleared by the hook, which runs from a signal */
+static volatile Dio_LevelType Test_Level;
+
+static const Dio_ChannelGroupType Test_Group =
+{
+    .mask   = TEST_GROUP_MASK,
+    .offset = 0U,
+    .port   = DIO_PORT_B,
+};
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static GPIO_TypeDef* Test_Port(Dio_ChannelType Channel);
+static Dio_LevelType Test_SplReadChannel(Dio_ChannelType ChannelId);
+static void Test_SplWriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
+static void Test_SplRead(void);
+static void Test_CheckedRead(void);
+static void Test_FastRead(void);
+static void Test_SplWrite(void);
+static void Test_CheckedWrite(void);
+static void Test_FastWrite(void);
+static void Test_ProbePair(void);
+static void Test_WriteSetsOdrBit(void);
+static void Test_ReadFollowsIdr(void);
+static void Test_FastMatchesChecked(void);
+static void Test_InvalidChannelReported(void);
+static void Test_AccessCost(void);
+static void Test_IsrOnFirstPortAccess(uint32_t Addr, uint8_t Write);
+static void Test_ReadModifyWriteLosesIsrUpdate(void);
+static void Test_BsrrKeepsIsrUpdate(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("Dio");
+    TestHost_Run("WriteSetsOdrBit", Test_WriteSetsOdrBit);
+    TestHost_Run("ReadFollowsIdr", Test_ReadFollowsIdr);
+    TestHost_Run("FastMatchesChecked", Test_FastMatchesChecked);
+    TestHost_Run("InvalidChannelReported", Test_InvalidChannelReported);
+    TestHost_Run("AccessCost", Test_AccessCost);
+    TestHost_Run("ReadModifyWriteLosesIsrUpdate", Test_ReadModifyWriteLosesIsrUpdate);
+    TestHost_Run("BsrrKeepsIsrUpdate", Test_BsrrKeepsIsrUpdate);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+static GPIO_TypeDef* Test_Port(Dio_ChannelType Channel)
+{
+    return DIO_GET_PORT_CHANNEL_ID(Channel);
+}
+
+/**
+ * @brief   Every channel of ports A..D: one write changes exactly its ODR bit
+ */
+static void Test_WriteSetsOdrBit(void)
+{
+    Dio_ChannelType Channel;
+
+    for (Channel = 0U; Channel < TEST_BAD_CHANNEL; Channel++)
+    {
+        GPIO_TypeDef* Port = Test_Port(Channel);
+        uint32_t Before = HostSim_PeekRegister(&Port->ODR);
+
+        Dio_WriteChannel(Channel, STD_HIGH);
+        TEST_ASSERT_EQ(Before | DIO_GET_PIN_CHANNEL_ID(Channel), HostSim_PeekRegister(&Port->ODR));
+        Dio_WriteChannel(Channel, STD_LOW);
+        TEST_ASSERT_EQ(Before & ~DIO_GET_PIN_CHANNEL_ID(Channel), HostSim_PeekRegister(&Port->ODR));
+    }
+}
+
+/**
+ * @brief   Every channel of ports A..D reads its IDR bit
+ */
+static void Test_ReadFollowsIdr(void)
+{
+    Dio_ChannelType Channel;
+
+    for (Channel = 0U; Channel < TEST_BAD_CHANNEL; Channel++)
+    {
+        HostSim_SetPinInput(Test_Port(Channel), Channel % 16U, STD_HIGH);
+        TEST_ASSERT_EQ(STD_HIGH, Dio_ReadChannel(Channel));
+        HostSim_SetPinInput(Test_Port(Channel), Channel % 16U, STD_LOW);
+        TEST_ASSERT_EQ(STD_LOW, Dio_ReadChannel(Channel));
+    }
+}
+
+/**
+ * @brief   The unchecked bit-band variants give the same levels and registers
+ */
+static void Test_FastMatchesChecked(void)
+{
+    Dio_ChannelType Channel;
+
+    for (Channel = 0U; Channel < TEST_BAD_CHANNEL; Channel++)
+    {
+        GPIO_TypeDef* Port = Test_Port(Channel);
+        uint8_t Level = (uint8_t)((Channel / 3U) & 1U);
+
+        HostSim_SetPinInput(Port, Channel % 16U, Level);
+        TEST_ASSERT_EQ(Dio_ReadChannel(Channel), Dio_FastReadChannel(Channel));
+
+        Dio_FastWriteChannel(Channel, Level);
+        TEST_ASSERT_EQ(Level, (HostSim_PeekRegister(&Port->ODR) >> (Channel % 16U)) & 1U);
+    }
+    TEST_ASSERT_EQ(0U, Det_GetErrorCount(DIO_E_PARAM_INVALID_CHANNEL_ID));
+}
+
+/**
+ * @brief   An ID past port D is reported to Det and touches no register
+ */
+static void Test_InvalidChannelReported(void)
+{
+    Det_ErrorEntryType Entries[2];
+    uint64_t Start;
+
+    Det_Init();
+    Start = HostSim_GetCycles();
+    TEST_ASSERT_EQ(STD_LOW, Dio_ReadChannel(TEST_BAD_CHANNEL));
+    Dio_WriteChannel(TEST_BAD_CHANNEL, STD_HIGH);
+    Dio_WriteChannel(0xFFU, STD_HIGH);
+    TEST_ASSERT_EQ(0U, HostSim_GetCycles() - Start);
+
+    TEST_ASSERT_EQ(3U, Det_GetErrorCount(DIO_E_PARAM_INVALID_CHANNEL_ID));
+    TEST_ASSERT_EQ(2U, Det_Drain(Entries, 2U));
+    TEST_ASSERT_EQ(DIO_MODULE_ID, Entries[0].ModuleId);
+    TEST_ASSERT_EQ(DIO_READCHANNEL_ID, Entries[0].ApiId);
+    TEST_ASSERT_EQ(DIO_WRITECHANNEL_ID, Entries[1].ApiId);
+    TEST_ASSERT_EQ(DIO_E_PARAM_INVALID_CHANNEL_ID, Entries[1].ErrorId);
+}
+
+/**
+ * @brief   Dio_ReadChannel before the bit-band rework, out of line like the driver
+ */
+static __attribute__((noinline)) Dio_LevelType Test_SplReadChannel(Dio_ChannelType ChannelId)
+{
+    GPIO_TypeDef* GPIO_Port = DIO_GET_PORT_CHANNEL_ID(ChannelId);
+    Dio_LevelType Level;
+
+    if (GPIO_Port == NULL_PTR)
+    {
+        return STD_LOW;
+    }
+    PROF_BEGIN(PROF_PROBE_DIO_READ_CHANNEL);
+    Level = (GPIO_ReadInputDataBit(GPIO_Port, DIO_GET_PIN_CHANNEL_ID(ChannelId)) == Bit_SET) ? STD_HIGH : STD_LOW;
+    PROF_END(PROF_PROBE_DIO_READ_CHANNEL);
+    return Level;
+}
+
+/**
+ * @brief   Dio_WriteChannel before the bit-band rework, one BSRR or BRR store
+ */
+static __attribute__((noinline)) void Test_SplWriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    GPIO_TypeDef* GPIO_Port = DIO_GET_PORT_CHANNEL_ID(ChannelId);
+    BitAction BitVal = (Level == STD_HIGH) ? Bit_SET : Bit_RESET;
+
+    if (GPIO_Port == NULL_PTR)
+    {
+        return;
+    }
+    PROF_BEGIN(PROF_PROBE_DIO_WRITE_CHANNEL);
+    GPIO_WriteBit(GPIO_Port, DIO_GET_PIN_CHANNEL_ID(ChannelId), BitVal);
+    PROF_END(PROF_PROBE_DIO_WRITE_CHANNEL);
+}
+
+/* One call per path, as counted by HostSim_CountInstructions */
+static void Test_SplRead(void)      { Test_Level = Test_SplReadChannel(DIO_CHANNEL_C13); }
+static void Test_CheckedRead(void)  { Test_Level = Dio_ReadChannel(DIO_CHANNEL_C13); }
+static void Test_FastRead(void)     { Test_Level = Dio_FastReadChannel(DIO_CHANNEL_C13); }
+static void Test_SplWrite(void)     { Test_SplWriteChannel(DIO_CHANNEL_C13, STD_HIGH); }
+static void Test_CheckedWrite(void) { Dio_WriteChannel(DIO_CHANNEL_C13, STD_HIGH); }
+static void Test_FastWrite(void)    { Dio_FastWriteChannel(DIO_CHANNEL_C13, STD_HIGH); }
+
+static void Test_ProbePair(void)
+{
+    PROF_BEGIN(PROF_PROBE_DIO_READ_CHANNEL);
+    PROF_END(PROF_PROBE_DIO_READ_CHANNEL);
+}
+
+/**
+ * @brief   Every path costs one bus access. In executed instructions the fast
+ *          variant beats the checked one, which beats the SPL path it replaced.
+ */
+static void Test_AccessCost(void)
+{
+    static const struct
+    {
+        const char* Name;
+        void (*Func)(void);
+    } Test_Paths[TEST_NBR_OF_PATHS] =
+    {
+        { "SplReadChannel",     Test_SplRead },
+        { "ReadChannel",        Test_CheckedRead },
+        { "FastReadChannel",    Test_FastRead },
+        { "SplWriteChannel",    Test_SplWrite },
+        { "WriteChannel",       Test_CheckedWrite },
+        { "FastWriteChannel",   Test_FastWrite },
+    };
+    uint64_t Counts[TEST_NBR_OF_PATHS];
+    uint64_t Count;
+    uint64_t Start;
+    uint8_t Path;
+    uint8_t Run;
+
+    for (Path = 0U; Path < TEST_NBR_OF_PATHS; Path++)
+    {
+        Start = HostSim_GetCycles();
+        Test_Paths[Path].Func();
+        TEST_ASSERT_EQ(HOSTSIM_ACCESS_CYCLES, HostSim_GetCycles() - Start);
+
+        /* The first run binds clock_gettime, a clock update can make it retry */
+        Counts[Path] = UINT64_MAX;
+        for (Run = 0U; Run < TEST_COUNT_RUNS; Run++)
+        {
+            Count = HostSim_CountInstructions(Test_Paths[Path].Func);
+            Counts[Path] = (Count < Counts[Path]) ? Count : Counts[Path];
+        }
+        TestHost_Bench(Test_Paths[Path].Name, (double)Counts[Path], "host_insns");
+    }
+    TestHost_Bench("ProbePair", (double)HostSim_CountInstructions(Test_ProbePair), "host_insns");
+
+    for (Path = 0U; Path < TEST_NBR_OF_PATHS; Path += 3U)
+    {
+        TEST_ASSERT(Counts[Path + 2U] < Counts[Path + 1U]);
+        TEST_ASSERT(Counts[Path + 1U] < Counts[Path]);
+    }
+}
+
+/**
+ * @brief   Access hook: once armed, the first GPIOB access is followed by an ISR
+ *          that sets PB8 the safe way
+ */
+static void Test_IsrOnFirstPortAccess(uint32_t Addr, uint8_t Write)
+{
+    (void)Write;
+
+    if ((Test_IsrArmed != 0U) && (Addr >= (uint32_t)(uintptr_t)GPIOB) &&
+        (Addr < ((uint32_t)(uintptr_t)GPIOB + sizeof(GPIO_TypeDef))))
+    {
+        Test_IsrArmed = 0U;
+        GPIOB->BSRR = 1UL << TEST_ISR_PIN;
+    }
+}
+
+/**
+ * @brief   The ODR read-modify-write the group writes used before: the ISR sets
+ *          PB8 between the load and the store, the store takes it back
+ */
+static void Test_ReadModifyWriteLosesIsrUpdate(void)
+{
+    uint32_t Odr;
+
+    HostSim_SetAccessHook(Test_IsrOnFirstPortAccess);
+    Test_IsrArmed = 1U;
+
+    Odr = GPIOB->ODR;
+    Odr = (Odr & ~TEST_GROUP_MASK) | 0x0005U;
+    GPIOB->ODR = Odr;
+
+    TEST_ASSERT_EQ(0U, Test_IsrArmed);
+    TEST_ASSERT_EQ(0x0005U, HostSim_PeekRegister(&GPIOB->ODR) & 0xFFFFU);
+}
+
+/**
+ * @brief   Dio_WriteChannelGroup and Dio_MaskWritePort store once to BSRR, the
+ *          ISR update survives on either side of the store
+ */
+static void Test_BsrrKeepsIsrUpdate(void)
+{
+    const uint32_t IsrBit = 1UL << TEST_ISR_PIN;
+
+    HostSim_SetAccessHook(Test_IsrOnFirstPortAccess);
+
+    Test_IsrArmed = 1U;
+    Dio_WriteChannelGroup(&Test_Group, 0x5U);
+    TEST_ASSERT_EQ(0U, Test_IsrArmed);
+    TEST_ASSERT_EQ(IsrBit | 0x0005U, HostSim_PeekRegister(&GPIOB->ODR) & 0xFFFFU);
+
+    GPIOB->BSRR = IsrBit << 16;
+    Test_IsrArmed = 1U;
+    Dio_MaskWritePort(DIO_PORT_B, 0x000AU, TEST_GROUP_MASK);
+    TEST_ASSERT_EQ(0U, Test_IsrArmed);
+    TEST_ASSERT_EQ(IsrBit | 0x000AU, HostSim_PeekRegister(&GPIOB->ODR) & 0xFFFFU);
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
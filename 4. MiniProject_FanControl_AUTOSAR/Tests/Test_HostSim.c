@@ -0,0 +1,183 @@
+/****************************************************************************************
+*                                TEST_HOSTSIM.C                                         *
+****************************************************************************************
+* File Name   : Test_HostSim.c
+* Module      : Host Tests (TEST)
+* Description : Checks of the peripheral model the other host tests rely on
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+
+#include "TestHost.h"
+#include "stm32f10x_adc.h"
+#include "stm32f10x_rcc.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_LED_PIN                13U
+#define TEST_ANALOG_VALUE           1234U
+#define TEST_SYSTICK_RELOAD         72000U  /*!< 1 ms at 72 MHz */
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void Test_BsrrUpdatesOdr(void);
+static void Test_AccessCost(void);
+static void Test_SysTickCount(void);
+static void Test_PrimaskDefersInterrupt(void);
+static void Test_AdcSoftwareConversion(void);
+static void Test_SetLed(void);
+static void Test_ToggleLed(void);
+static void Test_CountInstructions(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("HostSim");
+    TestHost_Run("BsrrUpdatesOdr", Test_BsrrUpdatesOdr);
+    TestHost_Run("AccessCost", Test_AccessCost);
+    TestHost_Run("SysTickCount", Test_SysTickCount);
+    TestHost_Run("PrimaskDefersInterrupt", Test_PrimaskDefersInterrupt);
+    TestHost_Run("AdcSoftwareConversion", Test_AdcSoftwareConversion);
+    TestHost_Run("CountInstructions", Test_CountInstructions);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   BSRR sets and BRR clears ODR bits, both read back as 0
+ */
+static void Test_BsrrUpdatesOdr(void)
+{
+    GPIOC->BSRR = 1UL << TEST_LED_PIN;
+    TEST_ASSERT_EQ(1UL << TEST_LED_PIN, HostSim_PeekRegister(&GPIOC->ODR));
+    TEST_ASSERT_EQ(0U, HostSim_PeekRegister(&GPIOC->BSRR));
+
+    /* Reset half wins over the set half of the same pin */
+    GPIOC->BSRR = (1UL << TEST_LED_PIN) | (1UL << (TEST_LED_PIN + 16U));
+    TEST_ASSERT_EQ(1UL << TEST_LED_PIN, HostSim_PeekRegister(&GPIOC->ODR));
+
+    GPIOC->BRR = 1UL << TEST_LED_PIN;
+    TEST_ASSERT_EQ(0U, HostSim_PeekRegister(&GPIOC->ODR));
+}
+
+/**
+ * @brief   Every trapped access advances the clock by HOSTSIM_ACCESS_CYCLES
+ */
+static void Test_AccessCost(void)
+{
+    uint64_t Start = HostSim_GetCycles();
+
+    (void)GPIOA->IDR;
+    GPIOA->BSRR = 1U;
+    TEST_ASSERT_EQ(2U * HOSTSIM_ACCESS_CYCLES, HostSim_GetCycles() - Start);
+
+    /* Peeking is free */
+    Start = HostSim_GetCycles();
+    (void)HostSim_PeekRegister(&GPIOA->ODR);
+    TEST_ASSERT_EQ(0U, HostSim_GetCycles() - Start);
+}
+
+/**
+ * @brief   SysTick at 1 ms raises one exception per millisecond
+ */
+static void Test_SysTickCount(void)
+{
+    TEST_ASSERT_EQ(0U, SysTick_Config(TEST_SYSTICK_RELOAD));
+    HostSim_Advance(10U * TEST_SYSTICK_RELOAD);
+    TEST_ASSERT_EQ(10U, HostSim_GetInterruptCount(SysTick_IRQn));
+}
+
+/**
+ * @brief   A tick raised with PRIMASK set is taken when PRIMASK clears
+ */
+static void Test_PrimaskDefersInterrupt(void)
+{
+    TEST_ASSERT_EQ(0U, SysTick_Config(TEST_SYSTICK_RELOAD));
+
+    __disable_irq();
+    HostSim_Advance(TEST_SYSTICK_RELOAD + 1U);
+    TEST_ASSERT_EQ(0U, HostSim_GetInterruptCount(SysTick_IRQn));
+
+    __enable_irq();
+    TEST_ASSERT_EQ(1U, HostSim_GetInterruptCount(SysTick_IRQn));
+}
+
+/**
+ * @brief   SWSTART converts the analog input after the sampling time
+ */
+static void Test_AdcSoftwareConversion(void)
+{
+    ADC_InitTypeDef Init;
+
+    HostSim_SetAnalogInput(ADC_Channel_0, TEST_ANALOG_VALUE);
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC1, ENABLE);
+
+    /* SWSTART only starts the regular sequence with EXTSEL = SWSTART */
+    ADC_StructInit(&Init);
+    Init.ADC_ExternalTrigConv = ADC_ExternalTrigConv_None;
+    ADC_Init(ADC1, &Init);
+    ADC_RegularChannelConfig(ADC1, ADC_Channel_0, 1, ADC_SampleTime_1Cycles5);
+    ADC_Cmd(ADC1, ENABLE);
+    ADC_SoftwareStartConvCmd(ADC1, ENABLE);
+
+    TEST_ASSERT_EQ(RESET, ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC));
+    HostSim_Advance(1000U);
+    TEST_ASSERT_EQ(SET, ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC));
+    TEST_ASSERT_EQ(1U, HostSim_GetConversionCount(ADC1));
+
+    /* Reading DR clears EOC */
+    TEST_ASSERT_EQ(TEST_ANALOG_VALUE, ADC_GetConversionValue(ADC1));
+    TEST_ASSERT_EQ(RESET, ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC));
+}
+
+/**
+ * @brief   One store to BSRR
+ */
+static void Test_SetLed(void)
+{
+    GPIOC->BSRR = 1UL << TEST_LED_PIN;
+}
+
+/**
+ * @brief   BRR then BSRR, two stores
+ */
+static void Test_ToggleLed(void)
+{
+    GPIOC->BRR = 1UL << TEST_LED_PIN;
+    GPIOC->BSRR = 1UL << TEST_LED_PIN;
+}
+
+/**
+ * @brief   A trapped access is one counted instruction, its side effect and cost
+ *          still apply, and code after the count runs without single steps
+ */
+static void Test_CountInstructions(void)
+{
+    uint64_t Start = HostSim_GetCycles();
+
+    TEST_ASSERT_EQ(1U, HostSim_CountInstructions(Test_SetLed));
+    TEST_ASSERT_EQ(1UL << TEST_LED_PIN, HostSim_PeekRegister(&GPIOC->ODR));
+    TEST_ASSERT_EQ(2U, HostSim_CountInstructions(Test_ToggleLed));
+    TEST_ASSERT_EQ(3U * HOSTSIM_ACCESS_CYCLES, HostSim_GetCycles() - Start);
+
+    /* A SIGTRAP out of a count would end the process */
+    GPIOC->BRR = 1UL << TEST_LED_PIN;
+    TEST_ASSERT_EQ(0U, HostSim_PeekRegister(&GPIOC->ODR));
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -0,0 +1,365 @@
+/****************************************************************************************
+*                                TEST_IOHWAB.C                                          *
+****************************************************************************************
+* File Name   : Test_IoHwAb.c
+* Module      : Host Tests (TEST)
+* Description : Non-blocking temperature acquisition of IoHwAb: completion, timeout,
+*               staleness, the conversion of the cached value to 0.01 degC and the
+*               accuracy and cost of the lookup table behind it
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * The test plays the scheduler: one IoHwAb_MainFunction call per simulated
+ * IOHWAB_MAINFUNCTION_PERIOD_MS. Holding PRIMASK keeps the ADC completion interrupt
+ * pending, which is how a conversion that finishes late or never is produced.
+ *
+ * The table cases compare IoHwAb_ConvertAdcToTemperature with the LM35 formula for
+ * every 12-bit code. The table stops at 150 degC, the LM35 limit, so the formula is
+ * clamped there too. The benchmark is host time of pure code. The compiler turns
+ * the old division by the constant 4095 into a multiply, on x86 and on the core.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+
+#include "TestHost.h"
+#include "IoHwAb.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_TEMP_CHANNEL           0U      /*!< PA0 */
+#define TEST_CYCLES_PER_MS          72000ULL
+#define TEST_LATE_POLLS             3U      /*!< Below the 50 ms timeout */
+#define TEST_TIMEOUT_POLLS          (IOHWAB_TEMP_TIMEOUT_MS / IOHWAB_MAINFUNCTION_PERIOD_MS)
+#define TEST_STALE_POLLS            (IOHWAB_TEMP_STALE_MS / IOHWAB_MAINFUNCTION_PERIOD_MS)
+
+#define TEST_RAW_50C                620U    /*!< 499.6 mV, 49.96 degC on the LM35 */
+#define TEST_TEMP_50C               4996    /*!< 620 * 330000 / 4095 / 10 in 0.01 degC */
+#define TEST_TEMP_TOLERANCE         2       /*!< Table interpolation, 0.02 degC */
+
+#define TEST_LUT_MAX_CENTI          15000   /*!< Table clamp, 150.00 degC */
+#define TEST_LUT_RATED_CENTI        12500   /*!< Accuracy stated by TempLutGen up to 125 degC */
+#define TEST_LUT_KNEE_TOLERANCE     50      /*!< Segment across the clamp, 0.5 degC */
+#define TEST_BENCH_ROUNDS           2000U   /*!< Sweeps of all 4096 codes */
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static uint8_t Test_ReadyCount;
+static IoHwAb_TempStatusType Test_ReadyStatus;
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void Test_Poll(void);
+static void Test_AcquireOnce(uint16 Raw);
+static void Test_CompletesAfterPolls(void);
+static void Test_NeverCompletes(void);
+static void Test_NeverCompletesKeepsOldValue(void);
+static void Test_StaleWithoutRequests(void);
+static void Test_ValueInCentiCelsius(void);
+static void Test_ZeroInputReadsZero(void);
+static double Test_FormulaCenti(uint16 Raw);
+static uint16 Test_OldConvert(uint16 Raw);
+static void Test_TempLutMatchesFormula(void);
+static void Test_TempLutCost(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("IoHwAb");
+    TestHost_Run("CompletesAfterPolls", Test_CompletesAfterPolls);
+    TestHost_Run("NeverCompletes", Test_NeverCompletes);
+    TestHost_Run("NeverCompletesKeepsOldValue", Test_NeverCompletesKeepsOldValue);
+    TestHost_Run("StaleWithoutRequests", Test_StaleWithoutRequests);
+    TestHost_Run("ValueInCentiCelsius", Test_ValueInCentiCelsius);
+    TestHost_Run("ZeroInputReadsZero", Test_ZeroInputReadsZero);
+    TestHost_Run("TempLutMatchesFormula", Test_TempLutMatchesFormula);
+    TestHost_Run("TempLutCost", Test_TempLutCost);
+    return TestHost_End();
+}
+
+/**
+ * @brief   Completion callback, replaces the weak default of IoHwAb
+ */
+void IoHwAb_TemperatureReady(IoHwAb_TempStatusType status)
+{
+    Test_ReadyStatus = status;
+    Test_ReadyCount++;
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   One main function period
+ */
+static void Test_Poll(void)
+{
+    HostSim_Advance(IOHWAB_MAINFUNCTION_PERIOD_MS * TEST_CYCLES_PER_MS);
+    IoHwAb_MainFunction();
+}
+
+/**
+ * @brief   Init and take one good reading of Raw
+ */
+static void Test_AcquireOnce(uint16 Raw)
+{
+    HostSim_SetAnalogInput(TEST_TEMP_CHANNEL, Raw);
+    IoHwAb_Init();
+
+    TEST_ASSERT_EQ(E_OK, IoHwAb_RequestTemperature());
+    Test_Poll();
+    TEST_ASSERT_EQ(1U, Test_ReadyCount);
+    TEST_ASSERT_EQ(IOHWAB_TEMP_STATUS_VALID, Test_ReadyStatus);
+}
+
+/**
+ * @brief   Interrupt held off for N polls, the request stays pending and then completes
+ */
+static void Test_CompletesAfterPolls(void)
+{
+    uint16 Value = 0U;
+    uint8_t Poll;
+
+    HostSim_SetAnalogInput(TEST_TEMP_CHANNEL, TEST_RAW_50C);
+    IoHwAb_Init();
+
+    __disable_irq();
+    TEST_ASSERT_EQ(E_OK, IoHwAb_RequestTemperature());
+    for (Poll = 0U; Poll < TEST_LATE_POLLS; Poll++)
+    {
+        Test_Poll();
+        TEST_ASSERT_EQ(0U, Test_ReadyCount);
+        TEST_ASSERT_EQ(IOHWAB_TEMP_STATUS_INVALID, IoHwAb_GetTemperature(&Value, NULL_PTR));
+        TEST_ASSERT_EQ(IOHWAB_TEMP_INVALID_VALUE, Value);
+
+        /* Still one request in flight */
+        TEST_ASSERT_EQ(E_NOT_OK, IoHwAb_RequestTemperature());
+    }
+
+    /* The completion interrupt is taken here, the next poll collects it */
+    __enable_irq();
+    IoHwAb_MainFunction();
+    TEST_ASSERT_EQ(1U, Test_ReadyCount);
+    TEST_ASSERT_EQ(IOHWAB_TEMP_STATUS_VALID, Test_ReadyStatus);
+    TEST_ASSERT_EQ(IOHWAB_TEMP_STATUS_VALID, IoHwAb_GetTemperature(&Value, NULL_PTR));
+    TEST_ASSERT_RANGE(TEST_TEMP_50C - TEST_TEMP_TOLERANCE, TEST_TEMP_50C + TEST_TEMP_TOLERANCE, Value);
+
+    /* The ADC is free for the next request */
+    TEST_ASSERT_EQ(E_OK, IoHwAb_RequestTemperature());
+}
+
+/**
+ * @brief   No completion at all: aborted after the timeout, no value ever
+ */
+static void Test_NeverCompletes(void)
+{
+    uint16 Value = 0U;
+    uint8_t Poll;
+
+    HostSim_SetAnalogInput(TEST_TEMP_CHANNEL, TEST_RAW_50C);
+    IoHwAb_Init();
+
+    __disable_irq();
+    TEST_ASSERT_EQ(E_OK, IoHwAb_RequestTemperature());
+    for (Poll = 0U; Poll < (TEST_TIMEOUT_POLLS - 1U); Poll++)
+    {
+        Test_Poll();
+        TEST_ASSERT_EQ(0U, Test_ReadyCount);
+    }
+
+    Test_Poll();
+    TEST_ASSERT_EQ(1U, Test_ReadyCount);
+    TEST_ASSERT_EQ(IOHWAB_TEMP_STATUS_INVALID, Test_ReadyStatus);
+    TEST_ASSERT_EQ(IOHWAB_TEMP_STATUS_INVALID, IoHwAb_GetTemperature(&Value, NULL_PTR));
+    TEST_ASSERT_EQ(IOHWAB_TEMP_INVALID_VALUE, Value);
+
+    /* The group was stopped, reading kicks the next request on the free ADC */
+    TEST_ASSERT_EQ(ADC_IDLE, Adc_GetGroupStatus(0U));
+    TEST_ASSERT_EQ(IOHWAB_TEMP_INVALID_VALUE, IoHwAb_ReadTemperature());
+    TEST_ASSERT_EQ(ADC_BUSY, Adc_GetGroupStatus(0U));
+}
+
+/**
+ * @brief   A timeout after a good reading keeps the value but marks it stale
+ */
+static void Test_NeverCompletesKeepsOldValue(void)
+{
+    uint16 Value = 0U;
+    uint32 AgeMs = 0U;
+    uint8_t Poll;
+
+    Test_AcquireOnce(TEST_RAW_50C);
+
+    __disable_irq();
+    TEST_ASSERT_EQ(E_OK, IoHwAb_RequestTemperature());
+    for (Poll = 0U; Poll < TEST_TIMEOUT_POLLS; Poll++)
+    {
+        Test_Poll();
+    }
+
+    TEST_ASSERT_EQ(2U, Test_ReadyCount);
+    TEST_ASSERT_EQ(IOHWAB_TEMP_STATUS_STALE, Test_ReadyStatus);
+    TEST_ASSERT_EQ(IOHWAB_TEMP_STATUS_STALE, IoHwAb_GetTemperature(&Value, &AgeMs));
+    TEST_ASSERT_RANGE(TEST_TEMP_50C - TEST_TEMP_TOLERANCE, TEST_TEMP_50C + TEST_TEMP_TOLERANCE, Value);
+    TEST_ASSERT_EQ(IOHWAB_TEMP_TIMEOUT_MS, AgeMs);
+    TEST_ASSERT_EQ(IOHWAB_TEMP_INVALID_VALUE, IoHwAb_ReadTemperature());
+}
+
+/**
+ * @brief   A value nobody refreshes turns stale after IOHWAB_TEMP_STALE_MS
+ */
+static void Test_StaleWithoutRequests(void)
+{
+    uint16 Poll;
+
+    Test_AcquireOnce(TEST_RAW_50C);
+
+    for (Poll = 1U; Poll < TEST_STALE_POLLS; Poll++)
+    {
+        IoHwAb_MainFunction();
+    }
+    TEST_ASSERT_EQ(IOHWAB_TEMP_STATUS_VALID, IoHwAb_GetTemperature(NULL_PTR, NULL_PTR));
+
+    IoHwAb_MainFunction();
+    TEST_ASSERT_EQ(IOHWAB_TEMP_STATUS_STALE, IoHwAb_GetTemperature(NULL_PTR, NULL_PTR));
+}
+
+/**
+ * @brief   The cache holds 0.01 degC, not ADC codes
+ */
+static void Test_ValueInCentiCelsius(void)
+{
+    uint16 Value = 0U;
+
+    Test_AcquireOnce(TEST_RAW_50C);
+
+    TEST_ASSERT_EQ(IOHWAB_TEMP_STATUS_VALID, IoHwAb_GetTemperature(&Value, NULL_PTR));
+    TEST_ASSERT_RANGE(TEST_TEMP_50C - TEST_TEMP_TOLERANCE, TEST_TEMP_50C + TEST_TEMP_TOLERANCE, Value);
+    TEST_ASSERT_EQ(Value, IoHwAb_ReadTemperature());
+}
+
+/**
+ * @brief   0 V reads as 0 degC
+ */
+static void Test_ZeroInputReadsZero(void)
+{
+    uint16 Value = IOHWAB_TEMP_INVALID_VALUE;
+
+    Test_AcquireOnce(0U);
+
+    TEST_ASSERT_EQ(IOHWAB_TEMP_STATUS_VALID, IoHwAb_GetTemperature(&Value, NULL_PTR));
+    TEST_ASSERT_EQ(0U, Value);
+}
+
+/**
+ * @brief   LM35 reference: code * VREF / 4095 / 10 mV per degC, in 0.01 degC
+ */
+static double Test_FormulaCenti(uint16 Raw)
+{
+    double Centi = ((double)Raw * IOHWAB_ADC_VREF_MV * 100.0) /
+                   ((double)IOHWAB_ADC_RESOLUTION * IOHWAB_LM35_MV_PER_CELSIUS);
+
+    return (Centi > TEST_LUT_MAX_CENTI) ? TEST_LUT_MAX_CENTI : Centi;
+}
+
+/**
+ * @brief   The conversion before the table: whole degC, one division by 4095
+ */
+__attribute__((noinline)) static uint16 Test_OldConvert(uint16 Raw)
+{
+    return (uint16)(((uint32)Raw * 330U) / 4095U);
+}
+
+/**
+ * @brief   Every code 0..4095: within 0.02 degC of the formula up to 125 degC,
+ *          monotonic, and clamped at 150 degC
+ */
+static void Test_TempLutMatchesFormula(void)
+{
+    double RatedErr = 0.0;
+    double FullErr = 0.0;
+    double OldErr = 0.0;
+    sint16 Previous = 0;
+    uint32 Raw;
+
+    for (Raw = 0U; Raw <= IOHWAB_ADC_RESOLUTION; Raw++)
+    {
+        sint16 Centi = IoHwAb_ConvertAdcToTemperature((uint16)Raw);
+        double Exact = Test_FormulaCenti((uint16)Raw);
+        double Err = fabs((double)Centi - Exact);
+
+        TEST_ASSERT(Centi >= Previous);
+        Previous = Centi;
+        if (Exact <= TEST_LUT_RATED_CENTI)
+        {
+            RatedErr = fmax(RatedErr, Err);
+            OldErr = fmax(OldErr, Exact - (100.0 * Test_OldConvert((uint16)Raw)));
+        }
+        FullErr = fmax(FullErr, Err);
+    }
+
+    TEST_ASSERT(RatedErr <= TEST_TEMP_TOLERANCE);
+    TEST_ASSERT(FullErr <= TEST_LUT_KNEE_TOLERANCE);
+    TEST_ASSERT_EQ(TEST_LUT_MAX_CENTI, IoHwAb_ConvertAdcToTemperature(IOHWAB_ADC_RESOLUTION));
+
+    TestHost_Bench("TempLutMaxErrTo125C", RatedErr / 100.0, "degC");
+    TestHost_Bench("TempLutMaxErrTo150C", FullErr / 100.0, "degC");
+    TestHost_Bench("OldConvertMaxErrTo125C", OldErr / 100.0, "degC");
+}
+
+/**
+ * @brief   Host time per conversion, table against the old division
+ */
+static void Test_TempLutCost(void)
+{
+    volatile sint32 Sink = 0;
+    sint32 Sum = 0;
+    uint64_t Start;
+    uint64_t LutNs;
+    uint64_t OldNs;
+    uint32 Round;
+    uint32 Raw;
+
+    Start = TestHost_HostNs();
+    for (Round = 0U; Round < TEST_BENCH_ROUNDS; Round++)
+    {
+        for (Raw = 0U; Raw <= IOHWAB_ADC_RESOLUTION; Raw++)
+        {
+            Sum += IoHwAb_ConvertAdcToTemperature((uint16)Raw);
+        }
+    }
+    LutNs = TestHost_HostNs() - Start;
+    Sink = Sum;
+
+    Sum = 0;
+    Start = TestHost_HostNs();
+    for (Round = 0U; Round < TEST_BENCH_ROUNDS; Round++)
+    {
+        for (Raw = 0U; Raw <= IOHWAB_ADC_RESOLUTION; Raw++)
+        {
+            Sum += Test_OldConvert((uint16)Raw);
+        }
+    }
+    OldNs = TestHost_HostNs() - Start;
+    Sink = Sum;
+    (void)Sink;
+
+    TestHost_Bench("TempLutConvert", (double)LutNs / (TEST_BENCH_ROUNDS * 4096.0), "host_ns_per_call");
+    TestHost_Bench("OldDivideConvert", (double)OldNs / (TEST_BENCH_ROUNDS * 4096.0), "host_ns_per_call");
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -0,0 +1,400 @@
+/****************************************************************************************
+*                                TEST_IOHWABFILTER.C                                    *
+****************************************************************************************
+* File Name   : Test_IoHwAbFilter.c
+* Module      : Host Tests (TEST)
+* Description : IoHwAb signal filters against reference models: boxcar mean, IIR low
+*               pass and running median, the configured chain and the cost per sample
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * IoHwAb_FilterConfig is const, a case that needs another chain makes its page
+ * writable and replaces entry 0. Every case runs in its own process, so the
+ * configured temperature chain is back for the next one.
+ *
+ * The filters touch no register, the benchmark reports host time per sample of
+ * the C code. Target cycles need Prof around IoHwAb_FilterProcess.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "TestHost.h"
+#include "IoHwAb.h"
+#include "IoHwAb_Filter.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_SIGNAL                 IOHWAB_FILTER_SIGNAL_TEMPERATURE
+#define TEST_SAMPLES                2000U
+#define TEST_MAX_LENGTH             15U
+#define TEST_BOXCAR_LENGTH          8U
+#define TEST_MEDIAN_LENGTH          5U
+#define TEST_WIDE_MEDIAN_LENGTH     15U
+#define TEST_BENCH_BLOCK            256U
+#define TEST_BENCH_BLOCKS           4000U
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static uint32_t Test_Seed = 0x9E3779B9U;
+static uint16 Test_Window[TEST_MAX_LENGTH];
+static uint16 Test_Sorted[TEST_MAX_LENGTH];
+static IoHwAb_FilterStageStateType Test_State[2];
+static Adc_ValueGroupType Test_Input[TEST_SAMPLES];
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static uint32_t Test_Random(void);
+static void Test_FillInput(uint16 Range, uint8 Spikes);
+static Std_ReturnType Test_UseStage(IoHwAb_FilterKindType Kind, uint8 Length, uint16 Alpha);
+static uint16 Test_Step(Adc_ValueGroupType Sample);
+static uint16 Test_ReferenceMedian(const Adc_ValueGroupType* History, uint8 Length);
+static double Test_NsPerSample(void);
+static void Test_NoOutputBeforeFirstSample(void);
+static void Test_BoxcarIsRoundedMean(void);
+static void Test_IirFollowsFloatModel(void);
+static void Test_MedianOfWindow(void);
+static void Test_StrideSelectsChannel(void);
+static void Test_InvalidStageRejected(void);
+static void Test_ChainRejectsSpike(void);
+static void Test_CostPerSample(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("IoHwAbFilter");
+    TestHost_Run("NoOutputBeforeFirstSample", Test_NoOutputBeforeFirstSample);
+    TestHost_Run("BoxcarIsRoundedMean", Test_BoxcarIsRoundedMean);
+    TestHost_Run("IirFollowsFloatModel", Test_IirFollowsFloatModel);
+    TestHost_Run("MedianOfWindow", Test_MedianOfWindow);
+    TestHost_Run("StrideSelectsChannel", Test_StrideSelectsChannel);
+    TestHost_Run("InvalidStageRejected", Test_InvalidStageRejected);
+    TestHost_Run("ChainRejectsSpike", Test_ChainRejectsSpike);
+    TestHost_Run("CostPerSample", Test_CostPerSample);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   xorshift32, the same sequence in every run
+ */
+static uint32_t Test_Random(void)
+{
+    Test_Seed ^= Test_Seed << 13;
+    Test_Seed ^= Test_Seed >> 17;
+    Test_Seed ^= Test_Seed << 5;
+    return Test_Seed;
+}
+
+/**
+ * @brief   Values around mid scale within Range, Spikes in 16 are full scale
+ */
+static void Test_FillInput(uint16 Range, uint8 Spikes)
+{
+    uint32_t Idx;
+
+    for (Idx = 0U; Idx < TEST_SAMPLES; Idx++)
+    {
+        uint32_t Random = Test_Random();
+
+        Test_Input[Idx] = (Adc_ValueGroupType)(2048U - (Range / 2U) + ((Random >> 8) % (Range + 1U)));
+        if ((Random & 0x0FU) < Spikes)
+        {
+            Test_Input[Idx] = ((Random & 0x10U) != 0U) ? 4095U : 0U;
+        }
+    }
+}
+
+/**
+ * @brief   Replace entry 0 of IoHwAb_FilterConfig by one stage and init
+ */
+static Std_ReturnType Test_UseStage(IoHwAb_FilterKindType Kind, uint8 Length, uint16 Alpha)
+{
+    static IoHwAb_FilterStageDefType Stage;
+    IoHwAb_FilterSignalDefType Chain = { &Stage, Test_State, 1U };
+    uintptr_t PageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uintptr_t Start = (uintptr_t)&IoHwAb_FilterConfig[TEST_SIGNAL] & ~(PageSize - 1U);
+    uintptr_t End = (uintptr_t)&IoHwAb_FilterConfig[TEST_SIGNAL + 1U];
+
+    Stage.Kind = Kind;
+    Stage.Length = Length;
+    Stage.Alpha = Alpha;
+    Stage.Window = Test_Window;
+    Stage.Sorted = Test_Sorted;
+
+    TEST_ASSERT_EQ(0, mprotect((void*)Start, End - Start, PROT_READ | PROT_WRITE));
+    (void)memcpy((void*)&IoHwAb_FilterConfig[TEST_SIGNAL], &Chain, sizeof(Chain));
+
+    return IoHwAb_FilterInit();
+}
+
+/**
+ * @brief   One sample through the chain
+ */
+static uint16 Test_Step(Adc_ValueGroupType Sample)
+{
+    uint16 Output = 0U;
+
+    TEST_ASSERT_EQ(E_OK, IoHwAb_FilterProcess(TEST_SIGNAL, &Sample, 1U, 1U, &Output));
+    return Output;
+}
+
+/**
+ * @brief   Median of the Length values ending at History, by sorting a copy
+ */
+static uint16 Test_ReferenceMedian(const Adc_ValueGroupType* History, uint8 Length)
+{
+    uint16 Copy[TEST_MAX_LENGTH];
+    uint8 i;
+    uint8 j;
+
+    for (i = 0U; i < Length; i++)
+    {
+        Copy[i] = History[-(int)i];
+    }
+    for (i = 1U; i < Length; i++)
+    {
+        uint16 Value = Copy[i];
+        for (j = i; (j > 0U) && (Copy[j - 1U] > Value); j--)
+        {
+            Copy[j] = Copy[j - 1U];
+        }
+        Copy[j] = Value;
+    }
+    return Copy[Length / 2U];
+}
+
+/**
+ * @brief   Host time per sample of the current chain, in blocks like a DMA half
+ */
+static double Test_NsPerSample(void)
+{
+    volatile uint16 Sink = 0U;
+    uint16 Output = 0U;
+    uint64_t Start;
+    uint32_t Block;
+
+    Test_FillInput(200U, 1U);
+    Start = TestHost_HostNs();
+    for (Block = 0U; Block < TEST_BENCH_BLOCKS; Block++)
+    {
+        (void)IoHwAb_FilterProcess(TEST_SIGNAL, &Test_Input[(Block * 7U) % (TEST_SAMPLES - TEST_BENCH_BLOCK)],
+                                   TEST_BENCH_BLOCK, 1U, &Output);
+        Sink = Output;
+    }
+    (void)Sink;
+
+    return (double)(TestHost_HostNs() - Start) / ((double)TEST_BENCH_BLOCKS * TEST_BENCH_BLOCK);
+}
+
+/**
+ * @brief   Invalid value until the first sample, which passes unchanged
+ */
+static void Test_NoOutputBeforeFirstSample(void)
+{
+    TEST_ASSERT_EQ(E_OK, IoHwAb_FilterInit());
+    TEST_ASSERT_EQ(IOHWAB_TEMP_INVALID_VALUE, IoHwAb_FilterGetOutput(TEST_SIGNAL));
+    TEST_ASSERT_EQ(1234U, Test_Step(1234U));
+    TEST_ASSERT_EQ(1234U, IoHwAb_FilterGetOutput(TEST_SIGNAL));
+
+    IoHwAb_FilterReset(TEST_SIGNAL);
+    TEST_ASSERT_EQ(IOHWAB_TEMP_INVALID_VALUE, IoHwAb_FilterGetOutput(TEST_SIGNAL));
+    TEST_ASSERT_EQ(3000U, Test_Step(3000U));
+}
+
+/**
+ * @brief   Rounded mean of the last 8 inputs, the first input fills the window
+ */
+static void Test_BoxcarIsRoundedMean(void)
+{
+    uint32_t Idx;
+
+    TEST_ASSERT_EQ(E_OK, Test_UseStage(IOHWAB_FILTER_BOXCAR, TEST_BOXCAR_LENGTH, 0U));
+    Test_FillInput(4095U, 0U);
+
+    for (Idx = 0U; Idx < TEST_SAMPLES; Idx++)
+    {
+        uint32_t Sum = 0U;
+        uint8 k;
+
+        for (k = 0U; k < TEST_BOXCAR_LENGTH; k++)
+        {
+            Sum += Test_Input[(Idx >= k) ? (Idx - k) : 0U];
+        }
+        TEST_ASSERT_EQ((Sum + (TEST_BOXCAR_LENGTH / 2U)) / TEST_BOXCAR_LENGTH, Test_Step(Test_Input[Idx]));
+    }
+}
+
+/**
+ * @brief   Within one code of y += alpha * (x - y) in double, for several weights
+ */
+static void Test_IirFollowsFloatModel(void)
+{
+    static const double Alphas[] = { 0.01, 0.25, 0.5, 0.99 };
+    uint8 a;
+
+    Test_FillInput(4095U, 0U);
+    for (a = 0U; a < (sizeof(Alphas) / sizeof(Alphas[0])); a++)
+    {
+        uint16 Alpha = IOHWAB_FILTER_Q15(Alphas[a]);
+        double Model = Test_Input[0];
+        uint32_t Idx;
+
+        TEST_ASSERT_EQ(E_OK, Test_UseStage(IOHWAB_FILTER_IIR, 0U, Alpha));
+        (void)Test_Step(Test_Input[0]);
+        for (Idx = 1U; Idx < TEST_SAMPLES; Idx++)
+        {
+            Model += ((double)Alpha / 32768.0) * ((double)Test_Input[Idx] - Model);
+            TEST_ASSERT(fabs((double)Test_Step(Test_Input[Idx]) - Model) <= 1.0);
+        }
+    }
+
+    /* Constant input settles exactly on it */
+    TEST_ASSERT_EQ(E_OK, Test_UseStage(IOHWAB_FILTER_IIR, 0U, IOHWAB_FILTER_Q15(0.01)));
+    (void)Test_Step(0U);
+    for (a = 0U; a < 250U; a++)
+    {
+        (void)Test_Step(4095U);
+        (void)Test_Step(4095U);
+        (void)Test_Step(4095U);
+        (void)Test_Step(4095U);
+    }
+    TEST_ASSERT_EQ(4095U, Test_Step(4095U));
+}
+
+/**
+ * @brief   Median of the last 5 and 15 inputs, with duplicates and spikes
+ */
+static void Test_MedianOfWindow(void)
+{
+    static const uint8 Lengths[] = { 1U, TEST_MEDIAN_LENGTH, TEST_WIDE_MEDIAN_LENGTH };
+    Adc_ValueGroupType History[TEST_SAMPLES + TEST_MAX_LENGTH];
+    uint8 l;
+
+    /* A narrow range repeats values, the spikes hit both ends of the sorted window */
+    Test_FillInput(6U, 3U);
+    for (l = 0U; l < (sizeof(Lengths) / sizeof(Lengths[0])); l++)
+    {
+        uint32_t Idx;
+
+        TEST_ASSERT_EQ(E_OK, Test_UseStage(IOHWAB_FILTER_MEDIAN, Lengths[l], 0U));
+        for (Idx = 0U; Idx < TEST_MAX_LENGTH; Idx++)
+        {
+            History[Idx] = Test_Input[0];
+        }
+        for (Idx = 0U; Idx < TEST_SAMPLES; Idx++)
+        {
+            History[TEST_MAX_LENGTH + Idx] = Test_Input[Idx];
+            TEST_ASSERT_EQ(Test_ReferenceMedian(&History[TEST_MAX_LENGTH + Idx], Lengths[l]),
+                           Test_Step(Test_Input[Idx]));
+        }
+    }
+}
+
+/**
+ * @brief   Stride 2 takes every other value of an interleaved buffer
+ */
+static void Test_StrideSelectsChannel(void)
+{
+    Adc_ValueGroupType Interleaved[2U * TEST_BOXCAR_LENGTH];
+    uint16 Output = 0U;
+    uint8 Idx;
+
+    for (Idx = 0U; Idx < TEST_BOXCAR_LENGTH; Idx++)
+    {
+        Interleaved[2U * Idx] = (Adc_ValueGroupType)(100U * (Idx + 1U));
+        Interleaved[(2U * Idx) + 1U] = 4095U;
+    }
+
+    TEST_ASSERT_EQ(E_OK, Test_UseStage(IOHWAB_FILTER_BOXCAR, TEST_BOXCAR_LENGTH, 0U));
+    TEST_ASSERT_EQ(E_OK, IoHwAb_FilterProcess(TEST_SIGNAL, Interleaved, TEST_BOXCAR_LENGTH, 2U, &Output));
+
+    /* 100..800, the first one fills the window: (100 * 1 + 200 + .. + 800) / 8 */
+    TEST_ASSERT_EQ(450U, Output);
+    TEST_ASSERT_EQ(E_NOT_OK, IoHwAb_FilterProcess(TEST_SIGNAL, Interleaved, 1U, 0U, &Output));
+}
+
+/**
+ * @brief   Lengths and weights the stages cannot run are refused at init
+ */
+static void Test_InvalidStageRejected(void)
+{
+    Adc_ValueGroupType Sample = 1000U;
+
+    TEST_ASSERT_EQ(E_NOT_OK, Test_UseStage(IOHWAB_FILTER_BOXCAR, 6U, 0U));
+    TEST_ASSERT_EQ(E_NOT_OK, IoHwAb_FilterProcess(TEST_SIGNAL, &Sample, 1U, 1U, NULL_PTR));
+    TEST_ASSERT_EQ(E_NOT_OK, Test_UseStage(IOHWAB_FILTER_MEDIAN, 4U, 0U));
+    TEST_ASSERT_EQ(E_NOT_OK, Test_UseStage(IOHWAB_FILTER_IIR, 0U, 0U));
+    TEST_ASSERT_EQ(E_NOT_OK, Test_UseStage(IOHWAB_FILTER_IIR, 0U, 32768U));
+    TEST_ASSERT_EQ(E_NOT_OK, IoHwAb_FilterProcess(IOHWAB_FILTER_MAX_SIGNALS, &Sample, 1U, 1U, NULL_PTR));
+    TEST_ASSERT_EQ(IOHWAB_TEMP_INVALID_VALUE, IoHwAb_FilterGetOutput(IOHWAB_FILTER_MAX_SIGNALS));
+}
+
+/**
+ * @brief   Configured median 5 + IIR: a single spike does not move the output,
+ *          a step does
+ */
+static void Test_ChainRejectsSpike(void)
+{
+    uint8 Idx;
+    uint16 Output = 0U;
+
+    TEST_ASSERT_EQ(E_OK, IoHwAb_FilterInit());
+    for (Idx = 0U; Idx < 20U; Idx++)
+    {
+        Output = Test_Step(1000U);
+    }
+    TEST_ASSERT_EQ(1000U, Output);
+
+    TEST_ASSERT_EQ(1000U, Test_Step(4095U));
+    TEST_ASSERT_EQ(1000U, Test_Step(0U));
+    for (Idx = 0U; Idx < 5U; Idx++)
+    {
+        TEST_ASSERT_EQ(1000U, Test_Step(1000U));
+    }
+
+    for (Idx = 0U; Idx < 40U; Idx++)
+    {
+        Output = Test_Step(2000U);
+    }
+    TEST_ASSERT_EQ(2000U, Output);
+}
+
+/**
+ * @brief   Host time per sample of each stage kind and of the configured chain
+ */
+static void Test_CostPerSample(void)
+{
+    TEST_ASSERT_EQ(E_OK, IoHwAb_FilterInit());
+    TestHost_Bench("TemperatureChain", Test_NsPerSample(), "host_ns_per_sample");
+
+    TEST_ASSERT_EQ(E_OK, Test_UseStage(IOHWAB_FILTER_BOXCAR, TEST_BOXCAR_LENGTH, 0U));
+    TestHost_Bench("Boxcar8", Test_NsPerSample(), "host_ns_per_sample");
+    TEST_ASSERT_EQ(E_OK, Test_UseStage(IOHWAB_FILTER_IIR, 0U, IOHWAB_FILTER_Q15(0.25)));
+    TestHost_Bench("Iir", Test_NsPerSample(), "host_ns_per_sample");
+    TEST_ASSERT_EQ(E_OK, Test_UseStage(IOHWAB_FILTER_MEDIAN, TEST_MEDIAN_LENGTH, 0U));
+    TestHost_Bench("Median5", Test_NsPerSample(), "host_ns_per_sample");
+    TEST_ASSERT_EQ(E_OK, Test_UseStage(IOHWAB_FILTER_MEDIAN, TEST_WIDE_MEDIAN_LENGTH, 0U));
+    TestHost_Bench("Median15", Test_NsPerSample(), "host_ns_per_sample");
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
@@ -0,0 +1,257 @@
+/****************************************************************************************
+*                                TEST_PORT.C                                            *
+****************************************************************************************
+* File Name   : Test_Port.c
+* Module      : Host Tests (TEST)
+* Description : Port_Init register images against the per-pin GPIO_Init path they
+*               replace, bit for bit
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * The per-pin path is the driver's own: Port_RefreshPortDirection calls
+ * Port_ApplyPinConfig, which enables the port clock and runs GPIO_Init (plus
+ * GPIO_SetBits/ResetBits for a DIO output) for each pin, like Port_Init did before
+ * it used register images. A configuration with empty images makes Port_Init
+ * touch no GPIO register, so the refresh is the only writer.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "TestHost.h"
+#include "Port.h"
+#include "Port_Cfg.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_CR_RESET               0x44444444UL    /*!< CRL/CRH after reset, floating inputs */
+#define TEST_MATRIX_PORT            PORT_ID_B       /*!< Not used by the shipped pins */
+
+/****************************************************************************************
+*                              LOCAL TYPES                                             *
+****************************************************************************************/
+typedef struct
+{
+    uint32_t Crl[PORT_NBR_OF_PORTS];
+    uint32_t Crh[PORT_NBR_OF_PORTS];
+    uint32_t Odr[PORT_NBR_OF_PORTS];
+    uint32_t Apb2Enr;
+} Test_PortStateType;
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static const Port_PortImageType Test_NoImages[PORT_NBR_OF_PORTS];
+static uint32_t Test_Apb2EnrReset;
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void Test_ResetPorts(uint32_t Odr);
+static void Test_Snapshot(Test_PortStateType* State);
+static void Test_ApplyPerPin(const Port_PinConfigType* Pins, uint8 Count);
+static void Test_CheckPin(const Port_PinConfigType* Pin);
+static void Test_InitMatchesPerPinPath(void);
+static void Test_ConfiguredPinsMatchGpioInit(void);
+static void Test_EveryPinSettingMatchesGpioInit(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("Port");
+    TestHost_Run("InitMatchesPerPinPath", Test_InitMatchesPerPinPath);
+    TestHost_Run("ConfiguredPinsMatchGpioInit", Test_ConfiguredPinsMatchGpioInit);
+    TestHost_Run("EveryPinSettingMatchesGpioInit", Test_EveryPinSettingMatchesGpioInit);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   Put ports A..D and the APB2 clocks back to their state before Port_Init
+ */
+static void Test_ResetPorts(uint32_t Odr)
+{
+    uint8 Port;
+
+    for (Port = 0U; Port < PORT_NBR_OF_PORTS; Port++)
+    {
+        PORT_GET_PORT(Port)->CRL = TEST_CR_RESET;
+        PORT_GET_PORT(Port)->CRH = TEST_CR_RESET;
+        PORT_GET_PORT(Port)->ODR = Odr;
+    }
+    RCC->APB2ENR = Test_Apb2EnrReset;
+}
+
+static void Test_Snapshot(Test_PortStateType* State)
+{
+    uint8 Port;
+
+    for (Port = 0U; Port < PORT_NBR_OF_PORTS; Port++)
+    {
+        State->Crl[Port] = HostSim_PeekRegister(&PORT_GET_PORT(Port)->CRL);
+        State->Crh[Port] = HostSim_PeekRegister(&PORT_GET_PORT(Port)->CRH);
+        State->Odr[Port] = HostSim_PeekRegister(&PORT_GET_PORT(Port)->ODR) & 0xFFFFU;
+    }
+    State->Apb2Enr = HostSim_PeekRegister(&RCC->APB2ENR);
+}
+
+/**
+ * @brief   Configure Pins one GPIO_Init at a time, through Port_RefreshPortDirection
+ */
+static void Test_ApplyPerPin(const Port_PinConfigType* Pins, uint8 Count)
+{
+    const Port_ConfigType Config =
+    {
+        .PinCount = Count,
+        .PinConfigs = Pins,
+        .Apb2EnableMask = 0UL,
+        .PortImages = Test_NoImages,
+    };
+    uint8 Pin;
+
+    /* The refresh skips pins whose direction may change, they would go untested */
+    for (Pin = 0U; Pin < Count; Pin++)
+    {
+        TEST_ASSERT_EQ(0U, Pins[Pin].DirectionChangeable);
+    }
+    Port_Init(&Config);
+    Port_RefreshPortDirection();
+}
+
+/**
+ * @brief   One pin from reset, with ODR all low then all high: the per-pin path
+ *          writes exactly the nibble and the BSRR bits the image macros give
+ */
+static void Test_CheckPin(const Port_PinConfigType* Pin)
+{
+    static const uint32_t OdrBefore[2] = { 0x0000U, 0xFFFFU };
+    GPIO_TypeDef* GPIOx = PORT_GET_PORT(Pin->PortNum);
+    uint32_t Shift = PORT_PIN_CR_SHIFT(Pin->PinNum);
+    uint32_t Nibble = PORT_PIN_CNF_MODE(Pin->Mode, Pin->Direction, Pin->Pull, Pin->Speed);
+    uint32_t Bsrr = PORT_PIN_BSRR(Pin->PinNum, Pin->Mode, Pin->Direction, Pin->Level, Pin->Pull);
+    uint32_t ExpectCrl = TEST_CR_RESET;
+    uint32_t ExpectCrh = TEST_CR_RESET;
+    uint8 Run;
+
+    if (Pin->PinNum < 8U)
+    {
+        ExpectCrl = (TEST_CR_RESET & ~(0xFUL << Shift)) | (Nibble << Shift);
+    }
+    else
+    {
+        ExpectCrh = (TEST_CR_RESET & ~(0xFUL << Shift)) | (Nibble << Shift);
+    }
+
+    for (Run = 0U; Run < 2U; Run++)
+    {
+        Test_ResetPorts(OdrBefore[Run]);
+        Test_ApplyPerPin(Pin, 1U);
+        TEST_ASSERT_EQ(ExpectCrl, HostSim_PeekRegister(&GPIOx->CRL));
+        TEST_ASSERT_EQ(ExpectCrh, HostSim_PeekRegister(&GPIOx->CRH));
+        TEST_ASSERT_EQ((OdrBefore[Run] | (Bsrr & 0xFFFFU)) & ~(Bsrr >> 16),
+                       HostSim_PeekRegister(&GPIOx->ODR) & 0xFFFFU);
+        TEST_ASSERT_EQ(Test_Apb2EnrReset | PORT_GET_APB2_CLOCK(Pin->PortNum),
+                       HostSim_PeekRegister(&RCC->APB2ENR));
+    }
+}
+
+/**
+ * @brief   From reset, Port_Init with the shipped images leaves CRL, CRH, ODR and
+ *          APB2ENR exactly as the per-pin path over PortCfg_Pins does
+ */
+static void Test_InitMatchesPerPinPath(void)
+{
+    Test_PortStateType Images;
+    Test_PortStateType PerPin;
+    uint8 Port;
+
+    Test_Apb2EnrReset = HostSim_PeekRegister(&RCC->APB2ENR);
+
+    Test_ResetPorts(0U);
+    Port_Init(&PortCfg_Port);
+    Test_Snapshot(&Images);
+
+    Test_ResetPorts(0U);
+    Test_ApplyPerPin(PortCfg_Pins, PortCfg_PinsCount);
+    Test_Snapshot(&PerPin);
+
+    for (Port = 0U; Port < PORT_NBR_OF_PORTS; Port++)
+    {
+        TEST_ASSERT_EQ(PerPin.Crl[Port], Images.Crl[Port]);
+        TEST_ASSERT_EQ(PerPin.Crh[Port], Images.Crh[Port]);
+        TEST_ASSERT_EQ(PerPin.Odr[Port], Images.Odr[Port]);
+    }
+    TEST_ASSERT_EQ(PerPin.Apb2Enr, Images.Apb2Enr);
+}
+
+/**
+ * @brief   Every PortCfg_Pins entry on its own matches its share of the images
+ */
+static void Test_ConfiguredPinsMatchGpioInit(void)
+{
+    uint8 Pin;
+
+    Test_Apb2EnrReset = HostSim_PeekRegister(&RCC->APB2ENR);
+    for (Pin = 0U; Pin < PortCfg_PinsCount; Pin++)
+    {
+        const Port_PinConfigType* Cfg = &PortCfg_Pins[Pin];
+        const Port_PortImageType* Image = &PortCfg_Port.PortImages[Cfg->PortNum];
+        uint32_t Shift = PORT_PIN_CR_SHIFT(Cfg->PinNum);
+        uint32_t Field = (Cfg->PinNum < 8U) ? Image->Crl : Image->Crh;
+
+        Test_CheckPin(Cfg);
+        TEST_ASSERT_EQ(PORT_PIN_CNF_MODE(Cfg->Mode, Cfg->Direction, Cfg->Pull, Cfg->Speed),
+                       (Field >> Shift) & 0xFU);
+    }
+}
+
+/**
+ * @brief   The image macros against GPIO_Init for every mode, direction, pull, level
+ *          and speed, on a low pin and on a high pin
+ */
+static void Test_EveryPinSettingMatchesGpioInit(void)
+{
+    static const Port_PinModeType Modes[] =
+        { PORT_PIN_MODE_DIO, PORT_PIN_MODE_ADC, PORT_PIN_MODE_PWM };
+    static const Port_PinSpeedType Speeds[] =
+        { PORT_PIN_SPEED_10MHZ, PORT_PIN_SPEED_2MHZ, PORT_PIN_SPEED_50MHZ };
+    static const Port_PinType PinNums[] = { 0U, 7U, 8U, 15U };
+    Port_PinConfigType Pin;
+    uint8 Mode, Direction, Pull, Level, Speed, Num;
+
+    Test_Apb2EnrReset = HostSim_PeekRegister(&RCC->APB2ENR);
+    (void)memset(&Pin, 0, sizeof(Pin));
+    Pin.PortNum = TEST_MATRIX_PORT;
+
+    for (Mode = 0U; Mode < (sizeof(Modes) / sizeof(Modes[0])); Mode++)
+    for (Direction = PORT_PIN_IN; Direction <= PORT_PIN_OUT; Direction++)
+    for (Pull = PORT_PIN_PULL_NONE; Pull <= PORT_PIN_PULL_DOWN; Pull++)
+    for (Level = PORT_PIN_LEVEL_LOW; Level <= PORT_PIN_LEVEL_HIGH; Level++)
+    for (Speed = 0U; Speed < (sizeof(Speeds) / sizeof(Speeds[0])); Speed++)
+    for (Num = 0U; Num < (sizeof(PinNums) / sizeof(PinNums[0])); Num++)
+    {
+        Pin.Mode = Modes[Mode];
+        Pin.Direction = (Port_PinDirectionType)Direction;
+        Pin.Pull = Pull;
+        Pin.Level = (Port_PinLevelType)Level;
+        Pin.Speed = Speeds[Speed];
+        Pin.PinNum = PinNums[Num];
+        Test_CheckPin(&Pin);
+    }
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
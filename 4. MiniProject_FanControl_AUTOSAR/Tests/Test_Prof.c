@@ -0,0 +1,259 @@
+/****************************************************************************************
+*                                TEST_PROF.C                                            *
+****************************************************************************************
+* File Name   : Test_Prof.c
+* Module      : Host Tests (TEST)
+* Description : Prof statistics, the CSV dump and the probes in the drivers and
+*               interrupt handlers, on the clock_gettime time source
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * On the host build a sample is nanoseconds of host time, so the driver cases only
+ * check what does not depend on the machine: one sample per call or handler entry,
+ * nothing for a call Det rejects, and min <= avg <= max. The statistics and the
+ * dump are checked with samples recorded by hand.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "TestHost.h"
+#include "Dio.h"
+#include "Prof.h"
+#include "Adc.h"
+#include "Pwm.h"
+#include "Det.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_DUMP_SIZE              512U
+#define TEST_CALLS                  100U
+#define TEST_BAD_CHANNEL            (DIO_NUM_PORTS * 16U)   /*!< First ID past port D */
+#define TEST_STREAM_GROUP           1U      /*!< Circular TIM3 TRGO stream, 1 kHz */
+#define TEST_CYCLES_PER_MS          72000ULL
+#define TEST_BENCH_PAIRS            100000U
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static char Test_Dump[TEST_DUMP_SIZE];
+static uint32_t Test_DumpLines;
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void Test_Write(const char* Text);
+static void Test_CheckSane(Prof_ProbeType Probe, uint32_t Count);
+static void Test_RecordKeepsStats(void);
+static void Test_DumpWritesCsv(void);
+static void Test_ApiProbesCountCalls(void);
+static void Test_IsrProbesCountEntries(void);
+static void Test_ProbeCost(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("Prof");
+    TestHost_Run("RecordKeepsStats", Test_RecordKeepsStats);
+    TestHost_Run("DumpWritesCsv", Test_DumpWritesCsv);
+    TestHost_Run("ApiProbesCountCalls", Test_ApiProbesCountCalls);
+    TestHost_Run("IsrProbesCountEntries", Test_IsrProbesCountEntries);
+    TestHost_Run("ProbeCost", Test_ProbeCost);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   Prof_Dump sink, collects the lines
+ */
+static void Test_Write(const char* Text)
+{
+    TEST_ASSERT((strlen(Test_Dump) + strlen(Text)) < TEST_DUMP_SIZE);
+    (void)strcat(Test_Dump, Text);
+    Test_DumpLines++;
+}
+
+/**
+ * @brief   Probe has Count samples and an average between its min and max
+ */
+static void Test_CheckSane(Prof_ProbeType Probe, uint32_t Count)
+{
+    Prof_StatsType Stats;
+
+    TEST_ASSERT_EQ(E_OK, Prof_GetStats(Probe, &Stats));
+    TEST_ASSERT_EQ(Count, Stats.Count);
+    if (Count > 0U)
+    {
+        TEST_ASSERT(Stats.Min <= Stats.Max);
+        TEST_ASSERT_RANGE((uint64_t)Stats.Min * Count, (uint64_t)Stats.Max * Count, Stats.Total);
+    }
+}
+
+/**
+ * @brief   Count, min, max and total of hand recorded samples, other probes and
+ *          invalid arguments untouched, Prof_Reset clears
+ */
+static void Test_RecordKeepsStats(void)
+{
+    Prof_StatsType Stats;
+
+    Prof_Init();
+    Prof_Record(PROF_PROBE_ADC_READ_GROUP, 5U);
+    Prof_Record(PROF_PROBE_ADC_READ_GROUP, 2U);
+    Prof_Record(PROF_PROBE_ADC_READ_GROUP, 9U);
+    Prof_Record(PROF_NBR_OF_PROBES, 1U);
+
+    TEST_ASSERT_EQ(E_OK, Prof_GetStats(PROF_PROBE_ADC_READ_GROUP, &Stats));
+    TEST_ASSERT_EQ(3U, Stats.Count);
+    TEST_ASSERT_EQ(2U, Stats.Min);
+    TEST_ASSERT_EQ(9U, Stats.Max);
+    TEST_ASSERT_EQ(16U, Stats.Total);
+
+    TEST_ASSERT_EQ(E_OK, Prof_GetStats(PROF_PROBE_ADC_STOP_GROUP, &Stats));
+    TEST_ASSERT_EQ(0U, Stats.Count);
+    TEST_ASSERT_EQ(0xFFFFFFFFUL, Stats.Min);
+    TEST_ASSERT_EQ(0U, Stats.Max);
+
+    TEST_ASSERT_EQ(E_NOT_OK, Prof_GetStats(PROF_NBR_OF_PROBES, &Stats));
+    TEST_ASSERT_EQ(E_NOT_OK, Prof_GetStats(PROF_PROBE_ADC_READ_GROUP, NULL_PTR));
+
+    Prof_Reset();
+    TEST_ASSERT_EQ(E_OK, Prof_GetStats(PROF_PROBE_ADC_READ_GROUP, &Stats));
+    TEST_ASSERT_EQ(0U, Stats.Count);
+    TEST_ASSERT_EQ(0xFFFFFFFFUL, Stats.Min);
+    TEST_ASSERT_EQ(0U, Stats.Total);
+}
+
+/**
+ * @brief   Header, then one line per probe with samples in probe order, one Write
+ *          per line, full uint32 range printed
+ */
+static void Test_DumpWritesCsv(void)
+{
+    Prof_Init();
+    Prof_Dump(Test_Write);
+    TEST_ASSERT_EQ(0, strcmp("probe,count,min,max,avg\n", Test_Dump));
+    TEST_ASSERT_EQ(1U, Test_DumpLines);
+
+    Test_Dump[0] = '\0';
+    Test_DumpLines = 0U;
+    Prof_Record(PROF_PROBE_STARTUP, 0xFFFFFFFFUL);
+    Prof_Record(PROF_PROBE_DIO_WRITE_CHANNEL, 7U);
+    Prof_Record(PROF_PROBE_DIO_WRITE_CHANNEL, 10U);
+    Prof_Record(PROF_PROBE_ADC1_2_IRQ, 0U);
+    Prof_Dump(Test_Write);
+
+    TEST_ASSERT_EQ(0, strcmp("probe,count,min,max,avg\n"
+                             "ADC1_2_IRQHandler,1,0,0,0\n"
+                             "Dio_WriteChannel,2,7,10,8\n"
+                             "Reset_Handler,1,4294967295,4294967295,4294967295\n", Test_Dump));
+    TEST_ASSERT_EQ(4U, Test_DumpLines);
+
+    /* A NULL sink is ignored */
+    Prof_Dump(NULL_PTR);
+}
+
+/**
+ * @brief   One sample per driver call that passes Det, none for a rejected one
+ */
+static void Test_ApiProbesCountCalls(void)
+{
+    Adc_ValueGroupType Buffer[1];
+    Adc_ValueGroupType Value;
+    uint32_t Call;
+
+    Det_Init();
+    Prof_Init();
+
+    for (Call = 0U; Call < TEST_CALLS; Call++)
+    {
+        Dio_WriteChannel(DIO_CHANNEL_C13, (Dio_LevelType)(Call & 1U));
+        (void)Dio_ReadChannel(DIO_CHANNEL_C13);
+    }
+    Dio_WriteChannel(TEST_BAD_CHANNEL, STD_HIGH);
+    (void)Dio_ReadChannel(TEST_BAD_CHANNEL);
+    Test_CheckSane(PROF_PROBE_DIO_WRITE_CHANNEL, TEST_CALLS);
+    Test_CheckSane(PROF_PROBE_DIO_READ_CHANNEL, TEST_CALLS);
+    TEST_ASSERT_EQ(2U, Det_GetErrorCount(DIO_E_PARAM_INVALID_CHANNEL_ID));
+
+    Pwm_Init(&Pwm_Config);
+    Pwm_SetDutyCycle(PWM_CHANNEL_0, 0x2000U);
+    Pwm_SetDutyCycle(PWM_CHANNEL_0, 0x9000U);
+    Test_CheckSane(PROF_PROBE_PWM_SET_DUTY, 1U);
+
+    /* Group 0: SW one-shot, read once it completed, read and stop again while idle */
+    Adc_Init(&Adc_Config);
+    TEST_ASSERT_EQ(E_OK, Adc_SetupResultBuffer(0U, Buffer));
+    Adc_StartGroupConversion(0U);
+    HostSim_Advance(TEST_CYCLES_PER_MS);
+    TEST_ASSERT_EQ(E_OK, Adc_ReadGroup(0U, &Value));
+    TEST_ASSERT_EQ(E_NOT_OK, Adc_ReadGroup(0U, &Value));
+    Adc_StopGroupConversion(0U);
+    Test_CheckSane(PROF_PROBE_ADC_START_GROUP, 1U);
+    Test_CheckSane(PROF_PROBE_ADC_READ_GROUP, 1U);
+    Test_CheckSane(PROF_PROBE_ADC_STOP_GROUP, 0U);
+}
+
+/**
+ * @brief   One sample per handler entry, counted against the model's interrupt counts
+ */
+static void Test_IsrProbesCountEntries(void)
+{
+    Det_Init();
+    Prof_Init();
+    Pwm_Init(&Pwm_Config);
+    Pwm_EnableNotification(PWM_CHANNEL_0, PWM_BOTH_EDGES);
+    Adc_Init(&Adc_Config);
+    Adc_EnableHardwareTrigger(TEST_STREAM_GROUP);
+
+    HostSim_Advance(40U * TEST_CYCLES_PER_MS);
+
+    TEST_ASSERT(HostSim_GetInterruptCount(DMA1_Channel1_IRQn) > 0U);
+    TEST_ASSERT(HostSim_GetInterruptCount(TIM1_CC_IRQn) > 0U);
+    Test_CheckSane(PROF_PROBE_DMA1_CH1_IRQ, HostSim_GetInterruptCount(DMA1_Channel1_IRQn));
+    Test_CheckSane(PROF_PROBE_TIM1_IRQ, HostSim_GetInterruptCount(TIM1_UP_IRQn) +
+                                        HostSim_GetInterruptCount(TIM1_CC_IRQn));
+    Test_CheckSane(PROF_PROBE_ADC1_2_IRQ, HostSim_GetInterruptCount(ADC1_2_IRQn));
+    Test_CheckSane(PROF_PROBE_TIM3_IRQ, HostSim_GetInterruptCount(TIM3_IRQn));
+}
+
+/**
+ * @brief   Host cost of an empty PROF_BEGIN/PROF_END pair, and the shortest sample
+ *          it records: the resolution the host reports can show
+ */
+static void Test_ProbeCost(void)
+{
+    Prof_StatsType Stats;
+    uint64_t Start;
+    uint32_t Pair;
+
+    Prof_Init();
+    Start = TestHost_HostNs();
+    for (Pair = 0U; Pair < TEST_BENCH_PAIRS; Pair++)
+    {
+        PROF_BEGIN(PROF_PROBE_ADC_READ_GROUP);
+        PROF_END(PROF_PROBE_ADC_READ_GROUP);
+    }
+    TestHost_Bench("ProbePair", (double)(TestHost_HostNs() - Start) / TEST_BENCH_PAIRS, "host_ns");
+
+    Test_CheckSane(PROF_PROBE_ADC_READ_GROUP, TEST_BENCH_PAIRS);
+    TEST_ASSERT_EQ(E_OK, Prof_GetStats(PROF_PROBE_ADC_READ_GROUP, &Stats));
+    TestHost_Bench("EmptyProbeMin", (double)Stats.Min, "host_ns");
+    TestHost_Bench("EmptyProbeAvg", (double)Stats.Total / Stats.Count, "host_ns");
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
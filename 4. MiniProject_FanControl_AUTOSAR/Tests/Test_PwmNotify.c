@@ -0,0 +1,217 @@
+/****************************************************************************************
+*                                TEST_PWMNOTIFY.C                                       *
+****************************************************************************************
+* File Name   : Test_PwmNotify.c
+* Module      : Host Tests (TEST)
+* Description : TIM notification dispatch: one callback per edge, falling edges from
+*               the compare flags, one SR read and clear per handler entry
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * PWM_CHANNEL_0 is TIM1 CH1, the only channel of the shipped configuration, so it is
+ * the only entry of the callback table. Its rising edge is the update event, its
+ * falling edge the CC1 match. CC2 is the ADC sample point, CC3 and CC4 are armed by
+ * hand to put more than one compare flag through the same handler entry; with no
+ * channel mapped on them they must be cleared without a callback.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+
+#include "TestHost.h"
+#include "Pwm.h"
+#include "Pwm_Hw.h"
+#include "Det.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_TICK_CYCLES            72ULL   /*!< 1 MHz timer clock */
+#define TEST_PERIOD_CYCLES          (PWM_DEFAULT_PERIOD * TEST_TICK_CYCLES)
+#define TEST_PERIODS                20U
+#define TEST_MAX_CALLS              64U
+
+#define TEST_DUTY                   0x2000U /*!< 25 %, rising and falling apart in time */
+#define TEST_FALLING_TICKS          (PWM_DEFAULT_PERIOD / 4U)
+#define TEST_CC3_TICKS              10U     /*!< Flag raised, interrupt not enabled */
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static volatile uint16_t Test_CallCnt[TEST_MAX_CALLS];
+static volatile uint32_t Test_Calls;
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static void Test_Notify(void);
+static void Test_Start(Pwm_EdgeNotificationType Edge);
+static void Test_CountEdges(uint32_t* Rising, uint32_t* Falling);
+static void Test_BothEdgesOncePerPeriod(void);
+static void Test_FallingEdgeOnly(void);
+static void Test_CompareFlagsShareEntry(void);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("PwmNotify");
+    TestHost_Run("BothEdgesOncePerPeriod", Test_BothEdgesOncePerPeriod);
+    TestHost_Run("FallingEdgeOnly", Test_FallingEdgeOnly);
+    TestHost_Run("CompareFlagsShareEntry", Test_CompareFlagsShareEntry);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   PWM_CHANNEL_0 notification, keeps the counter value of every call
+ */
+static void Test_Notify(void)
+{
+    if (Test_Calls < TEST_MAX_CALLS)
+    {
+        Test_CallCnt[Test_Calls] = (uint16_t)TIM1->CNT;
+    }
+    Test_Calls++;
+}
+
+/**
+ * @brief   PWM running at TEST_DUTY with Test_Notify on PWM_CHANNEL_0 for Edge
+ */
+static void Test_Start(Pwm_EdgeNotificationType Edge)
+{
+    Det_Init();
+    Pwm_ChannelConfig[PWM_CHANNEL_0].NotificationPtr = Test_Notify;
+    Pwm_Init(&Pwm_Config);
+    Pwm_SetDutyCycle(PWM_CHANNEL_0, TEST_DUTY);
+    TEST_ASSERT_EQ(TEST_FALLING_TICKS, HostSim_PeekRegister(&TIM1->CCR1));
+    /* The update event of Pwm_Init is still flagged, it is not an edge to report */
+    TEST_ASSERT(HostSim_PeekRegister(&TIM1->SR) & TIM_IT_Update);
+    Pwm_EnableNotification(PWM_CHANNEL_0, Edge);
+}
+
+/**
+ * @brief   Sorts the calls by the counter value they saw: 0 after the update event,
+ *          CCR1 at the compare match, nothing else
+ */
+static void Test_CountEdges(uint32_t* Rising, uint32_t* Falling)
+{
+    uint32_t Call;
+
+    *Rising = 0U;
+    *Falling = 0U;
+    TEST_ASSERT(Test_Calls <= TEST_MAX_CALLS);
+    for (Call = 0U; Call < Test_Calls; Call++)
+    {
+        if (Test_CallCnt[Call] == 0U)
+        {
+            (*Rising)++;
+        }
+        else
+        {
+            TEST_ASSERT_EQ(TEST_FALLING_TICKS, Test_CallCnt[Call]);
+            (*Falling)++;
+        }
+    }
+}
+
+/**
+ * @brief   Rising edge on the update event, falling edge on the CC1 match, one call
+ *          each per period and one handler entry per edge. The flag pending at
+ *          Pwm_EnableNotification is dropped, the first call is the CC1 match.
+ */
+static void Test_BothEdgesOncePerPeriod(void)
+{
+    Det_ErrorEntryType Entry;
+    uint32_t Rising;
+    uint32_t Falling;
+    uint32_t Call;
+
+    Test_Start(PWM_BOTH_EDGES);
+    TEST_ASSERT_EQ(TIM_IT_Update | TIM_IT_CC1, HostSim_PeekRegister(&TIM1->DIER) & PWM_HW_IRQ_FLAGS_MASK);
+    HostSim_Advance(TEST_PERIODS * TEST_PERIOD_CYCLES);
+
+    Test_CountEdges(&Rising, &Falling);
+    TEST_ASSERT_EQ(TEST_FALLING_TICKS, Test_CallCnt[0]);
+    TEST_ASSERT_RANGE(TEST_PERIODS - 1U, TEST_PERIODS + 1U, Rising);
+    TEST_ASSERT_RANGE(TEST_PERIODS - 1U, TEST_PERIODS + 1U, Falling);
+    for (Call = 1U; Call < Test_Calls; Call++)
+    {
+        TEST_ASSERT(Test_CallCnt[Call] != Test_CallCnt[Call - 1U]);
+    }
+    TEST_ASSERT_EQ(Rising, HostSim_GetInterruptCount(TIM1_UP_IRQn));
+    TEST_ASSERT_EQ(Falling, HostSim_GetInterruptCount(TIM1_CC_IRQn));
+    TEST_ASSERT_EQ(0U, HostSim_PeekRegister(&TIM1->SR) & HostSim_PeekRegister(&TIM1->DIER) & PWM_HW_IRQ_FLAGS_MASK);
+    TEST_ASSERT_EQ(0U, Det_Drain(&Entry, 1U));
+}
+
+/**
+ * @brief   Falling edge alone: CC1 interrupt only, no update interrupt, no rising call,
+ *          and nothing more once disabled
+ */
+static void Test_FallingEdgeOnly(void)
+{
+    uint32_t Rising;
+    uint32_t Falling;
+
+    Test_Start(PWM_FALLING_EDGE);
+    TEST_ASSERT_EQ(TIM_IT_CC1, HostSim_PeekRegister(&TIM1->DIER) & PWM_HW_IRQ_FLAGS_MASK);
+    HostSim_Advance(TEST_PERIODS * TEST_PERIOD_CYCLES);
+
+    Test_CountEdges(&Rising, &Falling);
+    TEST_ASSERT_EQ(0U, Rising);
+    TEST_ASSERT_RANGE(TEST_PERIODS - 1U, TEST_PERIODS, Falling);
+    TEST_ASSERT_EQ(0U, HostSim_GetInterruptCount(TIM1_UP_IRQn));
+    TEST_ASSERT_EQ(Falling, HostSim_GetInterruptCount(TIM1_CC_IRQn));
+
+    Pwm_DisableNotification(PWM_CHANNEL_0);
+    TEST_ASSERT_EQ(0U, HostSim_PeekRegister(&TIM1->DIER) & PWM_HW_IRQ_FLAGS_MASK);
+    HostSim_Advance(TEST_PERIODS * TEST_PERIOD_CYCLES);
+    TEST_ASSERT_EQ(Falling, Test_Calls);
+}
+
+/**
+ * @brief   CC4 matches together with CC1, CC2 alone at the sample point, CC3 with its
+ *          interrupt off: one entry per distinct match, one call per falling edge,
+ *          the flag nobody enabled left pending
+ */
+static void Test_CompareFlagsShareEntry(void)
+{
+    uint32_t Rising;
+    uint32_t Falling;
+    uint32_t Entries;
+
+    Test_Start(PWM_FALLING_EDGE);
+    TIM1->CCR3 = TEST_CC3_TICKS;
+    TIM1->CCR4 = TEST_FALLING_TICKS;
+    TIM_ITConfig(TIM1, TIM_IT_CC2 | TIM_IT_CC4, ENABLE);
+    TEST_ASSERT(HostSim_PeekRegister(&TIM1->CCR2) != TEST_FALLING_TICKS);
+    TEST_ASSERT(HostSim_PeekRegister(&TIM1->CCR2) != TEST_CC3_TICKS);
+
+    HostSim_Advance(TEST_PERIODS * TEST_PERIOD_CYCLES);
+
+    Test_CountEdges(&Rising, &Falling);
+    TEST_ASSERT_EQ(0U, Rising);
+    TEST_ASSERT_RANGE(TEST_PERIODS - 1U, TEST_PERIODS, Falling);
+
+    /* CC1 + CC4 in one entry, CC2 in another */
+    Entries = HostSim_GetInterruptCount(TIM1_CC_IRQn);
+    TEST_ASSERT_RANGE(2U * Falling - 1U, 2U * Falling + 1U, Entries);
+    TEST_ASSERT_EQ(0U, HostSim_PeekRegister(&TIM1->SR) & HostSim_PeekRegister(&TIM1->DIER) & PWM_HW_IRQ_FLAGS_MASK);
+    TEST_ASSERT(HostSim_PeekRegister(&TIM1->SR) & TIM_IT_CC3);
+
+    TestHost_Bench("HandlerEntriesPerPeriod", (double)Entries / Falling, "entries");
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
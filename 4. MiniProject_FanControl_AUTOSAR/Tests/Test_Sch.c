@@ -0,0 +1,362 @@
+/****************************************************************************************
+*                                TEST_SCH.C                                             *
+****************************************************************************************
+* File Name   : Test_Sch.c
+* Module      : Host Tests (TEST)
+* Description : Time-triggered scheduler on the simulated SysTick: release ticks,
+*               table order, overrun and late tick accounting, configuration checks
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************/
+
+/*
+ * Sch_Start never returns. Each case sets a stop time and runs the real dispatch
+ * loop, the model calls Test_Stop from WFI once the clock reaches it, so every tick
+ * before the stop time has been dispatched. Test_Stop runs the checks of the case
+ * and ends the child. Ticks are numbered from 0, tick N is raised at (N + 1) ms.
+ * A task consumes simulated time by advancing the model from thread context.
+ */
+
+/****************************************************************************************
+*                                 INCLUDE FILES                                        *
+****************************************************************************************/
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "TestHost.h"
+#include "Sch.h"
+#include "Sch_Cfg.h"
+#include "IoHwAb.h"
+
+/****************************************************************************************
+*                              LOCAL DEFINES                                           *
+****************************************************************************************/
+#define TEST_CYCLES_PER_TICK        72000ULL    /*!< SCH_TICK_HZ at 72 MHz */
+#define TEST_MAX_RUNS               128U
+#define TEST_TASKS                  3U
+
+#define TEST_RELEASE_TICKS          100U
+#define TEST_ORDER_TICKS            40U         /*!< 3 runs every other tick fit the log */
+#define TEST_OVERRUN_TICKS          50U
+#define TEST_OVERRUN_CYCLES         180000ULL   /*!< 2.5 ticks */
+#define TEST_STAMP_CYCLES           16U         /*!< Register reads of two cycle stamps */
+
+/****************************************************************************************
+*                              LOCAL TYPES                                             *
+****************************************************************************************/
+typedef struct
+{
+    uint32_t Runs;                      /*!< Activations seen by the task body */
+    uint32_t Tick[TEST_MAX_RUNS];       /*!< Tick of each activation */
+} Test_TaskLogType;
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static uint32_t Test_CurrentTick(void);
+static void Test_Log(uint8_t TaskId);
+static void Test_Task0(void);
+static void Test_Task1(void);
+static void Test_Task2(void);
+static void Test_SlowTask(void);
+static void Test_Stop(void);
+static void Test_RunTicks(const Sch_ConfigType* Config, uint32_t Ticks, void (*Check)(void));
+static void Test_CheckReleases(const Sch_ConfigType* Config, uint32_t Ticks);
+static void Test_CheckPeriodAndOffset(void);
+static void Test_CheckTableOrder(void);
+static void Test_CheckOverrun(void);
+static void Test_PeriodAndOffset(void);
+static void Test_SameTickTableOrder(void);
+static void Test_OverrunAndLateTicks(void);
+static void Test_InitRejectsBadConfig(void);
+static void Test_ShippedTable(void);
+
+/****************************************************************************************
+*                              LOCAL VARIABLES                                         *
+****************************************************************************************/
+static Test_TaskLogType Test_TaskLog[TEST_TASKS];
+static uint8_t Test_Order[TEST_MAX_RUNS];
+static uint32_t Test_OrderCount;
+static void (*Test_CheckFunc)(void);
+
+/* One task every tick, a 10 tick and a 7 tick task starting on their own offsets */
+static const Sch_TaskConfigType Test_PeriodTasks[TEST_TASKS] =
+{
+    { .Sch_TaskFunc = Test_Task0, .Sch_PeriodTicks = 1U,  .Sch_OffsetTicks = 0U, .Sch_BudgetUs = 50U },
+    { .Sch_TaskFunc = Test_Task1, .Sch_PeriodTicks = 10U, .Sch_OffsetTicks = 1U, .Sch_BudgetUs = 50U },
+    { .Sch_TaskFunc = Test_Task2, .Sch_PeriodTicks = 7U,  .Sch_OffsetTicks = 5U, .Sch_BudgetUs = 50U },
+};
+static const Sch_ConfigType Test_PeriodConfig =
+{
+    .Sch_Tasks = Test_PeriodTasks, .Sch_NbrOfTasks = TEST_TASKS, .Sch_TickHz = SCH_TICK_HZ
+};
+
+/* Three tasks released together every other tick, listed out of ID order */
+static const Sch_TaskConfigType Test_OrderTasks[TEST_TASKS] =
+{
+    { .Sch_TaskFunc = Test_Task2, .Sch_PeriodTicks = 2U, .Sch_OffsetTicks = 0U, .Sch_BudgetUs = 50U },
+    { .Sch_TaskFunc = Test_Task0, .Sch_PeriodTicks = 2U, .Sch_OffsetTicks = 0U, .Sch_BudgetUs = 50U },
+    { .Sch_TaskFunc = Test_Task1, .Sch_PeriodTicks = 2U, .Sch_OffsetTicks = 0U, .Sch_BudgetUs = 50U },
+};
+static const Sch_ConfigType Test_OrderConfig =
+{
+    .Sch_Tasks = Test_OrderTasks, .Sch_NbrOfTasks = TEST_TASKS, .Sch_TickHz = SCH_TICK_HZ
+};
+
+/* Every tick task next to one that runs for 2.5 ticks every 10 ticks */
+static const Sch_TaskConfigType Test_OverrunTasks[2] =
+{
+    { .Sch_TaskFunc = Test_Task0,    .Sch_PeriodTicks = 1U,  .Sch_OffsetTicks = 0U, .Sch_BudgetUs = 50U },
+    { .Sch_TaskFunc = Test_SlowTask, .Sch_PeriodTicks = 10U, .Sch_OffsetTicks = 3U, .Sch_BudgetUs = 100U },
+};
+static const Sch_ConfigType Test_OverrunConfig =
+{
+    .Sch_Tasks = Test_OverrunTasks, .Sch_NbrOfTasks = 2U, .Sch_TickHz = SCH_TICK_HZ
+};
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    TestHost_Begin("Sch");
+    TestHost_Run("PeriodAndOffset", Test_PeriodAndOffset);
+    TestHost_Run("SameTickTableOrder", Test_SameTickTableOrder);
+    TestHost_Run("OverrunAndLateTicks", Test_OverrunAndLateTicks);
+    TestHost_Run("InitRejectsBadConfig", Test_InitRejectsBadConfig);
+    TestHost_Run("ShippedTable", Test_ShippedTable);
+    return TestHost_End();
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   Tick whose SysTick interrupt was the last one raised
+ */
+static uint32_t Test_CurrentTick(void)
+{
+    return (uint32_t)(HostSim_GetCycles() / TEST_CYCLES_PER_TICK) - 1U;
+}
+
+/**
+ * @brief   Record one activation of a task
+ */
+static void Test_Log(uint8_t TaskId)
+{
+    Test_TaskLogType* Log = &Test_TaskLog[TaskId];
+
+    if (Log->Runs < TEST_MAX_RUNS)
+    {
+        Log->Tick[Log->Runs] = Test_CurrentTick();
+    }
+    Log->Runs++;
+    if (Test_OrderCount < TEST_MAX_RUNS)
+    {
+        Test_Order[Test_OrderCount] = TaskId;
+    }
+    Test_OrderCount++;
+}
+
+static void Test_Task0(void)
+{
+    Test_Log(0U);
+}
+
+static void Test_Task1(void)
+{
+    Test_Log(1U);
+}
+
+static void Test_Task2(void)
+{
+    Test_Log(2U);
+}
+
+/**
+ * @brief   Task that runs far past its budget
+ */
+static void Test_SlowTask(void)
+{
+    Test_Log(1U);
+    HostSim_Advance(TEST_OVERRUN_CYCLES);
+}
+
+/**
+ * @brief   Stop time reached inside WFI: check and end the case
+ */
+static void Test_Stop(void)
+{
+    Test_CheckFunc();
+    _exit(EXIT_SUCCESS);
+}
+
+/**
+ * @brief   Run the dispatch loop until Ticks ticks have been raised
+ */
+static void Test_RunTicks(const Sch_ConfigType* Config, uint32_t Ticks, void (*Check)(void))
+{
+    TEST_ASSERT_EQ(E_OK, Sch_Init(Config));
+
+    /* Half a tick after the last one, its tasks have run by then */
+    Test_CheckFunc = Check;
+    HostSim_SetStopTime((Ticks * TEST_CYCLES_PER_TICK) + (TEST_CYCLES_PER_TICK / 2U), Test_Stop);
+    Sch_Start();
+    TEST_ASSERT(0);
+}
+
+/**
+ * @brief   Every task ran exactly on the ticks where (tick - offset) % period == 0
+ */
+static void Test_CheckReleases(const Sch_ConfigType* Config, uint32_t Ticks)
+{
+    Sch_TaskStatsType Stats;
+    uint8_t TaskId;
+    uint32_t Run;
+
+    for (TaskId = 0U; TaskId < Config->Sch_NbrOfTasks; TaskId++)
+    {
+        const Sch_TaskConfigType* Task = &Config->Sch_Tasks[TaskId];
+        const Test_TaskLogType* Log = &Test_TaskLog[TaskId];
+        uint32_t Expected = ((Ticks - Task->Sch_OffsetTicks) + Task->Sch_PeriodTicks - 1U) / Task->Sch_PeriodTicks;
+
+        TEST_ASSERT_EQ(Expected, Log->Runs);
+        for (Run = 0U; Run < Log->Runs; Run++)
+        {
+            TEST_ASSERT_EQ(Task->Sch_OffsetTicks + (Run * Task->Sch_PeriodTicks), Log->Tick[Run]);
+        }
+
+        TEST_ASSERT_EQ(E_OK, Sch_GetTaskStats(TaskId, &Stats));
+        TEST_ASSERT_EQ(Expected, Stats.RunCount);
+        TEST_ASSERT_EQ(0U, Stats.Overruns);
+    }
+}
+
+static void Test_CheckPeriodAndOffset(void)
+{
+    TEST_ASSERT_EQ(TEST_RELEASE_TICKS, HostSim_GetInterruptCount(SysTick_IRQn));
+    Test_CheckReleases(&Test_PeriodConfig, TEST_RELEASE_TICKS);
+    TEST_ASSERT_EQ(0U, Sch_GetLostTicks());
+}
+
+static void Test_CheckTableOrder(void)
+{
+    uint32_t Run;
+
+    TEST_ASSERT_EQ(3U * (TEST_ORDER_TICKS / 2U), Test_OrderCount);
+    for (Run = 0U; Run < Test_OrderCount; Run += 3U)
+    {
+        TEST_ASSERT_EQ(2U, Test_Order[Run]);
+        TEST_ASSERT_EQ(0U, Test_Order[Run + 1U]);
+        TEST_ASSERT_EQ(1U, Test_Order[Run + 2U]);
+    }
+}
+
+static void Test_CheckOverrun(void)
+{
+    Sch_TaskStatsType Fast;
+    Sch_TaskStatsType Slow;
+    uint32_t SlowRuns = (TEST_OVERRUN_TICKS - 3U + 9U) / 10U;
+
+    TEST_ASSERT_EQ(E_OK, Sch_GetTaskStats(0U, &Fast));
+    TEST_ASSERT_EQ(E_OK, Sch_GetTaskStats(1U, &Slow));
+
+    /* Late, never dropped: the every tick task ran once per raised tick */
+    TEST_ASSERT_EQ(HostSim_GetInterruptCount(SysTick_IRQn), Fast.RunCount);
+    TEST_ASSERT_EQ(0U, Fast.Overruns);
+
+    TEST_ASSERT_EQ(SlowRuns, Slow.RunCount);
+    TEST_ASSERT_EQ(SlowRuns, Slow.Overruns);
+    TEST_ASSERT_RANGE(TEST_OVERRUN_CYCLES, TEST_OVERRUN_CYCLES + TEST_STAMP_CYCLES, Slow.MaxExecCycles);
+
+    /* Each slow run leaves two ticks waiting, the one with another behind it counts */
+    TEST_ASSERT_EQ(SlowRuns, Sch_GetLostTicks());
+    TestHost_Bench("SlowTaskExec", (double)Slow.MaxExecCycles, "cycles");
+    TestHost_Bench("LateTicksPerOverrun", (double)Sch_GetLostTicks() / SlowRuns, "ticks");
+}
+
+/**
+ * @brief   Release ticks follow Sch_PeriodTicks and Sch_OffsetTicks
+ */
+static void Test_PeriodAndOffset(void)
+{
+    Test_RunTicks(&Test_PeriodConfig, TEST_RELEASE_TICKS, Test_CheckPeriodAndOffset);
+}
+
+/**
+ * @brief   Tasks released on the same tick run in table order
+ */
+static void Test_SameTickTableOrder(void)
+{
+    Test_RunTicks(&Test_OrderConfig, TEST_ORDER_TICKS, Test_CheckTableOrder);
+}
+
+/**
+ * @brief   A task past its budget counts an overrun, the ticks it covers run late
+ */
+static void Test_OverrunAndLateTicks(void)
+{
+    Test_RunTicks(&Test_OverrunConfig, TEST_OVERRUN_TICKS, Test_CheckOverrun);
+}
+
+/**
+ * @brief   Sch_Init refuses a table it cannot run, SysTick stays off
+ */
+static void Test_InitRejectsBadConfig(void)
+{
+    Sch_TaskConfigType Tasks[SCH_MAX_TASKS + 1U];
+    Sch_ConfigType Config = { .Sch_Tasks = Tasks, .Sch_NbrOfTasks = 1U, .Sch_TickHz = SCH_TICK_HZ };
+    Sch_TaskStatsType Stats;
+    uint8_t TaskId;
+
+    for (TaskId = 0U; TaskId < (SCH_MAX_TASKS + 1U); TaskId++)
+    {
+        Tasks[TaskId] = Test_PeriodTasks[0];
+    }
+
+    TEST_ASSERT_EQ(E_NOT_OK, Sch_Init(NULL_PTR));
+
+    Config.Sch_NbrOfTasks = SCH_MAX_TASKS + 1U;
+    TEST_ASSERT_EQ(E_NOT_OK, Sch_Init(&Config));
+    Config.Sch_NbrOfTasks = 1U;
+
+    Config.Sch_TickHz = 0U;
+    TEST_ASSERT_EQ(E_NOT_OK, Sch_Init(&Config));
+    Config.Sch_TickHz = 1U;         /* 72 M cycles per tick, beyond the 24-bit SysTick */
+    TEST_ASSERT_EQ(E_NOT_OK, Sch_Init(&Config));
+    Config.Sch_TickHz = SCH_TICK_HZ;
+
+    Tasks[0].Sch_PeriodTicks = 0U;
+    TEST_ASSERT_EQ(E_NOT_OK, Sch_Init(&Config));
+    Tasks[0] = Test_PeriodTasks[0];
+    Tasks[0].Sch_TaskFunc = NULL_PTR;
+    TEST_ASSERT_EQ(E_NOT_OK, Sch_Init(&Config));
+
+    TEST_ASSERT_EQ(E_NOT_OK, Sch_GetTaskStats(0U, &Stats));
+    TEST_ASSERT_EQ(0U, HostSim_PeekRegister(&SysTick->CTRL) & SysTick_CTRL_ENABLE_Msk);
+
+    /* A valid table is accepted, stats are only given for its tasks */
+    Tasks[0] = Test_PeriodTasks[0];
+    TEST_ASSERT_EQ(E_OK, Sch_Init(&Config));
+    TEST_ASSERT_EQ(E_OK, Sch_GetTaskStats(0U, &Stats));
+    TEST_ASSERT_EQ(E_NOT_OK, Sch_GetTaskStats(1U, &Stats));
+    TEST_ASSERT_EQ(E_NOT_OK, Sch_GetTaskStats(0U, NULL_PTR));
+}
+
+/**
+ * @brief   The shipped table holds the two runnables of the application only
+ */
+static void Test_ShippedTable(void)
+{
+    TEST_ASSERT_EQ(2U, Sch_Config.Sch_NbrOfTasks);
+    TEST_ASSERT(Sch_Config.Sch_Tasks[0].Sch_TaskFunc == IoHwAb_MainFunction);
+    TEST_ASSERT_EQ(SCH_MS_TO_TICKS(IOHWAB_MAINFUNCTION_PERIOD_MS), Sch_Config.Sch_Tasks[0].Sch_PeriodTicks);
+    TEST_ASSERT(Sch_Config.Sch_Tasks[1].Sch_TaskFunc == Application_MainFunction);
+    TEST_ASSERT_EQ(E_OK, Sch_Init(&Sch_Config));
+}
+
+/****************************************************************************************
+*                                 END OF FILE                                          *
+****************************************************************************************/
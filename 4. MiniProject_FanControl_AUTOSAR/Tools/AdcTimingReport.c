@@ -0,0 +1,267 @@
+/****************************************************************************************
+*                      ADC Group Timing Report (host tool)                             *
+****************************************************************************************
+* File Name   : AdcTimingReport.c
+* Module      : Tools
+* Description : Achievable sample rate and interrupt load of every group in Adc_Cfg.c,
+*               from the Adc_Timing model and from a run on the host peripheral model.
+*               Runs on the build host, never on target.
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************
+* Usage:
+*   make adc-report
+*
+* Each group is started alone in a fresh simulated MCU, with the drivers initialized as
+* IoHwAb_Init does and every analog input at mid scale. The model columns come from
+* Adc_TimingGetGroupTiming, the sim_ columns count what the driver actually converted
+* and how often its handlers ran:
+*   one-shot software groups  from the start until the group leaves ADC_BUSY
+*   every other group         over at least 100 ms and 16 interrupts, after one round
+* cpu_load_pct uses the handler costs in Adc_Cfg.h. One-shot software groups convert
+* when the application asks, their rates are the back-to-back bound and cpu_load_pct
+* reads on-demand, isr_cycles_per_round times the request rate gives their load.
+* overrun is 1 when the trigger period is shorter than the conversion sequence.
+****************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "HostSim.h"
+#include "Adc.h"
+#include "Adc_Hw.h"
+#include "Adc_Timing.h"
+#include "Pwm.h"
+#include "Det.h"
+
+/****************************************************************************************
+*                                   LOCAL DEFINES                                      *
+****************************************************************************************/
+#define REPORT_ANALOG_MID           2048U
+#define REPORT_MIN_WINDOW_MS        100ULL
+#define REPORT_MAX_WINDOW_MS        10000ULL
+#define REPORT_MIN_INTERRUPTS       16ULL
+#define REPORT_ONESHOT_STEPS        64ULL       /* Status polls per conversion sequence */
+#define REPORT_DET_DRAIN_SIZE       8U
+
+/****************************************************************************************
+*                              LOCAL FUNCTION PROTOTYPES                               *
+****************************************************************************************/
+static const char* Report_GroupKind(Adc_GroupType Group);
+static uint32_t Report_Interrupts(void);
+static uint32_t Report_PerSecond(uint64_t Events, uint64_t Cycles);
+static uint32_t Report_DrainDet(void);
+static void Report_RunGroup(Adc_GroupType Group);
+
+/****************************************************************************************
+*                              FUNCTION IMPLEMENTATIONS                                *
+****************************************************************************************/
+int main(void)
+{
+    Adc_GroupType Group;
+    int Status;
+    int Result = EXIT_SUCCESS;
+
+    /* Mapped once, each child gets a copy of the MCU fresh out of reset */
+    HostSim_Init();
+
+    printf("hclk_hz,%lu\n", (unsigned long)SystemCoreClock);
+    printf("adcclk_hz,%lu\n", (unsigned long)(SystemCoreClock / Adc_TimingAdcClockDivider()));
+    printf("group,kind,trigger,channels,seq_us,round_us,conv_per_s,sim_conv_per_s,"
+           "results_per_s,irq_per_s,sim_irq_per_s,cpu_load_pct,isr_cycles_per_round,overrun,det\n");
+    (void)fflush(stdout);
+
+    for (Group = 0; Group < ADC_GROUP_CONFIG_SIZE; Group++)
+    {
+        pid_t Pid = fork();
+        if (Pid == 0)
+        {
+            Report_RunGroup(Group);
+            _exit(EXIT_SUCCESS);
+        }
+
+        if ((Pid < 0) || (waitpid(Pid, &Status, 0) != Pid) ||
+            !WIFEXITED(Status) || (WEXITSTATUS(Status) != EXIT_SUCCESS))
+        {
+            fprintf(stderr, "AdcTimingReport: group %u did not finish\n", (unsigned)Group);
+            Result = EXIT_FAILURE;
+        }
+    }
+
+    return Result;
+}
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+/**
+ * @brief   Short name of the path the driver takes for a group
+ */
+static const char* Report_GroupKind(Adc_GroupType Group)
+{
+    const Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[Group];
+    const Adc_HwUnitDefType* HwUnitConfig = &Adc_HwUnitConfig[GroupConfig->Adc_HwUnitId];
+
+    if (ADC_HW_IS_INJECTED_GROUP(GroupConfig))
+    {
+        return "injected";
+    }
+    if (ADC_HW_IS_OVERSAMPLED_GROUP(HwUnitConfig, GroupConfig))
+    {
+        return "oversampled";
+    }
+    if (ADC_HW_IS_DUAL_GROUP(HwUnitConfig, GroupConfig))
+    {
+        return "dual";
+    }
+    if (ADC_HW_IS_PING_PONG_GROUP(HwUnitConfig, GroupConfig))
+    {
+        return "ping-pong";
+    }
+    if (ADC_HW_IS_SCAN_DMA_GROUP(HwUnitConfig, GroupConfig))
+    {
+        return "scan-dma";
+    }
+    return "interrupt";
+}
+
+/**
+ * @brief   ADC and DMA handler calls so far
+ */
+static uint32_t Report_Interrupts(void)
+{
+    return HostSim_GetInterruptCount(ADC1_2_IRQn) + HostSim_GetInterruptCount(DMA1_Channel1_IRQn);
+}
+
+static uint32_t Report_PerSecond(uint64_t Events, uint64_t Cycles)
+{
+    return (Cycles != 0U) ? (uint32_t)((Events * SystemCoreClock) / Cycles) : 0U;
+}
+
+/**
+ * @brief   Empty the DET ring and return how many errors it held
+ */
+static uint32_t Report_DrainDet(void)
+{
+    Det_ErrorEntryType Entries[REPORT_DET_DRAIN_SIZE];
+    uint32_t Total = 0U;
+    uint8 Count;
+
+    do
+    {
+        Count = Det_Drain(Entries, REPORT_DET_DRAIN_SIZE);
+        Total += Count;
+    } while (Count == REPORT_DET_DRAIN_SIZE);
+
+    return Total + Det_GetOverflowCount();
+}
+
+/**
+ * @brief   Start one group, measure it and print its row
+ */
+static void Report_RunGroup(Adc_GroupType Group)
+{
+    const Adc_GroupDefType* GroupConfig = &Adc_GroupConfig[Group];
+    const uint64_t CyclesPerMs = SystemCoreClock / 1000U;
+    Adc_GroupTimingType Timing = { 0 };
+    uint64_t Start;
+    uint64_t Elapsed;
+    uint32_t Conversions;
+    uint32_t Interrupts;
+    char Load[16];
+
+    for (uint8_t Channel = 0U; Channel < HOSTSIM_NBR_OF_ANALOG_INPUTS; Channel++)
+    {
+        HostSim_SetAnalogInput(Channel, REPORT_ANALOG_MID);
+    }
+
+    Det_Init();
+    Adc_Init(&Adc_Config);
+    Pwm_Init(&Pwm_Config);
+
+    if (GroupConfig->Adc_SetupBufferFlag == 0U)
+    {
+        (void)Adc_SetupResultBuffer(Group, GroupConfig->Adc_ValueResultPtr);
+    }
+
+    Start = HostSim_GetCycles();
+    Conversions = HostSim_GetConversionCount(ADC1);
+    Interrupts = Report_Interrupts();
+    if (GroupConfig->Adc_TriggerSource == ADC_TRIGG_SRC_HW)
+    {
+        Adc_EnableHardwareTrigger(Group);
+    }
+    else
+    {
+        Adc_StartGroupConversion(Group);
+    }
+
+    /* After the start, the trigger timer is running with its final period */
+    (void)Adc_TimingGetGroupTiming(Group, &Timing);
+
+    if ((GroupConfig->Adc_TriggerSource == ADC_TRIGG_SRC_SW) && (GroupConfig->Adc_GroupConvMode == ADC_CONV_MODE_ONESHOT))
+    {
+        uint64_t Step = (Timing.SequenceCycles / REPORT_ONESHOT_STEPS) + 1U;
+
+        while ((Adc_GetGroupStatus(Group) == ADC_BUSY) &&
+               ((HostSim_GetCycles() - Start) < (REPORT_MAX_WINDOW_MS * CyclesPerMs)))
+        {
+            HostSim_Advance(Step);
+        }
+    }
+    else
+    {
+        uint64_t Window = REPORT_MIN_WINDOW_MS * CyclesPerMs;
+
+        if (Timing.InterruptsPerSecond != 0U)
+        {
+            uint64_t Needed = (REPORT_MIN_INTERRUPTS * SystemCoreClock) / Timing.InterruptsPerSecond;
+            Window = (Needed > Window) ? Needed : Window;
+        }
+        if (Window > (REPORT_MAX_WINDOW_MS * CyclesPerMs))
+        {
+            Window = REPORT_MAX_WINDOW_MS * CyclesPerMs;
+        }
+
+        /* Skip the first trigger latency, then count a steady window */
+        HostSim_Advance(Timing.RoundCycles);
+        Start = HostSim_GetCycles();
+        Conversions = HostSim_GetConversionCount(ADC1);
+        Interrupts = Report_Interrupts();
+        HostSim_Advance(Window);
+    }
+
+    Elapsed = HostSim_GetCycles() - Start;
+    Conversions = HostSim_GetConversionCount(ADC1) - Conversions;
+    Interrupts = Report_Interrupts() - Interrupts;
+
+    if (Timing.OnDemand == TRUE)
+    {
+        (void)snprintf(Load, sizeof(Load), "on-demand");
+    }
+    else
+    {
+        (void)snprintf(Load, sizeof(Load), "%.1f", Timing.CpuLoadPermille / 10.0);
+    }
+
+    printf("%u,%s,%s,%u,%.2f,%.2f,%lu,%lu,%lu,%lu,%lu,%s,%lu,%u,%lu\n",
+           (unsigned)Group, Report_GroupKind(Group),
+           (GroupConfig->Adc_TriggerSource == ADC_TRIGG_SRC_HW) ? "hw" : "sw",
+           (unsigned)GroupConfig->Adc_NbrOfChannel,
+           (Timing.SequenceCycles * 1e6) / SystemCoreClock,
+           (Timing.RoundCycles * 1e6) / SystemCoreClock,
+           (unsigned long)Timing.ConversionsPerSecond,
+           (unsigned long)Report_PerSecond(Conversions, Elapsed),
+           (unsigned long)Timing.ResultsPerSecond,
+           (unsigned long)Timing.InterruptsPerSecond,
+           (unsigned long)Report_PerSecond(Interrupts, Elapsed),
+           Load,
+           (unsigned long)Timing.IsrCyclesPerRound,
+           (unsigned)Timing.TriggerOverrun,
+           (unsigned long)Report_DrainDet());
+    (void)fflush(stdout);
+}
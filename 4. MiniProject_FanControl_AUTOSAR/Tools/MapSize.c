@@ -0,0 +1,532 @@
+/****************************************************************************************
+*                      Map File Size Report (host tool)                                *
+****************************************************************************************
+* File Name   : MapSize.c
+* Module      : Tools
+* Description : Flash and RAM used per module, read from a GNU ld map file, with the
+*               change against a second map. Runs on the build host, never on target.
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************
+* Usage:
+*   MapSize <map> [baseline_map]
+*
+* Every input section placed in an output section is counted: in flash when its
+* address or load address is in a read-only region of the Memory Configuration, in RAM
+* when its address is in a writable one (.data counts in both). .bss and .noinit have a
+* load address after .data but take no flash.
+*
+* The module is taken from the section name, which -ffunction-sections/-fdata-sections
+* make the symbol name, so LTO partitions are split the same way as plain objects:
+*   Adc_Init, AdcHw_PowerUp          Adc, AdcHw (text before the first '_')
+*   ADC_Init, TIM_Cmd                SPL (upper case prefix)
+*   DMA1_Channel1_IRQHandler         isr
+*   .rodata.str1.1, .rodata.cst4     (const), merged literals
+* Sections without a symbol (assembler .text, COMMON) take the object name, archive
+* members the library name.
+*
+* Code in the .ramfunc output section (RAMFUNC) is counted as one (ramfunc) module and
+* listed per function afterwards. Static functions have no map entry, their bytes go
+* to the global function before them, or to (static) at the start of a section.
+****************************************************************************************/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/****************************************************************************************
+*                                   LOCAL DEFINES                                      *
+****************************************************************************************/
+#define MAX_LINE            1024
+#define MAX_NAME            64
+#define MAX_MODULES         128
+#define MAX_REGIONS         8
+#define MAX_RAMFUNCS        64
+
+typedef struct
+{
+    unsigned long origin;
+    unsigned long length;
+    int           writable;
+} Region;
+
+typedef struct
+{
+    char          name[MAX_NAME];
+    unsigned long flash;
+    unsigned long ram;
+} Module;
+
+/* Global symbol or input section start inside .ramfunc */
+typedef struct
+{
+    char          name[MAX_NAME];
+    unsigned long addr;
+    unsigned long end;          /* End of the input section, 0 for a symbol */
+} RamMark;
+
+typedef struct
+{
+    Region        regions[MAX_REGIONS];
+    int           regionCount;
+    Module        modules[MAX_MODULES];
+    int           moduleCount;
+    unsigned long flashSize;
+    unsigned long ramSize;
+    RamMark       ramMarks[MAX_RAMFUNCS];
+    int           ramMarkCount;
+} MapInfo;
+
+/* Where the output section being read is placed */
+typedef struct
+{
+    int inFlash;
+    int inRam;
+} Placement;
+
+/****************************************************************************************
+*                              LOCAL FUNCTIONS                                         *
+****************************************************************************************/
+static const Region* findRegion(const MapInfo* map, unsigned long addr)
+{
+    for (int i = 0; i < map->regionCount; i++)
+    {
+        const Region* r = &map->regions[i];
+        if ((addr >= r->origin) && (addr - r->origin < r->length))
+        {
+            return r;
+        }
+    }
+    return NULL;
+}
+
+static Module* findModule(MapInfo* map, const char* name)
+{
+    for (int i = 0; i < map->moduleCount; i++)
+    {
+        if (strcmp(map->modules[i].name, name) == 0)
+        {
+            return &map->modules[i];
+        }
+    }
+    if (map->moduleCount == MAX_MODULES)
+    {
+        fprintf(stderr, "MapSize: more than %d modules\n", MAX_MODULES);
+        exit(EXIT_FAILURE);
+    }
+
+    Module* m = &map->modules[map->moduleCount++];
+    snprintf(m->name, sizeof(m->name), "%s", name);
+    m->flash = 0;
+    m->ram = 0;
+    return m;
+}
+
+/**
+ * @brief Module owning an input section, see the file header
+ */
+static void moduleName(const char* section, const char* object, char* out, size_t size)
+{
+    const char* symbol = NULL;
+    static const char* const prefixes[] = { ".text.", ".rodata.", ".data.", ".bss." };
+
+    for (size_t i = 0; i < sizeof(prefixes) / sizeof(prefixes[0]); i++)
+    {
+        size_t len = strlen(prefixes[i]);
+        if (strncmp(section, prefixes[i], len) == 0)
+        {
+            symbol = section + len;
+            break;
+        }
+    }
+
+    /* Archive member, e.g. .../libgcc.a(_udivmoddi4.o) */
+    const char* archive = strstr(object, ".a(");
+    if (archive != NULL)
+    {
+        const char* base = archive;
+        while ((base > object) && (base[-1] != '/') && (base[-1] != '\\'))
+        {
+            base--;
+        }
+        snprintf(out, size, "%.*s", (int)(archive - base), base);
+        return;
+    }
+
+    /* Merged string and constant pools have no owner */
+    if ((strncmp(section, ".rodata.str", 11) == 0) || (strncmp(section, ".rodata.cst", 11) == 0))
+    {
+        snprintf(out, size, "(const)");
+        return;
+    }
+
+    if ((symbol != NULL) && (*symbol != '\0') && (*symbol != '.'))
+    {
+        const char* underscore = strchr(symbol, '_');
+        size_t symLen = strlen(symbol);
+
+        if ((symLen > 8) && (strcmp(symbol + symLen - 8, "_Handler") == 0))
+        {
+            snprintf(out, size, "isr");
+            return;
+        }
+        if ((underscore != NULL) && (underscore != symbol))
+        {
+            int upper = 1;
+            for (const char* c = symbol; c < underscore; c++)
+            {
+                if (islower((unsigned char)*c))
+                {
+                    upper = 0;
+                    break;
+                }
+            }
+            if (upper)
+            {
+                snprintf(out, size, "SPL");
+            }
+            else
+            {
+                snprintf(out, size, "%.*s", (int)(underscore - symbol), symbol);
+            }
+            return;
+        }
+    }
+
+    /* No usable symbol: object base name without extension */
+    const char* base = object + strlen(object);
+    while ((base > object) && (base[-1] != '/') && (base[-1] != '\\'))
+    {
+        base--;
+    }
+    const char* dot = strchr(base, '.');
+    snprintf(out, size, "%.*s", (int)((dot != NULL) ? (size_t)(dot - base) : strlen(base)), base);
+    if (*out == '\0')
+    {
+        snprintf(out, size, "(other)");
+    }
+}
+
+/**
+ * @brief Read an output section header, "name addr size [load address addr]"
+ */
+static Placement placeOutput(const MapInfo* map, const char* name, const char* rest)
+{
+    Placement p = { 0, 0 };
+    unsigned long addr;
+    unsigned long size;
+    unsigned long load;
+    const char* loadText;
+
+    if (sscanf(rest, "%lx %lx", &addr, &size) != 2)
+    {
+        return p;
+    }
+
+    const Region* r = findRegion(map, addr);
+    if (r != NULL)
+    {
+        p.inFlash = !r->writable;
+        p.inRam = r->writable;
+    }
+
+    /* Zero-filled or left alone at reset, nothing is copied from flash */
+    loadText = strstr(rest, "load address");
+    if ((strncmp(name, ".bss", 4) != 0) && (strncmp(name, ".noinit", 7) != 0) && (loadText != NULL) && (sscanf(loadText, "load address %lx", &load) == 1))
+    {
+        const Region* lr = findRegion(map, load);
+        if ((lr != NULL) && !lr->writable)
+        {
+            p.inFlash = 1;
+        }
+    }
+    return p;
+}
+
+static void parseMap(const char* path, MapInfo* map)
+{
+    FILE* f = fopen(path, "r");
+    char raw[MAX_LINE];
+    char line[2 * MAX_LINE + 2];
+    char pending[MAX_LINE] = "";
+    enum { SKIP, MEMORY, SECTIONS } state = SKIP;
+    Placement place = { 0, 0 };
+    int inRamfunc = 0;
+
+    if (f == NULL)
+    {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    memset(map, 0, sizeof(*map));
+
+    while (fgets(raw, sizeof(raw), f) != NULL)
+    {
+        char name[sizeof(line)];
+        char object[sizeof(line)];
+        unsigned long addr;
+        unsigned long size;
+        unsigned long origin;
+        char attrs[32];
+
+        raw[strcspn(raw, "\r\n")] = '\0';
+
+        /* Long names wrap, the address and size follow on the next line */
+        snprintf(line, sizeof(line), "%s%s%s", pending, (pending[0] != '\0') ? " " : "", raw);
+        pending[0] = '\0';
+
+        if (strncmp(line, "Memory Configuration", 20) == 0)
+        {
+            state = MEMORY;
+            continue;
+        }
+        if (strncmp(line, "Linker script and memory map", 28) == 0)
+        {
+            state = SECTIONS;
+            continue;
+        }
+
+        if (state == MEMORY)
+        {
+            /* "FLASH  0x08000000  0x00010000  xr", attributes may be missing */
+            attrs[0] = '\0';
+            if ((sscanf(line, "%s %lx %lx %31s", name, &origin, &size, attrs) >= 3) &&
+                (strcmp(name, "*default*") != 0) && (map->regionCount < MAX_REGIONS))
+            {
+                Region* r = &map->regions[map->regionCount++];
+                r->origin = origin;
+                r->length = size;
+                r->writable = (strchr(attrs, 'w') != NULL);
+                if (r->writable)
+                {
+                    map->ramSize += size;
+                }
+                else
+                {
+                    map->flashSize += size;
+                }
+            }
+            continue;
+        }
+        if (state != SECTIONS)
+        {
+            continue;
+        }
+
+        if (line[0] == '.')
+        {
+            /* Output section header */
+            const char* rest = line + strcspn(line, " \t");
+            if (*rest == '\0')
+            {
+                snprintf(pending, sizeof(pending), "%s", raw);
+                continue;
+            }
+            place = placeOutput(map, line, rest);
+            inRamfunc = (strncmp(line, ".ramfunc", 8) == 0) && ((line[8] == ' ') || (line[8] == '\t'));
+            continue;
+        }
+
+        /* "   0x20000000   AdcHw_InterruptHandler", a global symbol */
+        if (inRamfunc && (sscanf(line, " %lx %s %s", &addr, name, object) == 2) &&
+            (map->ramMarkCount < MAX_RAMFUNCS))
+        {
+            RamMark* mark = &map->ramMarks[map->ramMarkCount++];
+            snprintf(mark->name, sizeof(mark->name), "%.*s", MAX_NAME - 1, name);
+            mark->addr = addr;
+            mark->end = 0;
+            continue;
+        }
+
+        if ((line[0] != ' ') || ((line[1] != '.') && (strncmp(line + 1, "COMMON", 6) != 0) &&
+                                 (strncmp(line + 1, "*fill*", 6) != 0)))
+        {
+            continue;
+        }
+
+        object[0] = '\0';
+        int fields = sscanf(line, " %s %lx %lx %s", name, &addr, &size, object);
+        if (fields == 1)
+        {
+            snprintf(pending, sizeof(pending), "%s", raw);
+            continue;
+        }
+        if ((fields < 3) || (size == 0) || (!place.inFlash && !place.inRam))
+        {
+            continue;
+        }
+
+        char owner[MAX_NAME];
+        if (strcmp(name, "*fill*") == 0)
+        {
+            snprintf(owner, sizeof(owner), "(fill)");
+        }
+        else if (inRamfunc)
+        {
+            snprintf(owner, sizeof(owner), "(ramfunc)");
+            if (map->ramMarkCount < MAX_RAMFUNCS)
+            {
+                RamMark* mark = &map->ramMarks[map->ramMarkCount++];
+                snprintf(mark->name, sizeof(mark->name), "%.*s", MAX_NAME - 1, name);
+                mark->addr = addr;
+                mark->end = addr + size;
+            }
+        }
+        else
+        {
+            moduleName(name, object, owner, sizeof(owner));
+        }
+
+        Module* m = findModule(map, owner);
+        if (place.inFlash)
+        {
+            m->flash += size;
+        }
+        if (place.inRam)
+        {
+            m->ram += size;
+        }
+    }
+
+    fclose(f);
+}
+
+/**
+ * @brief Print the size of every global function in .ramfunc
+ * @details A function ends at the next symbol or at the end of its input section.
+ */
+static void printRamfuncs(const MapInfo* map)
+{
+    unsigned long total = 0;
+    unsigned long sectionEnd = 0;
+
+    if (map->ramMarkCount == 0)
+    {
+        return;
+    }
+
+    printf("ramfunc,size\n");
+    for (int i = 0; i < map->ramMarkCount; i++)
+    {
+        const RamMark* mark = &map->ramMarks[i];
+        if (mark->end != 0)
+        {
+            sectionEnd = mark->end;
+            total += mark->end - mark->addr;
+
+            /* Static functions ahead of the first global of the section */
+            const RamMark* next = (i + 1 < map->ramMarkCount) ? &map->ramMarks[i + 1] : NULL;
+            unsigned long first = ((next != NULL) && (next->end == 0)) ? next->addr : sectionEnd;
+            if (first > mark->addr)
+            {
+                printf("(static),%lu\n", first - mark->addr);
+            }
+            continue;
+        }
+
+        unsigned long end = sectionEnd;
+        for (int j = i + 1; j < map->ramMarkCount; j++)
+        {
+            if (map->ramMarks[j].addr > mark->addr)
+            {
+                end = (map->ramMarks[j].addr < sectionEnd) ? map->ramMarks[j].addr : sectionEnd;
+                break;
+            }
+        }
+        if (end > mark->addr)
+        {
+            printf("%s,%lu\n", mark->name, end - mark->addr);
+        }
+    }
+    printf("ramfunc_total,%lu\n", total);
+}
+
+static int compareFlash(const void* a, const void* b)
+{
+    const Module* ma = a;
+    const Module* mb = b;
+    if (ma->flash != mb->flash)
+    {
+        return (ma->flash < mb->flash) ? 1 : -1;
+    }
+    return strcmp(ma->name, mb->name);
+}
+
+/****************************************************************************************
+*                                   MAIN                                               *
+****************************************************************************************/
+int main(int argc, char** argv)
+{
+    static MapInfo map;
+    static MapInfo base;
+    int haveBase = 0;
+    unsigned long flash = 0;
+    unsigned long ram = 0;
+    unsigned long baseFlash = 0;
+    unsigned long baseRam = 0;
+
+    if ((argc < 2) || (argc > 3))
+    {
+        fprintf(stderr, "usage: MapSize <map> [baseline_map]\n");
+        return EXIT_FAILURE;
+    }
+
+    parseMap(argv[1], &map);
+    if (map.regionCount == 0)
+    {
+        fprintf(stderr, "MapSize: no MEMORY regions in %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    if (argc == 3)
+    {
+        parseMap(argv[2], &base);
+        haveBase = 1;
+    }
+
+    qsort(map.modules, (size_t)map.moduleCount, sizeof(Module), compareFlash);
+
+    printf("module,flash,ram,flash_delta,ram_delta\n");
+    for (int i = 0; i < map.moduleCount; i++)
+    {
+        const Module* m = &map.modules[i];
+        const Module* b = haveBase ? findModule(&base, m->name) : NULL;
+        long flashDelta = (b != NULL) ? (long)m->flash - (long)b->flash : 0;
+        long ramDelta = (b != NULL) ? (long)m->ram - (long)b->ram : 0;
+
+        printf("%s,%lu,%lu,%+ld,%+ld\n", m->name, m->flash, m->ram, flashDelta, ramDelta);
+        flash += m->flash;
+        ram += m->ram;
+    }
+
+    /* Modules that only exist in the baseline, e.g. removed by LTO */
+    for (int i = 0; haveBase && (i < base.moduleCount); i++)
+    {
+        const Module* b = &base.modules[i];
+        int found = 0;
+        for (int j = 0; j < map.moduleCount; j++)
+        {
+            found |= (strcmp(map.modules[j].name, b->name) == 0);
+        }
+        if (!found && ((b->flash != 0) || (b->ram != 0)))
+        {
+            printf("%s,0,0,%+ld,%+ld\n", b->name, -(long)b->flash, -(long)b->ram);
+        }
+    }
+
+    for (int i = 0; haveBase && (i < base.moduleCount); i++)
+    {
+        baseFlash += base.modules[i].flash;
+        baseRam += base.modules[i].ram;
+    }
+
+    printf("total,%lu,%lu,%+ld,%+ld\n", flash, ram,
+           haveBase ? (long)flash - (long)baseFlash : 0L, haveBase ? (long)ram - (long)baseRam : 0L);
+    printf("free,%ld,%ld,,\n", (long)map.flashSize - (long)flash, (long)map.ramSize - (long)ram);
+
+    printRamfuncs(&map);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,323 @@
+/****************************************************************************************
+*                      Temperature Lookup Table Generator (host tool)                  *
+****************************************************************************************
+* File Name   : TempLutGen.c
+* Module      : Tools
+* Description : Generates IoHwAb_TempLut.c, the ADC code to temperature table used by
+*               IoHwAb_ConvertAdcToTemperature. Runs on the build host, never on target.
+* Version     : 1.0.0
+* Date        : 16/10/2026
+* Author      : hoangphuc540202@gmail.com
+* Github      : https://github.com/HoangPhuc02
+****************************************************************************************
+* Usage:
+*   TempLutGen [options] > IoHwAb/IoHwAb_TempLut.c
+*
+*   --sensor lm35|ntc     Sensor model (default lm35)
+*   --shift N             Segment width is 2^N ADC codes (default 6, 65 entries)
+*   --vref MV             ADC reference in mV (default 3300)
+*   --lm35-mv MV          LM35 gain in mV per degree (default 10)
+*   --beta B              NTC Beta value (default 3950)
+*   --r0 OHM              NTC resistance at --t0 (default 10000)
+*   --t0 DEGC             NTC reference temperature (default 25)
+*   --sh A B C            NTC Steinhart-Hart coefficients, overrides Beta model
+*   --rfix OHM            Divider resistor (default 10000)
+*   --ntc-high            NTC is on the VREF side of the divider (default GND side)
+*
+* The accuracy of the interpolated table against the exact model over -40..125 degC
+* is printed to stderr.
+****************************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/****************************************************************************************
+*                                   LOCAL DEFINES                                      *
+****************************************************************************************/
+#define ADC_RESOLUTION      4095        /* Must match IOHWAB_ADC_RESOLUTION */
+#define KELVIN_OFFSET       273.15
+#define TABLE_MIN_CENTI     (-5500)     /* Table clamp, -55.00 degC */
+#define TABLE_MAX_CENTI     15000       /* Table clamp, 150.00 degC */
+#define REPORT_MIN_DEGC     (-40)
+#define REPORT_MAX_DEGC     125
+
+typedef enum
+{
+    SENSOR_LM35 = 0,
+    SENSOR_NTC  = 1
+} SensorType;
+
+typedef struct
+{
+    SensorType sensor;
+    int        shift;
+    double     vrefMv;
+    double     lm35MvPerDeg;
+    double     beta;
+    double     r0;
+    double     t0;
+    int        useSteinhart;
+    double     shA;
+    double     shB;
+    double     shC;
+    double     rFix;
+    int        ntcHighSide;
+} LutParamsType;
+
+/****************************************************************************************
+*                                 SENSOR MODELS                                        *
+****************************************************************************************/
+/**
+ * @brief   Exact temperature seen by the ADC for a (possibly fractional) code
+ * @param   p      Generator parameters
+ * @param   code   ADC code, 0..ADC_RESOLUTION+1
+ * @return  Temperature in degC, may be +/-HUGE_VAL at the divider rails
+ */
+static double Model_CodeToDegC(const LutParamsType* p, double code)
+{
+    double ratio = code / ADC_RESOLUTION;
+    double r;
+    double lnR;
+    double invT;
+
+    if (p->sensor == SENSOR_LM35)
+    {
+        return (ratio * p->vrefMv) / p->lm35MvPerDeg;
+    }
+
+    /* Ratiometric divider, VREF cancels out */
+    if (p->ntcHighSide)
+    {
+        ratio = 1.0 - ratio;
+    }
+    if (ratio <= 0.0)
+    {
+        return p->ntcHighSide ? -HUGE_VAL : HUGE_VAL;
+    }
+    if (ratio >= 1.0)
+    {
+        return p->ntcHighSide ? HUGE_VAL : -HUGE_VAL;
+    }
+    r = p->rFix * ratio / (1.0 - ratio);
+    lnR = log(r);
+
+    if (p->useSteinhart)
+    {
+        invT = p->shA + (p->shB * lnR) + (p->shC * lnR * lnR * lnR);
+    }
+    else
+    {
+        invT = (1.0 / (p->t0 + KELVIN_OFFSET)) + ((lnR - log(p->r0)) / p->beta);
+    }
+
+    return (1.0 / invT) - KELVIN_OFFSET;
+}
+
+/**
+ * @brief   Convert to the table format, 0.01 degC clamped to the table range
+ */
+static long Model_ToCenti(double degC)
+{
+    double centi = degC * 100.0;
+
+    if (centi < TABLE_MIN_CENTI)
+    {
+        return TABLE_MIN_CENTI;
+    }
+    if (centi > TABLE_MAX_CENTI)
+    {
+        return TABLE_MAX_CENTI;
+    }
+    return lround(centi);
+}
+
+/**
+ * @brief   Same arithmetic as IoHwAb_ConvertAdcToTemperature on the target
+ */
+static long Lut_Interpolate(const long* table, int shift, unsigned code)
+{
+    unsigned idx  = code >> shift;
+    long     frac = (long)(code & ((1u << shift) - 1u));
+    long     t0   = table[idx];
+
+    return t0 + (((table[idx + 1u] - t0) * frac) >> shift);
+}
+
+/****************************************************************************************
+*                                   ARGUMENTS                                          *
+****************************************************************************************/
+static void Usage(const char* prog)
+{
+    fprintf(stderr,
+            "usage: %s [--sensor lm35|ntc] [--shift N] [--vref MV] [--lm35-mv MV]\n"
+            "          [--beta B] [--r0 OHM] [--t0 DEGC] [--sh A B C] [--rfix OHM]\n"
+            "          [--ntc-high]\n", prog);
+    exit(2);
+}
+
+static double ArgNumber(int argc, char** argv, int* i)
+{
+    char* end;
+    double v;
+
+    if (++(*i) >= argc)
+    {
+        Usage(argv[0]);
+    }
+    v = strtod(argv[*i], &end);
+    if (*end != '\0')
+    {
+        Usage(argv[0]);
+    }
+    return v;
+}
+
+static void ParseArgs(int argc, char** argv, LutParamsType* p)
+{
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--sensor") == 0)
+        {
+            if (++i >= argc)
+            {
+                Usage(argv[0]);
+            }
+            if (strcmp(argv[i], "lm35") == 0)
+            {
+                p->sensor = SENSOR_LM35;
+            }
+            else if (strcmp(argv[i], "ntc") == 0)
+            {
+                p->sensor = SENSOR_NTC;
+            }
+            else
+            {
+                Usage(argv[0]);
+            }
+        }
+        else if (strcmp(argv[i], "--shift") == 0)   { p->shift = (int)ArgNumber(argc, argv, &i); }
+        else if (strcmp(argv[i], "--vref") == 0)    { p->vrefMv = ArgNumber(argc, argv, &i); }
+        else if (strcmp(argv[i], "--lm35-mv") == 0) { p->lm35MvPerDeg = ArgNumber(argc, argv, &i); }
+        else if (strcmp(argv[i], "--beta") == 0)    { p->beta = ArgNumber(argc, argv, &i); }
+        else if (strcmp(argv[i], "--r0") == 0)      { p->r0 = ArgNumber(argc, argv, &i); }
+        else if (strcmp(argv[i], "--t0") == 0)      { p->t0 = ArgNumber(argc, argv, &i); }
+        else if (strcmp(argv[i], "--rfix") == 0)    { p->rFix = ArgNumber(argc, argv, &i); }
+        else if (strcmp(argv[i], "--ntc-high") == 0){ p->ntcHighSide = 1; }
+        else if (strcmp(argv[i], "--sh") == 0)
+        {
+            p->useSteinhart = 1;
+            p->shA = ArgNumber(argc, argv, &i);
+            p->shB = ArgNumber(argc, argv, &i);
+            p->shC = ArgNumber(argc, argv, &i);
+        }
+        else
+        {
+            Usage(argv[0]);
+        }
+    }
+
+    if ((p->shift < 2) || (p->shift > 8) || (p->lm35MvPerDeg <= 0.0) || (p->beta <= 0.0) ||
+        (p->r0 <= 0.0) || (p->rFix <= 0.0) || (p->vrefMv <= 0.0))
+    {
+        Usage(argv[0]);
+    }
+}
+
+/****************************************************************************************
+*                                      MAIN                                            *
+****************************************************************************************/
+int main(int argc, char** argv)
+{
+    LutParamsType p = { SENSOR_LM35, 6, 3300.0, 10.0, 3950.0, 10000.0, 25.0,
+                        0, 0.0, 0.0, 0.0, 10000.0, 0 };
+    long*    table;
+    unsigned size;
+    unsigned i;
+    unsigned code;
+    double   maxErr = 0.0;
+    unsigned maxErrCode = 0u;
+
+    ParseArgs(argc, argv, &p);
+
+    size = (unsigned)(ADC_RESOLUTION >> p.shift) + 2u;
+    table = malloc(size * sizeof(*table));
+    if (table == NULL)
+    {
+        return 1;
+    }
+    for (i = 0u; i < size; i++)
+    {
+        table[i] = Model_ToCenti(Model_CodeToDegC(&p, (double)(i << p.shift)));
+    }
+
+    /* Accuracy over the specified range, clamped regions excluded */
+    for (code = 0u; code <= ADC_RESOLUTION; code++)
+    {
+        double exact = Model_CodeToDegC(&p, (double)code);
+        double err;
+
+        if ((exact < REPORT_MIN_DEGC) || (exact > REPORT_MAX_DEGC))
+        {
+            continue;
+        }
+        err = fabs((Lut_Interpolate(table, p.shift, code) / 100.0) - exact);
+        if (err > maxErr)
+        {
+            maxErr = err;
+            maxErrCode = code;
+        }
+    }
+    fprintf(stderr, "TempLutGen: %u entries, max error %.3f degC at code %u (%d..%d degC)\n",
+            size, maxErr, maxErrCode, REPORT_MIN_DEGC, REPORT_MAX_DEGC);
+
+    printf("/****************************************************************************************\n");
+    printf("*                  IoHwAb Temperature Lookup Table - GENERATED FILE                    *\n");
+    printf("****************************************************************************************\n");
+    printf("* File Name   : IoHwAb_TempLut.c\n");
+    printf("* Description : ADC code to temperature in 0.01 degC, generated by Tools/TempLutGen.\n");
+    printf("*               Do not edit, regenerate with 'make templut'.\n");
+    if (p.sensor == SENSOR_LM35)
+    {
+        printf("* Sensor      : LM35, %.3f mV/degC, VREF %.0f mV\n", p.lm35MvPerDeg, p.vrefMv);
+    }
+    else if (p.useSteinhart)
+    {
+        printf("* Sensor      : NTC, Steinhart-Hart A=%.6e B=%.6e C=%.6e\n", p.shA, p.shB, p.shC);
+        printf("* Divider     : Rfix %.0f Ohm, NTC on %s side\n", p.rFix, p.ntcHighSide ? "VREF" : "GND");
+    }
+    else
+    {
+        printf("* Sensor      : NTC, Beta %.0f, R0 %.0f Ohm at %.2f degC\n", p.beta, p.r0, p.t0);
+        printf("* Divider     : Rfix %.0f Ohm, NTC on %s side\n", p.rFix, p.ntcHighSide ? "VREF" : "GND");
+    }
+    printf("* Accuracy    : max %.3f degC interpolation error over %d..%d degC\n",
+           maxErr, REPORT_MIN_DEGC, REPORT_MAX_DEGC);
+    printf("****************************************************************************************/\n");
+    printf("\n#include \"IoHwAb.h\"\n\n");
+    printf("#if (IOHWAB_TEMP_LUT_SHIFT != %d)\n", p.shift);
+    printf("#error \"IoHwAb_TempLut.c was generated for another IOHWAB_TEMP_LUT_SHIFT\"\n");
+    printf("#endif\n\n");
+    printf("#if (IOHWAB_TEMP_SENSOR_TYPE != %s)\n",
+           (p.sensor == SENSOR_LM35) ? "TEMP_SENSOR_LM35" : "TEMP_SENSOR_NTC");
+    printf("#error \"IoHwAb_TempLut.c was generated for another IOHWAB_TEMP_SENSOR_TYPE\"\n");
+    printf("#endif\n\n");
+    printf("/* Entry i is the temperature at ADC code (i << IOHWAB_TEMP_LUT_SHIFT) */\n");
+    printf("const sint16 IoHwAb_TempLut[IOHWAB_TEMP_LUT_SIZE] =\n{\n");
+    for (i = 0u; i < size; i++)
+    {
+        if ((i % 8u) == 0u)
+        {
+            printf("    ");
+        }
+        printf("%6ld%s", table[i], (i + 1u < size) ? "," : "");
+        printf("%s", (((i % 8u) == 7u) || (i + 1u == size)) ? "\n" : " ");
+    }
+    printf("};\n");
+
+    free(table);
+    return 0;
+}
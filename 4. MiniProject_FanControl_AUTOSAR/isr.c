@@ -19,7 +19,10 @@
 #include "misc.h" // For NVIC configuration
 #include "Pwm.h"
 #include "Adc_Cfg.h"
+#include "Sch.h"
+#include "Prof.h"
 
+#if !defined(HOST_BUILD)
 void HardFault_Handler(void)
 {
     // Fault occurred - examine registers
@@ -47,9 +50,30 @@ void fault_handler_c(uint32_t lr_value, uint32_t sp_value)
     // Set breakpoint on next line to examine these values
     while(1);  // Trap here for debugging
 }
+#endif
 
-void ADC1_2_IRQHandler(void)
+void SysTick_Handler(void)
 {
+    Sch_TickHandler();
+}
+
+RAMFUNC void ADC1_2_IRQHandler(void)
+{
+    PROF_BEGIN(PROF_PROBE_ADC1_2_IRQ);
+
+    // Injected sequence first, it preempted the regular one
+    if (ADC_GetITStatus(ADC1, ADC_IT_JEOC) != RESET)
+    {
+        Adc_InjectedTransferComplete_Callback(ADC1);
+        ADC_ClearITPendingBit(ADC1, ADC_IT_JEOC);
+    }
+
+    // Limit crossed, only a window change or a new group arms it again
+    if (ADC_GetITStatus(ADC1, ADC_IT_AWD) != RESET)
+    {
+        Adc_Watchdog_Callback(ADC1);
+        ADC_ClearITPendingBit(ADC1, ADC_IT_AWD);
+    }
 
     // Check if the ADC conversion is complete
     if (ADC_GetITStatus(ADC1, ADC_IT_EOC) != RESET)
@@ -62,170 +86,62 @@ void ADC1_2_IRQHandler(void)
 
     else if (ADC_GetITStatus(ADC2, ADC_IT_EOC) != RESET)
     {
-        // Handle overrun error
-        Adc_TransferComplete_Callback(ADC1);
+        Adc_TransferComplete_Callback(ADC2);
 
         // Clear the interrupt flag
         ADC_ClearITPendingBit(ADC2, ADC_IT_EOC);
     }
+
+    PROF_END(PROF_PROBE_ADC1_2_IRQ);
 }
-void DMA1_Channel1_IRQHandler(void)
+RAMFUNC void DMA1_Channel1_IRQHandler(void)
 {
+    PROF_BEGIN(PROF_PROBE_DMA1_CH1_IRQ);
 
+    // HT flag is set even when HTIE is off, only ping-pong groups enable it
+    if (DMA_GetITStatus(DMA1_IT_HT1) && (DMA1_Channel1->CCR & DMA_IT_HT))
+    {
+        Adc_DmaHalfTransfer_Callback(DMA1_Channel1);
+        DMA_ClearITPendingBit(DMA1_IT_HT1);
+    }
     if (DMA_GetITStatus(DMA1_IT_TC1))
     {
         Adc_DmaTransferComplete_Callback(DMA1_Channel1);
         DMA_ClearITPendingBit(DMA1_IT_TC1);
     }
+
+    PROF_END(PROF_PROBE_DMA1_CH1_IRQ);
 }
 
 
-void TIM1_IRQHandler(void)
+// TIM1 has separate update and compare vectors, both share one probe
+RAMFUNC void TIM1_UP_IRQHandler(void)
 {
-    // Check if the timer update interrupt is pending
-    if (TIM_GetITStatus(TIM1, TIM_IT_Update) != RESET)
-    {
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM1, TIM_IT_Update);
-        TIM_ClearITPendingBit(TIM1, TIM_IT_Update);
-    }
-    if (TIM_GetITStatus(TIM1, TIM_IT_CC1) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM1, TIM_IT_CC1);
-        TIM_ClearITPendingBit(TIM1, TIM_IT_CC1);
-    }
-    if (TIM_GetITStatus(TIM1, TIM_IT_CC2) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM1, TIM_IT_CC2);
-        TIM_ClearITPendingBit(TIM1, TIM_IT_CC2);
-    }
-    if (TIM_GetITStatus(TIM1, TIM_IT_CC3) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM1, TIM_IT_CC3);
-        TIM_ClearITPendingBit(TIM1, TIM_IT_CC3);
-    }
-    if (TIM_GetITStatus(TIM1, TIM_IT_CC4) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM1, TIM_IT_CC4);
-        TIM_ClearITPendingBit(TIM1, TIM_IT_CC4);
-    }
-}   
-void TIM2_IRQHandler(void)
+    PROF_BEGIN(PROF_PROBE_TIM1_IRQ);
+    Pwm_NotificationHandler(PWM_HW_UNIT_TIM1);
+    PROF_END(PROF_PROBE_TIM1_IRQ);
+}
+RAMFUNC void TIM1_CC_IRQHandler(void)
 {
-    // Check if the timer update interrupt is pending
-    if (TIM_GetITStatus(TIM2, TIM_IT_Update) != RESET)
-    {
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM2, TIM_IT_Update);
-        TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
-    }
-    if (TIM_GetITStatus(TIM2, TIM_IT_CC1) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM2, TIM_IT_CC1);
-        TIM_ClearITPendingBit(TIM2, TIM_IT_CC1);
-    }
-    if (TIM_GetITStatus(TIM2, TIM_IT_CC2) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM2, TIM_IT_CC2);
-        TIM_ClearITPendingBit(TIM2, TIM_IT_CC2);
-    }
-    if (TIM_GetITStatus(TIM2, TIM_IT_CC3) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM2, TIM_IT_CC3);
-        TIM_ClearITPendingBit(TIM2, TIM_IT_CC3);
-    }
-    if (TIM_GetITStatus(TIM2, TIM_IT_CC4) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM2, TIM_IT_CC4);
-        TIM_ClearITPendingBit(TIM2, TIM_IT_CC4);
-    }
-} 
-void TIM3_IRQHandler(void)
+    PROF_BEGIN(PROF_PROBE_TIM1_IRQ);
+    Pwm_NotificationHandler(PWM_HW_UNIT_TIM1);
+    PROF_END(PROF_PROBE_TIM1_IRQ);
+}
+RAMFUNC void TIM2_IRQHandler(void)
 {
-    // Check if the timer update interrupt is pending
-    if (TIM_GetITStatus(TIM3, TIM_IT_Update) != RESET)
-    {
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM3, TIM_IT_Update);
-        TIM_ClearITPendingBit(TIM3, TIM_IT_Update);
-    }
-    if (TIM_GetITStatus(TIM3, TIM_IT_CC1) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM3, TIM_IT_CC1);
-        TIM_ClearITPendingBit(TIM3, TIM_IT_CC1);
-    }
-    if (TIM_GetITStatus(TIM3, TIM_IT_CC2) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM3, TIM_IT_CC2);
-        TIM_ClearITPendingBit(TIM3, TIM_IT_CC2);
-    }
-    if (TIM_GetITStatus(TIM3, TIM_IT_CC3) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM3, TIM_IT_CC3);
-        TIM_ClearITPendingBit(TIM3, TIM_IT_CC3);
-    }
-    if (TIM_GetITStatus(TIM3, TIM_IT_CC4) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM3, TIM_IT_CC4);
-        TIM_ClearITPendingBit(TIM3, TIM_IT_CC4);
-    }
-} 
-
-void TIM4_IRQHandler(void)
+    PROF_BEGIN(PROF_PROBE_TIM2_IRQ);
+    Pwm_NotificationHandler(PWM_HW_UNIT_TIM2);
+    PROF_END(PROF_PROBE_TIM2_IRQ);
+}
+RAMFUNC void TIM3_IRQHandler(void)
 {
-    // Check if the timer update interrupt is pending
-    if (TIM_GetITStatus(TIM4, TIM_IT_Update) != RESET)
-    {
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM4, TIM_IT_Update);
-        TIM_ClearITPendingBit(TIM4, TIM_IT_Update);
-    }
-    if (TIM_GetITStatus(TIM4, TIM_IT_CC1) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM4, TIM_IT_CC1);
-        TIM_ClearITPendingBit(TIM4, TIM_IT_CC1);
-    }
-    if (TIM_GetITStatus(TIM4, TIM_IT_CC2) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM4, TIM_IT_CC2);
-        TIM_ClearITPendingBit(TIM4, TIM_IT_CC2);
-    }
-    if (TIM_GetITStatus(TIM4, TIM_IT_CC3) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM4, TIM_IT_CC3);
-        TIM_ClearITPendingBit(TIM4, TIM_IT_CC3);
-    }
-    if (TIM_GetITStatus(TIM4, TIM_IT_CC4) != RESET)
-    {
-
-        // Clear the interrupt flag
-        Pwm_NotificationHandler(PWM_HW_UNIT_TIM4, TIM_IT_CC4);
-        TIM_ClearITPendingBit(TIM4, TIM_IT_CC4);
-    }
-} 
+    PROF_BEGIN(PROF_PROBE_TIM3_IRQ);
+    Pwm_NotificationHandler(PWM_HW_UNIT_TIM3);
+    PROF_END(PROF_PROBE_TIM3_IRQ);
+}
+RAMFUNC void TIM4_IRQHandler(void)
+{
+    PROF_BEGIN(PROF_PROBE_TIM4_IRQ);
+    Pwm_NotificationHandler(PWM_HW_UNIT_TIM4);
+    PROF_END(PROF_PROBE_TIM4_IRQ);
+}
@@ -10,6 +10,10 @@
  */
 
 #include "IoHwAb.h"
+#include "Sch.h"
+#include "Sch_Cfg.h"
+#include "Prof.h"
+#include "Det.h"
 #include "stm32f10x.h"
 #include "stm32f10x_rcc.h"
 #include "stm32f10x_flash.h"
@@ -20,20 +24,27 @@
 
 #define TEMP_LOW_THRESHOLD     1500u    /* Below this: Fan OFF */
 #define TEMP_MEDIUM_THRESHOLD  2500u    /* Above this: Fan 100% */
+#define TEMP_HYSTERESIS        50u      /* Counts past a threshold before the fan changes */
+
+/* Temperature bands reported by the IoHwAb monitor */
+#define TEMP_BAND_LOW          0u      /* Below TEMP_LOW_THRESHOLD */
+#define TEMP_BAND_MEDIUM       1u      /* TEMP_LOW_THRESHOLD .. TEMP_MEDIUM_THRESHOLD */
+#define TEMP_BAND_HIGH         2u      /* TEMP_MEDIUM_THRESHOLD and above */
+#define TEMP_BAND_NONE         0xFFu   /* No band change pending */
 
 /* Fan duty cycle percentages */
 #define FAN_DUTY_OFF           0u      /* Fan stopped */
 #define FAN_DUTY_MEDIUM        50u     /* Fan at 50% */
 #define FAN_DUTY_HIGH          100u    /* Fan at 100% */
 
-/* System timing */
-#define TEMP_READ_INTERVAL_MS  1000u   /* Read temperature every 1 second */
-
 /* Global variables */
-static uint16 current_temperature = 0;
+static const uint16 temp_thresholds[] = { TEMP_LOW_THRESHOLD, TEMP_MEDIUM_THRESHOLD };
+static volatile uint8 pending_band = TEMP_BAND_NONE;    /* Set by the IoHwAb monitor */
 static uint8 current_fan_duty = 0;
 static boolean led_status = FALSE;
 
+void Application_UpdateFanControl(uint8 band);
+
 /*
  * Function: Application_Init
  * Description: Initialize the application and all hardware abstraction layers
@@ -48,26 +59,46 @@ void Application_Init(void)
     /* Initial state: Fan OFF, LED OFF */
     IoHwAb_SetFanDuty(FAN_DUTY_OFF);
     IoHwAb_SetLed(FALSE);
+
+    /* Woken only on band changes, fan starts OFF to match band 0 */
+    if (IoHwAb_StartTemperatureMonitor(temp_thresholds, (uint8)(sizeof(temp_thresholds) / sizeof(temp_thresholds[0])),
+                                       TEMP_HYSTERESIS) != E_OK)
+    {
+        /* No monitoring: fail safe with the fan at full speed */
+        Application_UpdateFanControl(TEMP_BAND_HIGH);
+    }
+}
+
+/*
+ * Function: IoHwAb_TemperatureBandChanged
+ * Description: Band change from the IoHwAb monitor (ISR or IoHwAb task), applied in the main loop
+ * Parameters: band - New temperature band
+ * Return: None
+ */
+void IoHwAb_TemperatureBandChanged(uint8 band)
+{
+    pending_band = band;
 }
+
 /*
  * Function: Application_UpdateFanControl
- * Description: Update fan speed and LED status based on current temperature
- * Parameters: temperature - Current temperature in Celsius
+ * Description: Update fan speed and LED status based on the temperature band
+ * Parameters: band - Current temperature band (TEMP_BAND_xxx)
  * Return: None
  */
-void Application_UpdateFanControl(uint16 temperature)
+void Application_UpdateFanControl(uint8 band)
 {
     uint8 new_fan_duty = 0;
     boolean new_led_status = FALSE;
     
-    /* Determine fan duty cycle based on temperature thresholds */
-    if (temperature < TEMP_LOW_THRESHOLD)
+    /* Determine fan duty cycle based on temperature band */
+    if (band == TEMP_BAND_LOW)
     {
         /* Temperature below 30°C: Fan OFF */
         new_fan_duty = FAN_DUTY_OFF;
         new_led_status = FALSE;
     }
-    else if (temperature < TEMP_MEDIUM_THRESHOLD)
+    else if (band == TEMP_BAND_MEDIUM)
     {
         /* Temperature 30-40°C: Fan at 50% */
         new_fan_duty = FAN_DUTY_MEDIUM;
@@ -95,6 +126,23 @@ void Application_UpdateFanControl(uint16 temperature)
     }
 }
 
+/*
+ * Function: Application_MainFunction
+ * Description: Cyclic application task, applies band changes from the monitor
+ * Parameters: None
+ * Return: None
+ */
+void Application_MainFunction(void)
+{
+    /* Thresholds are checked by the ADC watchdog, only band changes reach here */
+    uint8 band = pending_band;
+    if (band != TEMP_BAND_NONE)
+    {
+        pending_band = TEMP_BAND_NONE;
+        Application_UpdateFanControl(band);
+    }
+}
+
 /*
  * Function: main
  * Description: Main application entry point
@@ -103,25 +151,23 @@ void Application_UpdateFanControl(uint16 temperature)
  */
 int main(void)
 {
+    /* Cycle counter first so driver init is already measured */
+    Prof_Init();
+    Det_Init();
+    
     /* Initialize application and hardware */
     Application_Init();
     
-    /* Main application loop */
+    /* IoHwAb and the application run from the task table, the core sleeps in between */
+    if (Sch_Init(&Sch_Config) == E_OK)
+    {
+        Sch_Start();
+    }
+    
+    /* No tick: fail safe with the fan at full speed */
+    Application_UpdateFanControl(TEMP_BAND_HIGH);
     while (1)
     {
-        /* Read current temperature from sensor */
-        current_temperature = IoHwAb_ReadTemperature();
-        
-        /* Update fan control based on temperature */
-        Application_UpdateFanControl(current_temperature);
-
-        /* TODO: Add delay or use system timer for proper timing */
-        /* Simple delay - replace with proper timer in production code */
-        for (volatile uint32 i = 0; i < 1000000; i++)
-        {
-            /* Delay approximately 1 second (depends on CPU frequency) */
-            __asm("nop");
-        }
     }
     
     /* Should never reach here */
@@ -1,6 +1,7 @@
 /*======== startup_stm32f103.s ===========
       - Định nghĩa vector table cho STM32F103
-      - Copy .data từ Flash vào RAM, clear .bss
+      - Bật DWT CYCCNT để đo thời gian reset -> main()
+      - Copy .ramfunc và .data từ Flash vào RAM, clear .bss (32 byte mỗi vòng)
       - Gọi main(), vào vòng lặp vô hạn nếu main() trả về
     ==========================================*/
 
@@ -211,32 +212,87 @@ Default_Handler:
     .weak   Reset_Handler
     .type   Reset_Handler, %function
 Reset_Handler:
-    /* 1/ Copy .data từ Flash sang RAM */
+    /* Các vùng bên dưới đều căn 4 byte (xem stm32f103.ld), copy/clear theo word.
+       Mỗi vòng chính xử lý 32 byte bằng LDMIA/STMIA 8 thanh ghi, phần dư (< 32 byte)
+       làm từng word. Chưa có gì cần giữ lại trước main() nên dùng tự do R0-R12 */
+
+    /* 0/ Bật DWT CYCCNT từ 0: Prof_Init() đọc giá trị này làm thời gian reset -> main()
+          (probe PROF_PROBE_STARTUP). Reset hệ thống không xóa DWT nên phải ghi 0 */
+    LDR   R0, =0xE000EDFC   /* CoreDebug->DEMCR */
+    LDR   R1, [R0]
+    ORR   R1, R1, #0x01000000 /* TRCENA: cho phép DWT */
+    STR   R1, [R0]
+    LDR   R0, =0xE0001000   /* DWT->CTRL, CYCCNT ở offset 4 */
+    MOVS  R1, #0
+    STR   R1, [R0, #4]      /* CYCCNT = 0 */
+    LDR   R1, [R0]
+    ORR   R1, R1, #1        /* CYCCNTENA: bắt đầu đếm */
+    STR   R1, [R0]
+
+    /* 1/ Copy .ramfunc (code chạy từ RAM) từ Flash sang RAM, trước mọi ISR */
+    LDR   R0, =_siramfunc   /* _siramfunc = địa chỉ đầu của vùng gốc .ramfunc trong Flash */
+    LDR   R1, =_sramfunc    /* _sramfunc = địa chỉ đầu vùng .ramfunc trong RAM */
+    LDR   R2, =_eramfunc    /* _eramfunc = địa chỉ kết thúc vùng .ramfunc trong RAM */
+    BL    copy_words
+
+    /* 2/ Copy .data từ Flash sang RAM */
     LDR   R0, =_sidata      /* _sidata = địa chỉ đầu của vùng gốc .data trong Flash */
     LDR   R1, =_sdata       /* _sdata = địa chỉ đầu vùng .data trong RAM */
     LDR   R2, =_edata       /* _edata = địa chỉ kết thúc vùng .data trong RAM */
-copy_data_loop:
-    CMP   R1, R2            /* nếu R1 >= R2 thì dừng */
-    ITT   LT
-    LDRLT R3, [R0], #4      /* load 4 byte tại R0, R0 += 4 */
-    STRLT R3, [R1], #4      /* store 4 byte vào R1, R1 += 4 */
-    BLT   copy_data_loop
+    BL    copy_words
 
-    /* 2/ Clear .bss (set 0) */
+    /* 3/ Clear .bss (set 0), .noinit giữ nguyên */
     LDR   R0, =_sbss        /* _sbss = địa chỉ đầu của vùng .bss trong RAM */
     LDR   R1, =_ebss        /* _ebss = địa chỉ kết thúc vùng .bss trong RAM */
-    MOV   R2, #0
-clear_bss_loop:
-    CMP   R0, R1            /* nếu R0 >= R1 thì dừng */
-    ITT   LT
-    STRLT R2, [R0], #4      /* store 0 vào [R0], R0 += 4 */
-    BLT   clear_bss_loop
+    BL    zero_words
 
-    /* 3/ Gọi hàm main() */
+    /* 4/ Gọi hàm main() */
     BL    main
 
-    /* 4/ Nếu main() trả về, vào vòng lặp vô hạn */
+    /* 5/ Nếu main() trả về, vào vòng lặp vô hạn */
 infinite_loop:
     B    infinite_loop
 
+/* copy_words: R0 = nguồn, R1 = đích, R2 = kết thúc đích. Dùng R3-R11 */
+copy_words:
+    ADD   R3, R1, #32       /* R3 = điểm kết thúc của khối 32 byte kế tiếp */
+copy_block_loop:
+    CMP   R3, R2            /* nếu khối vượt quá R2 thì sang phần dư */
+    BHI   copy_tail_loop
+    LDMIA R0!, {R4-R11}     /* load 8 word tại R0, R0 += 32 */
+    STMIA R1!, {R4-R11}     /* store 8 word vào R1, R1 += 32 */
+    ADD   R3, R3, #32
+    B     copy_block_loop
+copy_tail_loop:
+    CMP   R1, R2            /* nếu R1 >= R2 thì dừng */
+    ITT   LO
+    LDRLO R4, [R0], #4      /* load 4 byte tại R0, R0 += 4 */
+    STRLO R4, [R1], #4      /* store 4 byte vào R1, R1 += 4 */
+    BLO   copy_tail_loop
+    BX    LR
+
+/* zero_words: R0 = đầu, R1 = kết thúc. Dùng R2-R11 */
+zero_words:
+    MOV   R4, #0
+    MOV   R5, #0
+    MOV   R6, #0
+    MOV   R7, #0
+    MOV   R8, #0
+    MOV   R9, #0
+    MOV   R10, #0
+    MOV   R11, #0
+    ADD   R2, R0, #32       /* R2 = điểm kết thúc của khối 32 byte kế tiếp */
+zero_block_loop:
+    CMP   R2, R1            /* nếu khối vượt quá R1 thì sang phần dư */
+    BHI   zero_tail_loop
+    STMIA R0!, {R4-R11}     /* store 8 word 0 vào R0, R0 += 32 */
+    ADD   R2, R2, #32
+    B     zero_block_loop
+zero_tail_loop:
+    CMP   R0, R1            /* nếu R0 >= R1 thì dừng */
+    IT    LO
+    STRLO R4, [R0], #4      /* store 0 vào [R0], R0 += 4 */
+    BLO   zero_tail_loop
+    BX    LR
+
     .size Reset_Handler, .-Reset_Handler
\ No newline at end of file